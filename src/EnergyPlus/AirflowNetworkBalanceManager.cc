@@ -1,6 +1,8 @@
 // C++ Headers
+#include <algorithm>
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -115,6 +117,8 @@ namespace AirflowNetworkBalanceManager {
 	using ScheduleManager::GetScheduleIndex;
 	using ScheduleManager::GetCurrentScheduleValue;
 	using AirflowNetworkSolver::SETSKY;
+	using AirflowNetworkSolver::FACSKY;
+	using AirflowNetworkSolver::SLVSKY;
 	using AirflowNetworkSolver::AIRMOV;
 	using AirflowNetworkSolver::AllocateAirflowNetworkData;
 	using AirflowNetworkSolver::InitAirflowNetworkData;
@@ -162,10 +166,17 @@ namespace AirflowNetworkBalanceManager {
 	// MODULE VARIABLE DECLARATIONS:
 	// Report variables
 	FArray1D< Real64 > PZ;
-	// Inverse matrix
-	FArray1D< Real64 > MA;
-	FArray1D< Real64 > MV;
-	FArray1D_int IVEC;
+	// Node balance matrix in skyline form
+	FArray1D< Real64 > MV; // Right hand side of the node balances, then the node values
+	FArray1D_int BalanceIK; // Pointer to the top of column/row "K" of the node balance matrix
+	FArray1D< Real64 > BalanceAU; // Upper triangle of the node balance matrix
+	FArray1D< Real64 > BalanceAD; // Main diagonal of the node balance matrix
+	FArray1D< Real64 > BalanceAL; // Lower triangle of the node balance matrix
+	FArray1D< Real64 > BalanceRHS; // Right hand side and solution in BalanceNodeOrder
+	FArray1D_int BalanceNodeOrder; // Node at each row of the node balance matrix
+	FArray1D_int BalanceNodeIndex; // Row of each node in the node balance matrix
+	FArray1D_bool BalanceNodeFixed; // True if the value of the node is prescribed by a linked component
+	FArray1D_bool BalanceNodeOAInlet; // True if the node is fed directly by an outdoor air node
 	FArray1D_int SplitterNodeNumbers;
 
 	bool AirflowNetworkGetInputFlag( true );
@@ -3241,9 +3252,8 @@ namespace AirflowNetworkBalanceManager {
 			AirflowNetworkLinkReport1.allocate( AirflowNetworkNumOfSurfaces );
 		}
 
-		MA.allocate( AirflowNetworkNumOfNodes * AirflowNetworkNumOfNodes );
 		MV.allocate( AirflowNetworkNumOfNodes );
-		IVEC.allocate( AirflowNetworkNumOfNodes + 20 );
+		SetupNodeBalanceMatrix();
 
 		AirflowNetworkReportData.allocate( NumOfZones ); // Report variables
 		AirflowNetworkZnRpt.allocate( NumOfZones ); // Report variables
@@ -3877,13 +3887,13 @@ namespace AirflowNetworkBalanceManager {
 		Real64 DirSign;
 		Real64 Tamb;
 		Real64 CpAir;
-		Real64 TZON;
 		Real64 load;
 		int ZoneNum;
-		bool found;
 		bool OANode;
 
-		MA = 0.0;
+		BalanceAU = 0.0;
+		BalanceAD = 0.0;
+		BalanceAL = 0.0;
 		MV = 0.0;
 		for ( i = 1; i <= AirflowNetworkNumOfLinks; ++i ) {
 			CompNum = AirflowNetworkLinkageData( i ).CompNum;
@@ -3919,8 +3929,8 @@ namespace AirflowNetworkBalanceManager {
 				} else {
 					Tamb = ANZT( AirflowNetworkLinkageData( i ).ZoneNum );
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir * Ei;
+				BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+				BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir * Ei;
 				MV( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Tamb * ( 1.0 - Ei ) * CpAir;
 			}
 			if ( CompTypeNum == CompTypeNum_TMU ) { // Reheat unit: SINGLE DUCT:CONST VOLUME:REHEAT
@@ -3936,8 +3946,8 @@ namespace AirflowNetworkBalanceManager {
 				}
 				Ei = std::exp( -0.001 * DisSysCompTermUnitData( TypeNum ).L * DisSysCompTermUnitData( TypeNum ).D * Pi / ( DirSign * AirflowNetworkLinkSimu( i ).FLOW * CpAir ) );
 				Tamb = AirflowNetworkNodeSimu( LT ).TZ;
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir * Ei;
+				BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+				BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir * Ei;
 				MV( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Tamb * ( 1.0 - Ei ) * CpAir;
 			}
 			if ( CompTypeNum == CompTypeNum_COI ) { // heating or cooling coil
@@ -3968,8 +3978,8 @@ namespace AirflowNetworkBalanceManager {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+				BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+				BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
 				MV( LT ) = 0.0;
 			}
 			// Calculate return leak
@@ -3978,26 +3988,26 @@ namespace AirflowNetworkBalanceManager {
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
 				}
 			}
 			// Check reheat unit or coil
@@ -4029,75 +4039,43 @@ namespace AirflowNetworkBalanceManager {
 
 		// Prescribe temperature for EPlus nodes
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			found = false;
-			OANode = false;
-			for ( j = 1; j <= AirflowNetworkNumOfLinks; ++j ) {
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 1 ) == i || AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-					CompNum = AirflowNetworkLinkageData( j ).CompNum;
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_RHT && ( ! AirflowNetworkLinkageData( j ).VAVTermDamper ) ) {
-						found = true;
-						break;
-					}
-					// Overwrite fan outlet node
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_FAN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-						found = false;
-						break;
-					}
-					// Overwrite return connection outlet
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_RCN ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_SCN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-				}
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i && AirflowNetworkNodeData( AirflowNetworkLinkageData( j ).NodeNums( 1 ) ).EPlusTypeNum == EPlusTypeNum_OAN ) {
-					OANode = true;
-					break;
-				}
-			}
-			if ( found ) continue;
+			if ( BalanceNodeFixed( i ) ) continue;
+			OANode = BalanceNodeOAInlet( i );
 			if ( AirflowNetworkNodeData( i ).EPlusZoneNum == 0 && AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_ZIN ) continue;
 			j = AirflowNetworkNodeData( i ).EPlusNodeNum;
 
 			if ( j > 0 && ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_FOU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_COU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_HXO ) ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				BalanceMatrixDiagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).Temp * 1.0e10;
 			}
 			if ( j > 0 && OANode ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				BalanceMatrixDiagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).Temp * 1.0e10;
 			}
-			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 0.9e10 ) {
+			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && BalanceMatrixDiagonal( i ) < 0.9e10 ) {
 				ZoneNum = AirflowNetworkNodeData( i ).EPlusZoneNum;
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				BalanceMatrixDiagonal( i ) = 1.0e10;
 				MV( i ) = ANZT( ZoneNum ) * 1.0e10;
 			}
-			if ( AirflowNetworkNodeData( i ).ExtNodeNum > 0 && MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 0.9e10 ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+			if ( AirflowNetworkNodeData( i ).ExtNodeNum > 0 && BalanceMatrixDiagonal( i ) < 0.9e10 ) {
+				BalanceMatrixDiagonal( i ) = 1.0e10;
 				MV( i ) = OutDryBulbTempAt( AirflowNetworkNodeData( i ).NodeHeight ) * 1.0e10;
 			}
 		}
 
 		// Check singularity
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			if ( MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 1.0e-6 ) {
+			if ( BalanceMatrixDiagonal( i ) < 1.0e-6 ) {
 				ShowFatalError( "CalcAirflowNetworkHeatBalance: A diagonal entity is zero in AirflowNetwork matrix at node " + AirflowNetworkNodeData( i ).Name );
 			}
 		}
 
-		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+		// Solve the node balances
+		SolveNodeBalanceMatrix();
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			TZON = 0.0;
-			for ( j = 1; j <= AirflowNetworkNumOfNodes; ++j ) {
-				TZON += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * MV( j );
-			}
-			AirflowNetworkNodeSimu( i ).TZ = TZON;
+			AirflowNetworkNodeSimu( i ).TZ = MV( i );
 		}
 
 	}
@@ -4150,13 +4128,13 @@ namespace AirflowNetworkBalanceManager {
 		Real64 Ei;
 		Real64 DirSign;
 		Real64 Wamb;
-		Real64 WZON;
 		Real64 load;
 		int ZoneNum;
-		bool found;
 		bool OANode;
 
-		MA = 0.0;
+		BalanceAU = 0.0;
+		BalanceAD = 0.0;
+		BalanceAL = 0.0;
 		MV = 0.0;
 		for ( i = 1; i <= AirflowNetworkNumOfLinks; ++i ) {
 			CompNum = AirflowNetworkLinkageData( i ).CompNum;
@@ -4182,8 +4160,8 @@ namespace AirflowNetworkBalanceManager {
 				} else {
 					Wamb = ANZW( AirflowNetworkLinkageData( i ).ZoneNum );
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Ei;
+				BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Ei;
 				MV( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Wamb * ( 1.0 - Ei );
 			}
 			if ( CompTypeNum == CompTypeNum_TMU ) { // Reheat unit: SINGLE DUCT:CONST VOLUME:REHEAT
@@ -4199,8 +4177,8 @@ namespace AirflowNetworkBalanceManager {
 				}
 				Ei = std::exp( -0.0001 * DisSysCompTermUnitData( TypeNum ).L * DisSysCompTermUnitData( TypeNum ).D * Pi / ( DirSign * AirflowNetworkLinkSimu( i ).FLOW ) );
 				Wamb = AirflowNetworkNodeSimu( LT ).WZ;
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Ei;
+				BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Ei;
 				MV( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Wamb * ( 1.0 - Ei );
 			}
 			if ( CompTypeNum == CompTypeNum_COI ) { // heating or cooling coil
@@ -4231,8 +4209,8 @@ namespace AirflowNetworkBalanceManager {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				MV( LT ) = 0.0;
 			}
 			// Calculate return leak
@@ -4241,26 +4219,26 @@ namespace AirflowNetworkBalanceManager {
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
 				}
 			}
 			// Check reheat unit
@@ -4291,74 +4269,42 @@ namespace AirflowNetworkBalanceManager {
 
 		// Prescribe temperature for EPlus nodes
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			found = false;
-			OANode = false;
-			for ( j = 1; j <= AirflowNetworkNumOfLinks; ++j ) {
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 1 ) == i || AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-					CompNum = AirflowNetworkLinkageData( j ).CompNum;
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_RHT && ( ! AirflowNetworkLinkageData( j ).VAVTermDamper ) ) {
-						found = true;
-						break;
-					}
-					// Overwrite fan outlet node
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_FAN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-						found = false;
-						break;
-					}
-					// Overwrite return connection outlet
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_RCN ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_SCN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-				}
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i && AirflowNetworkNodeData( AirflowNetworkLinkageData( j ).NodeNums( 1 ) ).EPlusTypeNum == EPlusTypeNum_OAN ) {
-					OANode = true;
-					break;
-				}
-			}
-			if ( found ) continue;
+			if ( BalanceNodeFixed( i ) ) continue;
+			OANode = BalanceNodeOAInlet( i );
 			if ( AirflowNetworkNodeData( i ).EPlusZoneNum == 0 && AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_ZIN ) continue;
 			j = AirflowNetworkNodeData( i ).EPlusNodeNum;
 			if ( j > 0 && ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_FOU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_COU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_HXO ) ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				BalanceMatrixDiagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).HumRat * 1.0e10;
 			}
 			if ( j > 0 && OANode ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				BalanceMatrixDiagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).HumRat * 1.0e10;
 			}
-			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 0.9e10 ) {
+			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && BalanceMatrixDiagonal( i ) < 0.9e10 ) {
 				ZoneNum = AirflowNetworkNodeData( i ).EPlusZoneNum;
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				BalanceMatrixDiagonal( i ) = 1.0e10;
 				MV( i ) = ANZW( ZoneNum ) * 1.0e10;
 			}
 			if ( AirflowNetworkNodeData( i ).ExtNodeNum > 0 ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				BalanceMatrixDiagonal( i ) = 1.0e10;
 				MV( i ) = OutHumRat * 1.0e10;
 			}
 		}
 
 		// Check singularity
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			if ( MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 1.0e-6 ) {
+			if ( BalanceMatrixDiagonal( i ) < 1.0e-6 ) {
 				ShowFatalError( "CalcAirflowNetworkMoisBalance: A diagonal entity is zero in AirflowNetwork matrix at node " + AirflowNetworkNodeData( i ).Name );
 			}
 		}
 
-		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+		// Solve the node balances
+		SolveNodeBalanceMatrix();
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			WZON = 0.0;
-			for ( j = 1; j <= AirflowNetworkNumOfNodes; ++j ) {
-				WZON += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * MV( j );
-			}
-			AirflowNetworkNodeSimu( i ).WZ = WZON;
+			AirflowNetworkNodeSimu( i ).WZ = MV( i );
 		}
 
 	}
@@ -4409,12 +4355,12 @@ namespace AirflowNetworkBalanceManager {
 		int TypeNum;
 		std::string CompName;
 		Real64 DirSign;
-		Real64 COZN;
 		int ZoneNum;
-		bool found;
 		bool OANode;
 
-		MA = 0.0;
+		BalanceAU = 0.0;
+		BalanceAD = 0.0;
+		BalanceAL = 0.0;
 		MV = 0.0;
 		for ( i = 1; i <= AirflowNetworkNumOfLinks; ++i ) {
 			CompNum = AirflowNetworkLinkageData( i ).CompNum;
@@ -4432,8 +4378,8 @@ namespace AirflowNetworkBalanceManager {
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					DirSign = -1.0;
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 			}
 			if ( CompTypeNum == CompTypeNum_TMU ) { // Reheat unit: SINGLE DUCT:CONST VOLUME:REHEAT
 				TypeNum = AirflowNetworkCompData( CompNum ).TypeNum;
@@ -4446,8 +4392,8 @@ namespace AirflowNetworkBalanceManager {
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					DirSign = -1.0;
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 			}
 			if ( CompTypeNum == CompTypeNum_COI ) { // heating or cooling coil
 				TypeNum = AirflowNetworkCompData( CompNum ).TypeNum;
@@ -4470,8 +4416,8 @@ namespace AirflowNetworkBalanceManager {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				MV( LT ) = 0.0;
 			}
 			// Calculate return leak
@@ -4480,100 +4426,68 @@ namespace AirflowNetworkBalanceManager {
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
 				}
 			}
 		}
 
 		// Prescribe temperature for EPlus nodes
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			found = false;
-			OANode = false;
-			for ( j = 1; j <= AirflowNetworkNumOfLinks; ++j ) {
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 1 ) == i || AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-					CompNum = AirflowNetworkLinkageData( j ).CompNum;
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_RHT && ( ! AirflowNetworkLinkageData( j ).VAVTermDamper ) ) {
-						found = true;
-						break;
-					}
-					// Overwrite fan outlet node
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_FAN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-						found = false;
-						break;
-					}
-					// Overwrite return connection outlet
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_RCN ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_SCN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-				}
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i && AirflowNetworkNodeData( AirflowNetworkLinkageData( j ).NodeNums( 1 ) ).EPlusTypeNum == EPlusTypeNum_OAN ) {
-					OANode = true;
-					break;
-				}
-			}
-			if ( found ) continue;
+			if ( BalanceNodeFixed( i ) ) continue;
+			OANode = BalanceNodeOAInlet( i );
 			if ( AirflowNetworkNodeData( i ).EPlusZoneNum == 0 && AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_ZIN ) continue;
 			j = AirflowNetworkNodeData( i ).EPlusNodeNum;
 			if ( j > 0 && ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_FOU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_COU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_HXO ) ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				BalanceMatrixDiagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).CO2 * 1.0e10;
 			}
 			if ( j > 0 && OANode ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				BalanceMatrixDiagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).CO2 * 1.0e10;
 			}
-			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 0.9e10 ) {
+			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && BalanceMatrixDiagonal( i ) < 0.9e10 ) {
 				ZoneNum = AirflowNetworkNodeData( i ).EPlusZoneNum;
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				BalanceMatrixDiagonal( i ) = 1.0e10;
 				MV( i ) = ANCO( ZoneNum ) * 1.0e10;
 			}
 			if ( AirflowNetworkNodeData( i ).ExtNodeNum > 0 ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				BalanceMatrixDiagonal( i ) = 1.0e10;
 				MV( i ) = OutdoorCO2 * 1.0e10;
 			}
 		}
 
 		// Check singularity
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			if ( MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 1.0e-6 ) {
+			if ( BalanceMatrixDiagonal( i ) < 1.0e-6 ) {
 				ShowFatalError( "CalcAirflowNetworkCO2Balance: A diagonal entity is zero in AirflowNetwork matrix at node " + AirflowNetworkNodeData( i ).Name );
 			}
 		}
 
-		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+		// Solve the node balances
+		SolveNodeBalanceMatrix();
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			COZN = 0.0;
-			for ( j = 1; j <= AirflowNetworkNumOfNodes; ++j ) {
-				COZN += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * MV( j );
-			}
-			AirflowNetworkNodeSimu( i ).CO2Z = COZN;
+			AirflowNetworkNodeSimu( i ).CO2Z = MV( i );
 		}
 
 	}
@@ -4624,12 +4538,12 @@ namespace AirflowNetworkBalanceManager {
 		int TypeNum;
 		std::string CompName;
 		Real64 DirSign;
-		Real64 COZN;
 		int ZoneNum;
-		bool found;
 		bool OANode;
 
-		MA = 0.0;
+		BalanceAU = 0.0;
+		BalanceAD = 0.0;
+		BalanceAL = 0.0;
 		MV = 0.0;
 		for ( i = 1; i <= AirflowNetworkNumOfLinks; ++i ) {
 			CompNum = AirflowNetworkLinkageData( i ).CompNum;
@@ -4647,8 +4561,8 @@ namespace AirflowNetworkBalanceManager {
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					DirSign = -1.0;
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 			}
 			if ( CompTypeNum == CompTypeNum_TMU ) { // Reheat unit: SINGLE DUCT:CONST VOLUME:REHEAT
 				TypeNum = AirflowNetworkCompData( CompNum ).TypeNum;
@@ -4661,8 +4575,8 @@ namespace AirflowNetworkBalanceManager {
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					DirSign = -1.0;
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 			}
 			if ( CompTypeNum == CompTypeNum_COI ) { // heating or cooling coil
 				TypeNum = AirflowNetworkCompData( CompNum ).TypeNum;
@@ -4685,8 +4599,8 @@ namespace AirflowNetworkBalanceManager {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				MV( LT ) = 0.0;
 			}
 			// Calculate return leak
@@ -4695,31 +4609,249 @@ namespace AirflowNetworkBalanceManager {
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					BalanceMatrixDiagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					BalanceMatrixEntry( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
 				}
 			}
 		}
 
 		// Prescribe temperature for EPlus nodes
+		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
+			if ( BalanceNodeFixed( i ) ) continue;
+			OANode = BalanceNodeOAInlet( i );
+			if ( AirflowNetworkNodeData( i ).EPlusZoneNum == 0 && AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_ZIN ) continue;
+			j = AirflowNetworkNodeData( i ).EPlusNodeNum;
+			if ( j > 0 && ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_FOU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_COU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_HXO ) ) {
+				BalanceMatrixDiagonal( i ) = 1.0e10;
+				MV( i ) = Node( j ).GenContam * 1.0e10;
+			}
+			if ( j > 0 && OANode ) {
+				BalanceMatrixDiagonal( i ) = 1.0e10;
+				MV( i ) = Node( j ).GenContam * 1.0e10;
+			}
+			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && BalanceMatrixDiagonal( i ) < 0.9e10 ) {
+				ZoneNum = AirflowNetworkNodeData( i ).EPlusZoneNum;
+				BalanceMatrixDiagonal( i ) = 1.0e10;
+				MV( i ) = ANGC( ZoneNum ) * 1.0e10;
+			}
+			if ( AirflowNetworkNodeData( i ).ExtNodeNum > 0 ) {
+				BalanceMatrixDiagonal( i ) = 1.0e10;
+				MV( i ) = OutdoorGC * 1.0e10;
+			}
+		}
+
+		// Check singularity
+		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
+			if ( BalanceMatrixDiagonal( i ) < 1.0e-6 ) {
+				ShowFatalError( "CalcAirflowNetworkGCBalance: A diagonal entity is zero in AirflowNetwork matrix at node " + AirflowNetworkNodeData( i ).Name );
+			}
+		}
+
+		// Solve the node balances
+		SolveNodeBalanceMatrix();
+
+		// Calculate node temperatures
+		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
+			AirflowNetworkNodeSimu( i ).GCZ = MV( i );
+		}
+
+	}
+
+	void
+	SetupNodeBalanceMatrix()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine sets up the skyline storage of the matrix shared by the heat, moisture and
+		// contaminant balances of the AirflowNetwork nodes.
+
+		// METHODOLOGY EMPLOYED:
+		// The matrix has a nonzero pair for each linkage and a diagonal for each node, so its structure
+		// does not change during the simulation. The nodes are numbered once in reverse Cuthill-McKee order,
+		// starting each connected part of the network at a node with the fewest linkages, which keeps the
+		// skyline profile narrow. The "IK" pointers are then set from the linkages as in SETSKY and the
+		// matrix is factored and solved in place with FACSKY and SLVSKY, in place of a full inverse.
+
+		// REFERENCES:
+		// Cuthill, E. and J. McKee. 1969. Reducing the bandwidth of sparse symmetric matrices.
+		// Proceedings of the 24th National Conference of the ACM, pp. 157-172.
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int i;
+		int j;
+		int k;
+		int L;
+		int M;
+		int Start; // First node of a connected part of the network
+		int Head; // Next position of BalanceNodeOrder to be visited
+		int Tail; // Next free position of BalanceNodeOrder
+		std::vector< std::vector< int > > Neighbors( AirflowNetworkNumOfNodes + 1 ); // Linked nodes of each node
+		FArray1D_bool Visited( AirflowNetworkNumOfNodes, false );
+
+		for ( M = 1; M <= AirflowNetworkNumOfLinks; ++M ) {
+			i = AirflowNetworkLinkageData( M ).NodeNums( 1 );
+			j = AirflowNetworkLinkageData( M ).NodeNums( 2 );
+			if ( i == 0 || j == 0 || i == j ) continue;
+			Neighbors[ i ].push_back( j );
+			Neighbors[ j ].push_back( i );
+		}
+		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
+			std::sort( Neighbors[ i ].begin(), Neighbors[ i ].end() );
+			Neighbors[ i ].erase( std::unique( Neighbors[ i ].begin(), Neighbors[ i ].end() ), Neighbors[ i ].end() );
+		}
+		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
+			std::stable_sort( Neighbors[ i ].begin(), Neighbors[ i ].end(), [ &Neighbors ]( int const A, int const B ) { return Neighbors[ A ].size() < Neighbors[ B ].size(); } );
+		}
+
+		// Cuthill-McKee order, one connected part at a time
+		BalanceNodeOrder.allocate( AirflowNetworkNumOfNodes );
+		Tail = 1;
+		while ( Tail <= AirflowNetworkNumOfNodes ) {
+			Start = 0;
+			for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
+				if ( Visited( i ) ) continue;
+				if ( Start == 0 || Neighbors[ i ].size() < Neighbors[ Start ].size() ) Start = i;
+			}
+			Visited( Start ) = true;
+			BalanceNodeOrder( Tail ) = Start;
+			Head = Tail;
+			++Tail;
+			while ( Head < Tail ) {
+				for ( int const Next : Neighbors[ BalanceNodeOrder( Head ) ] ) {
+					if ( Visited( Next ) ) continue;
+					Visited( Next ) = true;
+					BalanceNodeOrder( Tail ) = Next;
+					++Tail;
+				}
+				++Head;
+			}
+		}
+
+		// Reverse the order and set the position of each node
+		BalanceNodeIndex.allocate( AirflowNetworkNumOfNodes );
+		for ( k = 1; k <= AirflowNetworkNumOfNodes / 2; ++k ) {
+			i = BalanceNodeOrder( k );
+			BalanceNodeOrder( k ) = BalanceNodeOrder( AirflowNetworkNumOfNodes + 1 - k );
+			BalanceNodeOrder( AirflowNetworkNumOfNodes + 1 - k ) = i;
+		}
+		for ( k = 1; k <= AirflowNetworkNumOfNodes; ++k ) {
+			BalanceNodeIndex( BalanceNodeOrder( k ) ) = k;
+		}
+
+		// Determine column heights and convert them to column addresses
+		BalanceIK.allocate( AirflowNetworkNumOfNodes + 1 );
+		BalanceIK = 0;
+		for ( M = 1; M <= AirflowNetworkNumOfLinks; ++M ) {
+			i = AirflowNetworkLinkageData( M ).NodeNums( 1 );
+			j = AirflowNetworkLinkageData( M ).NodeNums( 2 );
+			if ( i == 0 || j == 0 ) continue;
+			k = BalanceNodeIndex( i );
+			L = BalanceNodeIndex( j );
+			BalanceIK( max( k, L ) ) = max( BalanceIK( max( k, L ) ), std::abs( L - k ) );
+		}
+		j = BalanceIK( 1 );
+		BalanceIK( 1 ) = 1;
+		for ( k = 1; k <= AirflowNetworkNumOfNodes; ++k ) {
+			i = BalanceIK( k + 1 );
+			BalanceIK( k + 1 ) = BalanceIK( k ) + j;
+			j = i;
+		}
+
+		BalanceAU.allocate( BalanceIK( AirflowNetworkNumOfNodes + 1 ) );
+		BalanceAL.allocate( BalanceIK( AirflowNetworkNumOfNodes + 1 ) );
+		BalanceAD.allocate( AirflowNetworkNumOfNodes );
+		BalanceRHS.allocate( AirflowNetworkNumOfNodes );
+		BalanceNodeFixed.allocate( AirflowNetworkNumOfNodes );
+		BalanceNodeOAInlet.allocate( AirflowNetworkNumOfNodes );
+		BalanceNodeFixed = false;
+		BalanceNodeOAInlet = false;
+
+	}
+
+	void
+	SetupBalanceNodeTypes()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine finds the nodes whose values are prescribed by a linked component and the nodes
+		// fed by an outdoor air node, once the distribution system has been validated.
+
+		// METHODOLOGY EMPLOYED:
+		// This is the linkage search formerly repeated by every node balance at every call. It only uses
+		// the linkage and component data, which do not change after ValidateDistributionSystem.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int i;
+		int j;
+		int CompNum;
+		bool found;
+		bool OANode;
+
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
 			found = false;
 			OANode = false;
@@ -4750,64 +4882,94 @@ namespace AirflowNetworkBalanceManager {
 					break;
 				}
 			}
-			if ( found ) continue;
-			if ( AirflowNetworkNodeData( i ).EPlusZoneNum == 0 && AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_ZIN ) continue;
-			j = AirflowNetworkNodeData( i ).EPlusNodeNum;
-			if ( j > 0 && ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_FOU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_COU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_HXO ) ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
-				MV( i ) = Node( j ).GenContam * 1.0e10;
-			}
-			if ( j > 0 && OANode ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
-				MV( i ) = Node( j ).GenContam * 1.0e10;
-			}
-			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 0.9e10 ) {
-				ZoneNum = AirflowNetworkNodeData( i ).EPlusZoneNum;
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
-				MV( i ) = ANGC( ZoneNum ) * 1.0e10;
-			}
-			if ( AirflowNetworkNodeData( i ).ExtNodeNum > 0 ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
-				MV( i ) = OutdoorGC * 1.0e10;
-			}
+			BalanceNodeFixed( i ) = found;
+			BalanceNodeOAInlet( i ) = OANode;
 		}
 
-		// Check singularity
-		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			if ( MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 1.0e-6 ) {
-				ShowFatalError( "CalcAirflowNetworkGCBalance: A diagonal entity is zero in AirflowNetwork matrix at node " + AirflowNetworkNodeData( i ).Name );
-			}
-		}
+	}
 
-		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+	Real64 &
+	BalanceMatrixDiagonal( int const NodeNum ) // AirflowNetwork node number
+	{
 
-		// Calculate node temperatures
-		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			COZN = 0.0;
-			for ( j = 1; j <= AirflowNetworkNumOfNodes; ++j ) {
-				COZN += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * MV( j );
-			}
-			AirflowNetworkNodeSimu( i ).GCZ = COZN;
-		}
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the diagonal of the node balance matrix for a node.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		return BalanceAD( BalanceNodeIndex( NodeNum ) );
+
+	}
+
+	Real64 &
+	BalanceMatrixEntry(
+		int const RowNode, // AirflowNetwork node of the balance equation
+		int const ColNode // AirflowNetwork node of the coefficient
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns an off-diagonal coefficient of the node balance matrix.
+
+		// METHODOLOGY EMPLOYED:
+		// Column "K" of the upper triangle and row "K" of the lower triangle both end at BalanceIK(K+1)-1,
+		// with the diagonal neighbour last. A linkage from a node to itself addresses the diagonal.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int const Row( BalanceNodeIndex( RowNode ) );
+		int const Col( BalanceNodeIndex( ColNode ) );
+
+		if ( Row == Col ) return BalanceAD( Row );
+		if ( Row < Col ) return BalanceAU( BalanceIK( Col + 1 ) - Col + Row );
+		return BalanceAL( BalanceIK( Row + 1 ) - Row + Col );
 
 	}
 
 	void
-	MRXINV( int const NORDER )
+	SolveNodeBalanceMatrix()
 	{
 
 		// SUBROUTINE INFORMATION:
-		//       AUTHOR         Lixing Gu
-		//       DATE WRITTEN   Oct. 2005
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
 		//       MODIFIED       na
-		//       RE-ENGINEERED  Revised based on Subroutine ADSINV
+		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
-		// This subroutine inverses a matrix
+		// This subroutine solves the node balance matrix for the right hand side in MV and returns the
+		// node values in MV.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// L-U factorization without pivoting. Every free node has a diagonal at least as large as the
+		// flows into it and every prescribed node has a diagonal of 1.0e10, so no pivoting is needed.
 
 		// REFERENCES:
 		// na
@@ -4817,6 +4979,7 @@ namespace AirflowNetworkBalanceManager {
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		// na
@@ -4828,72 +4991,17 @@ namespace AirflowNetworkBalanceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int i;
-		int j;
-		int K;
-		int M;
-		Real64 R1;
-		Real64 S;
-		//   ############################################## MATRIX INVERSION
-
-		IVEC = 0;
-		for ( i = 1; i <= NORDER; ++i ) {
-			IVEC( i + 20 ) = i;
-		}
-		for ( i = 1; i <= NORDER; ++i ) {
-			R1 = 0.0;
-			M = i;
-			for ( j = i; j <= NORDER; ++j ) {
-				if ( std::abs( R1 ) < std::abs( MA( ( i - 1 ) * NORDER + j ) ) ) {
-					M = j;
-					R1 = MA( ( i - 1 ) * NORDER + j );
-				}
-			}
-			if ( i != M ) {
-				K = IVEC( M + 20 );
-				IVEC( M + 20 ) = IVEC( i + 20 );
-				IVEC( i + 20 ) = K;
-				for ( j = 1; j <= NORDER; ++j ) {
-					S = MA( ( j - 1 ) * NORDER + i );
-					MA( ( j - 1 ) * NORDER + i ) = MA( ( j - 1 ) * NORDER + M );
-					MA( ( j - 1 ) * NORDER + M ) = S;
-				}
-			}
-			MA( ( i - 1 ) * NORDER + i ) = 1.0;
-			for ( j = 1; j <= NORDER; ++j ) {
-				MA( ( i - 1 ) * NORDER + j ) /= R1;
-			}
-			for ( j = 1; j <= NORDER; ++j ) {
-				if ( i == j ) continue;
-				R1 = MA( ( j - 1 ) * NORDER + i );
-				if ( std::abs( R1 ) <= 1.0E-20 ) continue;
-				MA( ( j - 1 ) * NORDER + i ) = 0.0;
-				for ( K = 1; K <= NORDER; ++K ) {
-					MA( ( j - 1 ) * NORDER + K ) -= R1 * MA( ( i - 1 ) * NORDER + K );
-				}
-Label60: ;
-			}
-		}
-		for ( i = 1; i <= NORDER; ++i ) {
-			if ( IVEC( i + 20 ) == i ) continue;
-			M = i;
-			while ( NORDER > M ) {
-Label70: ;
-				++M;
-				if ( IVEC( M + 20 ) == i ) break;
-			}
-Label80: ;
-			IVEC( M + 20 ) = IVEC( i + 20 );
-			for ( j = 1; j <= NORDER; ++j ) {
-				R1 = MA( ( i - 1 ) * NORDER + j );
-				MA( ( i - 1 ) * NORDER + j ) = MA( ( M - 1 ) * NORDER + j );
-				MA( ( M - 1 ) * NORDER + j ) = R1;
-			}
-			IVEC( i + 20 ) = i;
-Label90: ;
-		}
-		return;
-		//   ########################################################### END
+		int k;
+
+		for ( k = 1; k <= AirflowNetworkNumOfNodes; ++k ) {
+			BalanceRHS( k ) = MV( BalanceNodeOrder( k ) );
+		}
+		FACSKY( BalanceAU, BalanceAD, BalanceAL, BalanceIK, AirflowNetworkNumOfNodes, 1 );
+		SLVSKY( BalanceAU, BalanceAD, BalanceAL, BalanceRHS, BalanceIK, AirflowNetworkNumOfNodes, 1 );
+		for ( k = 1; k <= AirflowNetworkNumOfNodes; ++k ) {
+			MV( BalanceNodeOrder( k ) ) = BalanceRHS( k );
+		}
+
 	}
 
 	void
@@ -6491,6 +6599,8 @@ Label90: ;
 				}
 			}
 
+			SetupBalanceNodeTypes();
+
 			OneTimeFlag = false;
 			if ( ErrorsFound ) {
 				ShowFatalError( RoutineName + "Program terminates for preceding reason(s)." );
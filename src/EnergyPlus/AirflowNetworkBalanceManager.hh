@@ -31,10 +31,17 @@ namespace AirflowNetworkBalanceManager {
 	// MODULE VARIABLE DECLARATIONS:
 	// Report variables
 	extern FArray1D< Real64 > PZ;
-	// Inverse matrix
-	extern FArray1D< Real64 > MA;
-	extern FArray1D< Real64 > MV;
-	extern FArray1D_int IVEC;
+	// Node balance matrix in skyline form
+	extern FArray1D< Real64 > MV; // Right hand side of the node balances, then the node values
+	extern FArray1D_int BalanceIK; // Pointer to the top of column/row "K" of the node balance matrix
+	extern FArray1D< Real64 > BalanceAU; // Upper triangle of the node balance matrix
+	extern FArray1D< Real64 > BalanceAD; // Main diagonal of the node balance matrix
+	extern FArray1D< Real64 > BalanceAL; // Lower triangle of the node balance matrix
+	extern FArray1D< Real64 > BalanceRHS; // Right hand side and solution in BalanceNodeOrder
+	extern FArray1D_int BalanceNodeOrder; // Node at each row of the node balance matrix
+	extern FArray1D_int BalanceNodeIndex; // Row of each node in the node balance matrix
+	extern FArray1D_bool BalanceNodeFixed; // True if the value of the node is prescribed by a linked component
+	extern FArray1D_bool BalanceNodeOAInlet; // True if the node is fed directly by an outdoor air node
 	extern FArray1D_int SplitterNodeNumbers;
 
 	extern bool AirflowNetworkGetInputFlag;
@@ -203,7 +210,22 @@ namespace AirflowNetworkBalanceManager {
 	CalcAirflowNetworkGCBalance();
 
 	void
-	MRXINV( int const NORDER );
+	SetupNodeBalanceMatrix();
+
+	void
+	SetupBalanceNodeTypes();
+
+	Real64 &
+	BalanceMatrixDiagonal( int const NodeNum ); // AirflowNetwork node number
+
+	Real64 &
+	BalanceMatrixEntry(
+		int const RowNode, // AirflowNetwork node of the balance equation
+		int const ColNode // AirflowNetwork node of the coefficient
+	);
+
+	void
+	SolveNodeBalanceMatrix();
 
 	void
 	ReportAirflowNetwork();
@@ -3393,10 +3393,10 @@ Label999: ;
 		// na
 
 		// Argument array dimensioning
-		AU.dim( IK(NetworkNumOfNodes+1) );
-		AD.dim( NetworkNumOfNodes );
-		AL.dim( IK(NetworkNumOfNodes+1)-1 );
-		IK.dim( NetworkNumOfNodes+1 );
+		AU.dim( IK(NEQ+1) );
+		AD.dim( NEQ );
+		AL.dim( IK(NEQ+1)-1 );
+		IK.dim( NEQ+1 );
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -3538,11 +3538,11 @@ Label999: ;
 		// na
 
 		// Argument array dimensioning
-		AU.dim( IK(NetworkNumOfNodes+1) );
-		AD.dim( NetworkNumOfNodes );
-		AL.dim( IK(NetworkNumOfNodes+1)-1 );
-		B.dim( NetworkNumOfNodes );
-		IK.dim( NetworkNumOfNodes+1 );
+		AU.dim( IK(NEQ+1) );
+		AD.dim( NEQ );
+		AL.dim( IK(NEQ+1)-1 );
+		B.dim( NEQ );
+		IK.dim( NEQ+1 );
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
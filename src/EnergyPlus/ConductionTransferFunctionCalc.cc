@@ -1,7 +1,10 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -14,6 +17,7 @@
 #include <DataGlobals.hh>
 #include <DataHeatBalance.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <UtilityRoutines.hh>
@@ -72,6 +76,12 @@ namespace ConductionTransferFunctionCalc {
 	// when a two-dimensional solution has been requested for a construction
 	// with a heat source/sink.
 
+	// How the CTFs of a construction are obtained
+	int const CTFNotCalculated( 0 ); // Window, or construction skipped after an input error
+	int const CTFResistive( 1 ); // Resistive layers only, CTFs from the overall conductance
+	int const CTFReversed( 2 ); // Reverse of an earlier construction, CTFs copied from it
+	int const CTFStateSpace( 3 ); // CTFs calculated with the state space method
+
 	// DERIVED TYPE DEFINITIONS
 	// na
 
@@ -79,26 +89,7 @@ namespace ConductionTransferFunctionCalc {
 	// na
 
 	// MODULE VARIABLE DECLARATIONS:
-	FArray2D< Real64 > AExp; // Exponential of AMat
-	FArray2D< Real64 > AInv; // Inverse of AMat
-	FArray2D< Real64 > AMat; // "A" matrix from Seem's dissertation
-	// (constant coefficients of linear system)
-	FArray1D< Real64 > BMat( 3 ); // "B" matrix of state space method (non-zero elements)
-	FArray1D< Real64 > CMat( 2 ); // "C" matrix of state space method (non-zero elements)
-	FArray1D< Real64 > DMat( 2 ); // "D" matrix of state space method (non-zero elements)
-	FArray1D< Real64 > e; // Coefficients for the surface flux history term
-	FArray2D< Real64 > Gamma1; // Intermediate calculation array corresponding to a term
-	// in Seem's dissertation
-	FArray2D< Real64 > Gamma2; // Intermediate calculation array corresponding to a term
-	// in Seem's dissertation
-	int NodeSource; // Node at which a source or sink is present
-	int NodeUserTemp; // Node where user wishes to calculate a temperature
-	// (for constructions with sources/sinks only)
-	int rcmax; // Total number of nodes in the construct (<= MaxTotNodes)
-	FArray3D< Real64 > s; // Coefficients for the surface temperature history terms
-	FArray2D< Real64 > s0( 4, 3 ); // Coefficients for the current surface temperature terms
 	Real64 TinyLimit;
-	FArray2D< Real64 > IdenMatrix; // Identity Matrix
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ConductionTransferFunctionCalc
 
@@ -119,6 +110,8 @@ namespace ConductionTransferFunctionCalc {
 		//                      June 2000, RKS, addition of QTFs (both 1- and 2-D solutions for constructions
 		//                       with embedded/internal heat sources/sinks)
 		//                      July 2010-August 2011, RKS, R-value only layer enhancement
+		//                      October 2014, state space calculations of the constructions
+		//                       done together on NumCTFThreads threads (CalculateConstructionCTFs)
 		//       RE-ENGINEERED  June 1996, February 1997, August-October 1997, RKS; Nov 1999, LKL
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -141,6 +134,10 @@ namespace ConductionTransferFunctionCalc {
 		//      the inside and outside terms).
 		//   5. If the answer to 2 is (c), calculate the CTFs using the state
 		//      space method described below.
+		// Steps 1 and 2 are done for all constructions first.  The state space
+		// calculations of step 5 are then done together, in parallel when
+		// NumCTFThreads > 1, and the CTFs are stored (steps 3-5) in construction
+		// order, so that the results and messages do not depend on the threads.
 		// The state space method of calculating CTFs involves
 		// applying a finite difference grid to a multilayered
 		// building element and performing linear algebra on the
@@ -167,6 +164,8 @@ namespace ConductionTransferFunctionCalc {
 		// Using/Aliasing
 		using namespace DataConversions;
 		using General::RoundSigDigits;
+		using DataSystemVariables::DeveloperFlag;
+		using DataSystemVariables::NumCTFThreads;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -185,23 +184,6 @@ namespace ConductionTransferFunctionCalc {
 		int const MinNodes( 6 ); // Minimum number of state space nodes
 		// per layer.  This value was chosen based on experience with IBLAST.
 
-		Real64 const MaxAllowedCTFSumError( 0.01 ); // Allow a 1 percent
-		// difference between the CTF series summations.  If the difference is
-		// greater than this, then the coefficients will not yield a valid steady
-		// state solution.
-
-		Real64 const MaxAllowedTimeStep( 4.0 ); // Sets the maximum allowed time step
-		// for CTF calculations to be 4 hours.  This is done in response to some
-		// rare situations where odd or faulty input will cause the routine to
-		// go off and get some huge time step (in excess of 20 hours).  This value
-		// is a compromise that does not really solve any input problems.  One run
-		// indicated that 2 meters of concrete will result in a time step of slightly
-		// more than 3 hours.  So, 4 hours was arbitrarily picked as a ceiling for
-		// time steps so that an error message can be produced to warn the user
-		// that something isn't right.  Note that the 4 hour limit does not guarantee
-		// that problems won't exist and it does not necessarily avoid any problems
-		// that interpolated temperature histories might cause.
-
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
 
@@ -212,62 +194,59 @@ namespace ConductionTransferFunctionCalc {
 		FArray1D_int AdjacentResLayerNum( MaxLayersInConstruct ); // Layers that are adjacent to each other which are resistive
 		// only can and should be combined
 		int AdjLayer; // Loop counter for adjacent resistance-only layers
-		Real64 amatx; // Intermediate calculation variable
-		Real64 amatxx; // Intermediate calculation variable
-		Real64 amaty; // Intermediate calculation variable
-		Real64 BiggestSum; // Largest CTF series summation (maximum of SumXi, SumYi, and SumZi)
-		Real64 cap; // Thermal capacitance of a node (intermediate calculation)
-		Real64 capavg; // Thermal capacitance of a node (average value for a node at an interface)
+		Real64 CalcTime; // Wall clock time of the state space calculations (s)
 		Real64 cnd; // Total thermal conductance (1/Rtot) of the bldg element
 		int Constr; // Loop counter
 		int ConstrNum; // Loop counter (construct number)
 		FArray1D< Real64 > cp( MaxLayersInConstruct ); // Specific heat of a material layer
-		bool CTFConvrg; // Set after CTFs are calculated, based on whether there are too
-		// many CTF terms
+		bool CTFConvergenceFailed; // Set once the CTFs of a construction did not converge (later ones are skipped)
 		int CurrentLayer; // Pointer to material number in Material derived type (current layer)
 		FArray1D< Real64 > dl( MaxLayersInConstruct ); // Thickness of a material layer
 		Real64 dtn; // Intermediate calculation of the time step
 		FArray1D< Real64 > dx( MaxLayersInConstruct ); // Distance between nodes in a particular material layer
 		Real64 dxn; // Intermediate calculation of nodal spacing
-		Real64 dxtmp; // Intermediate calculation variable ( = 1/dx/cap)
 		Real64 dyn; // Nodal spacing in the direction perpendicular to the main direction
 		// of heat transfer (only valid for a 2-D solution)
 		static bool ErrorsFound( false ); // Flag for input error condition
 		int HistTerm; // Loop counter
 		int ipts1; // Intermediate calculation for number of nodes per layer
-		int ir; // Loop control for constructing Identity Matrix
 		int Layer; // Loop counter
 		int Layer1; // Loop counter
 		int LayersInConstruct; // Array containing the number of layers for each construct
 		// Different from TotLayers because shades are not include in local var
 		FArray1D< Real64 > lr( MaxLayersInConstruct ); // R value of a material layer
-		int Node; // Loop counter
-		int Node2; // Node number (modification of Node and NodeInRow)
-		int NodeInLayer; // Loop counter
-		int NodeInRow; // Loop counter
+		int NodeSource; // Node at which a source or sink is present
+		int NodeUserTemp; // Node where user wishes to calculate a temperature
+		// (for constructions with sources/sinks only)
 		FArray1D_int Nodes( MaxLayersInConstruct ); // Array containing the number of nodes per layer
 		int NumResLayers; // Number of resistive layers in the construction
 		// property allowable, traditional value from BLAST
 		int NumAdjResLayers; // Number of resistive layers that are adjacent
+		int NumStateSpaceConstrs; // Number of constructions whose CTFs need the state space method
+		int NumThreads; // Threads used for the state space calculations
 		int OppositeLayer; // Used for comparing constructions (to see if one is the reverse of another)
 		FArray1D_bool ResLayer( MaxLayersInConstruct ); // Set true if the layer must be handled as a resistive
 		bool RevConst; // Set true if one construct is the reverse of another (CTFs already
 		// available)
 		FArray1D< Real64 > rho( MaxLayersInConstruct ); // Density of a material layer
 		FArray1D< Real64 > rk( MaxLayersInConstruct ); // Thermal conductivity of a material layer
+		int rcmax; // Total number of nodes in the construct
 		Real64 rs; // Total thermal resistance of the building element
-		Real64 SumXi; // Summation of all of the Xi terms (inside CTFs) for a construction
-		Real64 SumYi; // Summation of all of the Xi terms (cross CTFs) for a construction
-		Real64 SumZi; // Summation of all of the Xi terms (outside CTFs) for a construction
+		std::vector< int > StateSpaceConstrs; // Constructions whose CTFs need the state space method
 		bool DoCTFErrorReport;
 		Real64 Alpha; // thermal diffusivity in m2/s, for local check of properties
 		Real64 DeltaTimestep; // zone timestep in seconds, for local check of properties
 		Real64 ThicknessThreshold; // min thickness consistent with other thermal properties, for local check
 
+		// Object Data
+		FArray1D< CTFCalcData > CTFCalc; // CTF calculation of each construction
+
 		// FLOW:
 		// Subroutine initializations
 		TinyLimit = rTinyValue;
 		DoCTFErrorReport = false;
+		CTFCalc.allocate( TotConstructs );
+		StateSpaceConstrs.reserve( TotConstructs );
 
 		for ( ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) { // Begin construction loop ...
 
@@ -533,23 +512,11 @@ namespace ConductionTransferFunctionCalc {
 
 						if ( RevConst ) { // Curent construction is a reverse of
 							// construction Constr.  Thus, CTFs do not need to be re-
-							// calculated.  Copy CTF info for construction Constr to
-							// construction ConstrNum.
-
-							Construct( ConstrNum ).CTFTimeStep = Construct( Constr ).CTFTimeStep;
-							Construct( ConstrNum ).NumHistories = Construct( Constr ).NumHistories;
-							Construct( ConstrNum ).NumCTFTerms = Construct( Constr ).NumCTFTerms;
-
-							// Transfer the temperature and flux history terms to CTF arrays.
-							// Loop through the number of CTF history terms ...
-							for ( HistTerm = 0; HistTerm <= Construct( ConstrNum ).NumCTFTerms; ++HistTerm ) {
-
-								Construct( ConstrNum ).CTFInside( HistTerm ) = Construct( Constr ).CTFOutside( HistTerm );
-								Construct( ConstrNum ).CTFCross( HistTerm ) = Construct( Constr ).CTFCross( HistTerm );
-								Construct( ConstrNum ).CTFOutside( HistTerm ) = Construct( Constr ).CTFInside( HistTerm );
-								if ( HistTerm != 0 ) Construct( ConstrNum ).CTFFlux( HistTerm ) = Construct( Constr ).CTFFlux( HistTerm );
+							// calculated.  The CTF info of construction Constr is
+							// copied to construction ConstrNum once it has been stored.
 
-							} // ... end of CTF history terms loop.
+							CTFCalc( ConstrNum ).Method = CTFReversed;
+							CTFCalc( ConstrNum ).RevConstrNum = Constr;
 
 							break; // Constr DO loop
 
@@ -676,7 +643,7 @@ namespace ConductionTransferFunctionCalc {
 					// (see later code in this routine).
 
 					dtn = 0.0;
-					Construct( ConstrNum ).CTFTimeStep = 0.0;
+					CTFCalc( ConstrNum ).CTFTimeStep = 0.0;
 					for ( Layer = 1; Layer <= LayersInConstruct; ++Layer ) {
 						if ( Nodes( Layer ) >= MaxCTFTerms ) {
 							if ( Construct( ConstrNum ).SolutionDimensions == 1 ) {
@@ -684,7 +651,7 @@ namespace ConductionTransferFunctionCalc {
 							} else { // 2-D solution requested-->this changes length parameter in Fourier number calculation
 								dtn = rho( Layer ) * cp( Layer ) * ( pow_2( dx( Layer ) ) + pow_2( dyn ) ) / rk( Layer );
 							}
-							if ( dtn > Construct( ConstrNum ).CTFTimeStep ) Construct( ConstrNum ).CTFTimeStep = dtn;
+							if ( dtn > CTFCalc( ConstrNum ).CTFTimeStep ) CTFCalc( ConstrNum ).CTFTimeStep = dtn;
 						}
 					}
 
@@ -692,388 +659,109 @@ namespace ConductionTransferFunctionCalc {
 					// calculated time step for this construct, then CTFTimeStep must be
 					// revised.
 
-					if ( std::abs( ( TimeStepZone - Construct( ConstrNum ).CTFTimeStep ) / TimeStepZone ) > 0.1 ) {
+					if ( std::abs( ( TimeStepZone - CTFCalc( ConstrNum ).CTFTimeStep ) / TimeStepZone ) > 0.1 ) {
 
-						if ( Construct( ConstrNum ).CTFTimeStep > TimeStepZone ) {
+						if ( CTFCalc( ConstrNum ).CTFTimeStep > TimeStepZone ) {
 
 							// CTFTimeStep larger than TimeStepZone:  Make sure TimeStepZone
 							// divides evenly into CTFTimeStep
-							Construct( ConstrNum ).NumHistories = int( ( Construct( ConstrNum ).CTFTimeStep / TimeStepZone ) + 0.5 );
-							Construct( ConstrNum ).CTFTimeStep = TimeStepZone * double( Construct( ConstrNum ).NumHistories );
+							CTFCalc( ConstrNum ).NumHistories = int( ( CTFCalc( ConstrNum ).CTFTimeStep / TimeStepZone ) + 0.5 );
+							CTFCalc( ConstrNum ).CTFTimeStep = TimeStepZone * double( CTFCalc( ConstrNum ).NumHistories );
 
 						} else {
 
 							// CTFTimeStep smaller than TimeStepZone:  Set to TimeStepZone
-							Construct( ConstrNum ).CTFTimeStep = TimeStepZone;
-							Construct( ConstrNum ).NumHistories = 1;
+							CTFCalc( ConstrNum ).CTFTimeStep = TimeStepZone;
+							CTFCalc( ConstrNum ).NumHistories = 1;
 
 						}
 
 					}
 
-					// Calculate the CTFs using the state space method
-					// outlined in Seem's dissertation.  The main matrices
-					// AMat, BMat, CMat, and DMat must be derived from
-					// applying a finite difference network to the layers of
-					// each bldg element.
-
-					// This section must continue looping until the CTFs
-					// calculated here will produce a stable solution (less
-					// history terms than MaxCTFTerms).
-
-					// This first subsection calculates the elements of AMat
-					// which characterizes the heat transfer inside the
-					// building element.
-
-					CTFConvrg = false; // Initialize loop control logical
-
-					AExp.allocate( rcmax, rcmax );
-					AExp = 0.0;
-					AMat.allocate( rcmax, rcmax );
-					AMat = 0.0;
-					AInv.allocate( rcmax, rcmax );
-					AInv = 0.0;
-					IdenMatrix.allocate( rcmax, rcmax );
-					IdenMatrix = 0.0;
-					for ( ir = 1; ir <= rcmax; ++ir ) {
-						IdenMatrix( ir, ir ) = 1.0;
-					}
-					e.allocate( rcmax );
-					e = 0.0;
-					Gamma1.allocate( rcmax, 3 );
-					Gamma1 = 0.0;
-					Gamma2.allocate( rcmax, 3 );
-					Gamma2 = 0.0;
-					s.allocate( rcmax, 4, 3 );
-					s = 0.0;
-
-					while ( ! CTFConvrg ) { // Begin CTF calculation loop ...
-
-						BMat( 3 ) = 0.0;
-
-						if ( Construct( ConstrNum ).SolutionDimensions == 1 ) {
-
-							// Set up intermediate calculations for the first layer.
-							cap = rho( 1 ) * cp( 1 ) * dx( 1 );
-							cap *= 1.5; // For the first node, account for the fact that the
-							// half-node at the surface results in a "loss" of some
-							// thermal mass.  Therefore, for simplicity, include it
-							// at this node.  Same thing done at the last node...
-							dxtmp = 1.0 / dx( 1 ) / cap;
-
-							AMat( 1, 1 ) = -2.0 * rk( 1 ) * dxtmp; // Assign the matrix values for the
-							AMat( 1, 2 ) = rk( 1 ) * dxtmp; // first node.
-							BMat( 1 ) = rk( 1 ) * dxtmp; // Assign non-zero value of BMat.
-
-							Layer = 1; // Initialize the "layer" counter
-
-							NodeInLayer = 2; // Initialize the node (in a layer) counter (already
-							// on the second node for the first layer
-
-							for ( Node = 2; Node <= rcmax - 1; ++Node ) { // Begin nodes loop (includes all nodes except the
-								// first/last which have special equations) ...
-
-								if ( ( NodeInLayer == Nodes( Layer ) ) && ( LayersInConstruct != 1 ) ) { // For a node at
-									// the interface between two adjacent layers, the
-									// capacitance of the node must be calculated from the 2
-									// halves which may be made up of 2 different materials.
-
-									cap = ( rho( Layer ) * cp( Layer ) * dx( Layer ) + rho( Layer + 1 ) * cp( Layer + 1 ) * dx( Layer + 1 ) ) * 0.5;
-
-									AMat( Node, Node - 1 ) = rk( Layer ) / dx( Layer ) / cap; // Assign matrix
-									AMat( Node, Node ) = -1.0 * ( rk( Layer ) / dx( Layer ) + rk( Layer + 1 ) / dx( Layer + 1 ) ) / cap; // values for | the current
-									AMat( Node, Node + 1 ) = rk( Layer + 1 ) / dx( Layer + 1 ) / cap; // node.
+					// The state space calculation itself is done for all of the
+					// constructions together below; keep what it needs.
+					CTFCalc( ConstrNum ).Method = CTFStateSpace;
+					CTFCalc( ConstrNum ).SolutionDimensions = Construct( ConstrNum ).SolutionDimensions;
+					CTFCalc( ConstrNum ).LayersInConstruct = LayersInConstruct;
+					CTFCalc( ConstrNum ).Nodes = Nodes;
+					CTFCalc( ConstrNum ).dx = dx;
+					CTFCalc( ConstrNum ).rk = rk;
+					CTFCalc( ConstrNum ).rho = rho;
+					CTFCalc( ConstrNum ).cp = cp;
+					CTFCalc( ConstrNum ).dyn = dyn;
+					CTFCalc( ConstrNum ).rcmax = rcmax;
+					CTFCalc( ConstrNum ).NodeSource = NodeSource;
+					CTFCalc( ConstrNum ).NodeUserTemp = NodeUserTemp;
+					StateSpaceConstrs.push_back( ConstrNum );
 
-									NodeInLayer = 0; // At an interface, reset nodes in layer counter
-									++Layer; // Also increment the layer counter
-
-								} else { // Standard node within any layer
-
-									cap = rho( Layer ) * cp( Layer ) * dx( Layer ); // Intermediate
-									dxtmp = 1.0 / dx( Layer ) / cap; // calculations.
-									AMat( Node, Node - 1 ) = rk( Layer ) * dxtmp; // Assign matrix
-									AMat( Node, Node ) = -2.0 * rk( Layer ) * dxtmp; // values for the
-									AMat( Node, Node + 1 ) = rk( Layer ) * dxtmp; // current node.
-
-								}
-
-								++NodeInLayer; // Increment nodes in layer counter
-								if ( Node == NodeSource ) BMat( 3 ) = 1.0 / cap;
-
-							} // ... end of nodes loop.
-
-							// Intermediate calculations for the last node.
-							cap = rho( LayersInConstruct ) * cp( LayersInConstruct ) * dx( LayersInConstruct );
-							cap *= 1.5; // For the last node, account for the fact that the
-							// half-node at the surface results in a "loss" of some
-							// thermal mass.  Therefore, for simplicity, include it
-							// at this node.  Same thing done at the first node...
-							dxtmp = 1.0 / dx( LayersInConstruct ) / cap;
-
-							AMat( rcmax, rcmax ) = -2.0 * rk( LayersInConstruct ) * dxtmp; // Assign matrix
-							AMat( rcmax, rcmax - 1 ) = rk( LayersInConstruct ) * dxtmp; // values for the
-							BMat( 2 ) = rk( LayersInConstruct ) * dxtmp; // last node.
-
-							CMat( 1 ) = -rk( 1 ) / dx( 1 ); // Compute the necessary elements
-							CMat( 2 ) = rk( LayersInConstruct ) / dx( LayersInConstruct ); // of all other
-							DMat( 1 ) = rk( 1 ) / dx( 1 ); // matrices for the state
-							DMat( 2 ) = -rk( LayersInConstruct ) / dx( LayersInConstruct ); // space method
-
-						} else { // 2-D solution requested (assign matrices appropriately)
-
-							// As with the 1-D solution, we are accounting for the thermal mass
-							// of the half-node at the surface by adding it to the first row
-							// of interior nodes at both sides of the construction.  This is not
-							// exact, but it does take all of the thermal mass into account.
-							amatx = rk( 1 ) / ( 1.5 * rho( 1 ) * cp( 1 ) * dx( 1 ) * dx( 1 ) );
-							amaty = rk( 1 ) / ( 1.5 * rho( 1 ) * cp( 1 ) * dyn * dyn );
-
-							// FIRST ROW OF NODES: This first row within the first material layer
-							// is special in that it is exposed to a boundary condition.  Thus,
-							// the equations are slightly different.
-							// Note also that the first and last nodes in a row are slightly
-							// different from the rest since they are on an adiabatic plane in
-							// the direction perpendicular to the main direction of heat transfer.
-							AMat( 1, 1 ) = -2.0 * ( amatx + amaty );
-							AMat( 1, 2 ) = 2.0 * amaty;
-							AMat( 1, NumOfPerpendNodes + 1 ) = amatx;
-
-							for ( Node = 2; Node <= NumOfPerpendNodes - 1; ++Node ) {
-								AMat( Node, Node - 1 ) = amaty;
-								AMat( Node, Node ) = -2.0 * ( amatx + amaty );
-								AMat( Node, Node + 1 ) = amaty;
-								AMat( Node, Node + NumOfPerpendNodes ) = amatx;
-							}
+				} // ... end of IF block for non-reversed constructs.
 
-							AMat( NumOfPerpendNodes, NumOfPerpendNodes ) = -2.0 * ( amatx + amaty );
-							AMat( NumOfPerpendNodes, NumOfPerpendNodes - 1 ) = 2.0 * amaty;
-							AMat( NumOfPerpendNodes, NumOfPerpendNodes + NumOfPerpendNodes ) = amatx;
-
-							BMat( 1 ) = amatx;
-
-							Layer = 1;
-							NodeInLayer = 2;
-							amatx = rk( 1 ) / ( rho( 1 ) * cp( 1 ) * dx( 1 ) * dx( 1 ) ); // Reset these to the normal capacitance
-							amaty = rk( 1 ) / ( rho( 1 ) * cp( 1 ) * dyn * dyn ); // Reset these to the normal capacitance
-							assert( NumOfPerpendNodes > 0 ); //Autodesk:F2C++ Loop setup assumption
-							int const Node_stop( rcmax + 1 - 2 * NumOfPerpendNodes );
-							for ( Node = NumOfPerpendNodes + 1; Node <= Node_stop; Node += NumOfPerpendNodes ) {
-								// INTERNAL ROWS OF NODES: This is the majority of nodes which are all within
-								// a solid layer and not exposed to a boundary condition.
-								if ( ( LayersInConstruct == 1 ) || ( NodeInLayer != Nodes( Layer ) ) ) {
-									// Single material row: This row of nodes are all contained within a material
-									// and thus there is no special considerations necessary.
-									if ( NodeInLayer == 1 ) {
-										// These intermediate variables only need to be reassigned when a new layer is started.
-										// When this is simply another row of the same material, these have already been assigned correctly.
-										amatx = rk( Layer ) / ( rho( Layer ) * cp( Layer ) * dx( Layer ) * dx( Layer ) );
-										amaty = rk( Layer ) / ( rho( Layer ) * cp( Layer ) * dyn * dyn );
-									}
-
-									// Note that the first and last layers in a row are slightly different
-									// from the rest since they are on an adiabatic plane in the direction
-									// perpendicular to the main direction of heat transfer.
-									AMat( Node, Node ) = -2.0 * ( amatx + amaty );
-									AMat( Node, Node + 1 ) = 2.0 * amaty;
-									AMat( Node, Node - NumOfPerpendNodes ) = amatx;
-									AMat( Node, Node + NumOfPerpendNodes ) = amatx;
-
-									for ( NodeInRow = 2; NodeInRow <= NumOfPerpendNodes - 1; ++NodeInRow ) {
-										Node2 = Node + NodeInRow - 1;
-										AMat( Node2, Node2 - 1 ) = amaty;
-										AMat( Node2, Node2 ) = -2.0 * ( amatx + amaty );
-										AMat( Node2, Node2 + 1 ) = amaty;
-										AMat( Node2, Node2 - NumOfPerpendNodes ) = amatx;
-										AMat( Node2, Node2 + NumOfPerpendNodes ) = amatx;
-									}
-
-									Node2 = Node - 1 + NumOfPerpendNodes;
-									AMat( Node2, Node2 ) = -2.0 * ( amatx + amaty );
-									AMat( Node2, Node2 - 1 ) = 2.0 * amaty;
-									AMat( Node2, Node2 - NumOfPerpendNodes ) = amatx;
-									AMat( Node2, Node2 + NumOfPerpendNodes ) = amatx;
-
-								} else { // Row at a two-layer interface (half of node consists of one layer's materials
-									// and the other half consist of the next layer's materials)
-									capavg = 0.5 * ( rho( Layer ) * cp( Layer ) * dx( Layer ) + rho( Layer + 1 ) * cp( Layer + 1 ) * dx( Layer + 1 ) );
-									amatx = rk( Layer ) / ( capavg * dx( Layer ) );
-									amatxx = rk( Layer + 1 ) / ( capavg * dx( Layer + 1 ) );
-									amaty = ( rk( Layer ) * dx( Layer ) + rk( Layer + 1 ) * dx( Layer + 1 ) ) / ( capavg * dyn * dyn );
-
-									AMat( Node, Node ) = -amatx - amatxx - 2.0 * amaty;
-									AMat( Node, Node + 1 ) = 2.0 * amaty;
-									AMat( Node, Node - NumOfPerpendNodes ) = amatx;
-									AMat( Node, Node + NumOfPerpendNodes ) = amatxx;
-
-									for ( NodeInRow = 2; NodeInRow <= NumOfPerpendNodes - 1; ++NodeInRow ) {
-										Node2 = Node + NodeInRow - 1;
-										AMat( Node2, Node2 - 1 ) = amaty;
-										AMat( Node2, Node2 ) = -amatx - amatxx - 2.0 * amaty;
-										AMat( Node2, Node2 + 1 ) = amaty;
-										AMat( Node2, Node2 - NumOfPerpendNodes ) = amatx;
-										AMat( Node2, Node2 + NumOfPerpendNodes ) = amatxx;
-									}
-
-									Node2 = Node - 1 + NumOfPerpendNodes;
-									AMat( Node2, Node2 ) = -amatx - amatxx - 2.0 * amaty;
-									AMat( Node2, Node2 - 1 ) = 2.0 * amaty;
-									AMat( Node2, Node2 - NumOfPerpendNodes ) = amatx;
-									AMat( Node2, Node2 + NumOfPerpendNodes ) = amatxx;
-
-									if ( Node == NodeSource ) BMat( 3 ) = 2.0 * double( NumOfPerpendNodes - 1 ) / capavg;
-									NodeInLayer = 0;
-									++Layer;
+			} else { // Construct has only resistive layers (no thermal mass).
+				// CTF calculation not necessary, overall resistance
+				// (R-value) is all that is needed.
 
-								}
-								++NodeInLayer;
+				CTFCalc( ConstrNum ).Method = CTFResistive;
 
-							}
+				if ( Construct( ConstrNum ).SourceSinkPresent ) {
+					ShowSevereError( "Sources/sinks not allowed in purely resistive constructions --> " + Construct( ConstrNum ).Name );
+					ErrorsFound = true;
+				}
 
-							// LAST ROW OF NODES: Like the first row of nodes, this row is exposed to a boundary
-							// condition and thus has slightly modified nodal equations.
-
-							// As with the 1-D solution, we are accounting for the thermal mass
-							// of the half-node at the surface by adding it to the first row
-							// of interior nodes at both sides of the construction.  This is not
-							// exact, but it does take all of the thermal mass into account.
-							amatx /= 1.5;
-							amaty /= 1.5;
-
-							Node = rcmax + 1 - NumOfPerpendNodes;
-							AMat( Node, Node ) = -2.0 * ( amatx + amaty );
-							AMat( Node, Node + 1 ) = 2.0 * amaty;
-							AMat( Node, Node - NumOfPerpendNodes ) = amatx;
-
-							for ( Node = rcmax + 2 - NumOfPerpendNodes; Node <= rcmax - 1; ++Node ) {
-								AMat( Node, Node - 1 ) = amaty;
-								AMat( Node, Node ) = -2.0 * ( amatx + amaty );
-								AMat( Node, Node + 1 ) = amaty;
-								AMat( Node, Node - NumOfPerpendNodes ) = amatx;
-							}
+			} // ... end of resistive construction IF block.
 
-							AMat( rcmax, rcmax ) = -2.0 * ( amatx + amaty );
-							AMat( rcmax, rcmax - 1 ) = 2.0 * amaty;
-							AMat( rcmax, rcmax - NumOfPerpendNodes ) = amatx;
+			CTFCalc( ConstrNum ).cnd = cnd;
 
-							BMat( 2 ) = amatx;
+		} // ... end of construction loop.
 
-							CMat( 1 ) = -rk( 1 ) / dx( 1 ) / double( NumOfPerpendNodes - 1 );
-							CMat( 2 ) = rk( LayersInConstruct ) / dx( LayersInConstruct ) / double( NumOfPerpendNodes - 1 );
+		// Calculate the CTFs of the constructions that need the state space method.  Each
+		// calculation only uses its own CTFCalc entry, so the constructions are spread over
+		// NumCTFThreads threads, the ones with the most nodes first.
+		std::stable_sort( StateSpaceConstrs.begin(), StateSpaceConstrs.end(), [ &CTFCalc ]( int const A, int const B ) { return CTFCalc( A ).rcmax > CTFCalc( B ).rcmax; } );
+		NumStateSpaceConstrs = int( StateSpaceConstrs.size() );
+		NumThreads = max( 1, min( NumCTFThreads, NumStateSpaceConstrs ) );
+		auto const CalcStartTime( std::chrono::steady_clock::now() );
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( NumThreads ) schedule( dynamic, 1 )
+#endif
+		for ( int Item = 0; Item < NumStateSpaceConstrs; ++Item ) {
+			CTFCalcData & Calc( CTFCalc( StateSpaceConstrs[ Item ] ) );
+			auto const ConstrStartTime( std::chrono::steady_clock::now() );
+			CalculateConstructionCTFs( Calc );
+			Calc.CalcTime = std::chrono::duration< Real64 >( std::chrono::steady_clock::now() - ConstrStartTime ).count();
+		}
+		CalcTime = std::chrono::duration< Real64 >( std::chrono::steady_clock::now() - CalcStartTime ).count();
 
-							DMat( 1 ) = rk( 1 ) / dx( 1 ) / double( NumOfPerpendNodes - 1 );
-							DMat( 2 ) = -rk( LayersInConstruct ) / dx( LayersInConstruct ) / double( NumOfPerpendNodes - 1 );
+		// Store the CTFs in construction order: reversed constructions copy the stored CTFs
+		// of the construction they reverse, and the messages come out in the same order for
+		// any number of threads.
+		CTFConvergenceFailed = false;
+		for ( ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) {
 
-						}
+			if ( CTFCalc( ConstrNum ).Method == CTFNotCalculated ) continue;
+			if ( CTFConvergenceFailed ) continue; // Constructions after a convergence problem keep 0 CTFs
 
-						// Calculation of the CTFs based on the state space
-						// method.  This process involves finding the exponential
-						// and inverse of AMat and using these results to
-						// determine the CTFs.  The Gammas are an intermediate
-						// calculations which are necessary before the CTFs can
-						// be computed in TransFuncCoeffs.
-						DisplayNumberAndString( ConstrNum, "Calculating CTFs for \"" + Construct( ConstrNum ).Name + "\", Construction #" );
-
-						//          CALL DisplayNumberAndString(ConstrNum,'Matrix exponential for Construction #')
-						CalculateExponentialMatrix( Construct( ConstrNum ).CTFTimeStep ); // Compute exponential of AMat
-
-						//          CALL DisplayNumberAndString(ConstrNum,'Invert Matrix for Construction #')
-						CalculateInverseMatrix(); // Compute inverse of AMat
-
-						//          CALL DisplayNumberAndString(ConstrNum,'Gamma calculation for Construction #')
-						CalculateGammas( Construct( ConstrNum ).CTFTimeStep, Construct( ConstrNum ).SolutionDimensions );
-						// Compute "gamma"s from AMat, AExp, and AInv
-
-						//          CALL DisplayNumberAndString(ConstrNum,'Compute CTFs for Construction #')
-						CalculateCTFs( Construct( ConstrNum ).NumCTFTerms, Construct( ConstrNum ).SolutionDimensions ); // Compute CTFs
-
-						// Now check to see if the number of transfer functions
-						// is greater than MaxCTFTerms.  If it is, then increase the
-						// time step and the number of history terms and
-						// recalculate.  Whether or not it will be necessary to
-						// recalculate the CTFs is controlled by this DO WHILE
-						// loop and the logical CTFConvrg.
-
-						CTFConvrg = true; // Assume solution convergence
-
-						// If too many terms, then solution did not converge.  Increase the
-						// number of histories and the time step.  Reset CTFConvrg to continue
-						// the DO loop.
-						if ( Construct( ConstrNum ).NumCTFTerms > ( MaxCTFTerms - 1 ) ) {
-							++Construct( ConstrNum ).NumHistories;
-							Construct( ConstrNum ).CTFTimeStep += TimeStepZone;
-							CTFConvrg = false;
-						}
+			if ( CTFCalc( ConstrNum ).Method == CTFReversed ) { // Curent construction is a reverse of
+				// construction Constr.  Thus, CTFs do not need to be re-
+				// calculated.  Copy CTF info for construction Constr to
+				// construction ConstrNum.
 
-						// If the number of terms is okay, then do a further check on the summation of
-						// the various series summations.  In theory, Sum(Xi) = Sum(Yi) = Sum(Zi).  If
-						// this is not the case, then the terms have not reached a valid solution, and
-						// we need to increase the number of histories and the time step as above.
-						if ( CTFConvrg ) {
-							SumXi = s0( 2, 2 );
-							SumYi = s0( 2, 1 );
-							SumZi = s0( 1, 1 );
-							for ( HistTerm = 1; HistTerm <= Construct( ConstrNum ).NumCTFTerms; ++HistTerm ) {
-								SumXi += s( HistTerm, 2, 2 );
-								SumYi += s( HistTerm, 2, 1 );
-								SumZi += s( HistTerm, 1, 1 );
-							}
-							SumXi = std::abs( SumXi );
-							SumYi = std::abs( SumYi );
-							SumZi = std::abs( SumZi );
-							BiggestSum = max( SumXi, SumYi, SumZi );
-							if ( BiggestSum > 0.0 ) {
-								if ( ( ( std::abs( SumXi - SumYi ) / BiggestSum ) > MaxAllowedCTFSumError ) || ( ( std::abs( SumZi - SumYi ) / BiggestSum ) > MaxAllowedCTFSumError ) ) {
-									++Construct( ConstrNum ).NumHistories;
-									Construct( ConstrNum ).CTFTimeStep += TimeStepZone;
-									CTFConvrg = false;
-								}
-							} else { // Something terribly wrong--the surface has no CTFs, not even an R-value
-								ShowFatalError( "Illegal construction definition, no CTFs calculated for " + Construct( ConstrNum ).Name );
-							}
-						}
+				Constr = CTFCalc( ConstrNum ).RevConstrNum;
+				Construct( ConstrNum ).CTFTimeStep = Construct( Constr ).CTFTimeStep;
+				Construct( ConstrNum ).NumHistories = Construct( Constr ).NumHistories;
+				Construct( ConstrNum ).NumCTFTerms = Construct( Constr ).NumCTFTerms;
 
-						// Once the time step has reached a certain point, it is highly likely that
-						// there is either a problem with the input or the solution.  This should
-						// be extremely rare since other checks should flag most bad user input.
-						// Thus, if the time step reaches a certain point, error out and let the
-						// user know that something needs to be checked in the input file.
-						if ( Construct( ConstrNum ).CTFTimeStep >= MaxAllowedTimeStep ) {
-							ShowSevereError( "CTF calculation convergence problem for Construction=\"" + Construct( ConstrNum ).Name + "\"." );
-							ShowContinueError( "...with Materials (outside layer to inside)" );
-							ShowContinueError( "(outside)=\"" + Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Name + "\"" );
-							for ( Layer = 2; Layer <= Construct( ConstrNum ).TotLayers; ++Layer ) {
-								if ( Layer != Construct( ConstrNum ).TotLayers ) {
-									ShowContinueError( "(next)=\"" + Material( Construct( ConstrNum ).LayerPoint( Layer ) ).Name + "\"" );
-								} else {
-									ShowContinueError( "(inside)=\"" + Material( Construct( ConstrNum ).LayerPoint( Layer ) ).Name + "\"" );
-								}
-							}
-							ShowContinueError( "The Construction report will be produced. This will show more " "details on Constructions and their materials." );
-							ShowContinueError( "Attempts will be made to complete the CTF process but the report may be incomplete." );
-							ShowContinueError( "Constructs reported after this construction may appear to have all 0 CTFs." );
-							ShowContinueError( "The potential causes of this problem are related to the input for the construction" );
-							ShowContinueError( "listed in the severe error above.  The CTF calculate routine is unable to come up" );
-							ShowContinueError( "with a series of CTF terms that have a reasonable time step and this indicates an" );
-							ShowContinueError( "error.  Check the definition of this construction and the materials that make up" );
-							ShowContinueError( "the construction.  Very thin, highly conductive materials may cause problems." );
-							ShowContinueError( "This may be avoided by ignoring the presence of those materials since they probably" );
-							ShowContinueError( "do not effect the heat transfer characteristics of the construction.  Highly" );
-							ShowContinueError( "conductive or highly resistive layers that are alternated with high mass layers" );
-							ShowContinueError( "may also result in problems.  After confirming that the input is correct and" );
-							ShowContinueError( "realistic, the user should contact the EnergyPlus support team." );
-							DoCTFErrorReport = true;
-							ErrorsFound = true;
-							break;
-							//            CALL ShowFatalError('Program terminated for reasons listed (InitConductionTransferFunctions) ')
-						}
+				// Transfer the temperature and flux history terms to CTF arrays.
+				// Loop through the number of CTF history terms ...
+				for ( HistTerm = 0; HistTerm <= Construct( ConstrNum ).NumCTFTerms; ++HistTerm ) {
 
-					} // ... end of CTF calculation loop.
+					Construct( ConstrNum ).CTFInside( HistTerm ) = Construct( Constr ).CTFOutside( HistTerm );
+					Construct( ConstrNum ).CTFCross( HistTerm ) = Construct( Constr ).CTFCross( HistTerm );
+					Construct( ConstrNum ).CTFOutside( HistTerm ) = Construct( Constr ).CTFInside( HistTerm );
+					if ( HistTerm != 0 ) Construct( ConstrNum ).CTFFlux( HistTerm ) = Construct( Constr ).CTFFlux( HistTerm );
 
-				} // ... end of IF block for non-reversed constructs.
+				} // ... end of CTF history terms loop.
 
-			} else { // Construct has only resistive layers (no thermal mass).
-				// CTF calculation not necessary, overall resistance
-				// (R-value) is all that is needed.
+			} else if ( CTFCalc( ConstrNum ).Method == CTFResistive ) {
 
 				// Set time step for construct to user time step and the number of
 				// inter-time step interpolations to 1
@@ -1081,98 +769,127 @@ namespace ConductionTransferFunctionCalc {
 				Construct( ConstrNum ).NumHistories = 1;
 				Construct( ConstrNum ).NumCTFTerms = 1;
 
-				s0( 1, 1 ) = cnd; // CTFs for current time
-				s0( 1, 2 ) = -cnd; // step are set to the
-				s0( 2, 1 ) = cnd; // overall conductance
-				s0( 2, 2 ) = -cnd; // of the construction.
-
-				e.allocate( 1 );
-				e = 0.0;
-				s.allocate( 1, 2, 2 );
-				s = 0.0;
-				s( 1, 1, 1 ) = 0.0; // CTF temperature
-				s( 1, 1, 2 ) = 0.0; // and flux
-				s( 1, 2, 1 ) = 0.0; // history terms
-				s( 1, 2, 2 ) = 0.0; // are all
-				e( 1 ) = 0.0; // zero.
+				cnd = CTFCalc( ConstrNum ).cnd;
+				CTFCalc( ConstrNum ).s0( 1, 1 ) = cnd; // CTFs for current time
+				CTFCalc( ConstrNum ).s0( 1, 2 ) = -cnd; // step are set to the
+				CTFCalc( ConstrNum ).s0( 2, 1 ) = cnd; // overall conductance
+				CTFCalc( ConstrNum ).s0( 2, 2 ) = -cnd; // of the construction.
 
-				if ( Construct( ConstrNum ).SourceSinkPresent ) {
-					ShowSevereError( "Sources/sinks not allowed in purely resistive constructions --> " + Construct( ConstrNum ).Name );
-					ErrorsFound = true;
+				CTFCalc( ConstrNum ).e.allocate( 1 );
+				CTFCalc( ConstrNum ).e = 0.0;
+				CTFCalc( ConstrNum ).s.allocate( 1, 2, 2 );
+				CTFCalc( ConstrNum ).s = 0.0;
+				CTFCalc( ConstrNum ).s( 1, 1, 1 ) = 0.0; // CTF temperature
+				CTFCalc( ConstrNum ).s( 1, 1, 2 ) = 0.0; // and flux
+				CTFCalc( ConstrNum ).s( 1, 2, 1 ) = 0.0; // history terms
+				CTFCalc( ConstrNum ).s( 1, 2, 2 ) = 0.0; // are all
+				CTFCalc( ConstrNum ).e( 1 ) = 0.0; // zero.
+
+			} else { // CTFs from the state space method
+
+				DisplayNumberAndString( ConstrNum, "Calculating CTFs for \"" + Construct( ConstrNum ).Name + "\", Construction #" );
+
+				if ( CTFCalc( ConstrNum ).NoCTFs ) { // Something terribly wrong--the surface has no CTFs, not even an R-value
+					ShowFatalError( "Illegal construction definition, no CTFs calculated for " + Construct( ConstrNum ).Name );
 				}
 
-				RevConst = false; // In the code that follows, handle a resistive
-				// layer as a non-reversed construction.
+				Construct( ConstrNum ).CTFTimeStep = CTFCalc( ConstrNum ).CTFTimeStep;
+				Construct( ConstrNum ).NumHistories = CTFCalc( ConstrNum ).NumHistories;
+				Construct( ConstrNum ).NumCTFTerms = CTFCalc( ConstrNum ).NumCTFTerms;
+
+				// Once the time step has reached a certain point, it is highly likely that
+				// there is either a problem with the input or the solution.
+				if ( CTFCalc( ConstrNum ).ConvergenceProblem ) {
+					ShowSevereError( "CTF calculation convergence problem for Construction=\"" + Construct( ConstrNum ).Name + "\"." );
+					ShowContinueError( "...with Materials (outside layer to inside)" );
+					ShowContinueError( "(outside)=\"" + Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Name + "\"" );
+					for ( Layer = 2; Layer <= Construct( ConstrNum ).TotLayers; ++Layer ) {
+						if ( Layer != Construct( ConstrNum ).TotLayers ) {
+							ShowContinueError( "(next)=\"" + Material( Construct( ConstrNum ).LayerPoint( Layer ) ).Name + "\"" );
+						} else {
+							ShowContinueError( "(inside)=\"" + Material( Construct( ConstrNum ).LayerPoint( Layer ) ).Name + "\"" );
+						}
+					}
+					ShowContinueError( "The Construction report will be produced. This will show more " "details on Constructions and their materials." );
+					ShowContinueError( "Attempts will be made to complete the CTF process but the report may be incomplete." );
+					ShowContinueError( "Constructs reported after this construction may appear to have all 0 CTFs." );
+					ShowContinueError( "The potential causes of this problem are related to the input for the construction" );
+					ShowContinueError( "listed in the severe error above.  The CTF calculate routine is unable to come up" );
+					ShowContinueError( "with a series of CTF terms that have a reasonable time step and this indicates an" );
+					ShowContinueError( "error.  Check the definition of this construction and the materials that make up" );
+					ShowContinueError( "the construction.  Very thin, highly conductive materials may cause problems." );
+					ShowContinueError( "This may be avoided by ignoring the presence of those materials since they probably" );
+					ShowContinueError( "do not effect the heat transfer characteristics of the construction.  Highly" );
+					ShowContinueError( "conductive or highly resistive layers that are alternated with high mass layers" );
+					ShowContinueError( "may also result in problems.  After confirming that the input is correct and" );
+					ShowContinueError( "realistic, the user should contact the EnergyPlus support team." );
+					DoCTFErrorReport = true;
+					ErrorsFound = true;
+					CTFConvergenceFailed = true;
+				}
 
-			} // ... end of resistive construction IF block.
+			}
 
 			// Transfer the CTFs to the storage arrays for all non-reversed
-			// constructions.  This transfer was done earlier in the routine for
-			// reversed constructions.
+			// constructions.  This transfer was done above for reversed
+			// constructions.
 
-			if ( ! RevConst ) { // If this is either a new construction or a non-
+			if ( CTFCalc( ConstrNum ).Method != CTFReversed ) { // If this is either a new construction or a non-
 				// reversed construction, the CTFs must be stored
 				// in the proper arrays.  If this is a reversed
 				// construction, nothing further needs to be done.
 
 				// Copy the CTFs into the storage arrays, converting them back to SI
 				// units in the process.  First the "zero" terms and then the history terms...
-				Construct( ConstrNum ).CTFOutside( 0 ) = s0( 1, 1 ) * CFU;
-				Construct( ConstrNum ).CTFCross( 0 ) = s0( 2, 1 ) * CFU;
-				Construct( ConstrNum ).CTFInside( 0 ) = -s0( 2, 2 ) * CFU;
+				Construct( ConstrNum ).CTFOutside( 0 ) = CTFCalc( ConstrNum ).s0( 1, 1 ) * CFU;
+				Construct( ConstrNum ).CTFCross( 0 ) = CTFCalc( ConstrNum ).s0( 2, 1 ) * CFU;
+				Construct( ConstrNum ).CTFInside( 0 ) = -CTFCalc( ConstrNum ).s0( 2, 2 ) * CFU;
 				if ( Construct( ConstrNum ).SourceSinkPresent ) {
 					// QTFs...
-					Construct( ConstrNum ).CTFSourceOut( 0 ) = s0( 1, 3 );
-					Construct( ConstrNum ).CTFSourceIn( 0 ) = s0( 2, 3 );
+					Construct( ConstrNum ).CTFSourceOut( 0 ) = CTFCalc( ConstrNum ).s0( 1, 3 );
+					Construct( ConstrNum ).CTFSourceIn( 0 ) = CTFCalc( ConstrNum ).s0( 2, 3 );
 					// QTFs for temperature calculation at source/sink location
-					Construct( ConstrNum ).CTFTSourceOut( 0 ) = s0( 3, 1 );
-					Construct( ConstrNum ).CTFTSourceIn( 0 ) = s0( 3, 2 );
-					Construct( ConstrNum ).CTFTSourceQ( 0 ) = s0( 3, 3 ) / CFU;
+					Construct( ConstrNum ).CTFTSourceOut( 0 ) = CTFCalc( ConstrNum ).s0( 3, 1 );
+					Construct( ConstrNum ).CTFTSourceIn( 0 ) = CTFCalc( ConstrNum ).s0( 3, 2 );
+					Construct( ConstrNum ).CTFTSourceQ( 0 ) = CTFCalc( ConstrNum ).s0( 3, 3 ) / CFU;
 					if ( Construct( ConstrNum ).TempAfterLayer != 0 ) {
 						// QTFs for user specified interior temperature calculations...
-						Construct( ConstrNum ).CTFTUserOut( 0 ) = s0( 4, 1 );
-						Construct( ConstrNum ).CTFTUserIn( 0 ) = s0( 4, 2 );
-						Construct( ConstrNum ).CTFTUserSource( 0 ) = s0( 4, 3 ) / CFU;
+						Construct( ConstrNum ).CTFTUserOut( 0 ) = CTFCalc( ConstrNum ).s0( 4, 1 );
+						Construct( ConstrNum ).CTFTUserIn( 0 ) = CTFCalc( ConstrNum ).s0( 4, 2 );
+						Construct( ConstrNum ).CTFTUserSource( 0 ) = CTFCalc( ConstrNum ).s0( 4, 3 ) / CFU;
 					}
 				}
 
 				for ( HistTerm = 1; HistTerm <= Construct( ConstrNum ).NumCTFTerms; ++HistTerm ) {
 					// "REGULAR" CTFs...
-					Construct( ConstrNum ).CTFOutside( HistTerm ) = s( HistTerm, 1, 1 ) * CFU;
-					Construct( ConstrNum ).CTFCross( HistTerm ) = s( HistTerm, 2, 1 ) * CFU;
-					Construct( ConstrNum ).CTFInside( HistTerm ) = -s( HistTerm, 2, 2 ) * CFU;
-					if ( HistTerm != 0 ) Construct( ConstrNum ).CTFFlux( HistTerm ) = -e( HistTerm );
+					Construct( ConstrNum ).CTFOutside( HistTerm ) = CTFCalc( ConstrNum ).s( HistTerm, 1, 1 ) * CFU;
+					Construct( ConstrNum ).CTFCross( HistTerm ) = CTFCalc( ConstrNum ).s( HistTerm, 2, 1 ) * CFU;
+					Construct( ConstrNum ).CTFInside( HistTerm ) = -CTFCalc( ConstrNum ).s( HistTerm, 2, 2 ) * CFU;
+					if ( HistTerm != 0 ) Construct( ConstrNum ).CTFFlux( HistTerm ) = -CTFCalc( ConstrNum ).e( HistTerm );
 					if ( Construct( ConstrNum ).SourceSinkPresent ) {
 						// QTFs...
-						Construct( ConstrNum ).CTFSourceOut( HistTerm ) = s( HistTerm, 1, 3 );
-						Construct( ConstrNum ).CTFSourceIn( HistTerm ) = s( HistTerm, 2, 3 );
+						Construct( ConstrNum ).CTFSourceOut( HistTerm ) = CTFCalc( ConstrNum ).s( HistTerm, 1, 3 );
+						Construct( ConstrNum ).CTFSourceIn( HistTerm ) = CTFCalc( ConstrNum ).s( HistTerm, 2, 3 );
 						// QTFs for temperature calculation at source/sink location
-						Construct( ConstrNum ).CTFTSourceOut( HistTerm ) = s( HistTerm, 3, 1 );
-						Construct( ConstrNum ).CTFTSourceIn( HistTerm ) = s( HistTerm, 3, 2 );
-						Construct( ConstrNum ).CTFTSourceQ( HistTerm ) = s( HistTerm, 3, 3 ) / CFU;
+						Construct( ConstrNum ).CTFTSourceOut( HistTerm ) = CTFCalc( ConstrNum ).s( HistTerm, 3, 1 );
+						Construct( ConstrNum ).CTFTSourceIn( HistTerm ) = CTFCalc( ConstrNum ).s( HistTerm, 3, 2 );
+						Construct( ConstrNum ).CTFTSourceQ( HistTerm ) = CTFCalc( ConstrNum ).s( HistTerm, 3, 3 ) / CFU;
 						if ( Construct( ConstrNum ).TempAfterLayer != 0 ) {
 							// QTFs for user specified interior temperature calculations...
-							Construct( ConstrNum ).CTFTUserOut( HistTerm ) = s( HistTerm, 4, 1 );
-							Construct( ConstrNum ).CTFTUserIn( HistTerm ) = s( HistTerm, 4, 2 );
-							Construct( ConstrNum ).CTFTUserSource( HistTerm ) = s( HistTerm, 4, 3 ) / CFU;
+							Construct( ConstrNum ).CTFTUserOut( HistTerm ) = CTFCalc( ConstrNum ).s( HistTerm, 4, 1 );
+							Construct( ConstrNum ).CTFTUserIn( HistTerm ) = CTFCalc( ConstrNum ).s( HistTerm, 4, 2 );
+							Construct( ConstrNum ).CTFTUserSource( HistTerm ) = CTFCalc( ConstrNum ).s( HistTerm, 4, 3 ) / CFU;
 						}
 					}
 				}
 
 			} // ... end of the reversed construction IF block.
 
-			Construct( ConstrNum ).UValue = cnd * CFU;
+			Construct( ConstrNum ).UValue = CTFCalc( ConstrNum ).cnd * CFU;
 
-			if ( allocated( AExp ) ) AExp.deallocate();
-			if ( allocated( AMat ) ) AMat.deallocate();
-			if ( allocated( AInv ) ) AInv.deallocate();
-			if ( allocated( IdenMatrix ) ) IdenMatrix.deallocate();
-			if ( allocated( e ) ) e.deallocate();
-			if ( allocated( Gamma1 ) ) Gamma1.deallocate();
-			if ( allocated( Gamma2 ) ) Gamma2.deallocate();
-			if ( allocated( s ) ) s.deallocate();
+		} // ... end of CTF storage loop.
 
-		} // ... end of construction loop.
+		if ( DeveloperFlag ) WriteCTFCalcTimes( CTFCalc, NumThreads, CalcTime );
 
 		ReportCTFs( DoCTFErrorReport );
 
@@ -1183,13 +900,467 @@ namespace ConductionTransferFunctionCalc {
 	}
 
 	void
-	CalculateExponentialMatrix( Real64 & delt ) // Time step of the resulting CTFs
+	CalculateConstructionCTFs( CTFCalcData & Calc ) // CTF calculation of one construction
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Russ Taylor
+		//       DATE WRITTEN   June 1990
+		//       MODIFIED       October 2014, moved out of InitConductionTransferFunctions
+		//       RE-ENGINEERED  June 1996, February 1997, August-October 1997, RKS; Nov 1999, LKL
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine calculates the CTFs of one construction with the
+		// state space method, increasing the CTF time step until the CTFs
+		// produce a stable solution.
+
+		// METHODOLOGY EMPLOYED:
+		// All of the state of the calculation (layer properties, matrices and
+		// the resulting CTFs) is kept in Calc, so that the constructions can be
+		// calculated at the same time on several threads.  Nothing is written to
+		// the construction data and no messages are issued here; problems are
+		// flagged in Calc and reported by InitConductionTransferFunctions in
+		// construction order.
+
+		// REFERENCES:
+		// Seem, J.E.  "Modeling of Heat Transfer in Buildings",
+		//  Department of Mechanical Engineering, University of
+		//  Wisconsin-Madison, 1987.
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const MaxAllowedCTFSumError( 0.01 ); // Allow a 1 percent
+		// difference between the CTF series summations.  If the difference is
+		// greater than this, then the coefficients will not yield a valid steady
+		// state solution.
+
+		Real64 const MaxAllowedTimeStep( 4.0 ); // Sets the maximum allowed time step
+		// for CTF calculations to be 4 hours.  This is done in response to some
+		// rare situations where odd or faulty input will cause the routine to
+		// go off and get some huge time step (in excess of 20 hours).  This value
+		// is a compromise that does not really solve any input problems.  One run
+		// indicated that 2 meters of concrete will result in a time step of slightly
+		// more than 3 hours.  So, 4 hours was arbitrarily picked as a ceiling for
+		// time steps so that an error message can be produced to warn the user
+		// that something isn't right.  Note that the 4 hour limit does not guarantee
+		// that problems won't exist and it does not necessarily avoid any problems
+		// that interpolated temperature histories might cause.
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 amatx; // Intermediate calculation variable
+		Real64 amatxx; // Intermediate calculation variable
+		Real64 amaty; // Intermediate calculation variable
+		Real64 BiggestSum; // Largest CTF series summation (maximum of SumXi, SumYi, and SumZi)
+		Real64 cap; // Thermal capacitance of a node (intermediate calculation)
+		Real64 capavg; // Thermal capacitance of a node (average value for a node at an interface)
+		bool CTFConvrg; // Set after CTFs are calculated, based on whether there are too
+		// many CTF terms
+		Real64 dxtmp; // Intermediate calculation variable ( = 1/dx/cap)
+		int HistTerm; // Loop counter
+		int ir; // Loop control for constructing Identity Matrix
+		int Layer; // Loop counter
+		int Node; // Loop counter
+		int Node2; // Node number (modification of Node and NodeInRow)
+		int NodeInLayer; // Loop counter
+		int NodeInRow; // Loop counter
+		Real64 SumXi; // Summation of all of the Xi terms (inside CTFs) for a construction
+		Real64 SumYi; // Summation of all of the Xi terms (cross CTFs) for a construction
+		Real64 SumZi; // Summation of all of the Xi terms (outside CTFs) for a construction
+		int const LayersInConstruct( Calc.LayersInConstruct ); // Number of layers in the construct
+		int const rcmax( Calc.rcmax ); // Total number of nodes in the construct
+		int const NodeSource( Calc.NodeSource ); // Node at which a source or sink is present
+		Real64 const dyn( Calc.dyn ); // Nodal spacing in the direction perpendicular to the main direction
+		// of heat transfer (only valid for a 2-D solution)
+		FArray1D_int const & Nodes( Calc.Nodes ); // Number of nodes per layer
+		FArray1D< Real64 > const & cp( Calc.cp ); // Specific heat of a material layer
+		FArray1D< Real64 > const & dx( Calc.dx ); // Distance between nodes in a particular material layer
+		FArray1D< Real64 > const & rho( Calc.rho ); // Density of a material layer
+		FArray1D< Real64 > const & rk( Calc.rk ); // Thermal conductivity of a material layer
+		FArray2D< Real64 > & AExp( Calc.AExp ); // Exponential of AMat
+		FArray2D< Real64 > & AInv( Calc.AInv ); // Inverse of AMat
+		FArray2D< Real64 > & AMat( Calc.AMat ); // "A" matrix from Seem's dissertation
+		FArray1D< Real64 > & BMat( Calc.BMat ); // "B" matrix of state space method (non-zero elements)
+		FArray1D< Real64 > & CMat( Calc.CMat ); // "C" matrix of state space method (non-zero elements)
+		FArray1D< Real64 > & DMat( Calc.DMat ); // "D" matrix of state space method (non-zero elements)
+		FArray1D< Real64 > & e( Calc.e ); // Coefficients for the surface flux history term
+		FArray2D< Real64 > & Gamma1( Calc.Gamma1 ); // Intermediate calculation array (Seem's dissertation)
+		FArray2D< Real64 > & Gamma2( Calc.Gamma2 ); // Intermediate calculation array (Seem's dissertation)
+		FArray3D< Real64 > & s( Calc.s ); // Coefficients for the surface temperature history terms
+		FArray2D< Real64 > const & s0( Calc.s0 ); // Coefficients for the current surface temperature terms
+		FArray2D< Real64 > & IdenMatrix( Calc.IdenMatrix ); // Identity Matrix
+
+		// FLOW:
+		Calc.NumPasses = 0;
+		Calc.NoCTFs = false;
+		Calc.ConvergenceProblem = false;
+
+		// Calculate the CTFs using the state space method
+		// outlined in Seem's dissertation.  The main matrices
+		// AMat, BMat, CMat, and DMat must be derived from
+		// applying a finite difference network to the layers of
+		// each bldg element.
+
+		// This section must continue looping until the CTFs
+		// calculated here will produce a stable solution (less
+		// history terms than MaxCTFTerms).
+
+		// This first subsection calculates the elements of AMat
+		// which characterizes the heat transfer inside the
+		// building element.
+
+		CTFConvrg = false; // Initialize loop control logical
+
+		AExp.allocate( rcmax, rcmax );
+		AExp = 0.0;
+		AMat.allocate( rcmax, rcmax );
+		AMat = 0.0;
+		AInv.allocate( rcmax, rcmax );
+		AInv = 0.0;
+		IdenMatrix.allocate( rcmax, rcmax );
+		IdenMatrix = 0.0;
+		for ( ir = 1; ir <= rcmax; ++ir ) {
+			IdenMatrix( ir, ir ) = 1.0;
+		}
+		e.allocate( rcmax );
+		e = 0.0;
+		Gamma1.allocate( rcmax, 3 );
+		Gamma1 = 0.0;
+		Gamma2.allocate( rcmax, 3 );
+		Gamma2 = 0.0;
+		s.allocate( rcmax, 4, 3 );
+		s = 0.0;
+
+		while ( ! CTFConvrg ) { // Begin CTF calculation loop ...
+
+			BMat( 3 ) = 0.0;
+
+			if ( Calc.SolutionDimensions == 1 ) {
+
+				// Set up intermediate calculations for the first layer.
+				cap = rho( 1 ) * cp( 1 ) * dx( 1 );
+				cap *= 1.5; // For the first node, account for the fact that the
+				// half-node at the surface results in a "loss" of some
+				// thermal mass.  Therefore, for simplicity, include it
+				// at this node.  Same thing done at the last node...
+				dxtmp = 1.0 / dx( 1 ) / cap;
+
+				AMat( 1, 1 ) = -2.0 * rk( 1 ) * dxtmp; // Assign the matrix values for the
+				AMat( 1, 2 ) = rk( 1 ) * dxtmp; // first node.
+				BMat( 1 ) = rk( 1 ) * dxtmp; // Assign non-zero value of BMat.
+
+				Layer = 1; // Initialize the "layer" counter
+
+				NodeInLayer = 2; // Initialize the node (in a layer) counter (already
+				// on the second node for the first layer
+
+				for ( Node = 2; Node <= rcmax - 1; ++Node ) { // Begin nodes loop (includes all nodes except the
+					// first/last which have special equations) ...
+
+					if ( ( NodeInLayer == Nodes( Layer ) ) && ( LayersInConstruct != 1 ) ) { // For a node at
+						// the interface between two adjacent layers, the
+						// capacitance of the node must be calculated from the 2
+						// halves which may be made up of 2 different materials.
+
+						cap = ( rho( Layer ) * cp( Layer ) * dx( Layer ) + rho( Layer + 1 ) * cp( Layer + 1 ) * dx( Layer + 1 ) ) * 0.5;
+
+						AMat( Node, Node - 1 ) = rk( Layer ) / dx( Layer ) / cap; // Assign matrix
+						AMat( Node, Node ) = -1.0 * ( rk( Layer ) / dx( Layer ) + rk( Layer + 1 ) / dx( Layer + 1 ) ) / cap; // values for | the current
+						AMat( Node, Node + 1 ) = rk( Layer + 1 ) / dx( Layer + 1 ) / cap; // node.
+
+						NodeInLayer = 0; // At an interface, reset nodes in layer counter
+						++Layer; // Also increment the layer counter
+
+					} else { // Standard node within any layer
+
+						cap = rho( Layer ) * cp( Layer ) * dx( Layer ); // Intermediate
+						dxtmp = 1.0 / dx( Layer ) / cap; // calculations.
+						AMat( Node, Node - 1 ) = rk( Layer ) * dxtmp; // Assign matrix
+						AMat( Node, Node ) = -2.0 * rk( Layer ) * dxtmp; // values for the
+						AMat( Node, Node + 1 ) = rk( Layer ) * dxtmp; // current node.
+
+					}
+
+					++NodeInLayer; // Increment nodes in layer counter
+					if ( Node == NodeSource ) BMat( 3 ) = 1.0 / cap;
+
+				} // ... end of nodes loop.
+
+				// Intermediate calculations for the last node.
+				cap = rho( LayersInConstruct ) * cp( LayersInConstruct ) * dx( LayersInConstruct );
+				cap *= 1.5; // For the last node, account for the fact that the
+				// half-node at the surface results in a "loss" of some
+				// thermal mass.  Therefore, for simplicity, include it
+				// at this node.  Same thing done at the first node...
+				dxtmp = 1.0 / dx( LayersInConstruct ) / cap;
+
+				AMat( rcmax, rcmax ) = -2.0 * rk( LayersInConstruct ) * dxtmp; // Assign matrix
+				AMat( rcmax, rcmax - 1 ) = rk( LayersInConstruct ) * dxtmp; // values for the
+				BMat( 2 ) = rk( LayersInConstruct ) * dxtmp; // last node.
+
+				CMat( 1 ) = -rk( 1 ) / dx( 1 ); // Compute the necessary elements
+				CMat( 2 ) = rk( LayersInConstruct ) / dx( LayersInConstruct ); // of all other
+				DMat( 1 ) = rk( 1 ) / dx( 1 ); // matrices for the state
+				DMat( 2 ) = -rk( LayersInConstruct ) / dx( LayersInConstruct ); // space method
+
+			} else { // 2-D solution requested (assign matrices appropriately)
+
+				// As with the 1-D solution, we are accounting for the thermal mass
+				// of the half-node at the surface by adding it to the first row
+				// of interior nodes at both sides of the construction.  This is not
+				// exact, but it does take all of the thermal mass into account.
+				amatx = rk( 1 ) / ( 1.5 * rho( 1 ) * cp( 1 ) * dx( 1 ) * dx( 1 ) );
+				amaty = rk( 1 ) / ( 1.5 * rho( 1 ) * cp( 1 ) * dyn * dyn );
+
+				// FIRST ROW OF NODES: This first row within the first material layer
+				// is special in that it is exposed to a boundary condition.  Thus,
+				// the equations are slightly different.
+				// Note also that the first and last nodes in a row are slightly
+				// different from the rest since they are on an adiabatic plane in
+				// the direction perpendicular to the main direction of heat transfer.
+				AMat( 1, 1 ) = -2.0 * ( amatx + amaty );
+				AMat( 1, 2 ) = 2.0 * amaty;
+				AMat( 1, NumOfPerpendNodes + 1 ) = amatx;
+
+				for ( Node = 2; Node <= NumOfPerpendNodes - 1; ++Node ) {
+					AMat( Node, Node - 1 ) = amaty;
+					AMat( Node, Node ) = -2.0 * ( amatx + amaty );
+					AMat( Node, Node + 1 ) = amaty;
+					AMat( Node, Node + NumOfPerpendNodes ) = amatx;
+				}
+
+				AMat( NumOfPerpendNodes, NumOfPerpendNodes ) = -2.0 * ( amatx + amaty );
+				AMat( NumOfPerpendNodes, NumOfPerpendNodes - 1 ) = 2.0 * amaty;
+				AMat( NumOfPerpendNodes, NumOfPerpendNodes + NumOfPerpendNodes ) = amatx;
+
+				BMat( 1 ) = amatx;
+
+				Layer = 1;
+				NodeInLayer = 2;
+				amatx = rk( 1 ) / ( rho( 1 ) * cp( 1 ) * dx( 1 ) * dx( 1 ) ); // Reset these to the normal capacitance
+				amaty = rk( 1 ) / ( rho( 1 ) * cp( 1 ) * dyn * dyn ); // Reset these to the normal capacitance
+				assert( NumOfPerpendNodes > 0 ); //Autodesk:F2C++ Loop setup assumption
+				int const Node_stop( rcmax + 1 - 2 * NumOfPerpendNodes );
+				for ( Node = NumOfPerpendNodes + 1; Node <= Node_stop; Node += NumOfPerpendNodes ) {
+					// INTERNAL ROWS OF NODES: This is the majority of nodes which are all within
+					// a solid layer and not exposed to a boundary condition.
+					if ( ( LayersInConstruct == 1 ) || ( NodeInLayer != Nodes( Layer ) ) ) {
+						// Single material row: This row of nodes are all contained within a material
+						// and thus there is no special considerations necessary.
+						if ( NodeInLayer == 1 ) {
+							// These intermediate variables only need to be reassigned when a new layer is started.
+							// When this is simply another row of the same material, these have already been assigned correctly.
+							amatx = rk( Layer ) / ( rho( Layer ) * cp( Layer ) * dx( Layer ) * dx( Layer ) );
+							amaty = rk( Layer ) / ( rho( Layer ) * cp( Layer ) * dyn * dyn );
+						}
+
+						// Note that the first and last layers in a row are slightly different
+						// from the rest since they are on an adiabatic plane in the direction
+						// perpendicular to the main direction of heat transfer.
+						AMat( Node, Node ) = -2.0 * ( amatx + amaty );
+						AMat( Node, Node + 1 ) = 2.0 * amaty;
+						AMat( Node, Node - NumOfPerpendNodes ) = amatx;
+						AMat( Node, Node + NumOfPerpendNodes ) = amatx;
+
+						for ( NodeInRow = 2; NodeInRow <= NumOfPerpendNodes - 1; ++NodeInRow ) {
+							Node2 = Node + NodeInRow - 1;
+							AMat( Node2, Node2 - 1 ) = amaty;
+							AMat( Node2, Node2 ) = -2.0 * ( amatx + amaty );
+							AMat( Node2, Node2 + 1 ) = amaty;
+							AMat( Node2, Node2 - NumOfPerpendNodes ) = amatx;
+							AMat( Node2, Node2 + NumOfPerpendNodes ) = amatx;
+						}
+
+						Node2 = Node - 1 + NumOfPerpendNodes;
+						AMat( Node2, Node2 ) = -2.0 * ( amatx + amaty );
+						AMat( Node2, Node2 - 1 ) = 2.0 * amaty;
+						AMat( Node2, Node2 - NumOfPerpendNodes ) = amatx;
+						AMat( Node2, Node2 + NumOfPerpendNodes ) = amatx;
+
+					} else { // Row at a two-layer interface (half of node consists of one layer's materials
+						// and the other half consist of the next layer's materials)
+						capavg = 0.5 * ( rho( Layer ) * cp( Layer ) * dx( Layer ) + rho( Layer + 1 ) * cp( Layer + 1 ) * dx( Layer + 1 ) );
+						amatx = rk( Layer ) / ( capavg * dx( Layer ) );
+						amatxx = rk( Layer + 1 ) / ( capavg * dx( Layer + 1 ) );
+						amaty = ( rk( Layer ) * dx( Layer ) + rk( Layer + 1 ) * dx( Layer + 1 ) ) / ( capavg * dyn * dyn );
+
+						AMat( Node, Node ) = -amatx - amatxx - 2.0 * amaty;
+						AMat( Node, Node + 1 ) = 2.0 * amaty;
+						AMat( Node, Node - NumOfPerpendNodes ) = amatx;
+						AMat( Node, Node + NumOfPerpendNodes ) = amatxx;
+
+						for ( NodeInRow = 2; NodeInRow <= NumOfPerpendNodes - 1; ++NodeInRow ) {
+							Node2 = Node + NodeInRow - 1;
+							AMat( Node2, Node2 - 1 ) = amaty;
+							AMat( Node2, Node2 ) = -amatx - amatxx - 2.0 * amaty;
+							AMat( Node2, Node2 + 1 ) = amaty;
+							AMat( Node2, Node2 - NumOfPerpendNodes ) = amatx;
+							AMat( Node2, Node2 + NumOfPerpendNodes ) = amatxx;
+						}
+
+						Node2 = Node - 1 + NumOfPerpendNodes;
+						AMat( Node2, Node2 ) = -amatx - amatxx - 2.0 * amaty;
+						AMat( Node2, Node2 - 1 ) = 2.0 * amaty;
+						AMat( Node2, Node2 - NumOfPerpendNodes ) = amatx;
+						AMat( Node2, Node2 + NumOfPerpendNodes ) = amatxx;
+
+						if ( Node == NodeSource ) BMat( 3 ) = 2.0 * double( NumOfPerpendNodes - 1 ) / capavg;
+						NodeInLayer = 0;
+						++Layer;
+
+					}
+					++NodeInLayer;
+
+				}
+
+				// LAST ROW OF NODES: Like the first row of nodes, this row is exposed to a boundary
+				// condition and thus has slightly modified nodal equations.
+
+				// As with the 1-D solution, we are accounting for the thermal mass
+				// of the half-node at the surface by adding it to the first row
+				// of interior nodes at both sides of the construction.  This is not
+				// exact, but it does take all of the thermal mass into account.
+				amatx /= 1.5;
+				amaty /= 1.5;
+
+				Node = rcmax + 1 - NumOfPerpendNodes;
+				AMat( Node, Node ) = -2.0 * ( amatx + amaty );
+				AMat( Node, Node + 1 ) = 2.0 * amaty;
+				AMat( Node, Node - NumOfPerpendNodes ) = amatx;
+
+				for ( Node = rcmax + 2 - NumOfPerpendNodes; Node <= rcmax - 1; ++Node ) {
+					AMat( Node, Node - 1 ) = amaty;
+					AMat( Node, Node ) = -2.0 * ( amatx + amaty );
+					AMat( Node, Node + 1 ) = amaty;
+					AMat( Node, Node - NumOfPerpendNodes ) = amatx;
+				}
+
+				AMat( rcmax, rcmax ) = -2.0 * ( amatx + amaty );
+				AMat( rcmax, rcmax - 1 ) = 2.0 * amaty;
+				AMat( rcmax, rcmax - NumOfPerpendNodes ) = amatx;
+
+				BMat( 2 ) = amatx;
+
+				CMat( 1 ) = -rk( 1 ) / dx( 1 ) / double( NumOfPerpendNodes - 1 );
+				CMat( 2 ) = rk( LayersInConstruct ) / dx( LayersInConstruct ) / double( NumOfPerpendNodes - 1 );
+
+				DMat( 1 ) = rk( 1 ) / dx( 1 ) / double( NumOfPerpendNodes - 1 );
+				DMat( 2 ) = -rk( LayersInConstruct ) / dx( LayersInConstruct ) / double( NumOfPerpendNodes - 1 );
+
+			}
+
+			// Calculation of the CTFs based on the state space
+			// method.  This process involves finding the exponential
+			// and inverse of AMat and using these results to
+			// determine the CTFs.  The Gammas are an intermediate
+			// calculations which are necessary before the CTFs can
+			// be computed in TransFuncCoeffs.
+			++Calc.NumPasses;
+
+			//          CALL DisplayNumberAndString(ConstrNum,'Matrix exponential for Construction #')
+			CalculateExponentialMatrix( Calc, Calc.CTFTimeStep ); // Compute exponential of AMat
+
+			//          CALL DisplayNumberAndString(ConstrNum,'Invert Matrix for Construction #')
+			CalculateInverseMatrix( Calc ); // Compute inverse of AMat
+
+			//          CALL DisplayNumberAndString(ConstrNum,'Gamma calculation for Construction #')
+			CalculateGammas( Calc, Calc.CTFTimeStep, Calc.SolutionDimensions );
+			// Compute "gamma"s from AMat, AExp, and AInv
+
+			//          CALL DisplayNumberAndString(ConstrNum,'Compute CTFs for Construction #')
+			CalculateCTFs( Calc, Calc.NumCTFTerms, Calc.SolutionDimensions ); // Compute CTFs
+
+			// Now check to see if the number of transfer functions
+			// is greater than MaxCTFTerms.  If it is, then increase the
+			// time step and the number of history terms and
+			// recalculate.  Whether or not it will be necessary to
+			// recalculate the CTFs is controlled by this DO WHILE
+			// loop and the logical CTFConvrg.
+
+			CTFConvrg = true; // Assume solution convergence
+
+			// If too many terms, then solution did not converge.  Increase the
+			// number of histories and the time step.  Reset CTFConvrg to continue
+			// the DO loop.
+			if ( Calc.NumCTFTerms > ( MaxCTFTerms - 1 ) ) {
+				++Calc.NumHistories;
+				Calc.CTFTimeStep += TimeStepZone;
+				CTFConvrg = false;
+			}
+
+			// If the number of terms is okay, then do a further check on the summation of
+			// the various series summations.  In theory, Sum(Xi) = Sum(Yi) = Sum(Zi).  If
+			// this is not the case, then the terms have not reached a valid solution, and
+			// we need to increase the number of histories and the time step as above.
+			if ( CTFConvrg ) {
+				SumXi = s0( 2, 2 );
+				SumYi = s0( 2, 1 );
+				SumZi = s0( 1, 1 );
+				for ( HistTerm = 1; HistTerm <= Calc.NumCTFTerms; ++HistTerm ) {
+					SumXi += s( HistTerm, 2, 2 );
+					SumYi += s( HistTerm, 2, 1 );
+					SumZi += s( HistTerm, 1, 1 );
+				}
+				SumXi = std::abs( SumXi );
+				SumYi = std::abs( SumYi );
+				SumZi = std::abs( SumZi );
+				BiggestSum = max( SumXi, SumYi, SumZi );
+				if ( BiggestSum > 0.0 ) {
+					if ( ( ( std::abs( SumXi - SumYi ) / BiggestSum ) > MaxAllowedCTFSumError ) || ( ( std::abs( SumZi - SumYi ) / BiggestSum ) > MaxAllowedCTFSumError ) ) {
+						++Calc.NumHistories;
+						Calc.CTFTimeStep += TimeStepZone;
+						CTFConvrg = false;
+					}
+				} else { // Something terribly wrong--the surface has no CTFs, not even an R-value
+					Calc.NoCTFs = true; // Fatal error issued by InitConductionTransferFunctions
+					return;
+				}
+			}
+
+			// Once the time step has reached a certain point, it is highly likely that
+			// there is either a problem with the input or the solution.  This should
+			// be extremely rare since other checks should flag most bad user input.
+			// Thus, if the time step reaches a certain point, error out and let the
+			// user know that something needs to be checked in the input file.
+			if ( Calc.CTFTimeStep >= MaxAllowedTimeStep ) {
+				Calc.ConvergenceProblem = true; // Reported by InitConductionTransferFunctions
+				break;
+			}
+
+		} // ... end of CTF calculation loop.
+
+		// The matrices are only needed while the CTFs are calculated
+		AExp.deallocate();
+		AMat.deallocate();
+		AInv.deallocate();
+		IdenMatrix.deallocate();
+		Gamma1.deallocate();
+		Gamma2.deallocate();
+
+	}
+
+	void
+	CalculateExponentialMatrix(
+		CTFCalcData & Calc, // CTF calculation of one construction
+		Real64 & delt // Time step of the resulting CTFs
+	)
 	{
 
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Russ Taylor
 		//       DATE WRITTEN   June 1990
 		//       MODIFIED       Dec 1995, Apr 1996, RKS; June 2000 RKS
+		//                      October 2014, matrices passed in Calc
 		//       RE-ENGINEERED  June 1996, RKS; Nov 1999, LKL;
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1272,6 +1443,10 @@ namespace ConductionTransferFunctionCalc {
 		// when exponential calculation loop can be exited (i.e.
 		// the significant figure limit for REAL(r64)
 		// variables reached)
+		int const rcmax( Calc.rcmax ); // Total number of nodes in the construct
+		FArray2D< Real64 > & AExp( Calc.AExp ); // Exponential of AMat
+		FArray2D< Real64 > const & AMat( Calc.AMat ); // "A" matrix from Seem's dissertation
+		FArray2D< Real64 > const & IdenMatrix( Calc.IdenMatrix ); // Identity Matrix
 
 		// FLOW:
 		AMat1.allocate( rcmax, rcmax );
@@ -1451,13 +1626,14 @@ namespace ConductionTransferFunctionCalc {
 	}
 
 	void
-	CalculateInverseMatrix()
+	CalculateInverseMatrix( CTFCalcData & Calc ) // CTF calculation of one construction
 	{
 
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Rick Strand
 		//       DATE WRITTEN   Dec 1995
 		//       MODIFIED       June 2000 RKS (made routine generic to allow for 2-D solutions)
+		//                      October 2014, matrices passed in Calc
 		//       RE-ENGINEERED  June 1996, February 1997 RKS
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1497,6 +1673,10 @@ namespace ConductionTransferFunctionCalc {
 		int ic; // Loop counter
 		int ir; // Loop counter
 		int irr; // Loop counter
+		int const rcmax( Calc.rcmax ); // Total number of nodes in the construct
+		FArray2D< Real64 > & AInv( Calc.AInv ); // Inverse of AMat
+		FArray2D< Real64 > const & AMat( Calc.AMat ); // "A" matrix from Seem's dissertation
+		FArray2D< Real64 > const & IdenMatrix( Calc.IdenMatrix ); // Identity Matrix
 
 		// FLOW:
 
@@ -1596,6 +1776,7 @@ namespace ConductionTransferFunctionCalc {
 
 	void
 	CalculateGammas(
+		CTFCalcData & Calc, // CTF calculation of one construction
 		Real64 const delt, // Time increment in fraction of an hour
 		int const SolutionDimensions // Integer relating whether a 1- or 2-D solution is required
 	)
@@ -1604,7 +1785,7 @@ namespace ConductionTransferFunctionCalc {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Russ Taylor
 		//       DATE WRITTEN   June 1990
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, matrices passed in Calc
 		//       RE-ENGINEERED  July 1996, RKS
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1646,6 +1827,14 @@ namespace ConductionTransferFunctionCalc {
 		int is1; // Loop counter
 		int j; // Loop counter
 		int SurfNode; // Loop counter
+		int const rcmax( Calc.rcmax ); // Total number of nodes in the construct
+		int const NodeSource( Calc.NodeSource ); // Node at which a source or sink is present
+		FArray2D< Real64 > const & AExp( Calc.AExp ); // Exponential of AMat
+		FArray2D< Real64 > const & AInv( Calc.AInv ); // Inverse of AMat
+		FArray1D< Real64 > const & BMat( Calc.BMat ); // "B" matrix of state space method (non-zero elements)
+		FArray2D< Real64 > & Gamma1( Calc.Gamma1 ); // Intermediate calculation array (Seem's dissertation)
+		FArray2D< Real64 > & Gamma2( Calc.Gamma2 ); // Intermediate calculation array (Seem's dissertation)
+		FArray2D< Real64 > const & IdenMatrix( Calc.IdenMatrix ); // Identity Matrix
 
 		// FLOW:
 
@@ -1723,6 +1912,7 @@ namespace ConductionTransferFunctionCalc {
 
 	void
 	CalculateCTFs(
+		CTFCalcData & Calc, // CTF calculation of one construction
 		int & nrf, // Number of response factor terms
 		int const SolutionDimensions // Integer relating whether a 1- or 2-D solution is required
 	)
@@ -1732,6 +1922,7 @@ namespace ConductionTransferFunctionCalc {
 		//       AUTHOR         Russ Taylor
 		//       DATE WRITTEN   June 1990
 		//       MODIFIED       Apr 96, RKS, cosmetic, algorithm neutral changes
+		//                      October 2014, matrices passed in Calc
 		//       RE-ENGINEERED  July 1996, RKS; Nov 1999, LKL (allocatable arrays)
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1795,6 +1986,18 @@ namespace ConductionTransferFunctionCalc {
 		int SurfNode; // Loop counter (for nodes at a surface)
 		Real64 SurfNodeFac; // Multiplying factor applied to various surface nodes
 		Real64 trace; // Trace of the product of Phi( = AExp) and R0
+		int const rcmax( Calc.rcmax ); // Total number of nodes in the construct
+		int const NodeSource( Calc.NodeSource ); // Node at which a source or sink is present
+		int const NodeUserTemp( Calc.NodeUserTemp ); // Node where user wishes to calculate a temperature
+		FArray2D< Real64 > const & AExp( Calc.AExp ); // Exponential of AMat
+		FArray1D< Real64 > const & CMat( Calc.CMat ); // "C" matrix of state space method (non-zero elements)
+		FArray1D< Real64 > const & DMat( Calc.DMat ); // "D" matrix of state space method (non-zero elements)
+		FArray1D< Real64 > & e( Calc.e ); // Coefficients for the surface flux history term
+		FArray2D< Real64 > & Gamma1( Calc.Gamma1 ); // Intermediate calculation array (Seem's dissertation)
+		FArray2D< Real64 > const & Gamma2( Calc.Gamma2 ); // Intermediate calculation array (Seem's dissertation)
+		FArray3D< Real64 > & s( Calc.s ); // Coefficients for the surface temperature history terms
+		FArray2D< Real64 > & s0( Calc.s0 ); // Coefficients for the current surface temperature terms
+		FArray2D< Real64 > const & IdenMatrix( Calc.IdenMatrix ); // Identity Matrix
 
 		// FLOW:
 
@@ -2068,6 +2271,69 @@ namespace ConductionTransferFunctionCalc {
 
 	}
 
+	void
+	WriteCTFCalcTimes(
+		FArray1D< CTFCalcData > const & CTFCalc, // CTF calculations by construction
+		int const NumThreads, // Threads used for the state space calculations
+		Real64 const ElapsedTime // Wall clock time of the parallel state space calculations (s)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the time taken by the state space calculation of each construction
+		// to the audit file (DeveloperFlag only).
+
+		// METHODOLOGY EMPLOYED:
+		// The sum of the construction times compared with the elapsed time shows how
+		// well the constructions were spread over the threads.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+		using General::TrimSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int AuditFile; // found unit number for "eplusout.audit"
+		int ConstrNum; // Loop counter
+		int NumCalcs; // Number of constructions calculated with the state space method
+		Real64 SumTime; // Sum of the construction times (s)
+
+		AuditFile = FindUnitNumber( "eplusout.audit" );
+
+		gio::write( AuditFile, fmtA ) << "CTF Calculation Time,Construction Name,Construction #,#Nodes,#CTF Terms,#Passes,Time {s}";
+		NumCalcs = 0;
+		SumTime = 0.0;
+		for ( ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) {
+			if ( CTFCalc( ConstrNum ).Method != CTFStateSpace ) continue;
+			gio::write( AuditFile, fmtA ) << "CTF Calculation Time," + Construct( ConstrNum ).Name + ',' + TrimSigDigits( ConstrNum ) + ',' + TrimSigDigits( CTFCalc( ConstrNum ).rcmax ) + ',' + TrimSigDigits( CTFCalc( ConstrNum ).NumCTFTerms ) + ',' + TrimSigDigits( CTFCalc( ConstrNum ).NumPasses ) + ',' + RoundSigDigits( CTFCalc( ConstrNum ).CalcTime, 4 );
+			++NumCalcs;
+			SumTime += CTFCalc( ConstrNum ).CalcTime;
+		}
+		gio::write( AuditFile, fmtA ) << "CTF Calculation Summary,#Constructions,#Threads,Sum of Construction Times {s},Elapsed Time {s}";
+		gio::write( AuditFile, fmtA ) << "CTF Calculation Summary," + TrimSigDigits( NumCalcs ) + ',' + TrimSigDigits( NumThreads ) + ',' + RoundSigDigits( SumTime, 4 ) + ',' + RoundSigDigits( ElapsedTime, 4 );
+
+	}
+
 	void
 	ReportCTFs( bool const DoReportBecauseError )
 	{
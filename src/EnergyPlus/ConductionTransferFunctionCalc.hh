@@ -24,6 +24,12 @@ namespace ConductionTransferFunctionCalc {
 	// when a two-dimensional solution has been requested for a construction
 	// with a heat source/sink.
 
+	// How the CTFs of a construction are obtained
+	extern int const CTFNotCalculated; // Window, or construction skipped after an input error
+	extern int const CTFResistive; // Resistive layers only, CTFs from the overall conductance
+	extern int const CTFReversed; // Reverse of an earlier construction, CTFs copied from it
+	extern int const CTFStateSpace; // CTFs calculated with the state space method
+
 	// DERIVED TYPE DEFINITIONS
 	// na
 
@@ -31,52 +37,117 @@ namespace ConductionTransferFunctionCalc {
 	// na
 
 	// MODULE VARIABLE DECLARATIONS:
-	extern FArray2D< Real64 > AExp; // Exponential of AMat
-	extern FArray2D< Real64 > AInv; // Inverse of AMat
-	extern FArray2D< Real64 > AMat; // "A" matrix from Seem's dissertation
-	// (constant coefficients of linear system)
-	extern FArray1D< Real64 > BMat; // "B" matrix of state space method (non-zero elements)
-	extern FArray1D< Real64 > CMat; // "C" matrix of state space method (non-zero elements)
-	extern FArray1D< Real64 > DMat; // "D" matrix of state space method (non-zero elements)
-	extern FArray1D< Real64 > e; // Coefficients for the surface flux history term
-	extern FArray2D< Real64 > Gamma1; // Intermediate calculation array corresponding to a term
-	// in Seem's dissertation
-	extern FArray2D< Real64 > Gamma2; // Intermediate calculation array corresponding to a term
-	// in Seem's dissertation
-	extern int NodeSource; // Node at which a source or sink is present
-	extern int NodeUserTemp; // Node where user wishes to calculate a temperature
-	// (for constructions with sources/sinks only)
-	extern int rcmax; // Total number of nodes in the construct (<= MaxTotNodes)
-	extern FArray3D< Real64 > s; // Coefficients for the surface temperature history terms
-	extern FArray2D< Real64 > s0; // Coefficients for the current surface temperature terms
 	extern Real64 TinyLimit;
-	extern FArray2D< Real64 > IdenMatrix; // Identity Matrix
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ConductionTransferFunctionCalc
 
+	// Types
+
+	struct CTFCalcData
+	{
+		// Members
+		int Method; // How the CTFs are obtained (CTFNotCalculated, CTFResistive, CTFReversed, CTFStateSpace)
+		int RevConstrNum; // Construction this one is the reverse of (CTFReversed)
+		Real64 cnd; // Total thermal conductance (1/Rtot) of the bldg element
+		int SolutionDimensions; // 1- or 2-D solution
+		int LayersInConstruct; // Number of layers after combining adjacent resistive layers
+		FArray1D_int Nodes; // Number of nodes per layer
+		FArray1D< Real64 > dx; // Distance between nodes in a layer
+		FArray1D< Real64 > rk; // Thermal conductivity of a layer
+		FArray1D< Real64 > rho; // Density of a layer
+		FArray1D< Real64 > cp; // Specific heat of a layer
+		Real64 dyn; // Nodal spacing perpendicular to the main direction of heat transfer (2-D only)
+		int rcmax; // Total number of nodes in the construct
+		int NodeSource; // Node at which a source or sink is present
+		int NodeUserTemp; // Node where user wishes to calculate a temperature
+		// (for constructions with sources/sinks only)
+		FArray2D< Real64 > AExp; // Exponential of AMat
+		FArray2D< Real64 > AInv; // Inverse of AMat
+		FArray2D< Real64 > AMat; // "A" matrix from Seem's dissertation
+		// (constant coefficients of linear system)
+		FArray1D< Real64 > BMat; // "B" matrix of state space method (non-zero elements)
+		FArray1D< Real64 > CMat; // "C" matrix of state space method (non-zero elements)
+		FArray1D< Real64 > DMat; // "D" matrix of state space method (non-zero elements)
+		FArray1D< Real64 > e; // Coefficients for the surface flux history term
+		FArray2D< Real64 > Gamma1; // Intermediate calculation array corresponding to a term
+		// in Seem's dissertation
+		FArray2D< Real64 > Gamma2; // Intermediate calculation array corresponding to a term
+		// in Seem's dissertation
+		FArray3D< Real64 > s; // Coefficients for the surface temperature history terms
+		FArray2D< Real64 > s0; // Coefficients for the current surface temperature terms
+		FArray2D< Real64 > IdenMatrix; // Identity Matrix
+		Real64 CTFTimeStep; // Time step of the CTFs (hr)
+		int NumHistories; // Number of zone time steps per CTF time step
+		int NumCTFTerms; // Number of CTF history terms
+		int NumPasses; // Number of times the CTFs were calculated before they converged
+		bool NoCTFs; // True if the calculation produced no CTFs at all
+		bool ConvergenceProblem; // True if the CTF time step reached its limit without converging
+		Real64 CalcTime; // Wall clock time of the state space calculation (s)
+
+		// Default Constructor
+		CTFCalcData() :
+			Method( 0 ),
+			RevConstrNum( 0 ),
+			cnd( 0.0 ),
+			SolutionDimensions( 1 ),
+			LayersInConstruct( 0 ),
+			dyn( 0.0 ),
+			rcmax( 0 ),
+			NodeSource( 0 ),
+			NodeUserTemp( 0 ),
+			BMat( 3, 0.0 ),
+			CMat( 2, 0.0 ),
+			DMat( 2, 0.0 ),
+			s0( 4, 3, 0.0 ),
+			CTFTimeStep( 0.0 ),
+			NumHistories( 0 ),
+			NumCTFTerms( 0 ),
+			NumPasses( 0 ),
+			NoCTFs( false ),
+			ConvergenceProblem( false ),
+			CalcTime( 0.0 )
+		{}
+
+	};
+
 	// Functions
 
 	void
 	InitConductionTransferFunctions();
 
 	void
-	CalculateExponentialMatrix( Real64 & delt ); // Time step of the resulting CTFs
+	CalculateConstructionCTFs( CTFCalcData & Calc ); // CTF calculation of one construction
+
+	void
+	CalculateExponentialMatrix(
+		CTFCalcData & Calc, // CTF calculation of one construction
+		Real64 & delt // Time step of the resulting CTFs
+	);
 
 	void
-	CalculateInverseMatrix();
+	CalculateInverseMatrix( CTFCalcData & Calc ); // CTF calculation of one construction
 
 	void
 	CalculateGammas(
+		CTFCalcData & Calc, // CTF calculation of one construction
 		Real64 const delt, // Time increment in fraction of an hour
 		int const SolutionDimensions // Integer relating whether a 1- or 2-D solution is required
 	);
 
 	void
 	CalculateCTFs(
+		CTFCalcData & Calc, // CTF calculation of one construction
 		int & nrf, // Number of response factor terms
 		int const SolutionDimensions // Integer relating whether a 1- or 2-D solution is required
 	);
 
+	void
+	WriteCTFCalcTimes(
+		FArray1D< CTFCalcData > const & CTFCalc, // CTF calculations by construction
+		int const NumThreads, // Threads used for the state space calculations
+		Real64 const ElapsedTime // Wall clock time of the parallel state space calculations (s)
+	);
+
 	void
 	ReportCTFs( bool const DoReportBecauseError );
 
@@ -223,6 +223,8 @@ namespace DataBSDFWindow {
 		//otherwise in range 1..NBasis
 		FArray2D< Real64 > ThetaBm; // Theta angle corresponging to beam dir (hour, timestep) (rad)
 		FArray2D< Real64 > PhiBm; // Theta angle corresponging to beam dir (hour, timestep) (rad)
+		int GndPtSourceState; // Earlier state of the window with the same ground points (0 = none);
+		//SolBmGndWt is copied from that state instead of being traced again
 		BasisStruct Trn;
 		FArray1D< Vector > sTrn; // Central direction vectors of Outgoing grid (World coords)
 		FArray1D< BSDFDaylghtPosition > pTrn; // azimuth and altitude of incidence vectors
@@ -239,6 +241,7 @@ namespace DataBSDFWindow {
 
 		// Default Constructor
 		BSDFGeomDescr() :
+			GndPtSourceState( 0 ),
 			InitState( true )
 		{}
 
@@ -268,6 +271,7 @@ namespace DataBSDFWindow {
 			FArray2_int const & SolBmIndex, // Basis index corresponding to beam dir (hour, timestep)
 			FArray2< Real64 > const & ThetaBm, // Theta angle corresponging to beam dir (hour, timestep) (rad)
 			FArray2< Real64 > const & PhiBm, // Theta angle corresponging to beam dir (hour, timestep) (rad)
+			int const GndPtSourceState, // Earlier state of the window with the same ground points (0 = none)
 			BasisStruct const & Trn,
 			FArray1< Vector > const & sTrn, // Central direction vectors of Outgoing grid (World coords)
 			FArray1< BSDFDaylghtPosition > const & pTrn, // azimuth and altitude of incidence vectors
@@ -303,6 +307,7 @@ namespace DataBSDFWindow {
 			SolBmIndex( SolBmIndex ),
 			ThetaBm( ThetaBm ),
 			PhiBm( PhiBm ),
+			GndPtSourceState( GndPtSourceState ),
 			Trn( Trn ),
 			sTrn( sTrn ),
 			pTrn( pTrn ),
@@ -469,6 +474,10 @@ namespace DataBSDFWindow {
 		FArray1D< Real64 > IntegratedBkAbs; // Sum of all back layer absorptances (for each back direction)
 		FArray1D< Real64 > IntegratedBkRefl; // Integrated back layer reflectance (for each back direction)
 		FArray1D< Real64 > IntegratedBkTrans; // Integrated back layer transmittance (for each back direction)
+		// Beam values for each basis direction, so that the hourly beam properties are looked up rather than summed
+		FArray1D< Real64 > FtDirHemiTrans; // Front directional-hemispherical transmittance (for each incident direction)
+		FArray2D< Real64 > FtBmToSurfTrans; // Front beam transmittance to back surface (bk surf no, incident direction)
+		FArray1D< Real64 > BkDirHemiRefl; // Back directional-hemispherical reflectance (for each back direction)
 
 		// Default Constructor
 		BSDFStateDescr() :
@@ -506,7 +515,10 @@ namespace DataBSDFWindow {
 			FArray1< Real64 > const & IntegratedFtTrans, // Integrated back layer transmittance (for each back direction)
 			FArray1< Real64 > const & IntegratedBkAbs, // Sum of all back layer absorptances (for each back direction)
 			FArray1< Real64 > const & IntegratedBkRefl, // Integrated back layer reflectance (for each back direction)
-			FArray1< Real64 > const & IntegratedBkTrans // Integrated back layer transmittance (for each back direction)
+			FArray1< Real64 > const & IntegratedBkTrans, // Integrated back layer transmittance (for each back direction)
+			FArray1< Real64 > const & FtDirHemiTrans, // Front directional-hemispherical transmittance (for each incident direction)
+			FArray2< Real64 > const & FtBmToSurfTrans, // Front beam transmittance to back surface (bk surf no, incident direction)
+			FArray1< Real64 > const & BkDirHemiRefl // Back directional-hemispherical reflectance (for each back direction)
 		) :
 			Konst( Konst ),
 			WinDiffTrans( WinDiffTrans ),
@@ -532,7 +544,10 @@ namespace DataBSDFWindow {
 			IntegratedFtTrans( IntegratedFtTrans ),
 			IntegratedBkAbs( IntegratedBkAbs ),
 			IntegratedBkRefl( IntegratedBkRefl ),
-			IntegratedBkTrans( IntegratedBkTrans )
+			IntegratedBkTrans( IntegratedBkTrans ),
+			FtDirHemiTrans( FtDirHemiTrans ),
+			FtBmToSurfTrans( FtBmToSurfTrans ),
+			BkDirHemiRefl( BkDirHemiRefl )
 		{}
 
 	};
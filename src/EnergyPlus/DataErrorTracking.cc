@@ -69,6 +69,7 @@ namespace DataErrorTracking {
 	FArray1D_int MatchCounts( SearchCounts, 0 );
 	bool AbortProcessing( false ); // Flag used to if currently in "abort processing"
 	int NumRecurringErrors( 0 ); // Number of stored recurring error messages
+	bool MergedRecurringErrors( false ); // True once recurring errors of zone sizing workers were added
 	int TotalSevereErrors( 0 ); // Counter
 	int TotalWarningErrors( 0 ); // Counter
 	int TotalSevereErrorsDuringWarmup( 0 ); // Counter
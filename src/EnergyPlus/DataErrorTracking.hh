@@ -52,6 +52,7 @@ namespace DataErrorTracking {
 	extern FArray1D_int MatchCounts;
 	extern bool AbortProcessing; // Flag used to if currently in "abort processing"
 	extern int NumRecurringErrors; // Number of stored recurring error messages
+	extern bool MergedRecurringErrors; // True once recurring errors of zone sizing workers were added
 	extern int TotalSevereErrors; // Counter
 	extern int TotalWarningErrors; // Counter
 	extern int TotalSevereErrorsDuringWarmup; // Counter
@@ -88,6 +88,9 @@ namespace DataRootFinder {
 	// MODULE VARIABLE DECLARATIONS:
 	// na
 
+	// Object Data
+	std::vector< RootSolverCallerType > RootSolverCaller; // Indexed by the value from RegisterRootSolverCaller - 1
+
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
@@ -1,6 +1,10 @@
 #ifndef DataRootFinder_hh_INCLUDED
 #define DataRootFinder_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 
@@ -193,6 +197,58 @@ namespace DataRootFinder {
 
 	};
 
+	struct RootSolverHintType // Warm start for General::SolveRoot, one per solved component quantity
+	{
+		// Members
+		bool Valid; // True once XLast holds a converged solution
+		Real64 XLast; // Last converged solution
+
+		// Default Constructor
+		RootSolverHintType() :
+			Valid( false ),
+			XLast( 0.0 )
+		{}
+
+	};
+
+	struct RootSolverCallerType // Work counters for one General::SolveRoot call site
+	{
+		// Members
+		std::string Name; // Call site name as registered
+		Int64 NumSolves; // Number of calls to SolveRoot
+		Int64 NumResidualCalls; // Number of residual evaluations, including the bracket end points
+		Int64 NumWarmStarts; // Number of solves that started from a hint inside the bracket
+		Int64 NumWarmStartHits; // Number of warm starts converged by the hint alone
+		Int64 NumNotConverged; // Number of solves returning Flag = -1
+		Int64 NumNotBracketed; // Number of solves returning Flag = -2
+
+		// Default Constructor
+		RootSolverCallerType() :
+			NumSolves( 0 ),
+			NumResidualCalls( 0 ),
+			NumWarmStarts( 0 ),
+			NumWarmStartHits( 0 ),
+			NumNotConverged( 0 ),
+			NumNotBracketed( 0 )
+		{}
+
+		// Member Constructor
+		explicit
+		RootSolverCallerType( std::string const & Name ) :
+			Name( Name ),
+			NumSolves( 0 ),
+			NumResidualCalls( 0 ),
+			NumWarmStarts( 0 ),
+			NumWarmStartHits( 0 ),
+			NumNotConverged( 0 ),
+			NumNotBracketed( 0 )
+		{}
+
+	};
+
+	// Object Data
+	extern std::vector< RootSolverCallerType > RootSolverCaller; // Indexed by the value from RegisterRootSolverCaller - 1
+
 } // DataRootFinder
 
 } // EnergyPlus
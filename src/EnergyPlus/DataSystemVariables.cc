@@ -81,6 +81,27 @@ namespace DataSystemVariables {
 	// solutions of all controllers on each air loop at each call to SimAirLoop()
 	std::string const TraceHVACControllerEnvVar( "TRACE_HVACCONTROLLER" ); // To generate a trace file for
 	//  each individual HVAC controller with all controller iterations
+	std::string const AdaptiveControllerEnvVar( "ADAPTIVE_CONTROLLER" ); // To reuse the brackets of the previous
+	// solution of each HVAC controller when bracketing the root
+	std::string const cParallelSizing( "EP_PARALLEL_SIZING" ); // Number of worker processes used for the zone sizing periods
+	std::string const cParametricDeltas( "EP_PARAMETRIC_DELTAS" ); // Field delta file of a parametric batch run
+	std::string const cParametricJobs( "EP_PARAMETRIC_JOBS" ); // Number of parametric variants run at the same time
+	std::string const cIDDCache( "EP_IDD_CACHE" ); // Use (and write) the binary data dictionary cache
+	std::string const cIDFScanThreads( "EP_IDF_THREADS" ); // Number of threads scanning in.idf ahead of validation
+	std::string const cCTFThreads( "EP_CTF_THREADS" ); // Number of threads calculating the construction CTFs
+	std::string const cZoneEquipThreads( "EP_ZONE_EQUIP_THREADS" ); // Number of threads simulating independent zone equipment
+	std::string const cGLHEMultiLevelAgg( "EP_GLHE_MULTILEVEL" ); // Use multi-level load aggregation for vertical GLHEs
+	std::string const cGLHEAggBenchmark( "EP_GLHE_AGG_BENCHMARK" ); // Benchmark the GLHE load aggregation methods
+	std::string const cRunPeriodChunks( "EP_RUNPERIOD_CHUNKS" ); // Number of processes sharing the run period
+	std::string const cRunPeriodOverlap( "EP_RUNPERIOD_OVERLAP" ); // Days each run period chunk starts before its own dates
+	std::string const cCheckpointDate( "EP_CHECKPOINT" ); // Write a state checkpoint after warmup (WARMUP) or a day (month/day)
+	std::string const cRestartFile( "EP_RESTART" ); // Checkpoint file to restart the run period from
+	std::string const cSharedWarmup( "EP_SHARED_WARMUP" ); // Reuse converged warmup states across identical environments
+	std::string const cQuiescentHVAC( "EP_HVAC_QUIESCENT_SKIP" ); // Skip HVAC solutions while the system is quiescent
+	std::string const cTARCOGCache( "EP_TARCOG_CACHE" ); // Reuse TARCOG window solutions for repeated boundary conditions
+	std::string const cExternalSharedMemory( "EP_EXTERNAL_SHM" ); // Shared memory segment used by the ExternalInterface instead of its socket
+	std::string const cTabularBenchmark( "EP_TABULAR_BENCHMARK" ); // Time the gathering of the tabular reports
+	std::string const cTabularThreads( "EP_TABULAR_THREADS" ); // Number of threads writing the styles of the tabular reports
 
 	std::string const MinReportFrequencyEnvVar( "MINREPORTFREQUENCY" ); // environment var for reporting frequency.
 
@@ -105,6 +126,8 @@ namespace DataSystemVariables {
 	// HVAC controllers on each air loop at each call to SimAirLoop()
 	bool TraceHVACControllerEnvFlag( false ); // If TRUE generates a trace file for each individual HVAC
 	// controller with all controller iterations
+	bool AdaptiveControllerEnvFlag( false ); // If TRUE the brackets of the previous solution of each HVAC
+	// controller are tried before the min/max points
 	bool ReportDuringWarmup( false ); // True when the report outputs even during warmup
 	bool ReportDetailedWarmupConvergence( false ); // True when the detailed warmup convergence is requested
 	bool UpdateDataDuringWarmupExternalInterface( false ); // variable sets in the external interface.
@@ -131,6 +154,26 @@ namespace DataSystemVariables {
 	bool lnumActiveSims( false );
 	int MaxNumberOfThreads( 1 );
 	int NumberIntRadThreads( 1 );
+	int NumSizingWorkers( 1 ); // Number of processes sharing the zone sizing periods (1 = serial)
+	bool SizingWorkerProcess( false ); // TRUE in a forked zone sizing worker process
+	std::string ParametricDeltaFile; // Field delta file of a parametric batch run (blank = single run)
+	int NumParametricJobs( 1 ); // Number of parametric variants run at the same time
+	bool UseIDDCache( true ); // Load the data dictionary from its binary cache when it is current
+	int NumIDFScanThreads( 0 ); // Number of threads scanning in.idf ahead of validation (0 = read line by line)
+	int NumCTFThreads( 1 ); // Number of threads calculating the construction CTFs at startup (1 = serial)
+	int NumZoneEquipThreads( 1 ); // Number of threads simulating the independent zone equipment sets (1 = serial)
+	bool GLHEMultiLevelAgg( false ); // Superpose vertical GLHE load history from fixed multi-level aggregation bins
+	bool GLHEAggBenchmark( false ); // Write a timing comparison of the GLHE load aggregation methods to the audit file
+	int NumRunPeriodChunks( 1 ); // Number of month aligned chunks of the run period simulated in parallel (1 = serial)
+	int RunPeriodOverlapDays( 7 ); // Days simulated ahead of each run period chunk to build up its thermal history
+	std::string CheckpointDate; // When to write a state checkpoint in the run period (blank = never)
+	std::string RestartFile; // Checkpoint file the run period is restarted from (blank = normal run)
+	bool SharedWarmup( false ); // Restore the converged warmup state of an identical earlier environment
+	bool QuiescentHVACSkip( false ); // Reuse the previous HVAC solution while its inputs are unchanged
+	bool TARCOGResultCache( false ); // Reuse complex fenestration thermal solutions with the same boundary conditions
+	std::string ExternalSharedMemoryName; // Shared memory segment of the ExternalInterface peer (blank = socket.cfg socket)
+	bool TabularBenchmark( false ); // Write the time spent gathering the tabular reports to the audit file
+	int NumTabularThreads( 1 ); // Number of threads rendering the tabular report styles (1 = serial)
 	int iNominalTotSurfaces( 0 );
 	bool Threading( false );
 
@@ -53,6 +53,27 @@ namespace DataSystemVariables {
 	// solutions of all controllers on each air loop at each call to SimAirLoop()
 	extern std::string const TraceHVACControllerEnvVar; // To generate a trace file for
 	//  each individual HVAC controller with all controller iterations
+	extern std::string const AdaptiveControllerEnvVar; // To reuse the brackets of the previous
+	// solution of each HVAC controller when bracketing the root
+	extern std::string const cParallelSizing; // Number of worker processes used for the zone sizing periods
+	extern std::string const cParametricDeltas; // Field delta file of a parametric batch run
+	extern std::string const cParametricJobs; // Number of parametric variants run at the same time
+	extern std::string const cIDDCache; // Use (and write) the binary data dictionary cache
+	extern std::string const cIDFScanThreads; // Number of threads scanning in.idf ahead of validation
+	extern std::string const cCTFThreads; // Number of threads calculating the construction CTFs
+	extern std::string const cZoneEquipThreads; // Number of threads simulating independent zone equipment
+	extern std::string const cGLHEMultiLevelAgg; // Use multi-level load aggregation for vertical GLHEs
+	extern std::string const cGLHEAggBenchmark; // Benchmark the GLHE load aggregation methods
+	extern std::string const cRunPeriodChunks; // Number of processes sharing the run period
+	extern std::string const cRunPeriodOverlap; // Days each run period chunk starts before its own dates
+	extern std::string const cCheckpointDate; // Write a state checkpoint after warmup (WARMUP) or a day (month/day)
+	extern std::string const cRestartFile; // Checkpoint file to restart the run period from
+	extern std::string const cSharedWarmup; // Reuse converged warmup states across identical environments
+	extern std::string const cQuiescentHVAC; // Skip HVAC solutions while the system is quiescent
+	extern std::string const cTARCOGCache; // Reuse TARCOG window solutions for repeated boundary conditions
+	extern std::string const cExternalSharedMemory; // Shared memory segment used by the ExternalInterface instead of its socket
+	extern std::string const cTabularBenchmark; // Time the gathering of the tabular reports
+	extern std::string const cTabularThreads; // Number of threads writing the styles of the tabular reports
 
 	extern std::string const MinReportFrequencyEnvVar; // environment var for reporting frequency.
 
@@ -77,6 +98,8 @@ namespace DataSystemVariables {
 	// HVAC controllers on each air loop at each call to SimAirLoop()
 	extern bool TraceHVACControllerEnvFlag; // If TRUE generates a trace file for each individual HVAC
 	// controller with all controller iterations
+	extern bool AdaptiveControllerEnvFlag; // If TRUE the brackets of the previous solution of each HVAC
+	// controller are tried before the min/max points
 	extern bool ReportDuringWarmup; // True when the report outputs even during warmup
 	extern bool ReportDetailedWarmupConvergence; // True when the detailed warmup convergence is requested
 	extern bool UpdateDataDuringWarmupExternalInterface; // variable sets in the external interface.
@@ -103,6 +126,26 @@ namespace DataSystemVariables {
 	extern bool lnumActiveSims;
 	extern int MaxNumberOfThreads;
 	extern int NumberIntRadThreads;
+	extern int NumSizingWorkers; // Number of processes sharing the zone sizing periods (1 = serial)
+	extern bool SizingWorkerProcess; // TRUE in a forked zone sizing worker process
+	extern std::string ParametricDeltaFile; // Field delta file of a parametric batch run (blank = single run)
+	extern int NumParametricJobs; // Number of parametric variants run at the same time
+	extern bool UseIDDCache; // Load the data dictionary from its binary cache when it is current
+	extern int NumIDFScanThreads; // Number of threads scanning in.idf ahead of validation (0 = read line by line)
+	extern int NumCTFThreads; // Number of threads calculating the construction CTFs at startup (1 = serial)
+	extern int NumZoneEquipThreads; // Number of threads simulating the independent zone equipment sets (1 = serial)
+	extern bool GLHEMultiLevelAgg; // Superpose vertical GLHE load history from fixed multi-level aggregation bins
+	extern bool GLHEAggBenchmark; // Write a timing comparison of the GLHE load aggregation methods to the audit file
+	extern int NumRunPeriodChunks; // Number of month aligned chunks of the run period simulated in parallel (1 = serial)
+	extern int RunPeriodOverlapDays; // Days simulated ahead of each run period chunk to build up its thermal history
+	extern std::string CheckpointDate; // When to write a state checkpoint in the run period (blank = never)
+	extern std::string RestartFile; // Checkpoint file the run period is restarted from (blank = normal run)
+	extern bool SharedWarmup; // Restore the converged warmup state of an identical earlier environment
+	extern bool QuiescentHVACSkip; // Reuse the previous HVAC solution while its inputs are unchanged
+	extern bool TARCOGResultCache; // Reuse complex fenestration thermal solutions with the same boundary conditions
+	extern std::string ExternalSharedMemoryName; // Shared memory segment of the ExternalInterface peer (blank = socket.cfg socket)
+	extern bool TabularBenchmark; // Write the time spent gathering the tabular reports to the audit file
+	extern int NumTabularThreads; // Number of threads rendering the tabular report styles (1 = serial)
 	extern int iNominalTotSurfaces;
 	extern bool Threading;
 
@@ -2,6 +2,7 @@
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -36,6 +37,7 @@
 #include <ScheduleManager.hh>
 #include <SolarReflectionManager.hh>
 #include <SQLiteProcedures.hh>
+#include <SurfaceRayTree.hh>
 #include <UtilityRoutines.hh>
 #include <Vectors.hh>
 #include <WindowComplexManager.hh>
@@ -102,6 +104,7 @@ namespace DaylightingManager {
 	using DataBSDFWindow::ComplexWind;
 
 	using namespace ScheduleManager;
+	using SurfaceRayTree::RayTreeCandidates;
 	//USE Vectors
 
 	// Data
@@ -467,6 +470,7 @@ namespace DaylightingManager {
 		if ( firstTime ) {
 			GetDaylightingParametersInput();
 			CheckTDDsAndLightShelvesInDaylitZones();
+			SurfaceRayTree::InitSurfaceRayTree();
 			firstTime = false;
 			if ( allocated( CheckTDDZone ) ) CheckTDDZone.deallocate();
 		} // End of check if firstTime
@@ -2971,6 +2975,7 @@ namespace DaylightingManager {
 		Real64 IncAngSolidAngFac; // CosIncAngURay*dOmegaGnd/Pi
 		int IHitObs; // 1 if obstruction is hit; 0 otherwise
 		int ObsSurfNum; // Surface number of obstruction
+		static std::vector< int > ObsCandidates; // Possible obstructions from the surface ray tree
 		static FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 
 		DPhi = PiOvr2 / ( AltSteps / 2.0 );
@@ -2998,7 +3003,9 @@ namespace DaylightingManager {
 				SkyGndUnObs += IncAngSolidAngFac;
 				// Does this ground ray hit an obstruction?
 				IHitObs = 0;
-				for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+				RayTreeCandidates( GroundHitPt, URay, ObsCandidates );
+				for ( int iCand = 0, eCand = ObsCandidates.size(); iCand < eCand; ++iCand ) {
+					ObsSurfNum = ObsCandidates[ iCand ];
 					if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 					DayltgPierceSurface( ObsSurfNum, GroundHitPt, URay, IHitObs, ObsHitPt );
 					if ( IHitObs > 0 ) break;
@@ -3150,6 +3157,7 @@ namespace DaylightingManager {
 		int IHitObs; // 1 if obstruction is hit; 0 otherwise
 		static FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 		int ObsSurfNum; // Surface number of obstruction
+		static std::vector< int > ObsCandidates; // Possible obstructions from the surface ray tree
 		int ObsConstrNum; // Construction number of obstruction
 		Real64 ObsVisRefl; // Visible reflectance of obstruction
 		Real64 SkyReflVisLum; // Reflected sky luminance at hit point divided by
@@ -3364,7 +3372,9 @@ namespace DaylightingManager {
 							if ( CalcSolRefl ) { // Coordinates of ground point hit by the ray
 								// Sun reaches ground point if vector from this point to the sun is unobstructed
 								IHitObs = 0;
-								for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+								RayTreeCandidates( GroundHitPt, SUNCOS_iHour, ObsCandidates );
+								for ( int iCand = 0, eCand = ObsCandidates.size(); iCand < eCand; ++iCand ) {
+									ObsSurfNum = ObsCandidates[ iCand ];
 									if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 									DayltgPierceSurface( ObsSurfNum, GroundHitPt, SUNCOS_iHour, IHitObs, ObsHitPt );
 									if ( IHitObs > 0 ) break;
@@ -3623,7 +3633,9 @@ namespace DaylightingManager {
 									}
 								} else {
 									// Reflecting surface is a building shade
-									for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+									RayTreeCandidates( HitPtRefl, RAYCOS, ObsCandidates );
+									for ( int iCand = 0, eCand = ObsCandidates.size(); iCand < eCand; ++iCand ) {
+										ObsSurfNum = ObsCandidates[ iCand ];
 										if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 										if ( ObsSurfNum == ReflSurfNum ) continue;
 										DayltgPierceSurface( ObsSurfNum, HitPtRefl, RAYCOS, IHitObs, HitPtObs );
@@ -5651,6 +5663,7 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ISurf; // Surface index
+		static std::vector< int > ObsCandidates; // Possible obstructions from the surface ray tree
 		int IType; // Surface type/class
 		//  mirror surfaces of shading surfaces
 		static FArray1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction
@@ -5665,7 +5678,9 @@ namespace DaylightingManager {
 		// Building elements are assumed to be opaque. A shadowing surface is opaque unless
 		// its transmittance schedule value is non-zero.
 
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
+		RayTreeCandidates( R1, RN, ObsCandidates );
+		for ( int iCand = 0, eCand = ObsCandidates.size(); iCand < eCand; ++iCand ) {
+			ISurf = ObsCandidates[ iCand ];
 			if ( ! Surface( ISurf ).ShadowSurfPossibleObstruction ) continue;
 			IType = Surface( ISurf ).Class;
 			if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ISurf != Surface( IWin ).BaseSurf ) {
@@ -5741,6 +5756,7 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ISurf; // Surface index
+		static std::vector< int > ObsCandidates; // Possible obstructions from the surface ray tree
 		int IType; // Surface type/class
 		static FArray1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction
 		Real64 r12; // Distance between R1 and R2
@@ -5756,7 +5772,9 @@ namespace DaylightingManager {
 
 		// Loop over obstructions, which can be building elements, like walls,
 		// or shadowing surfaces, like overhangs. Exclude base surface of window IWin.
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
+		RayTreeCandidates( R1, RN, ObsCandidates );
+		for ( int iCand = 0, eCand = ObsCandidates.size(); iCand < eCand; ++iCand ) {
+			ISurf = ObsCandidates[ iCand ];
 			IType = Surface( ISurf ).Class;
 
 			if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ISurf != Surface( IWin ).BaseSurf && ISurf != Surface( Surface( IWin ).BaseSurf ).ExtBoundCond ) {
@@ -5827,6 +5845,7 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ISurf; // Surface index
+		static std::vector< int > ObsCandidates; // Possible obstructions from the surface ray tree
 		int IType; // Surface type/class
 		static FArray1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction surface (m)
 		Real64 r12; // Distance between R1 and R2 (m)
@@ -5843,7 +5862,9 @@ namespace DaylightingManager {
 		// Loop over obstructions, which can be building elements, like walls,
 		// or shadowing surfaces, like overhangs. Exclude base surface of window IWin1.
 		// Exclude base surface of window IWin2.
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
+		RayTreeCandidates( R1, RN, ObsCandidates );
+		for ( int iCand = 0, eCand = ObsCandidates.size(); iCand < eCand; ++iCand ) {
+			ISurf = ObsCandidates[ iCand ];
 			IType = Surface( ISurf ).Class;
 
 			if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ISurf != Surface( IWin2 ).BaseSurf && ISurf != Surface( IWin1 ).BaseSurf && ISurf != Surface( Surface( IWin2 ).BaseSurf ).ExtBoundCond && ISurf != Surface( Surface( IWin1 ).BaseSurf ).ExtBoundCond ) {
@@ -7153,6 +7174,7 @@ namespace DaylightingManager {
 		Real64 HorDis; // Distance between ground hit point and proj'n of window center onto ground (m)
 		static FArray1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray from window center hits the ground (m)
 		int ObsSurfNum; // Obstruction surface number
+		static std::vector< int > ObsCandidates; // Possible obstructions from the surface ray tree
 		int IHitObs; // = 1 if obstruction is hit, = 0 otherwise
 		static FArray1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 		int ObsConstrNum; // Construction number of obstruction
@@ -7337,7 +7359,9 @@ namespace DaylightingManager {
 					if ( CalcSolRefl && ObTransM( ITH, IPH ) > 1.e-6 ) {
 						// Sun reaches ground point if vector from this point to the sun is unobstructed
 						IHitObs = 0;
-						for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+						RayTreeCandidates( GroundHitPt, SUNCOS_IHR, ObsCandidates );
+						for ( int iCand = 0, eCand = ObsCandidates.size(); iCand < eCand; ++iCand ) {
+							ObsSurfNum = ObsCandidates[ iCand ];
 							if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 							DayltgPierceSurface( ObsSurfNum, GroundHitPt, SUNCOS_IHR, IHitObs, ObsHitPt );
 							if ( IHitObs > 0 ) break;
@@ -8725,6 +8749,7 @@ namespace DaylightingManager {
 		static FArray1D< Real64 > HitPt( 3 ); // Hit point on an obstruction (m)
 		int IHit; // > 0 if obstruction is hit, 0 otherwise
 		int ObsSurfNum; // Obstruction surface number
+		static std::vector< int > ObsCandidates; // Possible obstructions from the surface ray tree
 
 		int TotObstructionsHit; // Number of obstructions hit by a ray
 		int ObsSurfNumToSkip; // Surface number of obstruction to be ignored
@@ -8737,7 +8762,9 @@ namespace DaylightingManager {
 		Real64 HitDistance_sq; // Distance squared from receiving point to hit point for a ray (m^2)
 		NearestHitPt = 0.0;
 		ObsSurfNumToSkip = 0;
-		for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+		RayTreeCandidates( RecPt, RayVec, ObsCandidates );
+		for ( int iCand = 0, eCand = ObsCandidates.size(); iCand < eCand; ++iCand ) {
+			ObsSurfNum = ObsCandidates[ iCand ];
 			if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 			// If a window was hit previously (see below), ObsSurfNumToSkip was set to the window's base surface in order
 			// to remove that surface from consideration as a hit surface for this ray
@@ -8812,6 +8839,7 @@ namespace DaylightingManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static FArray1D< Real64 > ReflNorm( 3 ); // Unit normal to reflecting surface (m)
 		int ObsSurfNum; // Obstruction surface number
+		static std::vector< int > ObsCandidates; // Possible obstructions from the surface ray tree
 		int IHitObs; // > 0 if obstruction is hit
 		static FArray1D< Real64 > ObsHitPt( 3 ); // Hit point on obstruction (m)
 		Real64 CosIncAngAtHitPt; // Cosine of angle of incidence of sun at HitPt
@@ -8838,7 +8866,9 @@ namespace DaylightingManager {
 		if ( CosIncAngAtHitPt <= 0.0 ) return; // Sun is in back of reflecting surface
 		// Sun reaches ReflHitPt if vector from ReflHitPt to sun is unobstructed
 		IHitObs = 0;
-		for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+		RayTreeCandidates( ReflHitPt, SUNCOS_IHR, ObsCandidates );
+		for ( int iCand = 0, eCand = ObsCandidates.size(); iCand < eCand; ++iCand ) {
+			ObsSurfNum = ObsCandidates[ iCand ];
 			if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 			// Exclude as a possible obstructor ReflSurfNum and its base surface (if it has one)
 			if ( ObsSurfNum == ReflSurfNum || ObsSurfNum == Surface( ReflSurfNum ).BaseSurf ) continue;
@@ -5,12 +5,17 @@ extern "C" {
 #include <BCVTB/utilXml.h>
 }
 
+// Shared memory transport
+#include <ExternalInterfaceSharedMemory.h>
 
 // C++ Headers
+#include <chrono>
+#include <cmath>
 #include <string>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
+#include <ObjexxFCL/Fmath.hh>
 #include <ObjexxFCL/gio.hh>
 #include <ObjexxFCL/string.functions.hh>
 
@@ -75,6 +80,8 @@ namespace ExternalInterface {
 	int const fmiPending( 5 ); // fmiPending
 	std::string const socCfgFilNam( "socket.cfg" ); // socket configuration file
 	std::string const BlankString;
+	int const nLatencyBins( 24 ); // Bins of the exchange latency histogram (powers of two microseconds)
+	Real64 const sharedMemoryTimeout( 3600.0 ); // Seconds to wait for the peer of the shared memory transport
 
 	// MODULE VARIABLE DECLARATIONS:
 
@@ -95,6 +102,13 @@ namespace ExternalInterface {
 	FArray1D_int varTypes; // Types of variables in keyVarIndexes
 	FArray1D_int varInd; // Index of ErlVariables for ExternalInterface
 	int socketFD( -1 ); // socket file descriptor
+#ifdef __unix__
+	epshm_segment * sharedMemorySegment( nullptr ); // Segment of the shared memory transport (EP_EXTERNAL_SHM)
+#endif
+	int numExchanges( 0 ); // Number of exchanges with the peer
+	Real64 sumExchangeLatency( 0.0 ); // Sum of the round trip times of the exchanges (s)
+	Real64 maxExchangeLatency( 0.0 ); // Longest round trip time of an exchange (s)
+	FArray1D_int exchangeLatencyHist( nLatencyBins, 0 ); // Histogram of the round trip times of the exchanges
 	bool ErrorsFound( false ); // Set to true if errors are found
 	bool noMoreValues( false ); // Flag, true if no more values
 	// will be sent by the server
@@ -317,6 +331,9 @@ namespace ExternalInterface {
 		// It sends an appropriate message to the ExternalInterface
 		// and then calls a fatal error to stop EnergyPlus.
 
+		// Using/Aliasing
+		using DataSystemVariables::ExternalSharedMemoryName;
+
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int retVal; // Return value, needed to catch return value of function call
 		int const flag1( -10 );
@@ -324,8 +341,9 @@ namespace ExternalInterface {
 
 		if ( ( NumExternalInterfacesBCVTB != 0 ) || ( NumExternalInterfacesFMUExport != 0 ) ) {
 			if ( ErrorsFound ) {
-				// Check if the socket is open
-				if ( socketFD >= 0 ) {
+				if ( ! ExternalSharedMemoryName.empty() ) {
+					SendFlagToSharedMemory( ( simulationStatus == 1 ) ? flag1 : flag2 );
+				} else if ( socketFD >= 0 ) {
 					// Socket is open
 					if ( simulationStatus == 1 ) {
 						retVal = sendclientmessage( &socketFD, &flag1 );
@@ -360,10 +378,19 @@ namespace ExternalInterface {
 		// +1: E+ reached final time
 		// -1: E+ had some error
 
+		// Using/Aliasing
+		using DataSystemVariables::ExternalSharedMemoryName;
+
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int retVal; // Return value, needed to catch return value of function call
 		bool fileExist; // Set to true if file exists
 
+		// With the shared memory transport, the flag goes to the segment of EP_EXTERNAL_SHM
+		if ( ! ExternalSharedMemoryName.empty() ) {
+			if ( AttachSharedMemory() ) SendFlagToSharedMemory( FlagToWriteToSocket );
+			return;
+		}
+
 		// Try to establish socket connection. This is needed if Ptolemy started E+,
 		//  but E+ had an error before the call to InitExternalInterface.
 
@@ -443,6 +470,8 @@ namespace ExternalInterface {
 		using RuntimeLanguageProcessor::FindEMSVariable;
 		using DataGlobals::WeathSimReq;
 		using General::TrimSigDigits;
+		using DataSystemVariables::ExternalSharedMemoryName;
+		using DataSystemVariables::cExternalSharedMemory;
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
 
@@ -485,7 +514,19 @@ namespace ExternalInterface {
 
 			// Get port number
 			{ IOFlags flags; gio::inquire( socCfgFilNam, flags ); socFileExist = flags.exists(); }
-			if ( socFileExist ) {
+			if ( ! ExternalSharedMemoryName.empty() ) {
+				// Shared memory transport selected instead of the socket of socket.cfg
+				if ( AttachSharedMemory() ) {
+					DisplayString( "ExternalInterface exchanges values through shared memory segment \"" + ExternalSharedMemoryName + "\"." );
+				} else {
+					ShowSevereError( "ExternalInterface: Could not attach shared memory segment \"" + ExternalSharedMemoryName + "\" (" + cExternalSharedMemory + ")." );
+					ShowContinueError( "The peer process needs to create the segment (epshm_create) before EnergyPlus starts." );
+#ifndef __unix__
+					ShowContinueError( "The shared memory transport is only available on unix platforms." );
+#endif
+					ErrorsFound = true;
+				}
+			} else if ( socFileExist ) {
 				socketFD = establishclientsocket( socCfgFilNam.c_str() );
 				if ( socketFD < 0 ) {
 					ShowSevereError( "ExternalInterface: Could not open socket. File descriptor = " + TrimSigDigits( socketFD ) + '.' );
@@ -2019,6 +2060,7 @@ namespace ExternalInterface {
 		using RuntimeLanguageProcessor::ExternalInterfaceSetErlVariable;
 		using EMSManager::ManageEMS;
 		using General::TrimSigDigits;
+		using DataSystemVariables::ExternalSharedMemoryName;
 		//using DataPrecisionGlobals;
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
@@ -2081,14 +2123,18 @@ namespace ExternalInterface {
 				}
 			}
 
-			// Exchange data with socket
+			// Exchange data with socket (or shared memory)
 			retVal = 0;
 			flaRea = 0;
-			if ( haveExternalInterfaceBCVTB ) {
+			auto const exchangeStartTime( std::chrono::steady_clock::now() );
+			if ( ! ExternalSharedMemoryName.empty() ) {
+				retVal = ExchangeDoublesWithSharedMemory( flaWri, flaRea, nDblWri, nDblRea, preSimTim, dblValWri, curSimTim, dblValRea );
+			} else if ( haveExternalInterfaceBCVTB ) {
 				retVal = exchangedoubleswithsocket( &socketFD, &flaWri, &flaRea, &nDblWri, &nDblRea, &preSimTim, dblValWri.data_, &curSimTim, dblValRea.data_ );
 			} else if ( haveExternalInterfaceFMUExport ) {
 				retVal = exchangedoubleswithsocketFMU( &socketFD, &flaWri, &flaRea, &nDblWri, &nDblRea, &preSimTim, dblValWri.data_, &curSimTim, dblValRea.data_, &FMUExportActivate );
 			}
+			RecordExchangeLatency( std::chrono::duration< Real64 >( std::chrono::steady_clock::now() - exchangeStartTime ).count() );
 			continueSimulation = true;
 
 			// Check for errors, in which case we terminate the simulation loop
@@ -2148,6 +2194,180 @@ namespace ExternalInterface {
 
 	}
 
+	bool
+	AttachSharedMemory()
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Attaches the shared memory segment named by EP_EXTERNAL_SHM. The peer process creates
+		// this segment instead of listening on the socket of socket.cfg. Returns true while the
+		// segment is attached. The segment is attached at most once, so no flag is sent after
+		// SendFlagToSharedMemory has detached.
+
+		// REFERENCES:
+		// ExternalInterfaceSharedMemory.h
+
+		// Using/Aliasing
+		using DataSystemVariables::ExternalSharedMemoryName;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		static bool attachTried( false ); // True once the segment has been attached (or failed to)
+
+#ifdef __unix__
+		if ( ! attachTried ) {
+			attachTried = true;
+			sharedMemorySegment = epshm_attach( ExternalSharedMemoryName.c_str() );
+		}
+		return ( sharedMemorySegment != nullptr );
+#else
+		return false;
+#endif
+	}
+
+	int
+	ExchangeDoublesWithSharedMemory(
+		int const flaWri, // Flag written to the peer
+		int & flaRea, // Flag read from the peer
+		int const nDblWri, // Number of doubles written to the peer
+		int & nDblRea, // Number of doubles read from the peer
+		Real64 const preSimTim, // Simulation time written to the peer
+		FArray1D< Real64 > const & dblValWri, // Doubles written to the peer
+		Real64 & curSimTim, // Simulation time read from the peer
+		FArray1D< Real64 > & dblValRea // Doubles read from the peer
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Shared memory counterpart of exchangedoubleswithsocket. It sends the flag, the
+		// simulation time and all doubles of this exchange to the peer as one binary message,
+		// then waits for the peer's reply. Returns zero on success, like the socket exchange.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int retVal; // Return value of the transport
+
+#ifdef __unix__
+		if ( sharedMemorySegment == nullptr ) return EPSHM_BAD_SEGMENT;
+		retVal = epshm_send( &sharedMemorySegment->toPeer, flaWri, nDblWri, preSimTim, dblValWri.data_, sharedMemoryTimeout );
+		if ( retVal != EPSHM_OK ) return retVal;
+		retVal = epshm_receive( &sharedMemorySegment->toEnergyPlus, &flaRea, &nDblRea, &curSimTim, dblValRea.data_, isize( dblValRea ), sharedMemoryTimeout );
+#else
+		retVal = -1;
+#endif
+		return retVal;
+	}
+
+	void
+	SendFlagToSharedMemory( int const FlagToWrite )
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Shared memory counterpart of sendclientmessage. It sends a flag without values to the
+		// peer and detaches, so that a peer waiting for values stops waiting.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const flagTimeout( 10.0 ); // Seconds to wait for a free message slot
+
+#ifdef __unix__
+		if ( sharedMemorySegment == nullptr ) return;
+		epshm_send( &sharedMemorySegment->toPeer, FlagToWrite, 0, 0.0, nullptr, flagTimeout );
+		epshm_detach( sharedMemorySegment, 0 );
+		sharedMemorySegment = nullptr;
+#endif
+	}
+
+	void
+	RecordExchangeLatency( Real64 const Latency ) // Wall clock time of an exchange with the peer (s)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the round trip time of an exchange with the peer to the latency histogram.
+
+		// METHODOLOGY EMPLOYED:
+		// Bin 1 counts round trips below 1 microsecond. Bin k counts round trips from 2**(k-2)
+		// up to 2**(k-1) microseconds. The last bin is open ended.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 Microseconds; // Latency in microseconds
+		int Bin; // Histogram bin of the latency
+
+		Microseconds = Latency * 1.0e6;
+		if ( Microseconds < 1.0 ) {
+			Bin = 1;
+		} else {
+			Bin = min( nLatencyBins, 2 + int( std::floor( std::log2( Microseconds ) ) ) );
+		}
+		++exchangeLatencyHist( Bin );
+		++numExchanges;
+		sumExchangeLatency += Latency;
+		maxExchangeLatency = max( maxExchangeLatency, Latency );
+	}
+
+	void
+	ReportExternalInterfaceExchanges()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the number of exchanges with the peer, their mean and maximum round trip time
+		// and the latency histogram to the audit file.
+
+		// Using/Aliasing
+		using DataSystemVariables::ExternalSharedMemoryName;
+		using General::RoundSigDigits;
+		using General::TrimSigDigits;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int EchoInputFile; // found unit number for "eplusout.audit"
+		int Bin; // Histogram bin
+		std::string Transport; // Name of the transport used for the exchanges
+		std::string UpperBound; // Upper bound of a histogram bin (us)
+
+		if ( numExchanges == 0 ) return;
+		EchoInputFile = FindUnitNumber( "eplusout.audit" );
+		if ( EchoInputFile == 0 ) return;
+
+		if ( ! ExternalSharedMemoryName.empty() ) {
+			Transport = "Shared Memory " + ExternalSharedMemoryName;
+		} else {
+			Transport = "Socket";
+		}
+		gio::write( EchoInputFile, fmtA ) << "ExternalInterface Exchanges,Transport,#Exchanges,Mean Latency {us},Maximum Latency {us}";
+		gio::write( EchoInputFile, fmtA ) << "ExternalInterface Exchanges," + Transport + ',' + TrimSigDigits( numExchanges ) + ',' + RoundSigDigits( sumExchangeLatency / numExchanges * 1.0e6, 2 ) + ',' + RoundSigDigits( maxExchangeLatency * 1.0e6, 2 );
+		gio::write( EchoInputFile, fmtA ) << "ExternalInterface Latency Histogram,From {us},Below {us},#Exchanges";
+		for ( Bin = 1; Bin <= nLatencyBins; ++Bin ) {
+			if ( exchangeLatencyHist( Bin ) == 0 ) continue;
+			UpperBound = ( Bin < nLatencyBins ) ? TrimSigDigits( std::pow( 2, Bin - 1 ), 0 ) : std::string();
+			gio::write( EchoInputFile, fmtA ) << "ExternalInterface Latency Histogram," + TrimSigDigits( ( Bin > 1 ) ? std::pow( 2, Bin - 2 ) : 0.0, 0 ) + ',' + UpperBound + ',' + TrimSigDigits( exchangeLatencyHist( Bin ) );
+		}
+	}
+
 	void
 	GetReportVariableKey(
 		FArray1S_string const varKeys, // Standard variable name
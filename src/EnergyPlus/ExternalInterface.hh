@@ -52,6 +52,8 @@ namespace ExternalInterface {
 	extern int const fmiPending;     // fmiPending
 	extern std::string const socCfgFilNam; // socket configuration file
 	extern std::string const BlankString;
+	extern int const nLatencyBins; // Bins of the exchange latency histogram (powers of two microseconds)
+	extern Real64 const sharedMemoryTimeout; // Seconds to wait for the peer of the shared memory transport
 
 	struct fmuInputVariableType {
 		
@@ -305,6 +307,10 @@ namespace ExternalInterface {
 	extern FArray1D< int > varTypes; // Types of variables in keyVarIndexes
 	extern FArray1D< int > varInd; // Index of ErlVariables for ExternalInterface
 	extern int socketFD; // socket file descriptor
+	extern int numExchanges; // Number of exchanges with the peer
+	extern Real64 sumExchangeLatency; // Sum of the round trip times of the exchanges (s)
+	extern Real64 maxExchangeLatency; // Longest round trip time of an exchange (s)
+	extern FArray1D< int > exchangeLatencyHist; // Histogram of the round trip times of the exchanges
 	extern bool ErrorsFound; // Set to true if errors are found
 	extern bool noMoreValues; //Flag, true if no more values
 	// will be sent by the server
@@ -325,6 +331,30 @@ namespace ExternalInterface {
 	void
 	CloseSocket( int const FlagToWriteToSocket ); 
 
+	bool
+	AttachSharedMemory();
+
+	int
+	ExchangeDoublesWithSharedMemory(
+		int const flaWri, // Flag written to the peer
+		int & flaRea, // Flag read from the peer
+		int const nDblWri, // Number of doubles written to the peer
+		int & nDblRea, // Number of doubles read from the peer
+		Real64 const preSimTim, // Simulation time written to the peer
+		FArray1D< Real64 > const & dblValWri, // Doubles written to the peer
+		Real64 & curSimTim, // Simulation time read from the peer
+		FArray1D< Real64 > & dblValRea // Doubles read from the peer
+	);
+
+	void
+	SendFlagToSharedMemory( int const FlagToWrite );
+
+	void
+	RecordExchangeLatency( Real64 const Latency ); // Wall clock time of an exchange with the peer (s)
+
+	void
+	ReportExternalInterfaceExchanges();
+
 	void
 	InitExternalInterface();
 	
@@ -0,0 +1,245 @@
+#ifndef ExternalInterfaceSharedMemory_h_INCLUDED
+#define ExternalInterfaceSharedMemory_h_INCLUDED
+
+/*
+ * Shared memory transport of the ExternalInterface.
+ *
+ * Header-only C API used by EnergyPlus and by the peer process that would otherwise
+ * talk to EnergyPlus through the BCVTB socket. The peer creates the segment, starts
+ * EnergyPlus with EP_EXTERNAL_SHM set to the segment name, and then, once per
+ * ExternalInterface exchange:
+ *
+ *   epshm_receive( &seg->toPeer, ... )        values, flag and time sent by EnergyPlus
+ *   epshm_send( &seg->toEnergyPlus, ... )     values, flag and time sent to EnergyPlus
+ *
+ * The messages carry the same flag, time and double values as the socket protocol
+ * (flag 0 = values, +1 = end of simulation, negative = error) in binary form, all
+ * values of an exchange in one message. Each direction is a single producer / single
+ * consumer ring of EPSHM_SLOTS messages, synchronized with acquire/release atomics;
+ * a waiting side spins briefly and then yields, and gives up after a timeout or when
+ * the other side has detached.
+ *
+ * Only available on unix platforms (POSIX shared memory, GCC/Clang atomics). Link the
+ * peer with -lrt on older C libraries.
+ */
+
+#ifdef __unix__
+
+#include <fcntl.h>
+#include <sched.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define EPSHM_MAGIC 0x4d534545u /* "EESM" */
+#define EPSHM_VERSION 1
+#define EPSHM_MAX_DOUBLES 1024 /* same as the socket exchange (ExternalInterface nDblMax) */
+#define EPSHM_SLOTS 4 /* messages buffered in each direction */
+#define EPSHM_SPIN 20000 /* polls before a waiting side starts to yield */
+
+/* Return values of the API functions */
+#define EPSHM_OK 0
+#define EPSHM_TIMEOUT -1 /* no message / no free slot within the timeout */
+#define EPSHM_DETACHED -2 /* the other side has detached */
+#define EPSHM_TOO_MANY -3 /* more doubles than EPSHM_MAX_DOUBLES or than the receive buffer */
+#define EPSHM_BAD_SEGMENT -4 /* segment cannot be created, opened or has the wrong layout */
+
+typedef struct {
+	int32_t flag; /* 0 = values, +1 = end of simulation, negative = error */
+	int32_t nDbl; /* number of values */
+	double simTime; /* simulation time (s) */
+	double values[ EPSHM_MAX_DOUBLES ];
+} epshm_message;
+
+typedef struct {
+	uint64_t head; /* messages written (owned by the producer) */
+	uint64_t tail; /* messages read (owned by the consumer) */
+	int32_t producerAttached;
+	int32_t consumerAttached;
+	epshm_message slot[ EPSHM_SLOTS ];
+} epshm_ring;
+
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	epshm_ring toPeer; /* EnergyPlus -> peer */
+	epshm_ring toEnergyPlus; /* peer -> EnergyPlus */
+} epshm_segment;
+
+static inline double
+epshm_now( void )
+{
+	struct timespec ts;
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	return (double)ts.tv_sec + 1.0e-9 * (double)ts.tv_nsec;
+}
+
+/* Waits until the ring has a free slot (producer) or a message (consumer). */
+static inline int
+epshm_wait(
+	epshm_ring * ring,
+	int producer, /* 1 to wait for a free slot, 0 to wait for a message */
+	double timeout /* seconds, <= 0 waits forever */
+)
+{
+	long polls = 0;
+	double start = 0.0;
+	uint64_t head, tail;
+	int32_t other;
+
+	for ( ;; ) {
+		head = __atomic_load_n( &ring->head, __ATOMIC_ACQUIRE );
+		tail = __atomic_load_n( &ring->tail, __ATOMIC_ACQUIRE );
+		if ( producer ? ( head - tail < EPSHM_SLOTS ) : ( head != tail ) ) return EPSHM_OK;
+		other = __atomic_load_n( producer ? &ring->consumerAttached : &ring->producerAttached, __ATOMIC_ACQUIRE );
+		if ( other < 0 ) return EPSHM_DETACHED;
+		if ( ++polls < EPSHM_SPIN ) continue;
+		if ( polls == EPSHM_SPIN ) start = epshm_now();
+		sched_yield();
+		if ( timeout > 0.0 && ( polls & 255 ) == 0 && epshm_now() - start > timeout ) return EPSHM_TIMEOUT;
+	}
+}
+
+static inline int
+epshm_send(
+	epshm_ring * ring,
+	int flag,
+	int nDbl,
+	double simTime,
+	double const * values,
+	double timeout
+)
+{
+	epshm_message * msg;
+	uint64_t head;
+	int ret;
+
+	if ( nDbl < 0 || nDbl > EPSHM_MAX_DOUBLES ) return EPSHM_TOO_MANY;
+	ret = epshm_wait( ring, 1, timeout );
+	if ( ret != EPSHM_OK ) return ret;
+	head = __atomic_load_n( &ring->head, __ATOMIC_RELAXED );
+	msg = &ring->slot[ head % EPSHM_SLOTS ];
+	msg->flag = flag;
+	msg->nDbl = nDbl;
+	msg->simTime = simTime;
+	if ( nDbl > 0 ) memcpy( msg->values, values, (size_t)nDbl * sizeof( double ) );
+	__atomic_store_n( &ring->head, head + 1, __ATOMIC_RELEASE );
+	return EPSHM_OK;
+}
+
+static inline int
+epshm_receive(
+	epshm_ring * ring,
+	int * flag,
+	int * nDbl,
+	double * simTime,
+	double * values,
+	int maxDbl, /* size of values */
+	double timeout
+)
+{
+	epshm_message const * msg;
+	uint64_t tail;
+	int ret;
+
+	ret = epshm_wait( ring, 0, timeout );
+	if ( ret != EPSHM_OK ) return ret;
+	tail = __atomic_load_n( &ring->tail, __ATOMIC_RELAXED );
+	msg = &ring->slot[ tail % EPSHM_SLOTS ];
+	*flag = msg->flag;
+	*nDbl = msg->nDbl;
+	*simTime = msg->simTime;
+	if ( msg->nDbl > maxDbl ) ret = EPSHM_TOO_MANY;
+	else if ( msg->nDbl > 0 ) memcpy( values, msg->values, (size_t)msg->nDbl * sizeof( double ) );
+	__atomic_store_n( &ring->tail, tail + 1, __ATOMIC_RELEASE );
+	return ret;
+}
+
+static inline epshm_segment *
+epshm_map(
+	char const * name,
+	int create
+)
+{
+	int fd;
+	void * addr;
+	struct stat st;
+
+	fd = shm_open( name, create ? ( O_RDWR | O_CREAT | O_EXCL ) : O_RDWR, 0600 );
+	if ( fd < 0 ) return NULL;
+	if ( create ) {
+		if ( ftruncate( fd, (off_t)sizeof( epshm_segment ) ) != 0 ) {
+			close( fd );
+			shm_unlink( name );
+			return NULL;
+		}
+	} else if ( fstat( fd, &st ) != 0 || (size_t)st.st_size < sizeof( epshm_segment ) ) {
+		close( fd );
+		return NULL;
+	}
+	addr = mmap( NULL, sizeof( epshm_segment ), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+	close( fd );
+	if ( addr == MAP_FAILED ) return NULL;
+	return (epshm_segment *)addr;
+}
+
+/* Peer: creates and maps a new segment (fails if the name exists). */
+static inline epshm_segment *
+epshm_create( char const * name )
+{
+	epshm_segment * seg = epshm_map( name, 1 );
+	if ( seg == NULL ) return NULL;
+	memset( seg, 0, sizeof( epshm_segment ) );
+	seg->version = EPSHM_VERSION;
+	__atomic_store_n( &seg->toEnergyPlus.producerAttached, 1, __ATOMIC_RELEASE );
+	__atomic_store_n( &seg->toPeer.consumerAttached, 1, __ATOMIC_RELEASE );
+	__atomic_store_n( &seg->magic, EPSHM_MAGIC, __ATOMIC_RELEASE );
+	return seg;
+}
+
+/* EnergyPlus: maps the segment created by the peer. */
+static inline epshm_segment *
+epshm_attach( char const * name )
+{
+	epshm_segment * seg = epshm_map( name, 0 );
+	if ( seg == NULL ) return NULL;
+	if ( __atomic_load_n( &seg->magic, __ATOMIC_ACQUIRE ) != EPSHM_MAGIC || seg->version != EPSHM_VERSION ) {
+		munmap( seg, sizeof( epshm_segment ) );
+		return NULL;
+	}
+	__atomic_store_n( &seg->toPeer.producerAttached, 1, __ATOMIC_RELEASE );
+	__atomic_store_n( &seg->toEnergyPlus.consumerAttached, 1, __ATOMIC_RELEASE );
+	return seg;
+}
+
+/* Marks one side as gone, so that the other side stops waiting, and unmaps the segment. */
+static inline void
+epshm_detach(
+	epshm_segment * seg,
+	int isPeer
+)
+{
+	if ( seg == NULL ) return;
+	if ( isPeer ) {
+		__atomic_store_n( &seg->toEnergyPlus.producerAttached, -1, __ATOMIC_RELEASE );
+		__atomic_store_n( &seg->toPeer.consumerAttached, -1, __ATOMIC_RELEASE );
+	} else {
+		__atomic_store_n( &seg->toPeer.producerAttached, -1, __ATOMIC_RELEASE );
+		__atomic_store_n( &seg->toEnergyPlus.consumerAttached, -1, __ATOMIC_RELEASE );
+	}
+	munmap( seg, sizeof( epshm_segment ) );
+}
+
+/* Peer: removes the segment name once EnergyPlus has attached or finished. */
+static inline int
+epshm_unlink( char const * name )
+{
+	return shm_unlink( name );
+}
+
+#endif /* __unix__ */
+
+#endif /* ExternalInterfaceSharedMemory_h_INCLUDED */
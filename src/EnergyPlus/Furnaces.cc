@@ -5646,6 +5646,7 @@ namespace Furnaces {
 		//       AUTHOR         Richard Liesen
 		//       DATE WRITTEN   Feb 2001
 		//       MODIFIED       R. Raustad and D. Shirey, Feb/Mar/Sept/Oct/Dec 2001, Jan/Oct 2002
+		//                      October 2014, General::SolveRoot with heating, cooling and latent PLR hints
 		//       RE-ENGINEERED  R. Raustad, Feb. 2005 (added RegulaFalsi for iteration technique)
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5700,7 +5701,8 @@ namespace Furnaces {
 		using DataHeatBalFanSys::MAT;
 		using namespace ScheduleManager;
 		using namespace DataZoneEnergyDemands;
-		using General::SolveRegulaFalsi;
+		using General::SolveRoot;
+		using General::RegisterRootSolverCaller;
 		using General::TrimSigDigits;
 		using DXCoils::DXCoilPartLoadRatio;
 
@@ -5710,6 +5712,9 @@ namespace Furnaces {
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		int const MaxIter( 100 ); // maximum number of iterations
 		Real64 const MinPLR( 0.0 ); // minimum part load ratio allowed
+		static int const HeatSolveIndex( RegisterRootSolverCaller( "Furnace:HeatingPLR" ) ); // root solver statistics index
+		static int const CoolSolveIndex( RegisterRootSolverCaller( "Furnace:CoolingPLR" ) ); // root solver statistics index
+		static int const LatSolveIndex( RegisterRootSolverCaller( "Furnace:LatentPLR" ) ); // root solver statistics index
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -5744,7 +5749,7 @@ namespace Furnaces {
 		Real64 TempLatentOutput; // Temporary Latent output of AC at increasing PLR (W)
 		//                                           ! (Temp variables are used to find min PLR for positive latent removal)
 		static bool HumControl( false ); // Logical flag signaling when dehumidification is required
-		FArray1D< Real64 > Par( 10 ); // parameters passed to RegulaFalsi function
+		FurnaceLoadParams LoadPar; // parameters passed to CalcFurnaceResidual
 		int SolFlag; // return flag from RegulaFalsi
 		Real64 TempMinPLR; // Temporary min latent PLR when hum control is required and iter is exceeded
 		Real64 TempMinPLR2; // Temporary min latent PLR when cyc fan hum control is required and iter is exceeded
@@ -5912,19 +5917,18 @@ namespace Furnaces {
 							HeatErrorToler = Furnace( FurnaceNum ).HeatingConvergenceTolerance; //Error tolerance for convergence from input deck
 
 							SolFlag = 0; // # of iterations if positive, -1 means failed to converge, -2 means bounds are incorrect
-							Par( 1 ) = double( FurnaceNum );
-							Par( 2 ) = 0.0; // FLAG, if 1.0 then FirstHVACIteration equals TRUE, if 0.0 then FirstHVACIteration equals false
-							if ( FirstHVACIteration ) Par( 2 ) = 1.0;
-							Par( 3 ) = double( OpMode );
-							Par( 4 ) = double( CompOp );
-							Par( 5 ) = SystemSensibleLoad;
-							Par( 6 ) = 0.0; // FLAG, 0.0 if heating load, 1.0 if cooling or moisture load
-							Par( 7 ) = 1.0; // FLAG, 0.0 if latent load, 1.0 if sensible load to be met
-							Par( 8 ) = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
-							Par( 9 ) = 0.0; // HXUnitOn is always false for HX
-							Par( 10 ) = 0.0;
+							LoadPar.FurnaceNum = FurnaceNum;
+							LoadPar.FirstHVACIteration = FirstHVACIteration;
+							LoadPar.FanOpMode = OpMode;
+							LoadPar.CompOp = CompOp;
+							LoadPar.LoadToBeMet = SystemSensibleLoad;
+							LoadPar.CoolingLoad = false; // heating load
+							LoadPar.SensibleLoad = true; // sensible load to be met
+							LoadPar.OnOffAirFlowRatio = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
+							LoadPar.HXUnitOn = false; // HXUnitOn is always false for HX
+							LoadPar.HeatingCoilPLR = 0.0;
 							//         HeatErrorToler is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-							SolveRegulaFalsi( HeatErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, Par );
+							SolveRoot( HeatErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, LoadPar, Furnace( FurnaceNum ).HeatPLRHint, HeatSolveIndex );
 							//         OnOffAirFlowRatio is updated during the above iteration. Reset to correct value based on PLR.
 							OnOffAirFlowRatio = OnOffAirFlowRatioSave;
 							if ( SolFlag == -1 ) {
@@ -6092,19 +6096,18 @@ namespace Furnaces {
 							HeatErrorToler = Furnace( FurnaceNum ).HeatingConvergenceTolerance; //Error tolerance for convergence from input deck
 
 							SolFlag = 0; // # of iterations if positive, -1 means failed to converge, -2 means bounds are incorrect
-							Par( 1 ) = double( FurnaceNum );
-							Par( 2 ) = 0.0; // FLAG, if 1.0 then FirstHVACIteration equals TRUE, if 0.0 then FirstHVACIteration equals false
-							if ( FirstHVACIteration ) Par( 2 ) = 1.0;
-							Par( 3 ) = double( OpMode );
-							Par( 4 ) = double( CompOp );
-							Par( 5 ) = SystemSensibleLoad;
-							Par( 6 ) = 0.0; // FLAG, 0.0 if heating load, 1.0 if cooling or moisture load
-							Par( 7 ) = 1.0; // FLAG, 0.0 if latent load, 1.0 if sensible load to be met
-							Par( 8 ) = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
-							Par( 9 ) = 0.0; // HXUnitOn is always false for HX
-							Par( 10 ) = 0.0;
+							LoadPar.FurnaceNum = FurnaceNum;
+							LoadPar.FirstHVACIteration = FirstHVACIteration;
+							LoadPar.FanOpMode = OpMode;
+							LoadPar.CompOp = CompOp;
+							LoadPar.LoadToBeMet = SystemSensibleLoad;
+							LoadPar.CoolingLoad = false; // heating load
+							LoadPar.SensibleLoad = true; // sensible load to be met
+							LoadPar.OnOffAirFlowRatio = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
+							LoadPar.HXUnitOn = false; // HXUnitOn is always false for HX
+							LoadPar.HeatingCoilPLR = 0.0;
 							//         HeatErrorToler is in fraction load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-							SolveRegulaFalsi( HeatErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, Par );
+							SolveRoot( HeatErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, LoadPar, Furnace( FurnaceNum ).HeatPLRHint, HeatSolveIndex );
 							//         OnOffAirFlowRatio is updated during the above iteration. Reset to correct value based on PLR.
 							OnOffAirFlowRatio = OnOffAirFlowRatioSave;
 							//         Reset HeatCoilLoad calculated in CalcFurnaceResidual (in case it was reset because output temp > DesignMaxOutletTemp)
@@ -6136,7 +6139,7 @@ namespace Furnaces {
 									CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, 0.0, TempMinPLR, HeatCoilLoad, 0.0, TempHeatOutput, TempLatentOutput, OnOffAirFlowRatio, false );
 								}
 								//           Now solve again with tighter PLR limits
-								SolveRegulaFalsi( HeatErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, TempMinPLR, TempMaxPLR, Par );
+								SolveRoot( HeatErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, TempMinPLR, TempMaxPLR, LoadPar, Furnace( FurnaceNum ).HeatPLRHint, HeatSolveIndex );
 								if ( ModifiedHeatCoilLoad > 0.0 ) {
 									HeatCoilLoad = ModifiedHeatCoilLoad;
 								} else {
@@ -6265,24 +6268,19 @@ namespace Furnaces {
 							// Calculate the sensible part load ratio through iteration
 							CoolErrorToler = Furnace( FurnaceNum ).CoolingConvergenceTolerance; //Error tolerance for convergence from input deck
 							SolFlag = 0; // # of iterations if positive, -1 means failed to converge, -2 means bounds are incorrect
-							Par( 1 ) = double( FurnaceNum );
-							Par( 2 ) = 0.0; // FLAG, if 1.0 then FirstHVACIteration equals TRUE, if 0.0 then FirstHVACIteration equals false
-							if ( FirstHVACIteration ) Par( 2 ) = 1.0;
-							Par( 3 ) = double( OpMode );
-							Par( 4 ) = double( CompOp );
-							Par( 5 ) = CoolCoilLoad;
-							Par( 6 ) = 1.0; // FLAG, 0.0 if heating load, 1.0 if cooling or moisture load
-							Par( 7 ) = 1.0; // FLAG, 0.0 if latent load, 1.0 if sensible load to be met
-							Par( 8 ) = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
-							if ( HXUnitOn ) {
-								Par( 9 ) = 1.0;
-							} else {
-								Par( 9 ) = 0.0;
-							}
-							//             Par(10) is the heating coil PLR, set this value to 0 for sensible PLR calculations.
-							Par( 10 ) = 0.0;
+							LoadPar.FurnaceNum = FurnaceNum;
+							LoadPar.FirstHVACIteration = FirstHVACIteration;
+							LoadPar.FanOpMode = OpMode;
+							LoadPar.CompOp = CompOp;
+							LoadPar.LoadToBeMet = CoolCoilLoad;
+							LoadPar.CoolingLoad = true; // cooling or moisture load
+							LoadPar.SensibleLoad = true; // sensible load to be met
+							LoadPar.OnOffAirFlowRatio = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
+							LoadPar.HXUnitOn = HXUnitOn;
+							//             HeatingCoilPLR is the heating coil PLR, set this value to 0 for sensible PLR calculations.
+							LoadPar.HeatingCoilPLR = 0.0;
 							//             CoolErrorToler is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-							SolveRegulaFalsi( CoolErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, Par );
+							SolveRoot( CoolErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, LoadPar, Furnace( FurnaceNum ).CoolPLRHint, CoolSolveIndex );
 							//             OnOffAirFlowRatio is updated during the above iteration. Reset to correct value based on PLR.
 							OnOffAirFlowRatio = OnOffAirFlowRatioSave;
 							if ( SolFlag == -1 ) {
@@ -6365,40 +6363,31 @@ namespace Furnaces {
 							CoolErrorToler = Furnace( FurnaceNum ).CoolingConvergenceTolerance; //Error tolerance for convergence
 
 							SolFlag = 0; // # of iterations if positive, -1 means failed to converge, -2 means bounds are incorrect
-							Par( 1 ) = double( FurnaceNum );
-							Par( 2 ) = 0.0; // FLAG, if 1.0 then FirstHVACIteration equals TRUE, if 0.0 then FirstHVACIteration equals false
-							if ( FirstHVACIteration ) Par( 2 ) = 1.0;
-							Par( 3 ) = double( OpMode );
-							Par( 4 ) = double( CompOp );
-							//           Multimode always controls to meet the SENSIBLE load (however, HXUnitOn is now TRUE)
-							if ( Furnace( FurnaceNum ).DehumidControlType_Num == DehumidControl_Multimode ) {
-								Par( 5 ) = CoolCoilLoad;
-							} else {
-								Par( 5 ) = SystemMoistureLoad;
-							}
-							Par( 6 ) = 1.0; // FLAG, 0.0 if heating load, 1.0 if cooling or moisture load
+							LoadPar.FurnaceNum = FurnaceNum;
+							LoadPar.FirstHVACIteration = FirstHVACIteration;
+							LoadPar.FanOpMode = OpMode;
+							LoadPar.CompOp = CompOp;
 							//           Multimode always controls to meet the SENSIBLE load (however, HXUnitOn is now TRUE)
 							if ( Furnace( FurnaceNum ).DehumidControlType_Num == DehumidControl_Multimode ) {
-								Par( 7 ) = 1.0; // FLAG, 0.0 if latent load, 1.0 if sensible load to be met
+								LoadPar.LoadToBeMet = CoolCoilLoad;
+								LoadPar.SensibleLoad = true; // sensible load to be met
 							} else {
-								Par( 7 ) = 0.0;
+								LoadPar.LoadToBeMet = SystemMoistureLoad;
+								LoadPar.SensibleLoad = false; // latent load to be met
 							}
-							Par( 8 ) = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
-							if ( HXUnitOn ) {
-								Par( 9 ) = 1.0;
+							LoadPar.CoolingLoad = true; // cooling or moisture load
+							LoadPar.OnOffAirFlowRatio = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
+							LoadPar.HXUnitOn = HXUnitOn;
+							//           HeatingCoilPLR used only with cycling fan.
+							//           HeatingCoilPLR is the heating coil PLR, set this value only if there is a heating load (heating PLR > 0)
+							//           and the latent PLR is being calculated. Otherwise set HeatingCoilPLR to 0.
+							if ( OpMode == CycFanCycCoil && Furnace( FurnaceNum ).HeatPartLoadRatio > 0.0 && ! LoadPar.SensibleLoad ) {
+								LoadPar.HeatingCoilPLR = Furnace( FurnaceNum ).HeatPartLoadRatio;
 							} else {
-								Par( 9 ) = 0.0;
-							}
-							//           Par(10) used only with cycling fan.
-							//           Par(10) is the heating coil PLR, set this value only if there is a heating load (heating PLR > 0)
-							//           and the latent PLR is being calculated. Otherwise set Par(10) to 0.
-							if ( OpMode == CycFanCycCoil && Furnace( FurnaceNum ).HeatPartLoadRatio > 0.0 && Par( 7 ) == 0.0 ) {
-								Par( 10 ) = Furnace( FurnaceNum ).HeatPartLoadRatio;
-							} else {
-								Par( 10 ) = 0.0;
+								LoadPar.HeatingCoilPLR = 0.0;
 							}
 							//           CoolErrorToler is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-							SolveRegulaFalsi( CoolErrorToler, MaxIter, SolFlag, LatentPartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, Par );
+							SolveRoot( CoolErrorToler, MaxIter, SolFlag, LatentPartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, LoadPar, Furnace( FurnaceNum ).LatPLRHint, LatSolveIndex );
 							//           OnOffAirFlowRatio is updated during the above iteration. Reset to correct value based on PLR.
 							OnOffAirFlowRatio = OnOffAirFlowRatioSave;
 							if ( SolFlag == -1 ) {
@@ -6411,12 +6400,12 @@ namespace Furnaces {
 									TempMaxPLR += 0.1;
 
 									//               Same calculation as is done in Function CalcFurnaceResidual for latent PLR calculation.
-									//               Set cooling to heating PLR for use with Subroutine CalcFurnaceOutput. IF Par(10) = 0,
+									//               Set cooling to heating PLR for use with Subroutine CalcFurnaceOutput. IF HeatingCoilPLR = 0,
 									//               heating PLR = 0 so set the CoolingHeatingPLRRatio to 1 so the cooling PLR is used in the
 									//               DX cooling coil calculations.
-									if ( Par( 10 ) > 0.0 ) {
-										//                 Par(10) = Furnace(FurnaceNum)%HeatPartLoadRatio
-										//                 OpMode = CycFan and Furnace(FurnaceNum)%HeatPartLoadRatio must be > 0 for Part(10) to be greater than 0
+									if ( LoadPar.HeatingCoilPLR > 0.0 ) {
+										//                 HeatingCoilPLR = Furnace(FurnaceNum)%HeatPartLoadRatio
+										//                 OpMode = CycFan and Furnace(FurnaceNum)%HeatPartLoadRatio must be > 0 for HeatingCoilPLR to be greater than 0
 										CoolingHeatingPLRRatio = min( 1.0, TempMaxPLR / Furnace( FurnaceNum ).HeatPartLoadRatio );
 									} else {
 										CoolingHeatingPLRRatio = 1.0;
@@ -6433,9 +6422,9 @@ namespace Furnaces {
 									TempMinPLR -= 0.001;
 
 									//               Set cooling to heating PLR for use with Subroutine CalcFurnaceOutput.
-									if ( Par( 10 ) > 0.0 ) {
-										//                 Par(10) = Furnace(FurnaceNum)%HeatPartLoadRatio
-										//                 OpMode = CycFan and Furnace(FurnaceNum)%HeatPartLoadRatio must be > 0 for Part(10) to be greater than 0
+									if ( LoadPar.HeatingCoilPLR > 0.0 ) {
+										//                 HeatingCoilPLR = Furnace(FurnaceNum)%HeatPartLoadRatio
+										//                 OpMode = CycFan and Furnace(FurnaceNum)%HeatPartLoadRatio must be > 0 for HeatingCoilPLR to be greater than 0
 										//                 Since the latent output of cycling fan systems is 0 at PLR=0, do not allow the PLR to be 0,
 										//                 otherwise RegulaFalsi can fail when a heating and moisture load exists and heating PLR > latent PLR.
 										TempMinPLR2 = max( 0.0000000001, TempMinPLR );
@@ -6448,15 +6437,15 @@ namespace Furnaces {
 									CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, TempMinPLR2, 0.0, 0.0, 0.0, TempCoolOutput, TempLatentOutput, OnOffAirFlowRatio, HXUnitOn, CoolingHeatingPLRRatio );
 								}
 								//             tighter boundary of solution has been found, call RegulaFalsi a second time
-								SolveRegulaFalsi( CoolErrorToler, MaxIter, SolFlag, LatentPartLoadRatio, CalcFurnaceResidual, TempMinPLR2, TempMaxPLR, Par );
+								SolveRoot( CoolErrorToler, MaxIter, SolFlag, LatentPartLoadRatio, CalcFurnaceResidual, TempMinPLR2, TempMaxPLR, LoadPar, Furnace( FurnaceNum ).LatPLRHint, LatSolveIndex );
 								//             OnOffAirFlowRatio is updated during the above iteration. Reset to correct value based on PLR.
 								OnOffAirFlowRatio = OnOffAirFlowRatioSave;
 								if ( SolFlag == -1 ) {
 
 									//               Set cooling to heating PLR for use with Subroutine CalcFurnaceOutput.
-									if ( Par( 10 ) > 0.0 ) {
-										//                 Par(10) = Furnace(FurnaceNum)%HeatPartLoadRatio
-										//                 OpMode = CycFan and Furnace(FurnaceNum)%HeatPartLoadRatio must be > 0 for Part(10) to be greater than 0
+									if ( LoadPar.HeatingCoilPLR > 0.0 ) {
+										//                 HeatingCoilPLR = Furnace(FurnaceNum)%HeatPartLoadRatio
+										//                 OpMode = CycFan and Furnace(FurnaceNum)%HeatPartLoadRatio must be > 0 for HeatingCoilPLR to be greater than 0
 										CoolingHeatingPLRRatio = min( 1.0, LatentPartLoadRatio / Furnace( FurnaceNum ).HeatPartLoadRatio );
 									} else {
 										CoolingHeatingPLRRatio = 1.0;
@@ -7351,21 +7340,21 @@ namespace Furnaces {
 	Real64
 	CalcFurnaceResidual(
 		Real64 const PartLoadRatio, // DX cooling coil part load ratio
-		Optional< FArray1S< Real64 > const > Par // Function parameters
+		FurnaceLoadParams const & Par // Function parameters
 	)
 	{
 
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Richard Raustad
 		//       DATE WRITTEN   Feb 2005
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2014: typed parameters for General::SolveRoot
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// To calculate the part-load ratio for cooling and heating coils
 
 		// METHODOLOGY EMPLOYED:
-		// Use SolveRegulaFalsi to call this Function to converge on a solution
+		// Use SolveRoot to call this Function to converge on a solution
 
 		// REFERENCES:
 		// na
@@ -7381,17 +7370,7 @@ namespace Furnaces {
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
-		//   Parameter description example:
-		//       Par(1)  = REAL(FurnaceNum,r64) ! Index to furnace
-		//       Par(2)  = 0.0                  ! FirstHVACIteration FLAG, if 1.0 then TRUE, if 0.0 then FALSE
-		//       Par(3)  = REAL(OpMode,r64)     ! Fan control, if 1.0 then cycling fan, if 0.0 then continuous fan
-		//       Par(4)  = REAL(CompOp,r64)     ! Compressor control, if 1.0 then compressor ON, if 0.0 then compressor OFF
-		//       Par(5)  = CoolCoilLoad         ! Sensible or Latent load to be met by furnace
-		//       Par(6)  = 1.0                  ! Type of load FLAG, 0.0 if heating load, 1.0 if cooling or moisture load
-		//       Par(7)  = 1.0                  ! Output calculation FLAG, 0.0 for latent capacity, 1.0 for sensible capacity
-		//       Par(8)  = OnOffAirFlowRatio    ! Ratio of compressor ON air mass flow to AVERAGE air mass flow over time step
-		//       Par(9)  = HXUnitOn             ! flag to enable HX, 1=ON and 2=OFF
-		//       Par(10) = HeatingCoilPLR       ! used to calculate latent degradation for cycling fan RH control
+		//   Parameters are described in FurnaceLoadParams
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		// na
@@ -7419,18 +7398,13 @@ namespace Furnaces {
 		bool HXUnitOn; // flag to enable HX based on zone moisture load
 		bool errFlag; // flag denoting error in runtime calculation
 
-		// Convert parameters to usable variables
-		FurnaceNum = int( Par()( 1 ) );
-		if ( Par()( 2 ) == 1.0 ) {
-			FirstHVACIteration = true;
-		} else {
-			FirstHVACIteration = false;
-		}
-		FanOpMode = int( Par()( 3 ) );
-		CompOp = int( Par()( 4 ) );
-		LoadToBeMet = Par()( 5 );
+		FurnaceNum = Par.FurnaceNum;
+		FirstHVACIteration = Par.FirstHVACIteration;
+		FanOpMode = Par.FanOpMode;
+		CompOp = Par.CompOp;
+		LoadToBeMet = Par.LoadToBeMet;
 
-		if ( Par()( 6 ) == 1.0 ) {
+		if ( Par.CoolingLoad ) {
 			CoolPartLoadRatio = PartLoadRatio;
 			HeatPartLoadRatio = 0.0;
 			HeatCoilLoad = 0.0;
@@ -7445,22 +7419,18 @@ namespace Furnaces {
 			}
 		}
 
-		//  OnOffAirFlowRatio = Par()(8)
+		//  OnOffAirFlowRatio = Par.OnOffAirFlowRatio
 		if ( Furnace( FurnaceNum ).FurnaceType_Num == UnitarySys_HeatPump_WaterToAir ) {
 			HeatPumpRunFrac( FurnaceNum, PartLoadRatio, errFlag, RuntimeFrac );
 			Furnace( FurnaceNum ).CompPartLoadRatio = PartLoadRatio;
 			Furnace( FurnaceNum ).WSHPRuntimeFrac = RuntimeFrac;
 		}
 
-		if ( Par()( 9 ) == 1.0 ) {
-			HXUnitOn = true;
-		} else {
-			HXUnitOn = false;
-		}
+		HXUnitOn = Par.HXUnitOn;
 
-		if ( Par()( 10 ) > 0.0 ) {
-			//    Par()(10) = Furnace(FurnaceNum)%HeatPartLoadRatio
-			//    FanOpMode = CycFan and Furnace(FurnaceNum)%HeatPartLoadRatio must be > 0 for Part(10) to be greater than 0
+		if ( Par.HeatingCoilPLR > 0.0 ) {
+			//    Par.HeatingCoilPLR = Furnace(FurnaceNum)%HeatPartLoadRatio
+			//    FanOpMode = CycFan and Furnace(FurnaceNum)%HeatPartLoadRatio must be > 0 for HeatingCoilPLR to be greater than 0
 			//    This variable used when in heating mode and dehumidification (cooling) is required.
 			CoolingHeatingPLRRatio = min( 1.0, CoolPartLoadRatio / Furnace( FurnaceNum ).HeatPartLoadRatio );
 		} else {
@@ -7473,7 +7443,7 @@ namespace Furnaces {
 		CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, FanOpMode, CompOp, CoolPartLoadRatio, HeatPartLoadRatio, HeatCoilLoad, 0.0, SensibleLoadMet, LatentLoadMet, OnOffAirFlowRatio, HXUnitOn, CoolingHeatingPLRRatio );
 
 		// Calculate residual based on output calculation flag
-		if ( Par()( 7 ) == 1.0 ) {
+		if ( Par.SensibleLoad ) {
 			if ( LoadToBeMet == 0.0 ) {
 				Residuum = ( SensibleLoadMet - LoadToBeMet ) / 100.0;
 			} else {
@@ -10,6 +10,7 @@
 #include <EnergyPlus.hh>
 #include <VariableSpeedCoils.hh>
 #include <DataGlobals.hh>
+#include <DataRootFinder.hh>
 
 namespace EnergyPlus {
 
@@ -184,6 +185,9 @@ namespace Furnaces {
 		int HeatingMaxIterIndex; // Index to recurring warning message
 		int HeatingMaxIterIndex2; // Index to recurring warning message
 		int HeatingRegulaFalsiFailedIndex; // Index to recurring warning messages
+		DataRootFinder::RootSolverHintType HeatPLRHint; // last converged heating PLR
+		DataRootFinder::RootSolverHintType CoolPLRHint; // last converged cooling PLR for sensible load
+		DataRootFinder::RootSolverHintType LatPLRHint; // last converged cooling PLR for moisture load
 		Real64 ActualFanVolFlowRate; // Volumetric flow rate from fan object
 		Real64 HeatingSpeedRatio; // Fan speed ratio in heating mode
 		Real64 CoolingSpeedRatio; // Fan speed ratio in cooling mode
@@ -660,6 +664,36 @@ namespace Furnaces {
 
 	};
 
+	struct FurnaceLoadParams // Parameters of CalcFurnaceResidual
+	{
+		// Members
+		int FurnaceNum; // Index to furnace
+		bool FirstHVACIteration; // FirstHVACIteration flag
+		int FanOpMode; // Cycling fan or constant fan
+		int CompOp; // Compressor on/off; 1=on, 0=off
+		Real64 LoadToBeMet; // Sensible or Latent load to be met by furnace
+		bool CoolingLoad; // true if the PLR applies to the cooling coil (cooling or moisture load)
+		bool SensibleLoad; // true if a sensible load is to be met, false for latent
+		Real64 OnOffAirFlowRatio; // Ratio of compressor ON air mass flow to AVERAGE air mass flow over time step
+		bool HXUnitOn; // flag to enable HX based on zone moisture load
+		Real64 HeatingCoilPLR; // used to calculate latent degradation for cycling fan RH control
+
+		// Default Constructor
+		FurnaceLoadParams() :
+			FurnaceNum( 0 ),
+			FirstHVACIteration( false ),
+			FanOpMode( 0 ),
+			CompOp( 0 ),
+			LoadToBeMet( 0.0 ),
+			CoolingLoad( false ),
+			SensibleLoad( true ),
+			OnOffAirFlowRatio( 1.0 ),
+			HXUnitOn( false ),
+			HeatingCoilPLR( 0.0 )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< FurnaceEquipConditions > Furnace;
 
@@ -774,7 +808,7 @@ namespace Furnaces {
 	Real64
 	CalcFurnaceResidual(
 		Real64 const PartLoadRatio, // DX cooling coil part load ratio
-		Optional< FArray1S< Real64 > const > Par = _ // Function parameters
+		FurnaceLoadParams const & Par // Function parameters
 	);
 
 	Real64
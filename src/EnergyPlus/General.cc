@@ -14,6 +14,7 @@
 #include <DataHVACGlobals.hh>
 #include <DataIPShortCuts.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataRootFinder.hh>
 #include <DataRuntimeLanguage.hh>
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
@@ -210,6 +211,87 @@ namespace General {
 
 	}
 
+	int
+	RegisterRootSolverCaller( std::string const & Name ) // Call site name, e.g. "UnitarySystem:SensiblePLR"
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the counter index for a SolveRoot call site, creating it on first use.
+		// Call sites normally keep the index in a function-local static.
+
+		// Using/Aliasing
+		using DataRootFinder::RootSolverCaller;
+		using DataRootFinder::RootSolverCallerType;
+
+		for ( std::vector< RootSolverCallerType >::size_type Loop = 0; Loop < RootSolverCaller.size(); ++Loop ) {
+			if ( RootSolverCaller[ Loop ].Name == Name ) return Loop + 1;
+		}
+		RootSolverCaller.push_back( RootSolverCallerType( Name ) );
+		return RootSolverCaller.size();
+
+	}
+
+	void
+	ReportRootSolverCallers()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the residual evaluation counts of each SolveRoot call site to the audit file
+		// so the equipment that spends the most iterations can be found. The same counts are
+		// reported in the Root Solver Calls table of the Object Count Summary.
+
+		// Using/Aliasing
+		using DataRootFinder::RootSolverCaller;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtLD( "*" );
+		static gio::Fmt const fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int EchoInputFile; // found unit number for "eplusout.audit"
+		std::string cSolves;
+		std::string cResiduals;
+		std::string cWarmStarts;
+		std::string cWarmStartHits;
+		std::string cNotConverged;
+		std::string cNotBracketed;
+
+		if ( RootSolverCaller.empty() ) return;
+		EchoInputFile = FindUnitNumber( "eplusout.audit" );
+		if ( EchoInputFile == 0 ) return;
+
+		gio::write( EchoInputFile, fmtA ) << "Root Solver Caller,#Solves,#Residual Calls,Avg Residual Calls,#Warm Starts,#Warm Start Hits,#Not Converged,#Not Bracketed";
+		for ( auto const & caller : RootSolverCaller ) {
+			if ( caller.NumSolves == 0 ) continue;
+			gio::write( cSolves, fmtLD ) << caller.NumSolves;
+			strip( cSolves );
+			gio::write( cResiduals, fmtLD ) << caller.NumResidualCalls;
+			strip( cResiduals );
+			gio::write( cWarmStarts, fmtLD ) << caller.NumWarmStarts;
+			strip( cWarmStarts );
+			gio::write( cWarmStartHits, fmtLD ) << caller.NumWarmStartHits;
+			strip( cWarmStartHits );
+			gio::write( cNotConverged, fmtLD ) << caller.NumNotConverged;
+			strip( cNotConverged );
+			gio::write( cNotBracketed, fmtLD ) << caller.NumNotBracketed;
+			strip( cNotBracketed );
+			gio::write( EchoInputFile, fmtA ) << caller.Name + ',' + cSolves + ',' + cResiduals + ',' + RoundSigDigits( double( caller.NumResidualCalls ) / double( caller.NumSolves ), 2 ) + ',' + cWarmStarts + ',' + cWarmStartHits + ',' + cNotConverged + ',' + cNotBracketed;
+		}
+
+	}
+
 	Real64
 	InterpSw(
 		Real64 const SwitchFac, // Switching factor: 0.0 if glazing is unswitched, = 1.0 if fully switched
@@ -2,7 +2,10 @@
 #define General_hh_INCLUDED
 
 // C++ Headers
+#include <algorithm>
+#include <cmath>
 #include <functional>
+#include <string>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
@@ -12,6 +15,7 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <DataRootFinder.hh>
 
 namespace EnergyPlus {
 
@@ -51,6 +55,151 @@ namespace General {
 		Optional< FArray1S< Real64 > const > Par = _ // array with additional parameters used for function evaluation
 	);
 
+	int
+	RegisterRootSolverCaller( std::string const & Name ); // Call site name, e.g. "UnitarySystem:SensiblePLR"
+
+	void
+	ReportRootSolverCallers();
+
+	template< typename ParamsType, typename ResidualFunc >
+	void
+	SolveRoot(
+		Real64 const Eps, // required absolute accuracy
+		int const MaxIte, // maximum number of allowed iterations
+		int & Flag, // integer storing exit status, as for SolveRegulaFalsi
+		Real64 & XRes, // value of x that solves f(x,Par) = 0
+		ResidualFunc const & f, // residual, called as f( x, Par )
+		Real64 const X_0, // 1st bound of interval that contains the solution
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		ParamsType const & Par, // typed parameters used for function evaluation
+		DataRootFinder::RootSolverHintType & Hint, // last converged solution of this component
+		int const CallerIndex // from RegisterRootSolverCaller
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Allocation-free alternative to SolveRegulaFalsi. The residual is any callable taking
+		// the trial x and a typed parameter struct, so no std::function or FArray1S Par array
+		// is built per call. Exit status in Flag has the same meaning as for SolveRegulaFalsi.
+
+		// METHODOLOGY EMPLOYED:
+		// False position with the Illinois modification: when the same end of the bracket is
+		// retained twice in a row its function value is halved, which removes the one-sided
+		// stalling of plain regula falsi on convex residuals such as coil PLR curves.
+		// If the hint from the previous converged solve lies inside the bracket it is tried
+		// first and replaces the bracket end with the same sign.
+		// Residual evaluations are counted against CallerIndex.
+
+		// REFERENCES:
+		// Dowell, M. and Jarratt, P. 1971. A modified regula falsi method for computing the
+		// root of an equation. BIT 11, 168-174.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const SMALL( 1.e-10 );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 X0( X_0 ); // present 1st bound
+		Real64 X1( X_1 ); // present 2nd bound
+		Real64 XTemp( X_0 ); // new estimate
+		Real64 Y0; // f at X0
+		Real64 Y1; // f at X1
+		Real64 YTemp; // f at XTemp
+		Real64 DY; // DY = Y0 - Y1
+		int Side( 0 ); // bracket end retained last: -1 = X0 replaced, 1 = X1 replaced
+		int NIte( 0 ); // number of iterations
+		Int64 NEval( 0 ); // number of residual evaluations
+		bool Conv( false ); // flag, true if convergence is achieved
+
+		auto & caller( DataRootFinder::RootSolverCaller[ CallerIndex - 1 ] );
+		++caller.NumSolves;
+
+		Y0 = f( X0, Par );
+		Y1 = f( X1, Par );
+		NEval += 2;
+		// check initial values
+		if ( Y0 * Y1 > 0 ) {
+			Flag = -2;
+			XRes = X0;
+			Hint.Valid = false;
+			caller.NumResidualCalls += NEval;
+			++caller.NumNotBracketed;
+			return;
+		}
+
+		// warm start from the last converged solution of this component
+		if ( Hint.Valid && Hint.XLast > std::min( X0, X1 ) && Hint.XLast < std::max( X0, X1 ) ) {
+			++caller.NumWarmStarts;
+			XTemp = Hint.XLast;
+			YTemp = f( XTemp, Par );
+			++NEval;
+			if ( std::abs( YTemp ) < Eps ) {
+				++caller.NumWarmStartHits;
+				caller.NumResidualCalls += NEval;
+				Flag = 1;
+				XRes = XTemp;
+				return;
+			}
+			if ( ( YTemp < 0.0 ) == ( Y0 < 0.0 ) ) {
+				X0 = XTemp;
+				Y0 = YTemp;
+			} else {
+				X1 = XTemp;
+				Y1 = YTemp;
+			}
+		}
+
+		while ( true ) {
+
+			DY = Y0 - Y1;
+			if ( std::abs( DY ) < SMALL ) DY = SMALL;
+			// new estimation
+			XTemp = ( Y0 * X1 - Y1 * X0 ) / DY;
+			YTemp = f( XTemp, Par );
+			++NEval;
+			++NIte;
+
+			// check convergence
+			if ( std::abs( YTemp ) < Eps ) {
+				Conv = true;
+				break;
+			}
+			if ( NIte > MaxIte ) break;
+
+			// reassign values, halving the retained end if it was also retained last time
+			if ( ( YTemp < 0.0 ) == ( Y0 < 0.0 ) ) {
+				X0 = XTemp;
+				Y0 = YTemp;
+				if ( Side == -1 ) Y1 *= 0.5;
+				Side = -1;
+			} else {
+				X1 = XTemp;
+				Y1 = YTemp;
+				if ( Side == 1 ) Y0 *= 0.5;
+				Side = 1;
+			}
+
+		}
+
+		caller.NumResidualCalls += NEval;
+		if ( Conv ) {
+			Flag = NIte;
+			Hint.Valid = true;
+			Hint.XLast = XTemp;
+		} else {
+			Flag = -1;
+			Hint.Valid = false;
+			++caller.NumNotConverged;
+		}
+		XRes = XTemp;
+
+	}
+
 	Real64
 	InterpSw(
 		Real64 const SwitchFac, // Switching factor: 0.0 if glazing is unswitched, = 1.0 if fully switched
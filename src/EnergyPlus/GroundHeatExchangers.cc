@@ -4,6 +4,7 @@
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
+#include <ObjexxFCL/gio.hh>
 
 // EnergyPlus Headers
 #include <GroundHeatExchangers.hh>
@@ -14,6 +15,8 @@
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -46,12 +49,17 @@ namespace GroundHeatExchangers {
 	// The heat pulse histories need to be recorded over an extended period (months).
 	// To aid computational efficiency past pulses are continuously agregated into
 	// equivalent heat pulses of longer duration, as each pulse becomes less recent.
+	// With multi-level aggregation the completed hours are instead kept in a fixed number
+	// of bins whose durations double every AggBinsPerLevel bins, so the cost of a timestep
+	// does not grow with the elapsed simulation time.
 
 	// REFERENCES:
 	// Eskilson, P. 'Thermal Analysis of Heat Extraction Boreholes' Ph.D. Thesis:
 	//   Dept. of Mathematical Physics, University of Lund, Sweden, June 1987.
 	// Yavuzturk, C., J.D. Spitler. 1999. 'A Short Time Step Response Factor Model
 	//   for Vertical Ground Loop Heat Exchangers. ASHRAE Transactions. 105(2): 475-485.
+	// Claesson, J., S. Javed. 2012. 'A Load-Aggregation Method to Calculate Extraction
+	//   Temperatures of Borehole Heat Exchangers. ASHRAE Transactions. 118(1): 530-539.
 
 	// Using/Aliasing
 	using namespace DataPrecisionGlobals;
@@ -79,6 +87,10 @@ namespace GroundHeatExchangers {
 	Real64 const HrsPerDay( 24.0 ); // Number of hours in a day
 	Real64 const HrsPerMonth( 730.0 ); // Number of hours in month
 	int const MaxTSinHr( 60 ); // Max number of time step in a hour
+	int const AggBinsPerLevel( 8 ); // Number of multi-level aggregation bins of each duration
+	int const MaxAggOffsets( 2 * MaxTSinHr ); // Max number of sub-hourly window lengths with stored bin edge g-functions
+	int const MaxAggWindowSec( 7200 ); // Longest sub-hourly window ahead of the aggregation bins [s]
+	int const AggBenchmarkYears( 20 ); // Length of the synthetic load profile of the aggregation benchmark
 
 	// MODULE VARIABLE DECLARATIONS:
 	int NumVerticalGlhes( 0 );
@@ -269,6 +281,7 @@ namespace GroundHeatExchangers {
 		// due to Aggregated heat extraction/rejection step
 		Real64 SumQnHourly; // same as above for hourly
 		Real64 SumQnSubHourly; // same as above for subhourly( with no aggreation]
+		Real64 SumQnAggregated; // same as above for the multi-level aggregation bins
 		Real64 RQMonth;
 		Real64 RQHour;
 		Real64 RQSubHr;
@@ -331,6 +344,7 @@ namespace GroundHeatExchangers {
 				VerticalGlhe( I ).QnMonthlyAgg = 0.0;
 				VerticalGlhe( I ).QnSubHr = 0.0;
 				VerticalGlhe( I ).LastHourN = 1;
+				if ( VerticalGlhe( I ).MultiLevelAgg ) VerticalGlhe( I ).AggBinQ = 0.0;
 			}
 			N = 1;
 			UpdateCurSimTime = false;
@@ -390,8 +404,49 @@ namespace GroundHeatExchangers {
 				ToutNew = Tground - tmpQnSubHourly * ( GfuncVal / ( K_Ground_Factor ) + ResistanceBhole - C_1 );
 			}
 		} else {
+			if ( VerticalGlhe( GlheNum ).MultiLevelAgg ) { // multi-level aggregation
+
+				// Sub-hourly superposition of the steps since the last hour that was moved into the bins
+				SubHourlyLimit = max( min( N - VerticalGlhe( GlheNum ).LastHourN( 2 ), isize( VerticalGlhe( GlheNum ).QnSubHr ) - 1 ), 1 );
+				SumQnSubHourly = 0.0;
+				for ( I = 1; I <= SubHourlyLimit; ++I ) {
+					XI = std::log( ( CurrentSimTime - PrevTimeSteps( I + 1 ) ) / ( TimeSS_Factor ) );
+					INTERP( GlheNum, XI, GfuncVal );
+					RQSubHr = GfuncVal / ( K_Ground_Factor );
+					if ( I == SubHourlyLimit ) {
+						SumQnSubHourly += VerticalGlhe( GlheNum ).QnSubHr( I ) * RQSubHr;
+					} else {
+						SumQnSubHourly += ( VerticalGlhe( GlheNum ).QnSubHr( I ) - VerticalGlhe( GlheNum ).QnSubHr( I + 1 ) ) * RQSubHr;
+					}
+				}
+
+				// Superposition of the aggregation bins, which start where the sub-hourly steps end
+				SumQnAggregated = AggregationBinResponse( GlheNum, CurrentSimTime - PrevTimeSteps( SubHourlyLimit + 1 ), TimeSS_Factor ) / ( K_Ground_Factor );
+
+				SumTotal = SumQnSubHourly + SumQnAggregated;
+
+				//Calulate the subhourly temperature due the Last Time steps Load
+				XI = std::log( ( CurrentSimTime - PrevTimeSteps( 2 ) ) / ( TimeSS_Factor ) );
+				INTERP( GlheNum, XI, GfuncVal );
+				RQSubHr = GfuncVal / ( K_Ground_Factor );
+
+				if ( MDotActual <= 0.0 ) {
+					tmpQnSubHourly = 0.0;
+					FluidAveTemp = Tground - SumTotal; // Q(N)*RB = 0
+					ToutNew = GlheInletTemp;
+				} else {
+					// Explicit set of equations to calculate the New Outlet Temperature of the U-Tube
+					C0 = RQSubHr;
+					C1 = Tground - ( SumTotal - VerticalGlhe( GlheNum ).QnSubHr( 1 ) * RQSubHr );
+					C2 = BholeLength * NumBholes / ( 2.0 * MDotActual * Cp_Fluid );
+					C3 = MDotActual * Cp_Fluid / ( BholeLength * NumBholes );
+					tmpQnSubHourly = ( C1 - GlheInletTemp ) / ( ResistanceBhole + C0 - C2 + ( 1 / C3 ) );
+					FluidAveTemp = C1 - ( C0 + ResistanceBhole ) * tmpQnSubHourly;
+					ToutNew = C1 + ( C2 - C0 - ResistanceBhole ) * tmpQnSubHourly;
+				}
+
 			// no monthly super position
-			if ( CurrentSimTime < ( HrsPerMonth + AGG + SubAGG ) ) {
+			} else if ( CurrentSimTime < ( HrsPerMonth + AGG + SubAGG ) ) {
 
 				// Calculate the Sub Hourly Superposition
 				SumQnSubHourly = 0.0;
@@ -637,6 +692,8 @@ namespace GroundHeatExchangers {
 			SumQnHr /= std::abs( PrevTimeSteps( 1 ) - PrevTimeSteps( J ) );
 			VerticalGlhe( GlheNum ).QnHr = eoshift( VerticalGlhe( GlheNum ).QnHr, -1, SumQnHr );
 			VerticalGlhe( GlheNum ).LastHourN = eoshift( VerticalGlhe( GlheNum ).LastHourN, -1, N );
+			// the hour before the one just completed leaves the sub-hourly window of the multi-level method
+			if ( VerticalGlhe( GlheNum ).MultiLevelAgg ) ShiftLoadAggregationBins( GlheNum, VerticalGlhe( GlheNum ).QnHr( 2 ) );
 		}
 
 		//CHECK IF A MONTH PASSES...
@@ -687,6 +744,8 @@ namespace GroundHeatExchangers {
 		using General::RoundSigDigits;
 		using DataEnvironment::MaxNumberSimYears;
 		using PlantUtilities::RegisterPlantCompDesignFlow;
+		using DataSystemVariables::GLHEMultiLevelAgg;
+		using DataSystemVariables::GLHEAggBenchmark;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -823,6 +882,10 @@ namespace GroundHeatExchangers {
 			if ( ErrorsFound ) {
 				ShowFatalError( "Errors found in processing input for " + cCurrentModuleObject );
 			}
+
+			if ( GLHEAggBenchmark ) BenchmarkLoadAggregation( GlheNum );
+			VerticalGlhe( GlheNum ).MultiLevelAgg = GLHEMultiLevelAgg;
+			if ( VerticalGlhe( GlheNum ).MultiLevelAgg ) InitLoadAggregationBins( GlheNum, VerticalGlhe( GlheNum ).MaxSimYears );
 		}
 
 		//Set up report variables
@@ -1120,6 +1183,296 @@ namespace GroundHeatExchangers {
 
 	//******************************************************************************
 
+	void
+	InitLoadAggregationBins(
+		int const GlheNum, // Ground loop heat exchanger ID number
+		int const NumYears // Length of load history to be covered by the bins (years)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets up the multi-level load aggregation bins of a GLHE.
+
+		// METHODOLOGY EMPLOYED:
+		// The first AggBinsPerLevel bins are one hour long and the bins of each following
+		// level are twice as long as those of the level before. Levels are added until the
+		// bins cover NumYears, so 20 years are held in 120 bins. The bin edges are fixed, so
+		// the g-function values at the edges are evaluated once for each sub-hourly window
+		// length and kept in AggGEdge.
+
+		// REFERENCES:
+		// Claesson, J., S. Javed. 2012. 'A Load-Aggregation Method to Calculate Extraction
+		//   Temperatures of Borehole Heat Exchangers. ASHRAE Transactions. 118(1): 530-539.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumAggBins; // Number of bins
+		int BinNum;
+		Real64 Width; // Duration of the bins of a level [hr]
+		Real64 TotalHours; // Duration covered by the bins [hr]
+
+		NumAggBins = 0;
+		Width = 1.0;
+		TotalHours = 0.0;
+		while ( TotalHours < NumYears * 365.0 * HrsPerDay ) {
+			NumAggBins += AggBinsPerLevel;
+			TotalHours += AggBinsPerLevel * Width;
+			Width *= 2.0;
+		}
+
+		VerticalGlhe( GlheNum ).NumAggBins = NumAggBins;
+		VerticalGlhe( GlheNum ).AggBinQ.allocate( NumAggBins );
+		VerticalGlhe( GlheNum ).AggBinQ = 0.0;
+		VerticalGlhe( GlheNum ).AggBinWidth.allocate( NumAggBins );
+		VerticalGlhe( GlheNum ).AggBinEdge.allocate( {0,NumAggBins} );
+		VerticalGlhe( GlheNum ).AggOffsetSlot.allocate( {0,MaxAggWindowSec} );
+		VerticalGlhe( GlheNum ).AggOffsetSlot = 0;
+		VerticalGlhe( GlheNum ).AggGEdge.allocate( {0,NumAggBins}, MaxAggOffsets );
+		VerticalGlhe( GlheNum ).AggGEdge = 0.0;
+		VerticalGlhe( GlheNum ).NumAggOffsets = 0;
+
+		Width = 1.0;
+		VerticalGlhe( GlheNum ).AggBinEdge( 0 ) = 0.0;
+		for ( BinNum = 1; BinNum <= NumAggBins; ++BinNum ) {
+			VerticalGlhe( GlheNum ).AggBinWidth( BinNum ) = Width;
+			VerticalGlhe( GlheNum ).AggBinEdge( BinNum ) = VerticalGlhe( GlheNum ).AggBinEdge( BinNum - 1 ) + Width;
+			if ( mod( BinNum, AggBinsPerLevel ) == 0 ) Width *= 2.0;
+		}
+
+	}
+
+	//******************************************************************************
+
+	void
+	ShiftLoadAggregationBins(
+		int const GlheNum, // Ground loop heat exchanger ID number
+		Real64 const QnHour // Normalised heat extraction/rejection rate of the hour leaving the sub-hourly window [W/m]
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Moves the load history one hour further into the past.
+
+		// METHODOLOGY EMPLOYED:
+		// Each bin passes the fraction 1/width of its load on to the next older bin and takes
+		// the same fraction from the next younger bin; the first bin takes QnHour. The bins
+		// are updated from the oldest so that every bin takes the load its neighbour had
+		// before the shift. Load shifted out of the oldest bin is beyond the covered history.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int BinNum;
+
+		for ( BinNum = VerticalGlhe( GlheNum ).NumAggBins; BinNum >= 2; --BinNum ) {
+			VerticalGlhe( GlheNum ).AggBinQ( BinNum ) += ( VerticalGlhe( GlheNum ).AggBinQ( BinNum - 1 ) - VerticalGlhe( GlheNum ).AggBinQ( BinNum ) ) / VerticalGlhe( GlheNum ).AggBinWidth( BinNum );
+		}
+		VerticalGlhe( GlheNum ).AggBinQ( 1 ) += ( QnHour - VerticalGlhe( GlheNum ).AggBinQ( 1 ) ) / VerticalGlhe( GlheNum ).AggBinWidth( 1 );
+
+	}
+
+	//******************************************************************************
+
+	Real64
+	AggregationBinResponse(
+		int const GlheNum, // Ground loop heat exchanger ID number
+		Real64 const Offset, // Length of the sub-hourly window ahead of the bins [hr]
+		Real64 const TimeSS_Factor // Steady state time of the borefield [hr]
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the superposed response of the aggregation bins: the sum over the bins of
+		// the bin load times the increase of the g-function across the bin [W/m].
+
+		// METHODOLOGY EMPLOYED:
+		// The bins start Offset hours before the current time. The offset is rounded to the
+		// second, and the g-function at every bin edge is interpolated the first time an
+		// offset is seen and kept for the rest of the run, so that each later call is a
+		// single pass over the bins without interpolation. When MaxAggOffsets offsets are
+		// already kept, the g-function is interpolated at each edge.
+
+		// Return value
+		Real64 Response;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int OffsetSec; // Offset rounded to the second
+		int Slot; // AggGEdge column of the offset (0 if not kept)
+		int BinNum;
+		Real64 Age; // Time since a bin edge [hr]
+		Real64 GfuncVal;
+		Real64 GfuncPrev;
+
+		OffsetSec = nint( Offset * SecInHour );
+		Slot = 0;
+		if ( OffsetSec > 0 && OffsetSec <= MaxAggWindowSec ) {
+			Slot = VerticalGlhe( GlheNum ).AggOffsetSlot( OffsetSec );
+			if ( Slot == 0 && VerticalGlhe( GlheNum ).NumAggOffsets < MaxAggOffsets ) {
+				Slot = ++VerticalGlhe( GlheNum ).NumAggOffsets;
+				VerticalGlhe( GlheNum ).AggOffsetSlot( OffsetSec ) = Slot;
+				for ( BinNum = 0; BinNum <= VerticalGlhe( GlheNum ).NumAggBins; ++BinNum ) {
+					Age = OffsetSec / SecInHour + VerticalGlhe( GlheNum ).AggBinEdge( BinNum );
+					INTERP( GlheNum, std::log( Age / TimeSS_Factor ), GfuncVal );
+					VerticalGlhe( GlheNum ).AggGEdge( BinNum, Slot ) = GfuncVal;
+				}
+			}
+		}
+
+		Response = 0.0;
+		if ( Slot > 0 ) {
+			for ( BinNum = 1; BinNum <= VerticalGlhe( GlheNum ).NumAggBins; ++BinNum ) {
+				Response += VerticalGlhe( GlheNum ).AggBinQ( BinNum ) * ( VerticalGlhe( GlheNum ).AggGEdge( BinNum, Slot ) - VerticalGlhe( GlheNum ).AggGEdge( BinNum - 1, Slot ) );
+			}
+		} else if ( Offset > 0.0 ) {
+			INTERP( GlheNum, std::log( Offset / TimeSS_Factor ), GfuncPrev );
+			for ( BinNum = 1; BinNum <= VerticalGlhe( GlheNum ).NumAggBins; ++BinNum ) {
+				INTERP( GlheNum, std::log( ( Offset + VerticalGlhe( GlheNum ).AggBinEdge( BinNum ) ) / TimeSS_Factor ), GfuncVal );
+				Response += VerticalGlhe( GlheNum ).AggBinQ( BinNum ) * ( GfuncVal - GfuncPrev );
+				GfuncPrev = GfuncVal;
+			}
+		}
+
+		return Response;
+
+	}
+
+	//******************************************************************************
+
+	void
+	BenchmarkLoadAggregation( int const GlheNum )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Times the standard monthly and hourly superposition against the multi-level
+		// aggregation bins over a synthetic load profile of AggBenchmarkYears, and writes the
+		// run times and the difference in borehole wall temperature to the audit file.
+
+		// METHODOLOGY EMPLOYED:
+		// The load is prescribed hour by hour: a 5 W/m imbalance, a 25 W/m annual swing and
+		// a 10 W/m daily swing. With hourly steps there is no sub-hourly history. The standard
+		// method superposes the completed months (once AGG + SubAGG hours have passed since the
+		// end of the month) as monthly averages and the hours after them one by one, with one
+		// g-function interpolation per term as in CalcVerticalGroundHeatExchanger. The
+		// multi-level method superposes the current hour and the aggregation bins.
+
+		// Using/Aliasing
+		using DataTimings::epElapsedTime;
+		using General::RoundSigDigits;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+		int const NumHours( AggBenchmarkYears * 8760 ); // Length of the load profile [hr]
+		int const HoursInMonth( HrsPerMonth );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int EchoInputFile; // found unit number for "eplusout.audit"
+		int HourNum;
+		int MonthNum;
+		int CurrentMonth; // The Month upto which the Montly blocks are superposed
+		int I;
+		Real64 TimeSS_Factor; // Steady state time [hr]
+		Real64 K_Ground_Factor;
+		Real64 XI;
+		Real64 GfuncVal;
+		Real64 GfuncHour; // G-function one hour after a load step
+		Real64 SumQn; // Superposed response [W/m]
+		Real64 QnPrev; // Load of the previous block of the superposition [W/m]
+		Real64 TimeStart;
+		Real64 TimeStandard; // Run time of the standard method [s]
+		Real64 TimeMultiLevel; // Run time of the multi-level method [s]
+		Real64 MaxDiff; // Largest difference in borehole wall temperature [deltaC]
+		Real64 SumSqDiff;
+		FArray1D< Real64 > QnHour( NumHours ); // Synthetic hourly load [W/m]
+		FArray1D< Real64 > QnMonth( NumHours / HoursInMonth ); // Monthly average load [W/m]
+		FArray1D< Real64 > DeltaTStandard( NumHours ); // Borehole wall temperature change, standard method [deltaC]
+		FArray1D< Real64 > DeltaTMultiLevel( NumHours ); // Borehole wall temperature change, multi-level method [deltaC]
+
+		EchoInputFile = FindUnitNumber( "eplusout.audit" );
+		if ( EchoInputFile == 0 ) return;
+
+		TimeSS_Factor = pow_2( VerticalGlhe( GlheNum ).BoreholeLength ) / ( 9.0 * VerticalGlhe( GlheNum ).KGround / VerticalGlhe( GlheNum ).CpRhoGround ) / SecInHour;
+		K_Ground_Factor = 2.0 * Pi * VerticalGlhe( GlheNum ).KGround;
+
+		for ( HourNum = 1; HourNum <= NumHours; ++HourNum ) {
+			QnHour( HourNum ) = 5.0 + 25.0 * std::cos( 2.0 * Pi * HourNum / 8760.0 ) + 10.0 * std::sin( 2.0 * Pi * HourNum / HrsPerDay );
+		}
+
+		// standard monthly and hourly superposition
+		TimeStart = epElapsedTime();
+		for ( HourNum = 1; HourNum <= NumHours; ++HourNum ) {
+			if ( mod( HourNum, HoursInMonth ) == 0 ) {
+				MonthNum = HourNum / HoursInMonth;
+				QnMonth( MonthNum ) = sum( QnHour( {HourNum - HoursInMonth + 1, HourNum} ) ) / HrsPerMonth;
+			}
+			CurrentMonth = 0;
+			if ( HourNum >= VerticalGlhe( GlheNum ).AGG + VerticalGlhe( GlheNum ).SubAGG ) {
+				CurrentMonth = ( HourNum - VerticalGlhe( GlheNum ).AGG - VerticalGlhe( GlheNum ).SubAGG ) / HoursInMonth;
+			}
+			SumQn = 0.0;
+			QnPrev = 0.0;
+			for ( MonthNum = 1; MonthNum <= CurrentMonth; ++MonthNum ) {
+				XI = std::log( ( HourNum - ( MonthNum - 1 ) * HrsPerMonth ) / TimeSS_Factor );
+				INTERP( GlheNum, XI, GfuncVal );
+				SumQn += ( QnMonth( MonthNum ) - QnPrev ) * GfuncVal;
+				QnPrev = QnMonth( MonthNum );
+			}
+			for ( I = CurrentMonth * HoursInMonth + 1; I <= HourNum; ++I ) {
+				XI = std::log( ( HourNum - I + 1 ) / TimeSS_Factor );
+				INTERP( GlheNum, XI, GfuncVal );
+				SumQn += ( QnHour( I ) - QnPrev ) * GfuncVal;
+				QnPrev = QnHour( I );
+			}
+			DeltaTStandard( HourNum ) = SumQn / K_Ground_Factor;
+		}
+		TimeStandard = epElapsedTime() - TimeStart;
+
+		// multi-level aggregation
+		InitLoadAggregationBins( GlheNum, AggBenchmarkYears );
+		TimeStart = epElapsedTime();
+		XI = std::log( 1.0 / TimeSS_Factor );
+		INTERP( GlheNum, XI, GfuncHour );
+		for ( HourNum = 1; HourNum <= NumHours; ++HourNum ) {
+			SumQn = QnHour( HourNum ) * GfuncHour + AggregationBinResponse( GlheNum, 1.0, TimeSS_Factor );
+			DeltaTMultiLevel( HourNum ) = SumQn / K_Ground_Factor;
+			ShiftLoadAggregationBins( GlheNum, QnHour( HourNum ) );
+		}
+		TimeMultiLevel = epElapsedTime() - TimeStart;
+
+		MaxDiff = 0.0;
+		SumSqDiff = 0.0;
+		for ( HourNum = 1; HourNum <= NumHours; ++HourNum ) {
+			MaxDiff = max( MaxDiff, std::abs( DeltaTMultiLevel( HourNum ) - DeltaTStandard( HourNum ) ) );
+			SumSqDiff += pow_2( DeltaTMultiLevel( HourNum ) - DeltaTStandard( HourNum ) );
+		}
+
+		gio::write( EchoInputFile, fmtA ) << "GLHE Load Aggregation Benchmark,Name,Years,#Bins,Standard Time {s},Multi-Level Time {s},Max Difference {deltaC},RMS Difference {deltaC},Final Standard {deltaC},Final Multi-Level {deltaC}";
+		gio::write( EchoInputFile, fmtA ) << "GLHE Load Aggregation Benchmark," + VerticalGlhe( GlheNum ).Name + ',' + TrimSigDigits( AggBenchmarkYears ) + ',' + TrimSigDigits( VerticalGlhe( GlheNum ).NumAggBins ) + ',' + RoundSigDigits( TimeStandard, 3 ) + ',' + RoundSigDigits( TimeMultiLevel, 3 ) + ',' + RoundSigDigits( MaxDiff, 4 ) + ',' + RoundSigDigits( std::sqrt( SumSqDiff / NumHours ), 4 ) + ',' + RoundSigDigits( DeltaTStandard( NumHours ), 4 ) + ',' + RoundSigDigits( DeltaTMultiLevel( NumHours ), 4 );
+
+	}
+
+	//******************************************************************************
+
 	void
 	InitBoreholeHXSimVars(
 		int const GlheNum,
@@ -1208,6 +1561,7 @@ namespace GroundHeatExchangers {
 			VerticalGlhe( GlheNum ).QnMonthlyAgg = 0.0;
 			VerticalGlhe( GlheNum ).QnSubHr = 0.0;
 			VerticalGlhe( GlheNum ).LastHourN = 0;
+			if ( VerticalGlhe( GlheNum ).MultiLevelAgg ) VerticalGlhe( GlheNum ).AggBinQ = 0.0;
 			PrevTimeSteps = 0.0;
 			CurrentSimTime = 0.0;
 		}
@@ -3,6 +3,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/FArray2D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -21,6 +22,10 @@ namespace GroundHeatExchangers {
 	extern Real64 const HrsPerDay; // Number of hours in a day
 	extern Real64 const HrsPerMonth; // Number of hours in month
 	extern int const MaxTSinHr; // Max number of time step in a hour
+	extern int const AggBinsPerLevel; // Number of multi-level aggregation bins of each duration
+	extern int const MaxAggOffsets; // Max number of sub-hourly window lengths with stored bin edge g-functions
+	extern int const MaxAggWindowSec; // Longest sub-hourly window ahead of the aggregation bins [s]
+	extern int const AggBenchmarkYears; // Length of the synthetic load profile of the aggregation benchmark
 
 	// MODULE VARIABLE DECLARATIONS:
 	extern int NumVerticalGlhes;
@@ -84,6 +89,14 @@ namespace GroundHeatExchangers {
 		int SubAGG; // Minimum subhourly History
 		FArray1D_int LastHourN; // Stores the Previous hour's N for past hours
 		// until the minimum subhourly history
+		bool MultiLevelAgg; // True to superpose past hours from fixed multi-level aggregation bins
+		int NumAggBins; // Number of multi-level aggregation bins
+		FArray1D< Real64 > AggBinQ; // Aggregated normalised heat extraction/rejection rate of each bin [W/m]
+		FArray1D< Real64 > AggBinWidth; // Duration of each bin [hr]
+		FArray1D< Real64 > AggBinEdge; // Age of the older edge of each bin, AggBinEdge(0) = 0 [hr]
+		FArray1D_int AggOffsetSlot; // AggGEdge column of each sub-hourly window length [s], 0 if not evaluated
+		FArray2D< Real64 > AggGEdge; // G-function at each bin edge for each sub-hourly window length
+		int NumAggOffsets; // Number of sub-hourly window lengths evaluated in AggGEdge
 		//loop topology variables
 		int LoopNum;
 		int LoopSideNum;
@@ -115,6 +128,9 @@ namespace GroundHeatExchangers {
 			NPairs( 0 ),
 			AGG( 0 ),
 			SubAGG( 0 ),
+			MultiLevelAgg( false ),
+			NumAggBins( 0 ),
+			NumAggOffsets( 0 ),
 			LoopNum( 0 ),
 			LoopSideNum( 0 ),
 			BranchNum( 0 ),
@@ -153,6 +169,14 @@ namespace GroundHeatExchangers {
 			int const AGG, // Minimum Hourly Histroy required
 			int const SubAGG, // Minimum subhourly History
 			FArray1_int const & LastHourN, // Stores the Previous hour's N for past hours
+			bool const MultiLevelAgg, // True to superpose past hours from fixed multi-level aggregation bins
+			int const NumAggBins, // Number of multi-level aggregation bins
+			FArray1< Real64 > const & AggBinQ, // Aggregated normalised heat extraction/rejection rate of each bin [W/m]
+			FArray1< Real64 > const & AggBinWidth, // Duration of each bin [hr]
+			FArray1< Real64 > const & AggBinEdge, // Age of the older edge of each bin, AggBinEdge(0) = 0 [hr]
+			FArray1_int const & AggOffsetSlot, // AggGEdge column of each sub-hourly window length [s], 0 if not evaluated
+			FArray2< Real64 > const & AggGEdge, // G-function at each bin edge for each sub-hourly window length
+			int const NumAggOffsets, // Number of sub-hourly window lengths evaluated in AggGEdge
 			int const LoopNum,
 			int const LoopSideNum,
 			int const BranchNum,
@@ -188,6 +212,14 @@ namespace GroundHeatExchangers {
 			AGG( AGG ),
 			SubAGG( SubAGG ),
 			LastHourN( LastHourN ),
+			MultiLevelAgg( MultiLevelAgg ),
+			NumAggBins( NumAggBins ),
+			AggBinQ( AggBinQ ),
+			AggBinWidth( AggBinWidth ),
+			AggBinEdge( AggBinEdge ),
+			AggOffsetSlot( AggOffsetSlot ),
+			AggGEdge( AggGEdge ),
+			NumAggOffsets( NumAggOffsets ),
 			LoopNum( LoopNum ),
 			LoopSideNum( LoopSideNum ),
 			BranchNum( BranchNum ),
@@ -285,6 +317,36 @@ namespace GroundHeatExchangers {
 
 	//******************************************************************************
 
+	void
+	InitLoadAggregationBins(
+		int const GlheNum, // Ground loop heat exchanger ID number
+		int const NumYears // Length of load history to be covered by the bins (years)
+	);
+
+	//******************************************************************************
+
+	void
+	ShiftLoadAggregationBins(
+		int const GlheNum, // Ground loop heat exchanger ID number
+		Real64 const QnHour // Normalised heat extraction/rejection rate of the hour leaving the sub-hourly window [W/m]
+	);
+
+	//******************************************************************************
+
+	Real64
+	AggregationBinResponse(
+		int const GlheNum, // Ground loop heat exchanger ID number
+		Real64 const Offset, // Length of the sub-hourly window ahead of the bins [hr]
+		Real64 const TimeSS_Factor // Steady state time of the borefield [hr]
+	);
+
+	//******************************************************************************
+
+	void
+	BenchmarkLoadAggregation( int const GlheNum );
+
+	//******************************************************************************
+
 	void
 	InitBoreholeHXSimVars(
 		int const GlheNum,
@@ -28,6 +28,7 @@
 #include <ReportSizingManager.hh>
 #include <RootFinder.hh>
 #include <SetPointManager.hh>
+#include <SQLiteProcedures.hh>
 #include <UtilityRoutines.hh>
 #include <WaterCoils.hh>
 
@@ -76,6 +77,10 @@ namespace HVACControllers {
 	//                        in DataSystemVariables.f90.
 	//       MODIFIED       Feb. 2010, Brent Griffith (NREL)
 	//                       - changed plant loop interactions, Demand Side Update Phase 3
+	//       MODIFIED       Oct. 2014
+	//                      - Added convergence telemetry for each controller written to the SQLite output.
+	//                      - Added adaptive mode to reuse the brackets saved with the solution
+	//                        at the previous HVAC iteration (see ReusePreviousBracketFlag).
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS MODULE:
@@ -125,6 +130,8 @@ namespace HVACControllers {
 	// define the environment variable TRACE_AIRLOOP=YES or TRACE_AIRLOOP=Y.
 	// To enable generating an individual, detailed trace file for each controller, define the
 	// environment variable TRACE_CONTROLLER=YES or TRACE_CONTROLLER=Y.
+	// To enable reusing the brackets from the previous HVAC iteration, define the environment
+	// variable ADAPTIVE_CONTROLLER=YES or ADAPTIVE_CONTROLLER=Y.
 	// See DataSystemVariables.f90 for the definitions of the environment variables used to debug
 	// the air loop simulation.
 
@@ -204,6 +211,7 @@ namespace HVACControllers {
 	FArray1D< ControllerPropsType > ControllerProps;
 	FArray1D< RootFinderDataType > RootFinders;
 	FArray1D< AirLoopStatsType > AirLoopStats; // Statistics array to analyze computational profile for
+	FArray1D< ControllerTelemetryType > ControllerTelemetry; // Convergence telemetry for each controller
 
 	static gio::Fmt const fmtLD( "*" );
 	static gio::Fmt const fmtA( "(A)" );
@@ -308,6 +316,9 @@ namespace HVACControllers {
 		// Find the correct ControllerNumber with the AirLoop & CompNum from AirLoop Derived Type
 		//ControlNum = AirLoopEquip(AirLoopNum)%ComponentOfTypeNum(CompNum)
 
+		// The final check ends the solution, including a cold start retry, also when plant is locked
+		if ( Operation == iControllerOpEnd ) ControllerTelemetry( ControlNum ).ColdStartRetry = false;
+
 		// detect if plant is locked and flow cannot change
 		if ( ControllerProps( ControlNum ).ActuatedNodePlantLoopNum > 0 ) {
 
@@ -348,6 +359,9 @@ namespace HVACControllers {
 		// Plant upgrades for V7 added init to these cases because MassFlowRateMaxAvail is better controlled
 		ControllerOp: { auto const SELECT_CASE_var( Operation );
 		if ( SELECT_CASE_var == iControllerOpColdStart ) {
+			// A cold start after a failed warm restart completes the solution counted by the warm restart
+			if ( ! ControllerTelemetry( ControlNum ).ColdStartRetry ) ++ControllerTelemetry( ControlNum ).NumSolves;
+
 			// If a iControllerOpColdStart call, reset the actuator inlet flows
 			ResetController( ControlNum, FirstHVACIteration, false, IsConvergedFlag );
 			//    CALL InitController(ControlNum, FirstHVACIteration, IsConvergedFlag)
@@ -358,6 +372,9 @@ namespace HVACControllers {
 			ReportController( ControlNum );
 
 		} else if ( SELECT_CASE_var == iControllerOpWarmRestart ) {
+			++ControllerTelemetry( ControlNum ).NumSolves;
+			++ControllerTelemetry( ControlNum ).NumWarmRestarts;
+
 			// If a iControllerOpWarmRestart call, set the actuator inlet flows to previous solution
 			ResetController( ControlNum, FirstHVACIteration, true, IsConvergedFlag );
 			//   CALL InitController(ControlNum, FirstHVACIteration, IsConvergedFlag)
@@ -375,6 +392,8 @@ namespace HVACControllers {
 			// Simulate the correct Controller with the current ControlNum
 			ControllerType = ControllerProps( ControlNum ).ControllerType_Num;
 
+			++ControllerTelemetry( ControlNum ).NumIterations;
+
 			ControllerCalc: { auto const SELECT_CASE_var1( ControllerType );
 			if ( SELECT_CASE_var1 == ControllerSimple_Type ) { // 'Controller:WaterCoil'
 				CalcSimpleController( ControlNum, FirstHVACIteration, IsConvergedFlag, IsUpToDateFlag, ControllerName );
@@ -405,6 +424,15 @@ namespace HVACControllers {
 				ShowFatalError( "Invalid controller type in ManageControllers=" + ControllerProps( ControlNum ).ControllerType );
 			}} // ControllerCheck
 
+			// Update convergence telemetry for this solution. A warm restart that is not converged
+			// is always retried with a cold start, whose final check gives the outcome.
+			ControllerTelemetry( ControlNum ).MaxIterations = max( ControllerTelemetry( ControlNum ).MaxIterations, ControllerProps( ControlNum ).NumCalcCalls );
+			if ( ControllerProps( ControlNum ).DoWarmRestartFlag ) {
+				if ( IsConvergedFlag ) ++ControllerTelemetry( ControlNum ).NumSuccessfulWarmRestarts;
+			} else if ( ! IsConvergedFlag ) {
+				++ControllerTelemetry( ControlNum ).NumNotConverged;
+			}
+
 			// Report the current Controller
 			ReportController( ControlNum );
 
@@ -567,6 +595,7 @@ namespace HVACControllers {
 
 		ControllerProps.allocate( NumControllers );
 		RootFinders.allocate( NumControllers );
+		ControllerTelemetry.allocate( NumControllers );
 		CheckEquipName.allocate( NumControllers );
 		CheckEquipName = true;
 
@@ -777,6 +806,7 @@ namespace HVACControllers {
 
 		// Using/Aliasing
 		using PlantUtilities::SetActuatedBranchFlowRate;
+		using DataSystemVariables::AdaptiveControllerEnvFlag;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -839,6 +869,8 @@ namespace HVACControllers {
 		// Allow reusing the previous solution while identifying brackets if
 		// this is not the first HVAC step of the environment
 		ControllerProps( ControlNum ).ReusePreviousSolutionFlag = true;
+		// Same for the brackets saved with the previous solution, only in adaptive mode
+		ControllerProps( ControlNum ).ReusePreviousBracketFlag = AdaptiveControllerEnvFlag;
 		// Always reset to false by default. Set in CalcSimpleController() on the first controller iteration.
 		ControllerProps( ControlNum ).ReuseIntermediateSolutionFlag = false;
 		// By default not converged
@@ -1104,10 +1136,14 @@ namespace HVACControllers {
 
 			// Turn off scheme to reuse previous solution obtained at last SimAirLoop() call
 			ControllerProps( ControlNum ).ReusePreviousSolutionFlag = false;
+			ControllerProps( ControlNum ).ReusePreviousBracketFlag = false;
 			// Reset solution trackers
 			ControllerProps( ControlNum ).SolutionTrackers.DefinedFlag() = false;
 			ControllerProps( ControlNum ).SolutionTrackers.Mode() = iModeNone;
 			ControllerProps( ControlNum ).SolutionTrackers.ActuatedValue() = 0.0;
+			for ( int TrackerNum = 1; TrackerNum <= 2; ++TrackerNum ) {
+				ControllerProps( ControlNum ).SolutionTrackers( TrackerNum ).BracketDefinedFlag = false;
+			}
 
 			MyEnvrnFlag( ControlNum ) = false;
 		}
@@ -1540,10 +1576,12 @@ namespace HVACControllers {
 		// TRUE if root finder needs to continue iterating, FALSE otherwise.
 		bool IsDoneFlag;
 		bool ReusePreviousSolutionFlag;
+		bool ReusePreviousBracketFlag;
 		int PreviousSolutionIndex;
 		bool PreviousSolutionDefinedFlag;
 		int PreviousSolutionMode;
 		Real64 PreviousSolutionValue;
+		Real64 PreviousBracketValue;
 
 		// Obtain actuated and sensed nodes
 		ActuatedNode = ControllerProps( ControlNum ).ActuatedNode;
@@ -1590,6 +1628,24 @@ namespace HVACControllers {
 			} else {
 				// By default, use candidate value computed by root finder
 				ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).XCandidate;
+
+				// In adaptive mode, once the previous solution has been tried, try the bracket saved with
+				// it on the side still missing instead of the min/max point or the secant extrapolation.
+				// Only attempted once per HVAC iteration and only during the bracketing phase.
+				ReusePreviousBracketFlag = ControllerProps( ControlNum ).ReusePreviousBracketFlag && ( RootFinders( ControlNum ).CurrentMethodType == iMethodBracket ) && ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).BracketDefinedFlag && ( PreviousSolutionMode == iModeActive );
+
+				if ( ReusePreviousBracketFlag ) {
+					if ( ! RootFinders( ControlNum ).LowerPoint.DefinedFlag ) {
+						PreviousBracketValue = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).LowerBracket;
+					} else {
+						PreviousBracketValue = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).UpperBracket;
+					}
+					if ( CheckRootFinderCandidate( RootFinders( ControlNum ), PreviousBracketValue ) ) {
+						ControllerProps( ControlNum ).NextActuatedValue = PreviousBracketValue;
+						++ControllerTelemetry( ControlNum ).NumBracketReuses;
+					}
+					ControllerProps( ControlNum ).ReusePreviousBracketFlag = false;
+				}
 			}
 
 		} else if ( ( SELECT_CASE_var == iStatusOK ) || ( SELECT_CASE_var == iStatusOKRoundOff ) ) {
@@ -2080,10 +2136,17 @@ namespace HVACControllers {
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).DefinedFlag = true;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Mode = ControllerProps( ControlNum ).Mode;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).ActuatedValue = ControllerProps( ControlNum ).NextActuatedValue;
+				// Keep the final brackets if the root finder got that far (not the case after a warm restart)
+				if ( RootFinders( ControlNum ).LowerPoint.DefinedFlag && RootFinders( ControlNum ).UpperPoint.DefinedFlag ) {
+					ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).BracketDefinedFlag = true;
+					ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).LowerBracket = RootFinders( ControlNum ).LowerPoint.X;
+					ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).UpperBracket = RootFinders( ControlNum ).UpperPoint.X;
+				}
 			} else {
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).DefinedFlag = false;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Mode = ControllerProps( ControlNum ).Mode;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).ActuatedValue = ControllerProps( ControlNum ).NextActuatedValue;
+				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).BracketDefinedFlag = false;
 			}
 		}
 
@@ -2537,6 +2600,66 @@ Label100: ;
 
 	}
 
+	void
+	WriteControllerTelemetry()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the convergence telemetry gathered for each controller on each air loop
+		// to the SQLite output, one record per controller.
+
+		// METHODOLOGY EMPLOYED:
+		// The counters are updated in ManageControllers() for every run, so unlike the
+		// TRACK_AIRLOOP statistics they do not need a debugging environment variable.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataHVACGlobals::NumPrimaryAirSys;
+		using DataAirSystems::PrimaryAirSystem;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int AirLoopNum;
+		int AirLoopControlNum;
+		int ControlNum;
+
+		// FLOW
+
+		if ( NumControllers == 0 ) return;
+		if ( ! sqlite->writeOutputToSQLite() ) return;
+
+		for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+			for ( AirLoopControlNum = 1; AirLoopControlNum <= PrimaryAirSystem( AirLoopNum ).NumControllers; ++AirLoopControlNum ) {
+				ControlNum = PrimaryAirSystem( AirLoopNum ).ControllerIndex( AirLoopControlNum );
+				// Controller never simulated
+				if ( ControlNum == 0 ) continue;
+
+				auto const & Telemetry( ControllerTelemetry( ControlNum ) );
+				sqlite->addSQLiteControllerTelemetryRecord( ControllerProps( ControlNum ).ControllerName, PrimaryAirSystem( AirLoopNum ).Name, Telemetry.NumSolves, Telemetry.NumIterations, Telemetry.MaxIterations, Telemetry.NumWarmRestarts, Telemetry.NumSuccessfulWarmRestarts, Telemetry.NumNotConverged, Telemetry.NumBracketReuses, Telemetry.SolveTime );
+			}
+		}
+
+	}
+
 	void
 	WriteAirLoopStatistics(
 		int const FileUnit,
@@ -92,23 +92,35 @@ namespace HVACControllers {
 		bool DefinedFlag; // Flag set to TRUE when tracker is up-to-date. FALSE otherwise.
 		Real64 ActuatedValue; // Actuated value
 		int Mode; // Operational model of controller
+		bool BracketDefinedFlag; // Flag set to TRUE when the lower and upper brackets below are up-to-date
+		Real64 LowerBracket; // Actuated value of the lower bracket when the root was found
+		Real64 UpperBracket; // Actuated value of the upper bracket when the root was found
 
 		// Default Constructor
 		SolutionTrackerType() :
 			DefinedFlag( true ),
 			ActuatedValue( 0.0 ),
-			Mode( iModeNone )
+			Mode( iModeNone ),
+			BracketDefinedFlag( false ),
+			LowerBracket( 0.0 ),
+			UpperBracket( 0.0 )
 		{}
 
 		// Member Constructor
 		SolutionTrackerType(
 			bool const DefinedFlag, // Flag set to TRUE when tracker is up-to-date. FALSE otherwise.
 			Real64 const ActuatedValue, // Actuated value
-			int const Mode // Operational model of controller
+			int const Mode, // Operational model of controller
+			bool const BracketDefinedFlag, // Flag set to TRUE when the lower and upper brackets below are up-to-date
+			Real64 const LowerBracket, // Actuated value of the lower bracket when the root was found
+			Real64 const UpperBracket // Actuated value of the upper bracket when the root was found
 		) :
 			DefinedFlag( DefinedFlag ),
 			ActuatedValue( ActuatedValue ),
-			Mode( Mode )
+			Mode( Mode ),
+			BracketDefinedFlag( BracketDefinedFlag ),
+			LowerBracket( LowerBracket ),
+			UpperBracket( UpperBracket )
 		{}
 
 	};
@@ -140,6 +152,9 @@ namespace HVACControllers {
 		// Flag used to decide whether or not it is possible to reuse the solution from
 		// the last call to SimAirLoop() as a possible candidate.
 		bool ReusePreviousSolutionFlag;
+		// Flag used to decide whether or not it is possible to reuse the brackets saved with the
+		// solution from the last call to SimAirLoop() as a possible candidate (adaptive mode only).
+		bool ReusePreviousBracketFlag;
 		// Array of solution trackers. Saved at last call to SimAirLoop() in ManageControllers(iControllerOpEnd)
 		// The first tracker is used to track the solution when FirstHVACIteration is TRUE.
 		// The second tracker is used to track the solution at FirstHVACIteration is FALSE.
@@ -206,6 +221,7 @@ namespace HVACControllers {
 			DoWarmRestartFlag( false ),
 			ReuseIntermediateSolutionFlag( false ),
 			ReusePreviousSolutionFlag( false ),
+			ReusePreviousBracketFlag( false ),
 			SolutionTrackers( 2 ),
 			MaxAvailActuated( 0.0 ),
 			MaxAvailSensed( 0.0 ),
@@ -250,6 +266,7 @@ namespace HVACControllers {
 			bool const DoWarmRestartFlag,
 			bool const ReuseIntermediateSolutionFlag,
 			bool const ReusePreviousSolutionFlag,
+			bool const ReusePreviousBracketFlag,
 			FArray1< SolutionTrackerType > const & SolutionTrackers,
 			Real64 const MaxAvailActuated, // kg/s, The maximum actuated variable currently available.
 			Real64 const MaxAvailSensed, // Sensed value at maximum available actuated variable
@@ -292,6 +309,7 @@ namespace HVACControllers {
 			DoWarmRestartFlag( DoWarmRestartFlag ),
 			ReuseIntermediateSolutionFlag( ReuseIntermediateSolutionFlag ),
 			ReusePreviousSolutionFlag( ReusePreviousSolutionFlag ),
+			ReusePreviousBracketFlag( ReusePreviousBracketFlag ),
 			SolutionTrackers( 2, SolutionTrackers ),
 			MaxAvailActuated( MaxAvailActuated ),
 			MaxAvailSensed( MaxAvailSensed ),
@@ -407,10 +425,39 @@ namespace HVACControllers {
 
 	};
 
+	struct ControllerTelemetryType
+	{
+		// Members
+		int NumSolves; // Number of cold starts and warm restarts of this controller
+		int NumIterations; // Total number of controller iterations (each one is an air loop evaluation)
+		int MaxIterations; // Maximum number of iterations required by one solution
+		int NumWarmRestarts; // Number of speculative warm restarts attempted
+		int NumSuccessfulWarmRestarts; // Number of speculative warm restarts still converged at the final check
+		int NumNotConverged; // Number of solutions not converged at the final check
+		int NumBracketReuses; // Number of times the brackets from the previous solution were tried
+		Real64 SolveTime; // Wall clock time spent iterating this controller, including air loop evaluations (s)
+		bool ColdStartRetry; // True from a failed warm restart to the final check of its cold start retry (same solution, not counted again)
+
+		// Default Constructor
+		ControllerTelemetryType() :
+			NumSolves( 0 ),
+			NumIterations( 0 ),
+			MaxIterations( 0 ),
+			NumWarmRestarts( 0 ),
+			NumSuccessfulWarmRestarts( 0 ),
+			NumNotConverged( 0 ),
+			NumBracketReuses( 0 ),
+			SolveTime( 0.0 ),
+			ColdStartRetry( false )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< ControllerPropsType > ControllerProps;
 	extern FArray1D< RootFinderDataType > RootFinders;
 	extern FArray1D< AirLoopStatsType > AirLoopStats; // Statistics array to analyze computational profile for
+	extern FArray1D< ControllerTelemetryType > ControllerTelemetry; // Convergence telemetry for each controller
 
 	// Functions
 
@@ -557,6 +604,9 @@ namespace HVACControllers {
 	void
 	DumpAirLoopStatistics();
 
+	void
+	WriteControllerTelemetry();
+
 	void
 	WriteAirLoopStatistics(
 		int const FileUnit,
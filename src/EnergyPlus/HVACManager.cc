@@ -1,6 +1,7 @@
 // C++ Headers
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -27,8 +28,10 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataReportingFlags.hh>
 #include <DataRoomAirModel.hh>
+#include <DataRuntimeLanguage.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
 #include <DemandManager.hh>
 #include <DisplayRoutines.hh>
@@ -37,6 +40,7 @@
 #include <General.hh>
 #include <HVACStandAloneERV.hh>
 #include <IceThermalStorage.hh>
+#include <InputProcessor.hh>
 #include <InternalHeatGains.hh>
 #include <ManageElectricPower.hh>
 #include <NodeInputManager.hh>
@@ -76,6 +80,9 @@ namespace HVACManager {
 	// METHODOLOGY EMPLOYED:
 	// The basic solution technique is iteration with lagging.
 	// The timestep is shortened using a bisection method.
+	// With EP_HVAC_QUIESCENT_SKIP, SimHVAC reuses the node state of its last full solution
+	// while the inputs of that solution (schedules, EMS actuators, availability, setpoints,
+	// outdoor conditions, zone temperatures and loads) are unchanged within tolerance.
 
 	// REFERENCES:
 
@@ -137,11 +144,30 @@ namespace HVACManager {
 	// Data
 	//MODULE PARAMETER DEFINITIONS:
 	static std::string const BlankString;
+	Real64 const QuiescentTempTol( 0.05 ); // Setpoint and outdoor temperature change that ends quiescence (deltaC)
+	Real64 const QuiescentZoneTempTol( 0.1 ); // Zone air temperature change that ends quiescence (deltaC)
+	Real64 const QuiescentHumRatTol( 1.0e-5 ); // Humidity ratio change that ends quiescence (kgWater/kgDryAir)
+	Real64 const QuiescentFlowTol( 1.0e-6 ); // Mass flow rate setpoint change that ends quiescence (kg/s)
+	Real64 const QuiescentLoadTol( 10.0 ); // Zone sensible load change that ends quiescence (W)
+	Real64 const QuiescentMoistLoadTol( 1.0e-6 ); // Zone moisture load change that ends quiescence (kgWater/s)
+	int const MaxQuiescentSkips( 12 ); // Consecutive HVAC solutions skipped before a full solution is forced
 
 	//MODULE VARIABLE DECLARATIONS:
 
 	int HVACManageIteration( 0 ); // counts iterations to enforce maximum iteration limit
 	int RepIterAir( 0 );
+	int QuiescentSkipped( 0 ); // 1 if the HVAC solution of the system timestep was skipped (for reporting)
+	int NumQuiescentChecks( 0 ); // HVAC solutions checked for quiescence
+	int NumQuiescentSkips( 0 ); // HVAC solutions skipped because the system was quiescent
+	int NumQuiescentGuardSolves( 0 ); // Full solutions forced by a schedule or EMS change
+	int QuiescentRun( 0 ); // Consecutive HVAC solutions skipped so far
+	int MaxQuiescentRun( 0 ); // Longest run of consecutive skipped HVAC solutions
+	int NumQuiescentGuardValues( 0 ); // Leading values of the signature that must match exactly (schedules, EMS)
+	bool QuiescentReferenceValid( false ); // True if the reference solution may be reused
+	std::vector< Real64 > QuiescentSignature; // Inputs of the HVAC solution of this system timestep
+	std::vector< Real64 > QuiescentTolerance; // Tolerance of each value of the signature
+	std::vector< Real64 > QuiescentReference; // Inputs of the last full HVAC solution
+	FArray1D< NodeData > QuiescentNode; // Node state of the last full HVAC solution
 
 	//FArray1D_bool CrossMixingReportFlag; // TRUE when Cross Mixing is active based on controls
 	//FArray1D_bool MixingReportFlag; // TRUE when Mixing is active based on controls
@@ -601,6 +627,8 @@ namespace HVACManager {
 		using PlantUtilities::CheckForRunawayPlantTemps;
 		using PlantUtilities::AnyPlantSplitterMixerLacksContinuity;
 		using DataGlobals::AnyPlantInModel;
+		using DataSystemVariables::QuiescentHVACSkip;
+		using OutAirNodeManager::SetOutAirNodes;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -696,6 +724,9 @@ namespace HVACManager {
 				SetupPlantEMSActuators();
 			}
 
+			if ( QuiescentHVACSkip ) {
+				SetupOutputVariable( "HVAC System Solver Skipped Timestep Count []", QuiescentSkipped, "HVAC", "Sum", "SimHVAC" );
+			}
 			if ( TotNumLoops > 0 ) {
 				SetupOutputVariable( "Plant Solver Sub Iteration Count []", PlantManageSubIterations, "HVAC", "Sum", "SimHVAC" );
 				SetupOutputVariable( "Plant Solver Half Loop Calls Count []", PlantManageHalfLoopCalls, "HVAC", "Sum", "SimHVAC" );
@@ -737,6 +768,17 @@ namespace HVACManager {
 
 		ManageEMS( emsCallFromAfterHVACManagers ); // calling point
 
+		// A quiescent system keeps the node state of its last full solution
+		QuiescentSkipped = 0;
+		if ( QuiescentHVACSkip ) {
+			if ( HVACSystemQuiescent() ) {
+				Node = QuiescentNode;
+				SetOutAirNodes();
+				QuiescentSkipped = 1;
+				return;
+			}
+		}
+
 		// first explicitly call each system type with FirstHVACIteration,
 
 		// Manages the various component simulations
@@ -1411,6 +1453,8 @@ namespace HVACManager {
 			ShowFatalError( "Previous severe set point errors cause program termination" );
 		}
 
+		if ( QuiescentHVACSkip ) SaveHVACQuiescenceReference();
+
 	}
 
 	void
@@ -2099,6 +2143,8 @@ namespace HVACManager {
 		int MixNum; // Counter for MIXING and Cross Mixing statements
 		static FArray1D< Real64 > MixSenLoad; // Mixing sensible loss or gain
 		static FArray1D< Real64 > MixLatLoad; // Mixing latent loss or gain
+		static FArray1D< Real64 > ZoneRhoAir; // Indoor air density of each zone
+		static FArray1D< Real64 > ZoneCpAir; // Indoor air heat capacity of each zone
 		int j; // Index in a do-loop
 		int VentZoneNum; // Number of ventilation object per zone
 		Real64 VentZoneMassflow; // Total mass flow rate per zone
@@ -2116,9 +2162,15 @@ namespace HVACManager {
 		if ( firstTime ) {
 			MixSenLoad.allocate( NumOfZones );
 			MixLatLoad.allocate( NumOfZones );
+			ZoneRhoAir.allocate( NumOfZones );
+			ZoneCpAir.allocate( NumOfZones );
 			firstTime = false;
 		}
 
+		// Indoor air properties do not change during the report, evaluate them for all zones at once
+		PsyRhoAirFnPbTdbW( OutBaroPress, MAT, ZoneAirHumRatAvg, ZoneRhoAir, RoutineName3 );
+		PsyCpAirFnWTdb( ZoneAirHumRatAvg, MAT, ZoneCpAir );
+
 		for ( ZoneLoop = 1; ZoneLoop <= NumOfZones; ++ZoneLoop ) { // Start of zone loads report variable update loop ...
 
 			// Break the infiltration load into heat gain and loss components
@@ -2172,8 +2224,8 @@ namespace HVACManager {
 			ZnAirRpt( ZoneLoop ).VentilMdot = ( MCPV( ZoneLoop ) / CpAir ) * ADSCorrectionFactor;
 
 			//CR7751  second, calculate using indoor conditions for density property
-			AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, MAT( ZoneLoop ), ZoneAirHumRatAvg( ZoneLoop ), RoutineName3 );
-			CpAir = PsyCpAirFnWTdb( ZoneAirHumRatAvg( ZoneLoop ), MAT( ZoneLoop ) );
+			AirDensity = ZoneRhoAir( ZoneLoop );
+			CpAir = ZoneCpAir( ZoneLoop );
 			ZnAirRpt( ZoneLoop ).InfilVolumeCurDensity = ( MCPI( ZoneLoop ) / CpAir / AirDensity ) * TimeStepSys * SecInHour * ADSCorrectionFactor;
 			ZnAirRpt( ZoneLoop ).InfilAirChangeRate = ZnAirRpt( ZoneLoop ).InfilVolumeCurDensity / ( TimeStepSys * Zone( ZoneLoop ).Volume );
 			ZnAirRpt( ZoneLoop ).InfilVdotCurDensity = ( MCPI( ZoneLoop ) / CpAir / AirDensity ) * ADSCorrectionFactor;
@@ -2407,7 +2459,7 @@ namespace HVACManager {
 					}
 					ZnAirRpt( ZoneLoop ).OABalanceMass = ( MDotOA( ZoneLoop ) ) * TimeStepSys * SecInHour * ADSCorrectionFactor;
 					ZnAirRpt( ZoneLoop ).OABalanceMdot = ( MDotOA( ZoneLoop ) ) * ADSCorrectionFactor;
-					AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, MAT( ZoneLoop ), ZoneAirHumRatAvg( ZoneLoop ), BlankString );
+					AirDensity = ZoneRhoAir( ZoneLoop );
 					ZnAirRpt( ZoneLoop ).OABalanceVolumeCurDensity = ( MDotOA( ZoneLoop ) / AirDensity ) * TimeStepSys * SecInHour * ADSCorrectionFactor;
 					ZnAirRpt( ZoneLoop ).OABalanceAirChangeRate = ZnAirRpt( ZoneLoop ).OABalanceVolumeCurDensity / ( TimeStepSys * Zone( ZoneLoop ).Volume );
 					ZnAirRpt( ZoneLoop ).OABalanceVdotCurDensity = ( MDotOA( ZoneLoop ) / AirDensity ) * ADSCorrectionFactor;
@@ -2639,6 +2691,369 @@ namespace HVACManager {
 
 	}
 
+	void
+	GetHVACQuiescenceSignature()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Collects the inputs of the HVAC solution of the current system timestep into
+		// QuiescentSignature, with the tolerance of each value in QuiescentTolerance.
+
+		// METHODOLOGY EMPLOYED:
+		// The schedule values and the values EMS and the external interface assign to actuators
+		// come first and must match exactly (NumQuiescentGuardValues of them). They are followed
+		// by the system timestep, the availability of air loops, plant loops, zone equipment and
+		// zone components, the node setpoints left by the setpoint managers, the outdoor
+		// conditions, and the air temperature and loads of each zone.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataPlant::PlantAvailMgr;
+		using DataPlant::TotNumLoops;
+		using DataRuntimeLanguage::EMSActuatorUsed;
+		using DataRuntimeLanguage::ErlVariable;
+		using DataRuntimeLanguage::numActuatorsUsed;
+		using DataRuntimeLanguage::NumExternalInterfaceActuatorsUsed;
+		using DataRuntimeLanguage::NumExternalInterfaceFunctionalMockupUnitExportActuatorsUsed;
+		using DataRuntimeLanguage::NumExternalInterfaceFunctionalMockupUnitImportActuatorsUsed;
+		using DataZoneEnergyDemands::ZoneSysEnergyDemand;
+		using DataZoneEnergyDemands::ZoneSysMoistureDemand;
+		using DataZoneEquipment::ZoneEquipAvail;
+		using ScheduleManager::NumSchedules;
+		using ScheduleManager::Schedule;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SchedNum; // schedule index
+		int ActuatorNum; // used actuator index
+		int ErlVariableNum; // Erl variable of the actuator
+		int LoopNum; // air or plant loop index
+		int EquipType; // zone component type index
+		int CompNum; // zone component index
+		int NodeNum; // node index
+		int ZoneNum; // zone index
+
+		QuiescentSignature.clear();
+		QuiescentTolerance.clear();
+
+		// Schedules and actuators, which must not change at all
+		for ( SchedNum = 1; SchedNum <= NumSchedules; ++SchedNum ) {
+			if ( Schedule( SchedNum ).EMSActuatedOn ) {
+				QuiescentSignature.push_back( Schedule( SchedNum ).EMSValue );
+			} else {
+				QuiescentSignature.push_back( Schedule( SchedNum ).CurrentValue );
+			}
+		}
+		for ( ActuatorNum = 1; ActuatorNum <= numActuatorsUsed + NumExternalInterfaceActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitImportActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitExportActuatorsUsed; ++ActuatorNum ) {
+			ErlVariableNum = EMSActuatorUsed( ActuatorNum ).ErlVariableNum;
+			if ( ErlVariableNum <= 0 ) continue;
+			QuiescentSignature.push_back( Real64( ErlVariable( ErlVariableNum ).Value.Type ) );
+			QuiescentSignature.push_back( ErlVariable( ErlVariableNum ).Value.Number );
+		}
+		NumQuiescentGuardValues = int( QuiescentSignature.size() );
+		QuiescentTolerance.assign( NumQuiescentGuardValues, 0.0 );
+
+		// System timestep and availability
+		QuiescentSignature.push_back( TimeStepSys );
+		QuiescentTolerance.push_back( 0.0 );
+		if ( allocated( PriAirSysAvailMgr ) ) {
+			for ( LoopNum = 1; LoopNum <= isize( PriAirSysAvailMgr ); ++LoopNum ) {
+				QuiescentSignature.push_back( Real64( PriAirSysAvailMgr( LoopNum ).AvailStatus ) );
+				QuiescentTolerance.push_back( 0.0 );
+			}
+		}
+		if ( allocated( PlantAvailMgr ) ) {
+			for ( LoopNum = 1; LoopNum <= min( TotNumLoops, isize( PlantAvailMgr ) ); ++LoopNum ) {
+				QuiescentSignature.push_back( Real64( PlantAvailMgr( LoopNum ).AvailStatus ) );
+				QuiescentTolerance.push_back( 0.0 );
+			}
+		}
+		if ( allocated( ZoneEquipAvail ) ) {
+			for ( ZoneNum = 1; ZoneNum <= isize( ZoneEquipAvail ); ++ZoneNum ) {
+				QuiescentSignature.push_back( Real64( ZoneEquipAvail( ZoneNum ) ) );
+				QuiescentTolerance.push_back( 0.0 );
+			}
+		}
+		if ( allocated( ZoneComp ) ) {
+			for ( EquipType = 1; EquipType <= isize( ZoneComp ); ++EquipType ) {
+				if ( ! allocated( ZoneComp( EquipType ).ZoneCompAvailMgrs ) ) continue;
+				for ( CompNum = 1; CompNum <= isize( ZoneComp( EquipType ).ZoneCompAvailMgrs ); ++CompNum ) {
+					QuiescentSignature.push_back( Real64( ZoneComp( EquipType ).ZoneCompAvailMgrs( CompNum ).AvailStatus ) );
+					QuiescentTolerance.push_back( 0.0 );
+				}
+			}
+		}
+
+		// Node setpoints
+		for ( NodeNum = 1; NodeNum <= NumOfNodes; ++NodeNum ) {
+			auto const & ThisNode( Node( NodeNum ) );
+			QuiescentSignature.push_back( ThisNode.TempSetPoint );
+			QuiescentTolerance.push_back( QuiescentTempTol );
+			QuiescentSignature.push_back( ThisNode.TempSetPointHi );
+			QuiescentTolerance.push_back( QuiescentTempTol );
+			QuiescentSignature.push_back( ThisNode.TempSetPointLo );
+			QuiescentTolerance.push_back( QuiescentTempTol );
+			QuiescentSignature.push_back( ThisNode.HumRatSetPoint );
+			QuiescentTolerance.push_back( QuiescentHumRatTol );
+			QuiescentSignature.push_back( ThisNode.HumRatMin );
+			QuiescentTolerance.push_back( QuiescentHumRatTol );
+			QuiescentSignature.push_back( ThisNode.HumRatMax );
+			QuiescentTolerance.push_back( QuiescentHumRatTol );
+			QuiescentSignature.push_back( ThisNode.MassFlowRateSetPoint );
+			QuiescentTolerance.push_back( QuiescentFlowTol );
+		}
+
+		// Outdoor conditions
+		QuiescentSignature.push_back( OutDryBulbTemp );
+		QuiescentTolerance.push_back( QuiescentTempTol );
+		QuiescentSignature.push_back( OutWetBulbTemp );
+		QuiescentTolerance.push_back( QuiescentTempTol );
+		QuiescentSignature.push_back( OutHumRat );
+		QuiescentTolerance.push_back( QuiescentHumRatTol );
+
+		// Zone air temperatures and the loads the predictor asks of the HVAC system
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			QuiescentSignature.push_back( MAT( ZoneNum ) );
+			QuiescentTolerance.push_back( QuiescentZoneTempTol );
+			QuiescentSignature.push_back( ZoneAirHumRat( ZoneNum ) );
+			QuiescentTolerance.push_back( QuiescentHumRatTol );
+			QuiescentSignature.push_back( ZoneSysEnergyDemand( ZoneNum ).TotalOutputRequired );
+			QuiescentTolerance.push_back( QuiescentLoadTol );
+			QuiescentSignature.push_back( ZoneSysMoistureDemand( ZoneNum ).TotalOutputRequired );
+			QuiescentTolerance.push_back( QuiescentMoistLoadTol );
+		}
+
+	}
+
+	bool
+	HVACSystemQuiescent()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       October 2014, always solve models with stateful components
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the HVAC solution of the current system timestep may be skipped and
+		// the node state of the last full solution reused.
+
+		// METHODOLOGY EMPLOYED:
+		// The signature of the current inputs is compared with the signature of the last full
+		// solution, not with the previous timestep, so that slow drift still ends quiescence
+		// once it exceeds the tolerance. A change of a schedule or actuator value always forces a
+		// full solution, as does the start of an environment, a reference that did not converge,
+		// and MaxQuiescentSkips skipped solutions in a row. Models that couple the HVAC solution
+		// to other iterations (AirflowNetwork with HVAC, the ideal condenser entering
+		// temperature optimization, Erl programs called from the HVAC iteration loop) are always
+		// solved in full. So are models with components that advance an internal state every
+		// timestep (water heaters and thermal storage tanks, ice storage, ground heat exchangers
+		// and their load histories, pipes with heat transfer, integral collector storage,
+		// cogeneration generators with thermal mass, user defined plant components), which a
+		// skipped solution would freeze.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataRuntimeLanguage::EMSProgramCallManager;
+		using DataRuntimeLanguage::NumProgramCallManagers;
+		using InputProcessor::GetNumObjectsFound;
+
+		// Return value
+		bool Quiescent( true );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const NumStatefulObjects( 20 );
+		static FArray1D_string const StatefulObjects( NumStatefulObjects, { "WaterHeater:Mixed", "WaterHeater:Stratified", "WaterHeater:HeatPump", "ThermalStorage:ChilledWater:Mixed", "ThermalStorage:ChilledWater:Stratified", "ThermalStorage:Ice:Simple", "ThermalStorage:Ice:Detailed", "Coil:Cooling:DX:SingleSpeed:ThermalStorage", "GroundHeatExchanger:Vertical", "GroundHeatExchanger:Surface", "GroundHeatExchanger:Pond", "GroundHeatExchanger:HorizontalTrench", "PipingSystem:Underground:Domain", "Pipe:Indoor", "Pipe:Outdoor", "Pipe:Underground", "SolarCollector:IntegralCollectorStorage", "Generator:MicroCHP", "Generator:FuelCell", "PlantComponent:UserDefined" } );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		static bool OneTimeFlag( true );
+		static bool CoupledModel( false ); // true if the model is always solved in full
+		int ManagerNum; // EMS program calling manager index
+		int ObjNum; // stateful object type index
+		std::vector< Real64 >::size_type ValueNum; // signature value index (zero based)
+
+		if ( OneTimeFlag ) {
+			CoupledModel = ( SimulateAirflowNetwork > AirflowNetworkControlSimple ) || AnyIdealCondEntSetPointInModel;
+			for ( ManagerNum = 1; ManagerNum <= NumProgramCallManagers; ++ManagerNum ) {
+				if ( EMSProgramCallManager( ManagerNum ).CallingPoint == emsCallFromHVACIterationLoop ) CoupledModel = true;
+			}
+			for ( ObjNum = 1; ObjNum <= NumStatefulObjects; ++ObjNum ) {
+				if ( GetNumObjectsFound( StatefulObjects( ObjNum ) ) > 0 ) CoupledModel = true;
+			}
+			OneTimeFlag = false;
+		}
+
+		GetHVACQuiescenceSignature();
+
+		if ( CoupledModel || BeginEnvrnFlag || KickOffSimulation ) QuiescentReferenceValid = false;
+		if ( ! QuiescentReferenceValid || QuiescentSignature.size() != QuiescentReference.size() ) {
+			QuiescentRun = 0;
+			return false;
+		}
+
+		++NumQuiescentChecks;
+		for ( ValueNum = NumQuiescentGuardValues; ValueNum < QuiescentSignature.size(); ++ValueNum ) {
+			if ( std::abs( QuiescentSignature[ ValueNum ] - QuiescentReference[ ValueNum ] ) > QuiescentTolerance[ ValueNum ] ) {
+				Quiescent = false;
+				break;
+			}
+		}
+		if ( Quiescent ) {
+			for ( ValueNum = 0; ValueNum < std::vector< Real64 >::size_type( NumQuiescentGuardValues ); ++ValueNum ) {
+				if ( QuiescentSignature[ ValueNum ] != QuiescentReference[ ValueNum ] ) {
+					Quiescent = false;
+					++NumQuiescentGuardSolves;
+					break;
+				}
+			}
+		}
+		if ( Quiescent && QuiescentRun >= MaxQuiescentSkips ) Quiescent = false;
+
+		if ( Quiescent ) {
+			++QuiescentRun;
+			++NumQuiescentSkips;
+			MaxQuiescentRun = max( MaxQuiescentRun, QuiescentRun );
+		} else {
+			QuiescentRun = 0;
+		}
+
+		return Quiescent;
+
+	}
+
+	void
+	SaveHVACQuiescenceReference()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Keeps the signature and the node state of a full HVAC solution as the reference that
+		// later quiescent system timesteps reuse.
+
+		// METHODOLOGY EMPLOYED:
+		// A solution that exceeded the iteration limit is not kept, so that the next system
+		// timestep is solved in full again.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		if ( HVACManageIteration > MaxIter ) {
+			QuiescentReferenceValid = false;
+			return;
+		}
+
+		QuiescentReference = QuiescentSignature;
+		if ( ! allocated( QuiescentNode ) ) QuiescentNode.allocate( NumOfNodes );
+		QuiescentNode = Node;
+		QuiescentReferenceValid = true;
+
+	}
+
+	void
+	ReportHVACQuiescence()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the counters of the quiescent HVAC timestep skipping to the audit file.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::QuiescentHVACSkip;
+		using General::RoundSigDigits;
+		using General::TrimSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int EchoInputFile; // found unit number for "eplusout.audit"
+		Real64 SkippedFraction( 0.0 ); // fraction of the checked solutions that were skipped
+
+		if ( ! QuiescentHVACSkip ) return;
+		EchoInputFile = FindUnitNumber( "eplusout.audit" );
+		if ( EchoInputFile == 0 ) return;
+
+		if ( NumQuiescentChecks > 0 ) SkippedFraction = double( NumQuiescentSkips ) / double( NumQuiescentChecks );
+		gio::write( EchoInputFile, fmtA ) << "Quiescent HVAC,#Checked Solutions,#Skipped Solutions,Skipped Fraction,#Forced by Schedule or EMS Change,Longest Skipped Run";
+		gio::write( EchoInputFile, fmtA ) << "Quiescent HVAC," + TrimSigDigits( NumQuiescentChecks ) + ',' + TrimSigDigits( NumQuiescentSkips ) + ',' + RoundSigDigits( SkippedFraction, 3 ) + ',' + TrimSigDigits( NumQuiescentGuardSolves ) + ',' + TrimSigDigits( MaxQuiescentRun );
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -1,12 +1,16 @@
 #ifndef HVACManager_hh_INCLUDED
 #define HVACManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <DataLoopNode.hh>
 
 namespace EnergyPlus {
 
@@ -14,12 +18,30 @@ namespace HVACManager {
 
 	// Data
 	//MODULE PARAMETER DEFINITIONS:
-	// na
+	extern Real64 const QuiescentTempTol; // Setpoint and outdoor temperature change that ends quiescence (deltaC)
+	extern Real64 const QuiescentZoneTempTol; // Zone air temperature change that ends quiescence (deltaC)
+	extern Real64 const QuiescentHumRatTol; // Humidity ratio change that ends quiescence (kgWater/kgDryAir)
+	extern Real64 const QuiescentFlowTol; // Mass flow rate setpoint change that ends quiescence (kg/s)
+	extern Real64 const QuiescentLoadTol; // Zone sensible load change that ends quiescence (W)
+	extern Real64 const QuiescentMoistLoadTol; // Zone moisture load change that ends quiescence (kgWater/s)
+	extern int const MaxQuiescentSkips; // Consecutive HVAC solutions skipped before a full solution is forced
 
 	//MODULE VARIABLE DECLARATIONS:
 
 	extern int HVACManageIteration; // counts iterations to enforce maximum iteration limit
 	extern int RepIterAir;
+	extern int QuiescentSkipped; // 1 if the HVAC solution of the system timestep was skipped (for reporting)
+	extern int NumQuiescentChecks; // HVAC solutions checked for quiescence
+	extern int NumQuiescentSkips; // HVAC solutions skipped because the system was quiescent
+	extern int NumQuiescentGuardSolves; // Full solutions forced by a schedule or EMS change
+	extern int QuiescentRun; // Consecutive HVAC solutions skipped so far
+	extern int MaxQuiescentRun; // Longest run of consecutive skipped HVAC solutions
+	extern int NumQuiescentGuardValues; // Leading values of the signature that must match exactly (schedules, EMS)
+	extern bool QuiescentReferenceValid; // True if the reference solution may be reused
+	extern std::vector< Real64 > QuiescentSignature; // Inputs of the HVAC solution of this system timestep
+	extern std::vector< Real64 > QuiescentTolerance; // Tolerance of each value of the signature
+	extern std::vector< Real64 > QuiescentReference; // Inputs of the last full HVAC solution
+	extern FArray1D< DataLoopNode::NodeData > QuiescentNode; // Node state of the last full HVAC solution
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 	// and zone equipment simulations
@@ -70,6 +92,18 @@ namespace HVACManager {
 	void
 	UpdateZoneInletConvergenceLog();
 
+	void
+	GetHVACQuiescenceSignature();
+
+	bool
+	HVACSystemQuiescent();
+
+	void
+	SaveHVACQuiescenceReference();
+
+	void
+	ReportHVACQuiescence();
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
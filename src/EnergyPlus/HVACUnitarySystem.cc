@@ -6945,7 +6945,7 @@ namespace HVACUnitarySystem {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Richard Raustad, FSEC
 		//       DATE WRITTEN   February 2013
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, General::SolveRoot with heating, cooling and latent PLR hints
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -6958,7 +6958,8 @@ namespace HVACUnitarySystem {
 		// na
 
 		// Using/Aliasing
-		using General::SolveRegulaFalsi;
+		using General::SolveRoot;
+		using General::RegisterRootSolverCaller;
 		using General::TrimSigDigits;
 		using DataHeatBalFanSys::TempControlType;
 		using Psychrometrics::PsyCpAirFnWTdb;
@@ -6969,6 +6970,9 @@ namespace HVACUnitarySystem {
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		int const MaxIter( 100 ); // maximum number of iterations
 		Real64 const MinPLR( 0.0 ); // minimum part load ratio allowed
+		static int const HeatSolveIndex( RegisterRootSolverCaller( "UnitarySystem:HeatingPLR" ) ); // root solver statistics index
+		static int const CoolSolveIndex( RegisterRootSolverCaller( "UnitarySystem:CoolingPLR" ) ); // root solver statistics index
+		static int const LatSolveIndex( RegisterRootSolverCaller( "UnitarySystem:LatentPLR" ) ); // root solver statistics index
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -6991,7 +6995,7 @@ namespace HVACUnitarySystem {
 		Real64 LatOutputOn; // latent output at PLR = 1 [W]
 		Real64 CoolPLR; // cooing part load ratio
 		Real64 HeatPLR; // heating part load ratio
-		FArray1D< Real64 > Par( 10 ); // parameters passed to RegulaFalsi function
+		UnitarySystemLoadParams LoadPar; // parameters passed to CalcUnitarySystemLoadResidual
 		int SolFlag; // return flag from RegulaFalsi for sensible load
 		int SolFlagLat; // return flag from RegulaFalsi for latent load
 		Real64 TempLoad; // represents either a sensible or latent load [W]
@@ -7378,20 +7382,21 @@ namespace HVACUnitarySystem {
 		// must test to see if load is bounded by capacity before calling RegulaFalsi
 		if ( ( HeatingLoad && ZoneLoad < SensOutputOn ) || ( CoolingLoad && ZoneLoad > SensOutputOn ) ) {
 			if ( ( HeatingLoad && ZoneLoad > SensOutputOff ) || ( CoolingLoad && ZoneLoad < SensOutputOff ) ) {
-				Par( 1 ) = double( UnitarySysNum );
-				Par( 2 ) = 0.0; // FLAG, IF 1.0 then FirstHVACIteration equals TRUE, if 0.0 then FirstHVACIteration equals false
-				if ( FirstHVACIteration ) Par( 2 ) = 1.0;
-				Par( 3 ) = double( UnitarySystem( UnitarySysNum ).FanOpMode );
-				Par( 4 ) = CompressorONFlag; // CompOp
-				Par( 5 ) = ZoneLoad;
-				Par( 6 ) = 0.0; // FLAG, 0.0 if heating load, 1.0 IF cooling or moisture load
-				if ( CoolingLoad ) Par( 6 ) = 1.0;
-				Par( 7 ) = 1.0; // FLAG, 0.0 if latent load, 1.0 if sensible load to be met
-				Par( 8 ) = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
-				Par( 9 ) = 0.0; // HXUnitOn is always false for HX
-				Par( 10 ) = UnitarySystem( UnitarySysNum ).HeatingPartLoadFrac;
+				LoadPar.UnitarySysNum = UnitarySysNum;
+				LoadPar.FirstHVACIteration = FirstHVACIteration;
+				LoadPar.FanOpMode = UnitarySystem( UnitarySysNum ).FanOpMode;
+				LoadPar.CompOp = CompressorONFlag;
+				LoadPar.LoadToBeMet = ZoneLoad;
+				LoadPar.CoolingLoad = CoolingLoad; // false if heating load, true if cooling or moisture load
+				LoadPar.SensibleLoad = true; // sensible load to be met
+				LoadPar.OnOffAirFlowRatio = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
+				LoadPar.HXUnitOn = false; // HXUnitOn is always false for HX
 				//     Tolerance is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-				SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, Par );
+				if ( CoolingLoad ) {
+					SolveRoot( 0.001, MaxIter, SolFlag, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, LoadPar, UnitarySystem( UnitarySysNum ).CoolPLRHint, CoolSolveIndex );
+				} else {
+					SolveRoot( 0.001, MaxIter, SolFlag, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, LoadPar, UnitarySystem( UnitarySysNum ).HeatPLRHint, HeatSolveIndex );
+				}
 
 				if ( SolFlag == -1 ) {
 					if ( HeatingLoad ) {
@@ -7418,7 +7423,7 @@ namespace HVACUnitarySystem {
 							CalcUnitarySystemToLoad( UnitarySysNum, FirstHVACIteration, CoolPLR, TempMinPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 						}
 						// Now solve again with tighter PLR limits
-						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, HeatPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par );
+						SolveRoot( 0.001, MaxIter, SolFlag, HeatPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, LoadPar, UnitarySystem( UnitarySysNum ).HeatPLRHint, HeatSolveIndex );
 						CalcUnitarySystemToLoad( UnitarySysNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 					} else if ( CoolingLoad ) {
 						// RegulaFalsi may not find cooling PLR when the latent degradation model is used.
@@ -7444,7 +7449,7 @@ namespace HVACUnitarySystem {
 							TempSysOutput = TempSensOutput;
 						}
 						// Now solve again with tighter PLR limits
-						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, CoolPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par );
+						SolveRoot( 0.001, MaxIter, SolFlag, CoolPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, LoadPar, UnitarySystem( UnitarySysNum ).CoolPLRHint, CoolSolveIndex );
 						CalcUnitarySystemToLoad( UnitarySysNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 					} // IF(HeatingLoad)THEN
 					if ( SolFlag == -1 ) {
@@ -7564,29 +7569,22 @@ namespace HVACUnitarySystem {
 
 				// save heating PLR
 				HeatPLR = UnitarySystem( UnitarySysNum ).HeatingPartLoadFrac;
-				Par( 1 ) = double( UnitarySysNum );
-				Par( 2 ) = 0.0; // FLAG, if 1.0 then FirstHVACIteration equals TRUE, if 0.0 then FirstHVACIteration equals false
-				if ( FirstHVACIteration ) Par( 2 ) = 1.0;
-				Par( 3 ) = double( UnitarySystem( UnitarySysNum ).FanOpMode );
-				Par( 4 ) = CompressorONFlag; // CompOp
+				LoadPar.UnitarySysNum = UnitarySysNum;
+				LoadPar.FirstHVACIteration = FirstHVACIteration;
+				LoadPar.FanOpMode = UnitarySystem( UnitarySysNum ).FanOpMode;
+				LoadPar.CompOp = CompressorONFlag;
 				if ( UnitarySystem( UnitarySysNum ).DehumidControlType_Num == DehumidControl_Multimode ) {
-					Par( 5 ) = ZoneLoad;
-					Par( 7 ) = 1.0; // FLAG, 0.0 if latent load, 1.0 if sensible load to be met
-				} else {
-					Par( 5 ) = MoistureLoad;
-					Par( 7 ) = 0.0; // FLAG, 0.0 if latent load, 1.0 if sensible load to be met
-				}
-				Par( 6 ) = 1.0; // FLAG, 0.0 if heating load, 1.0 if cooling or moisture load
-				//      IF(HeatingLoad)Par(6)  = 0.0d0
-				Par( 8 ) = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
-				if ( HXUnitOn ) {
-					Par( 9 ) = 1.0;
+					LoadPar.LoadToBeMet = ZoneLoad;
+					LoadPar.SensibleLoad = true; // sensible load to be met
 				} else {
-					Par( 9 ) = 0.0;
+					LoadPar.LoadToBeMet = MoistureLoad;
+					LoadPar.SensibleLoad = false; // latent load to be met
 				}
-				Par( 10 ) = UnitarySystem( UnitarySysNum ).HeatingPartLoadFrac;
+				LoadPar.CoolingLoad = true; // cooling or moisture load
+				LoadPar.OnOffAirFlowRatio = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
+				LoadPar.HXUnitOn = HXUnitOn;
 				// Tolerance is fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-				SolveRegulaFalsi( 0.001, MaxIter, SolFlagLat, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, Par );
+				SolveRoot( 0.001, MaxIter, SolFlagLat, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, LoadPar, UnitarySystem( UnitarySysNum ).LatPLRHint, LatSolveIndex );
 				//      IF (HeatingLoad) THEN
 				//        UnitarySystem(UnitarySysNum)%HeatingPartLoadFrac = PartLoadRatio
 				//      ELSE
@@ -7627,7 +7625,7 @@ namespace HVACUnitarySystem {
 				CalcUnitarySystemToLoad( UnitarySysNum, FirstHVACIteration, TempMinPLR, HeatPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 			}
 			// Now solve again with tighter PLR limits
-			SolveRegulaFalsi( 0.001, MaxIter, SolFlagLat, CoolPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par );
+			SolveRoot( 0.001, MaxIter, SolFlagLat, CoolPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, LoadPar, UnitarySystem( UnitarySysNum ).LatPLRHint, LatSolveIndex );
 			CalcUnitarySystemToLoad( UnitarySysNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 			if ( SolFlagLat == -1 ) {
 				if ( std::abs( MoistureLoad - TempLatOutput ) > SmallLoad ) {
@@ -7775,21 +7773,21 @@ namespace HVACUnitarySystem {
 	Real64
 	CalcUnitarySystemLoadResidual(
 		Real64 const PartLoadRatio, // DX cooling coil part load ratio
-		Optional< FArray1S< Real64 > const > Par // Function parameters
+		UnitarySystemLoadParams const & Par // Function parameters
 	)
 	{
 
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Richard Raustad, FSEC
 		//       DATE WRITTEN   February 2013
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2014: typed parameters for General::SolveRoot
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// To calculate the part-load ratio for the unitary system
 
 		// METHODOLOGY EMPLOYED:
-		// Use SolveRegulaFalsi to CALL this Function to converge on a solution
+		// Use SolveRoot to CALL this Function to converge on a solution
 
 		// REFERENCES:
 		// na
@@ -7805,17 +7803,7 @@ namespace HVACUnitarySystem {
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
-		//   Parameter description example:
-		//       Par(1)  = REAL(UnitarySysNum,r64) ! Index to Unitary System
-		//       Par(2)  = 0.0                  ! FirstHVACIteration FLAG, IF 1.0 then TRUE, if 0.0 then FALSE
-		//       Par(3)  = REAL(OpMode,r64)     ! Fan control, IF 1.0 then cycling fan, if 0.0 then continuous fan
-		//       Par(4)  = REAL(CompOp,r64)     ! Compressor control, IF 1.0 then compressor ON, if 0.0 then compressor OFF
-		//       Par(5)  = SensLoad or MoistureLoad   ! Sensible or Latent load to be met by unitary system
-		//       Par(6)  = HeatingLoad or CoolingLoad ! Type of load FLAG, 0.0 IF heating load, 1.0 IF cooling or moisture load
-		//       Par(7)  = 1.0                  ! Output calculation FLAG, 0.0 for latent capacity, 1.0 for sensible capacity
-		//       Par(8)  = OnOffAirFlowRatio    ! Ratio of compressor ON air mass flow to AVERAGE air mass flow over time step
-		//       Par(9)  = HXUnitOn             ! flag to enable HX, 1=ON and 2=OFF
-		//       Par(10) = HeatingCoilPLR       ! used to calculate latent degradation for cycling fan RH control
+		//   Parameters are described in UnitarySystemLoadParams
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		// na
@@ -7840,21 +7828,14 @@ namespace HVACUnitarySystem {
 		Real64 SensOutput; // sensible output of system
 		Real64 LatOutput; // latent output of system
 
-		assert( present( Par ) ); // Only optional to match std::function specs for SolveRegularFalsi
-
-		// Convert parameters to usable variables
-		UnitarySysNum = int( Par()( 1 ) );
-		if ( Par()( 2 ) == 1.0 ) {
-			FirstHVACIteration = true;
-		} else {
-			FirstHVACIteration = false;
-		}
-		FanOpMode = int( Par()( 3 ) );
-		CompOp = int( Par()( 4 ) );
-		LoadToBeMet = Par()( 5 );
-		OnOffAirFlowRatio = Par()( 8 );
+		UnitarySysNum = Par.UnitarySysNum;
+		FirstHVACIteration = Par.FirstHVACIteration;
+		FanOpMode = Par.FanOpMode;
+		CompOp = Par.CompOp;
+		LoadToBeMet = Par.LoadToBeMet;
+		OnOffAirFlowRatio = Par.OnOffAirFlowRatio;
 
-		if ( Par()( 6 ) == 1.0 ) {
+		if ( Par.CoolingLoad ) {
 			CoolPLR = PartLoadRatio;
 			HeatPLR = 0.0;
 		} else {
@@ -7862,14 +7843,8 @@ namespace HVACUnitarySystem {
 			HeatPLR = PartLoadRatio;
 		}
 
-		SensibleLoad = false;
-		if ( Par()( 7 ) == 1.0 ) SensibleLoad = true;
-
-		if ( Par()( 9 ) == 1.0 ) {
-			HXUnitOn = true;
-		} else {
-			HXUnitOn = false;
-		}
+		SensibleLoad = Par.SensibleLoad;
+		HXUnitOn = Par.HXUnitOn;
 
 		SetSpeedVariables( UnitarySysNum, SensibleLoad, PartLoadRatio );
 
@@ -9,6 +9,7 @@
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 #include <DataGlobals.hh>
+#include <DataRootFinder.hh>
 #include <DataSizing.hh>
 
 namespace EnergyPlus {
@@ -401,6 +402,9 @@ namespace HVACUnitarySystem {
 		int RegulaFalsIFailedIndex; // used in PLR calculations for sensible load
 		int LatMaxIterIndex; // used in PLR calculations for moisture load
 		int LatRegulaFalsIFailedIndex; // used in PLR calculations for moisture load
+		DataRootFinder::RootSolverHintType HeatPLRHint; // last converged heating PLR for sensible load
+		DataRootFinder::RootSolverHintType CoolPLRHint; // last converged cooling PLR for sensible load
+		DataRootFinder::RootSolverHintType LatPLRHint; // last converged PLR for moisture load
 		// EMS variables
 		bool DesignFanVolFlowRateEMSOverrideOn; // If true, then EMS is calling to override autosize fan flow
 		bool MaxHeatAirVolFlowEMSOverrideOn; // If true, then EMS is calling to override autosize fan flow
@@ -1186,6 +1190,34 @@ namespace HVACUnitarySystem {
 
 	};
 
+	struct UnitarySystemLoadParams // Parameters of CalcUnitarySystemLoadResidual
+	{
+		// Members
+		int UnitarySysNum; // Index to this unitary system
+		bool FirstHVACIteration; // FirstHVACIteration flag
+		int FanOpMode; // Cycling fan or constant fan
+		int CompOp; // Compressor on/off; 1=on, 0=off
+		Real64 LoadToBeMet; // Sensible or Latent load to be met
+		bool CoolingLoad; // true if the PLR applies to the cooling coil (cooling or moisture load)
+		bool SensibleLoad; // true if a sensible load is to be met, false for latent
+		Real64 OnOffAirFlowRatio; // Ratio of compressor ON air mass flow to AVERAGE air mass flow over time step
+		bool HXUnitOn; // flag to enable HX based on zone moisture load
+
+		// Default Constructor
+		UnitarySystemLoadParams() :
+			UnitarySysNum( 0 ),
+			FirstHVACIteration( false ),
+			FanOpMode( 0 ),
+			CompOp( 0 ),
+			LoadToBeMet( 0.0 ),
+			CoolingLoad( false ),
+			SensibleLoad( true ),
+			OnOffAirFlowRatio( 1.0 ),
+			HXUnitOn( false )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< DesignSpecMSHPData > DesignSpecMSHP;
 	extern FArray1D< UnitarySystemData > UnitarySystem;
@@ -1310,7 +1342,7 @@ namespace HVACUnitarySystem {
 	Real64
 	CalcUnitarySystemLoadResidual(
 		Real64 const PartLoadRatio, // DX cooling coil part load ratio
-		Optional< FArray1S< Real64 > const > Par = _ // Function parameters
+		UnitarySystemLoadParams const & Par // Function parameters
 	);
 
 	void
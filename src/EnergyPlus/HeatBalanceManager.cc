@@ -43,7 +43,9 @@
 #include <NodeInputManager.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportTabular.hh>
+#include <ParametricRuns.hh>
 #include <ScheduleManager.hh>
+#include <SimulationCheckpoint.hh>
 #include <SolarShading.hh>
 #include <SurfaceGeometry.hh>
 #include <UtilityRoutines.hh>
@@ -96,6 +98,8 @@ namespace HeatBalanceManager {
 	// Use statements for access to subroutines in other modules
 	using InputProcessor::GetNumObjectsFound;
 	using InputProcessor::GetObjectItem;
+	using InputProcessor::GetObjectItemRecord;
+	using InputProcessor::LineDefinition;
 	using InputProcessor::SameString;
 	using InputProcessor::FindItemInList;
 	using InputProcessor::VerifyName;
@@ -215,6 +219,15 @@ namespace HeatBalanceManager {
 		using DataGlobals::emsCallFromEndZoneTimestepBeforeZoneReporting;
 		using DataGlobals::emsCallFromEndZoneTimestepAfterZoneReporting;
 		using DataGlobals::emsCallFromBeginNewEvironmentAfterWarmUp;
+		using DataSystemVariables::SharedWarmup;
+		using SimulationCheckpoint::CheckpointAfterWarmup;
+		using SimulationCheckpoint::RestartPending;
+		using SimulationCheckpoint::RestoredFromCheckpoint;
+		using SimulationCheckpoint::RestoreSimulationCheckpoint;
+		using SimulationCheckpoint::ReuseWarmupState;
+		using SimulationCheckpoint::SaveWarmupState;
+		using SimulationCheckpoint::WarmupStateReused;
+		using SimulationCheckpoint::WriteSimulationCheckpoint;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -266,17 +279,24 @@ namespace HeatBalanceManager {
 
 		if ( WarmupFlag && EndDayFlag ) {
 
-			CheckWarmupConvergence();
+			if ( RestartPending && KindOfSim == ksRunPeriodWeather ) {
+				RestoreSimulationCheckpoint(); // The checkpointed state replaces the warmup
+			} else if ( ! ( SharedWarmup && NumOfWarmupDays == 1 && ReuseWarmupState() ) ) {
+				CheckWarmupConvergence();
+				if ( SharedWarmup && ! WarmupFlag ) SaveWarmupState();
+			}
 			if ( ! WarmupFlag ) {
 				DayOfSim = 0; // Reset DayOfSim if Warmup converged
 				DayOfSimChr = "0";
 
+				if ( CheckpointAfterWarmup && KindOfSim == ksRunPeriodWeather ) WriteSimulationCheckpoint( DayOfYear );
+
 				ManageEMS( emsCallFromBeginNewEvironmentAfterWarmUp ); // calling point
 			}
 
 		}
 
-		if ( ! WarmupFlag && EndDayFlag && DayOfSim == 1 && ! DoingSizing ) {
+		if ( ! WarmupFlag && EndDayFlag && DayOfSim == 1 && ! DoingSizing && ! RestoredFromCheckpoint && ! WarmupStateReused ) {
 			ReportWarmupConvergence();
 		}
 
@@ -3461,6 +3481,7 @@ namespace HeatBalanceManager {
 		//       DATE WRITTEN   September 1997
 		//       MODIFIED       January 2003, FCW: accommodate between-glass shading device
 		//                      July 2009, TH: added constructions defined with F and C factors
+		//                      October 2014: read regular constructions through GetObjectItemRecord
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3565,12 +3586,14 @@ namespace HeatBalanceManager {
 		CurrentModuleObject = "Construction";
 		for ( Loop = 1; Loop <= TotRegConstructs; ++Loop ) { // Loop through all constructs in the input...
 
-			//Get the object names for each construction from the input processor
-			GetObjectItem( CurrentModuleObject, Loop, ConstructAlphas, ConstructNumAlpha, DummyProps, DummyNumProp, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+			//Get the object names for each construction from the input processor (read in place, the
+			//layer names are only looked up)
+			LineDefinition const & ConstructRec( GetObjectItemRecord( CurrentModuleObject, Loop ) );
+			ConstructNumAlpha = ConstructRec.NumAlphas;
 
 			ErrorInName = false;
 			IsBlank = false;
-			VerifyName( ConstructAlphas( 0 ), Construct.Name(), ConstrNum, ErrorInName, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( ConstructRec.Alphas( 1 ), Construct.Name(), ConstrNum, ErrorInName, IsBlank, CurrentModuleObject + " Name" );
 			if ( ErrorInName ) {
 				ErrorsFound = true;
 				continue;
@@ -3581,7 +3604,7 @@ namespace HeatBalanceManager {
 
 			++ConstrNum;
 			//Assign Construction name to the Derived Type using the zeroth position of the array
-			Construct( ConstrNum ).Name = ConstructAlphas( 0 );
+			Construct( ConstrNum ).Name = ConstructRec.Alphas( 1 );
 
 			//Set the total number of layers for the construction
 			Construct( ConstrNum ).TotLayers = ConstructNumAlpha - 1;
@@ -3592,7 +3615,7 @@ namespace HeatBalanceManager {
 
 				//Find the material in the list of materials
 
-				Construct( ConstrNum ).LayerPoint( Layer ) = FindItemInList( ConstructAlphas( Layer ), Material.Name(), TotMaterials );
+				Construct( ConstrNum ).LayerPoint( Layer ) = FindItemInList( ConstructRec.Alphas( Layer + 1 ), Material.Name(), TotMaterials );
 
 				// count number of glass layers
 				if ( Construct( ConstrNum ).LayerPoint( Layer ) > 0 ) {
@@ -3601,7 +3624,7 @@ namespace HeatBalanceManager {
 
 				if ( Construct( ConstrNum ).LayerPoint( Layer ) == 0 ) {
 					//This may be a TC GlazingGroup
-					Construct( ConstrNum ).LayerPoint( Layer ) = FindItemInList( ConstructAlphas( Layer ), TCGlazings.Name(), TotTCGlazings );
+					Construct( ConstrNum ).LayerPoint( Layer ) = FindItemInList( ConstructRec.Alphas( Layer + 1 ), TCGlazings.Name(), TotTCGlazings );
 
 					if ( Construct( ConstrNum ).LayerPoint( Layer ) > 0 ) {
 						//reset layer pointer to the first glazing in the TC GlazingGroup
@@ -3617,7 +3640,7 @@ namespace HeatBalanceManager {
 				}
 
 				if ( Construct( ConstrNum ).LayerPoint( Layer ) == 0 ) {
-					ShowSevereError( "Did not find matching material for " + CurrentModuleObject + ' ' + Construct( ConstrNum ).Name + ", missing material = " + ConstructAlphas( Layer ) );
+					ShowSevereError( "Did not find matching material for " + CurrentModuleObject + ' ' + Construct( ConstrNum ).Name + ", missing material = " + ConstructRec.Alphas( Layer + 1 ) );
 					ErrorsFound = true;
 				} else {
 					NominalRforNominalUCalculation( ConstrNum ) += NominalR( Construct( ConstrNum ).LayerPoint( Layer ) );
@@ -4253,7 +4276,7 @@ namespace HeatBalanceManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Rick Strand
 		//       DATE WRITTEN   April 1997
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, parametric variants forked after the setup
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4276,6 +4299,8 @@ namespace HeatBalanceManager {
 		using DataSystemVariables::DetailedSolarTimestepIntegration;
 		//  USE DataRoomAirModel, ONLY: IsZoneDV,IsZoneCV,HVACMassFlow, ZoneDVMixedFlag
 		using WindowEquivalentLayer::InitEquivalentLayerWindowCalculations;
+		using ParametricRuns::SetupForkPending;
+		using ParametricRuns::ForkParametricVariantsAfterSetup;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -4312,6 +4337,9 @@ namespace HeatBalanceManager {
 			DisplayString( "Initializing Solar Calculations" );
 			InitSolarCalculations(); // Initialize the shadowing calculations
 
+			// In a parametric batch the variants that share this setup are forked here
+			if ( SetupForkPending ) ForkParametricVariantsAfterSetup();
+
 		}
 
 		if ( BeginEnvrnFlag ) {
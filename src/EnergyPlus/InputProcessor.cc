@@ -1,3 +1,18 @@
+// C++ Headers
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#ifdef __unix__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
@@ -11,6 +26,7 @@
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DisplayRoutines.hh>
 #include <SortAndStringUtilities.hh>
 
@@ -83,6 +99,9 @@ namespace InputProcessor {
 	static std::string const AlphaNum( "ANan" ); // Valid indicators for Alpha or Numeric fields (A or N)
 	Real64 const DefAutoSizeValue( AutoSize );
 	Real64 const DefAutoCalculateValue( AutoCalculate );
+	int const IDDCacheVersion( 1 ); // Layout version of the binary data dictionary cache
+	std::string const IDDCacheSuffix( ".bin" ); // Appended to the IDD file name to name its binary cache
+	std::string::size_type const MinIDFScanChunk( 1048576 ); // Smallest part of the IDF scanned as one chunk (bytes)
 	static gio::Fmt const fmtLD( "*" );
 	static gio::Fmt const fmtA( "(A)" );
 
@@ -123,6 +142,18 @@ namespace InputProcessor {
 	int TotalAuditErrors( 0 ); // Counting some warnings that go onto only the audit file
 	int NumSecretObjects( 0 ); // Number of objects in "Secret Mode"
 	bool ProcessingIDD( false ); // True when processing IDD, false when processing IDF
+	bool IDDFromCache( false ); // True when the data dictionary tables were loaded from the binary cache
+	Real64 IDDLoadTime( 0.0 ); // Time to set up the data dictionary tables (s)
+	bool IDFScanActive( false ); // True while in.idf lines are served from the scanned memory image
+	char const * IDFScanBytes( nullptr ); // Memory image of in.idf
+	std::string IDFScanCopy; // Contents of in.idf where it cannot be mapped
+	std::string::size_type IDFScanSize( 0 ); // Size of in.idf (bytes)
+	std::string::size_type IDFScanPos( 0 ); // Start of the next line to be served
+	int IDFScanLineNum( 0 ); // Line last served (first line = 1)
+	int IDFScanChunkNum( 0 ); // Chunk holding the next pre-converted number (zero based)
+	std::vector< int >::size_type IDFScanItemNum( 0 ); // Next pre-converted number of that chunk (zero based)
+	Int64 IDFScanNumbersUsed( 0 ); // Numeric fields taken from the pre-converted numbers
+	Real64 IDFLoadTime( 0.0 ); // Time to read and process in.idf (s)
 
 	//Real Variables for Module
 	//na
@@ -134,6 +165,8 @@ namespace InputProcessor {
 	FArray1D_int iListOfObjects;
 	FArray1D_int ObjectGotCount;
 	FArray1D_int ObjectStartRecord;
+	FArray1D_int ObjectRecordStart; // Start of each object definition's records in ObjectRecordList (NumObjectDefs + 1 entries)
+	FArray1D_int ObjectRecordList; // IDF record numbers grouped by object definition, in input order
 	std::string CurrentFieldName; // Current Field Name (IDD)
 	FArray1D_string ObsoleteObjectsRepNames; // Array of Replacement names for Obsolete objects
 	std::string ReplacementName;
@@ -162,6 +195,7 @@ namespace InputProcessor {
 	LineDefinition LineItem; // Description of current record
 	FArray1D< LineDefinition > IDFRecords; // All the objects read from the IDF
 	FArray1D< SecretObjects > RepObjects; // Secret Objects that could replace old ones
+	std::vector< IDFScanChunk > IDFScanChunks; // Parts of in.idf scanned in parallel
 
 	// MODULE SUBROUTINES:
 	//*************************************************************************
@@ -200,6 +234,9 @@ namespace InputProcessor {
 		using DataOutputs::iTotalAutoSizableFields;
 		using DataOutputs::iNumberOfAutoCalcedFields;
 		using DataOutputs::iTotalAutoCalculatableFields;
+		using DataSystemVariables::UseIDDCache;
+		using DataSystemVariables::NumIDFScanThreads;
+		using DataTimings::epElapsedTime;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -224,6 +261,8 @@ namespace InputProcessor {
 		int endcol;
 		int write_stat;
 		int read_stat;
+		bool IDDCacheWritten; // True when the binary cache of the IDD was (re)written by this run
+		Int64 IDFFileSize; // Size of in.idf (bytes)
 
 		InitSecretObjects();
 
@@ -261,30 +300,46 @@ namespace InputProcessor {
 			DisplayString( "Missing " + FullName );
 			ShowFatalError( "ProcessInput: Energy+.idd missing. Program terminates. Fullname=" + FullName );
 		}
-		IDDFile = GetNewUnitNumber();
-		{ IOFlags flags; flags.ACTION( "read" ); gio::open( IDDFile, FullName, flags ); read_stat = flags.ios(); }
-		if ( read_stat != 0 ) {
-			DisplayString( "Could not open (read) Energy+.idd." );
-			ShowFatalError( "ProcessInput: Could not open file \"Energy+.idd\" for input (read)." );
-		}
-		gio::read( IDDFile, fmtA ) >> InputLine;
-		endcol = len( InputLine );
-		if ( endcol > 0 ) {
-			if ( int( InputLine[ endcol - 1 ] ) == iUnicode_end ) {
-				ShowSevereError( "ProcessInput: \"Energy+.idd\" appears to be a Unicode or binary file." );
-				ShowContinueError( "...This file cannot be read by this program. Please save as PC or Unix file and try again" );
-				ShowFatalError( "Program terminates due to previous condition." );
-			}
-		}
-		gio::backspace( IDDFile );
-		NumLines = 0;
 
 		DoingInputProcessing = true;
 		gio::write( EchoInputFile, fmtLD ) << " Processing Data Dictionary (Energy+.idd) File -- Start";
 		DisplayString( "Processing Data Dictionary" );
 		ProcessingIDD = true;
 
-		ProcessDataDicFile( ErrorsInIDD );
+		// A current binary cache of the IDD replaces parsing the text IDD
+		IDDLoadTime = epElapsedTime();
+		IDDFromCache = false;
+		IDDCacheWritten = false;
+		if ( UseIDDCache ) IDDFromCache = LoadIDDCache( FullName + IDDCacheSuffix, FullName );
+
+		if ( ! IDDFromCache ) {
+			IDDFile = GetNewUnitNumber();
+			{ IOFlags flags; flags.ACTION( "read" ); gio::open( IDDFile, FullName, flags ); read_stat = flags.ios(); }
+			if ( read_stat != 0 ) {
+				DisplayString( "Could not open (read) Energy+.idd." );
+				ShowFatalError( "ProcessInput: Could not open file \"Energy+.idd\" for input (read)." );
+			}
+			gio::read( IDDFile, fmtA ) >> InputLine;
+			endcol = len( InputLine );
+			if ( endcol > 0 ) {
+				if ( int( InputLine[ endcol - 1 ] ) == iUnicode_end ) {
+					ShowSevereError( "ProcessInput: \"Energy+.idd\" appears to be a Unicode or binary file." );
+					ShowContinueError( "...This file cannot be read by this program. Please save as PC or Unix file and try again" );
+					ShowFatalError( "Program terminates due to previous condition." );
+				}
+			}
+			gio::backspace( IDDFile );
+			NumLines = 0;
+
+			ProcessDataDicFile( ErrorsInIDD );
+
+			gio::close( IDDFile );
+
+			if ( UseIDDCache && ! ErrorsInIDD && NumObjectDefs > 0 ) {
+				IDDCacheWritten = WriteIDDCache( FullName + IDDCacheSuffix, FullName );
+			}
+		}
+		IDDLoadTime = epElapsedTime() - IDDLoadTime;
 
 		ListOfObjects.allocate( NumObjectDefs );
 		ListOfObjects = ObjectDef( {1,NumObjectDefs} ).Name();
@@ -298,8 +353,6 @@ namespace InputProcessor {
 		ObjectGotCount.allocate( NumObjectDefs );
 		ObjectGotCount = 0;
 
-		gio::close( IDDFile );
-
 		if ( NumObjectDefs == 0 ) {
 			ShowFatalError( "ProcessInput: No objects found in IDD.  Program will terminate." );
 			ErrorsInIDD = true;
@@ -311,6 +364,14 @@ namespace InputProcessor {
 
 		ProcessingIDD = false;
 		gio::write( EchoInputFile, fmtLD ) << " Processing Data Dictionary (Energy+.idd) File -- Complete";
+		if ( IDDFromCache ) {
+			gio::write( EchoInputFile, fmtLD ) << " Data Dictionary loaded from binary cache=" + FullName + IDDCacheSuffix;
+		} else if ( IDDCacheWritten ) {
+			gio::write( EchoInputFile, fmtLD ) << " Data Dictionary parsed from text, binary cache written=" + FullName + IDDCacheSuffix;
+		} else {
+			gio::write( EchoInputFile, fmtLD ) << " Data Dictionary parsed from text";
+		}
+		gio::write( EchoInputFile, fmtLD ) << " Data Dictionary Load Time [s]=" << IDDLoadTime;
 
 		gio::write( EchoInputFile, fmtLD ) << " Maximum number of Alpha Args=" << MaxAlphaArgsFound;
 		gio::write( EchoInputFile, fmtLD ) << " Maximum number of Numeric Args=" << MaxNumericArgsFound;
@@ -348,8 +409,14 @@ namespace InputProcessor {
 		EchoInputLine = true;
 		DisplayString( "Processing Input File" );
 
+		// The streaming reader scans in.idf in memory ahead of validation
+		IDFLoadTime = epElapsedTime();
+		if ( NumIDFScanThreads > 0 ) StartIDFScan( "in.idf", NumIDFScanThreads );
+
 		ProcessInputDataFile();
 
+		IDFLoadTime = epElapsedTime() - IDFLoadTime;
+
 		ListOfSections.allocate( NumSectionDefs );
 		ListOfSections = SectionDef( {1,NumSectionDefs} ).Name();
 
@@ -370,8 +437,23 @@ namespace InputProcessor {
 
 		IDFRecordsGotten.allocate( NumIDFRecords );
 		IDFRecordsGotten = false;
+		IndexIDFRecordsByObject();
 
 		gio::write( EchoInputFile, fmtLD ) << " Processing Input Data File (in.idf) -- Complete";
+		if ( IDFScanActive ) {
+			IDFFileSize = IDFScanSize;
+			gio::write( EchoInputFile, fmtLD ) << " Input Data File scanned in memory, threads=" << NumIDFScanThreads << ", chunks=" << int( IDFScanChunks.size() );
+			gio::write( EchoInputFile, fmtLD ) << " Number of Numeric Fields pre-converted=" << IDFScanNumbersUsed;
+			EndIDFScan();
+		} else {
+			std::ifstream IDFStream( "in.idf", std::ios_base::binary | std::ios_base::ate );
+			IDFFileSize = IDFStream ? Int64( IDFStream.tellg() ) : 0;
+		}
+		gio::write( EchoInputFile, fmtLD ) << " Input Data File Size [MB]=" << IDFFileSize / 1048576.0;
+		gio::write( EchoInputFile, fmtLD ) << " Input Data File Processing Time [s]=" << IDFLoadTime;
+		if ( IDFLoadTime > 0.0 ) {
+			gio::write( EchoInputFile, fmtLD ) << " Input Data File Throughput [MB/s]=" << IDFFileSize / 1048576.0 / IDFLoadTime;
+		}
 		//   WRITE(EchoInputFile,*) ' Number of IDF "Lines"=',NumIDFRecords
 		gio::write( EchoInputFile, fmtLD ) << " Maximum number of Alpha IDF Args=" << MaxAlphaIDFArgsFound;
 		gio::write( EchoInputFile, fmtLD ) << " Maximum number of Numeric IDF Args=" << MaxNumericIDFArgsFound;
@@ -568,6 +650,547 @@ namespace InputProcessor {
 
 	}
 
+	void
+	IDDCacheBuffer::Transfer( int & Value )
+	{
+		if ( Packing ) {
+			Data.append( reinterpret_cast< char const * >( &Value ), sizeof( Value ) );
+		} else {
+			Extract( &Value, sizeof( Value ) );
+		}
+	}
+
+	void
+	IDDCacheBuffer::Transfer( Int64 & Value )
+	{
+		if ( Packing ) {
+			Data.append( reinterpret_cast< char const * >( &Value ), sizeof( Value ) );
+		} else {
+			Extract( &Value, sizeof( Value ) );
+		}
+	}
+
+	void
+	IDDCacheBuffer::Transfer( bool & Value )
+	{
+		char Flag( Value ? 1 : 0 );
+
+		if ( Packing ) {
+			Data.append( 1, Flag );
+		} else if ( Extract( &Flag, 1 ) ) {
+			Value = ( Flag != 0 );
+		}
+	}
+
+	void
+	IDDCacheBuffer::Transfer( Real64 & Value )
+	{
+		if ( Packing ) {
+			Data.append( reinterpret_cast< char const * >( &Value ), sizeof( Value ) );
+		} else {
+			Extract( &Value, sizeof( Value ) );
+		}
+	}
+
+	void
+	IDDCacheBuffer::Transfer( std::string & Value )
+	{
+		int Length( Value.length() );
+
+		Transfer( Length );
+		if ( Packing ) {
+			Data.append( Value );
+		} else if ( ! Short ) {
+			if ( Length < 0 || Pos + Length > Size ) {
+				Short = true;
+				return;
+			}
+			Value.assign( Bytes + Pos, Length );
+			Pos += Length;
+		}
+	}
+
+	void
+	IDDCacheBuffer::Transfer( FArray1D_bool & Values )
+	{
+		int NumValues( Values.size() );
+		int ValueNum;
+
+		Transfer( NumValues );
+		if ( ! Packing ) {
+			if ( Short || NumValues < 0 || Pos + NumValues > Size ) {
+				Short = true;
+				return;
+			}
+			Values.allocate( NumValues );
+		}
+		for ( ValueNum = 1; ValueNum <= NumValues; ++ValueNum ) {
+			Transfer( Values( ValueNum ) );
+		}
+	}
+
+	void
+	IDDCacheBuffer::Transfer( FArray1D_int & Values )
+	{
+		int NumValues( Values.size() );
+		int ValueNum;
+
+		Transfer( NumValues );
+		if ( ! Packing ) {
+			if ( Short || NumValues < 0 || Pos + NumValues * sizeof( int ) > Size ) {
+				Short = true;
+				return;
+			}
+			Values.allocate( NumValues );
+		}
+		for ( ValueNum = 1; ValueNum <= NumValues; ++ValueNum ) {
+			Transfer( Values( ValueNum ) );
+		}
+	}
+
+	void
+	IDDCacheBuffer::Transfer( FArray1D< Real64 > & Values )
+	{
+		int NumValues( Values.size() );
+		int ValueNum;
+
+		Transfer( NumValues );
+		if ( ! Packing ) {
+			if ( Short || NumValues < 0 || Pos + NumValues * sizeof( Real64 ) > Size ) {
+				Short = true;
+				return;
+			}
+			Values.allocate( NumValues );
+		}
+		for ( ValueNum = 1; ValueNum <= NumValues; ++ValueNum ) {
+			Transfer( Values( ValueNum ) );
+		}
+	}
+
+	void
+	IDDCacheBuffer::Transfer( FArray1D_string & Values )
+	{
+		int NumValues( Values.size() );
+		int ValueNum;
+
+		Transfer( NumValues );
+		if ( ! Packing ) {
+			if ( Short || NumValues < 0 || Pos + NumValues * sizeof( int ) > Size ) {
+				Short = true;
+				return;
+			}
+			Values.allocate( NumValues );
+		}
+		for ( ValueNum = 1; ValueNum <= NumValues; ++ValueNum ) {
+			Transfer( Values( ValueNum ) );
+		}
+	}
+
+	bool
+	IDDCacheBuffer::Extract( void * Value, std::string::size_type const Length )
+	{
+		if ( Short || Pos + Length > Size ) {
+			Short = true;
+			return false;
+		}
+		std::memcpy( Value, Bytes + Pos, Length );
+		Pos += Length;
+		return true;
+	}
+
+	void
+	TransferIDDTables( IDDCacheBuffer & Buffer ) // packed data dictionary tables
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Packs (when writing the binary IDD cache) or unpacks (when loading it) everything
+		// ProcessDataDicFile leaves behind: the section and object definitions with their
+		// field tables, the obsolete object replacement names and the argument counts.
+
+		// METHODOLOGY EMPLOYED:
+		// The same list of fields is used in both directions so the two sides cannot drift
+		// apart. Any change to the fields of SectionsDefinition, ObjectsDefinition or
+		// RangeCheckDef must be reflected here and IDDCacheVersion incremented.
+		// Unpacking stops at the first short read; the caller then falls back to the text IDD.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Loop;
+		int Check;
+		int NumChecks;
+
+		Buffer.Transfer( IDDVerString );
+
+		Buffer.Transfer( NumSectionDefs );
+		if ( ! Buffer.Packing ) {
+			if ( Buffer.Short || NumSectionDefs < 0 ) return;
+			MaxSectionDefs = ( NumSectionDefs / SectionDefAllocInc + 1 ) * SectionDefAllocInc;
+			SectionDef.allocate( MaxSectionDefs );
+		}
+		for ( Loop = 1; Loop <= NumSectionDefs; ++Loop ) {
+			Buffer.Transfer( SectionDef( Loop ).Name );
+		}
+
+		Buffer.Transfer( NumObjectDefs );
+		if ( ! Buffer.Packing ) {
+			if ( Buffer.Short || NumObjectDefs < 0 ) return;
+			MaxObjectDefs = ( NumObjectDefs / ObjectDefAllocInc + 1 ) * ObjectDefAllocInc;
+			ObjectDef.allocate( MaxObjectDefs );
+		}
+		for ( Loop = 1; Loop <= NumObjectDefs; ++Loop ) {
+			Buffer.Transfer( ObjectDef( Loop ).Name );
+			Buffer.Transfer( ObjectDef( Loop ).NumParams );
+			Buffer.Transfer( ObjectDef( Loop ).NumAlpha );
+			Buffer.Transfer( ObjectDef( Loop ).NumNumeric );
+			Buffer.Transfer( ObjectDef( Loop ).MinNumFields );
+			Buffer.Transfer( ObjectDef( Loop ).NameAlpha1 );
+			Buffer.Transfer( ObjectDef( Loop ).UniqueObject );
+			Buffer.Transfer( ObjectDef( Loop ).RequiredObject );
+			Buffer.Transfer( ObjectDef( Loop ).ExtensibleObject );
+			Buffer.Transfer( ObjectDef( Loop ).ExtensibleNum );
+			Buffer.Transfer( ObjectDef( Loop ).LastExtendAlpha );
+			Buffer.Transfer( ObjectDef( Loop ).LastExtendNum );
+			Buffer.Transfer( ObjectDef( Loop ).ObsPtr );
+			Buffer.Transfer( ObjectDef( Loop ).AlphaOrNumeric );
+			Buffer.Transfer( ObjectDef( Loop ).ReqField );
+			Buffer.Transfer( ObjectDef( Loop ).AlphRetainCase );
+			Buffer.Transfer( ObjectDef( Loop ).AlphFieldChks );
+			Buffer.Transfer( ObjectDef( Loop ).AlphFieldDefs );
+
+			NumChecks = ObjectDef( Loop ).NumRangeChks.size();
+			Buffer.Transfer( NumChecks );
+			if ( ! Buffer.Packing ) {
+				if ( Buffer.Short || NumChecks < 0 ) return;
+				ObjectDef( Loop ).NumRangeChks.allocate( NumChecks );
+			}
+			for ( Check = 1; Check <= NumChecks; ++Check ) {
+				auto & RangeCheck( ObjectDef( Loop ).NumRangeChks( Check ) );
+				Buffer.Transfer( RangeCheck.MinMaxChk );
+				Buffer.Transfer( RangeCheck.FieldNumber );
+				Buffer.Transfer( RangeCheck.FieldName );
+				Buffer.Transfer( RangeCheck.MinMaxString );
+				Buffer.Transfer( RangeCheck.MinMaxValue );
+				Buffer.Transfer( RangeCheck.WhichMinMax );
+				Buffer.Transfer( RangeCheck.DefaultChk );
+				Buffer.Transfer( RangeCheck.Default );
+				Buffer.Transfer( RangeCheck.DefAutoSize );
+				Buffer.Transfer( RangeCheck.AutoSizable );
+				Buffer.Transfer( RangeCheck.AutoSizeValue );
+				Buffer.Transfer( RangeCheck.DefAutoCalculate );
+				Buffer.Transfer( RangeCheck.AutoCalculatable );
+				Buffer.Transfer( RangeCheck.AutoCalculateValue );
+			}
+			if ( Buffer.Short ) return;
+		}
+
+		Buffer.Transfer( NumObsoleteObjects );
+		Buffer.Transfer( ObsoleteObjectsRepNames );
+		Buffer.Transfer( MaxAlphaArgsFound );
+		Buffer.Transfer( MaxNumericArgsFound );
+		Buffer.Transfer( NumAlphaArgsFound );
+		Buffer.Transfer( NumNumericArgsFound );
+
+	}
+
+	Int64
+	IDDByteChecksum(
+		char const * Bytes, // bytes to be summed
+		std::string::size_type const Length // number of bytes
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns a 64 bit checksum (FNV-1a) of a block of bytes.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::uint64_t Sum( 14695981039346656037ULL );
+		std::string::size_type Loop;
+
+		for ( Loop = 0; Loop < Length; ++Loop ) {
+			Sum ^= static_cast< unsigned char >( Bytes[ Loop ] );
+			Sum *= 1099511628211ULL;
+		}
+
+		return static_cast< Int64 >( Sum );
+
+	}
+
+	Int64
+	IDDFileChecksum(
+		std::string const & FileName, // IDD file
+		Int64 & FileSize // Size of the file in bytes (-1 if it cannot be read)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the checksum of the text IDD, which ties a binary cache to the exact IDD
+		// it was made from.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::ifstream IDDStream( FileName, std::ios_base::binary );
+		std::string Contents;
+
+		FileSize = -1;
+		if ( ! IDDStream ) return 0;
+		Contents.assign( std::istreambuf_iterator< char >( IDDStream ), std::istreambuf_iterator< char >() );
+		if ( IDDStream.bad() ) return 0;
+		FileSize = Contents.length();
+
+		return IDDByteChecksum( Contents.data(), Contents.length() );
+
+	}
+
+	bool
+	LoadIDDCache(
+		std::string const & CacheFileName, // binary cache of the IDD
+		std::string const & IDDFileName // IDD the cache must have been made from
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sets up the data dictionary tables from the binary IDD cache instead of parsing
+		// the text IDD. Returns false (leaving the tables empty) when there is no usable cache.
+
+		// METHODOLOGY EMPLOYED:
+		// The cache is mapped into memory (read in whole where mapping is not available).
+		// Its header must match the cache layout version, the size of Real64 and the size
+		// and checksum of the text IDD, and the packed tables must match their own checksum,
+		// so a stale or damaged cache is never used.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		bool Loaded( false );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static std::string const CacheMagic( "EnergyPlus IDD cache" );
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		IDDCacheBuffer Buffer; // mapped cache file
+		std::string Magic; // cache file identification
+		int Version( 0 ); // cache layout version
+		int RealSize( 0 ); // size of Real64 when the cache was written
+		Int64 CachedIDDSize( 0 ); // size of the IDD the cache was made from
+		Int64 CachedIDDSum( 0 ); // checksum of the IDD the cache was made from
+		Int64 TablesSize( 0 ); // size of the packed tables
+		Int64 TablesSum( 0 ); // checksum of the packed tables
+		Int64 IDDSize; // size of the current IDD
+		Int64 IDDSum; // checksum of the current IDD
+#ifdef __unix__
+		int FD; // descriptor of the cache file
+		struct stat CacheStat; // status of the cache file
+		void * Mapped( MAP_FAILED ); // mapped cache file
+#else
+		std::string Contents; // cache file contents
+#endif
+
+#ifdef __unix__
+		FD = open( CacheFileName.c_str(), O_RDONLY );
+		if ( FD < 0 ) return Loaded;
+		if ( fstat( FD, &CacheStat ) == 0 && CacheStat.st_size > 0 ) {
+			Mapped = mmap( nullptr, CacheStat.st_size, PROT_READ, MAP_PRIVATE, FD, 0 );
+		}
+		close( FD );
+		if ( Mapped == MAP_FAILED ) return Loaded;
+		Buffer.Bytes = static_cast< char const * >( Mapped );
+		Buffer.Size = CacheStat.st_size;
+#else
+		std::ifstream CacheStream( CacheFileName, std::ios_base::binary );
+		if ( ! CacheStream ) return Loaded;
+		Contents.assign( std::istreambuf_iterator< char >( CacheStream ), std::istreambuf_iterator< char >() );
+		Buffer.Bytes = Contents.data();
+		Buffer.Size = Contents.length();
+#endif
+		Buffer.Packing = false;
+
+		Buffer.Transfer( Magic );
+		Buffer.Transfer( Version );
+		Buffer.Transfer( RealSize );
+		Buffer.Transfer( CachedIDDSize );
+		Buffer.Transfer( CachedIDDSum );
+		Buffer.Transfer( TablesSize );
+		Buffer.Transfer( TablesSum );
+		if ( ! Buffer.Short && Magic == CacheMagic && Version == IDDCacheVersion && RealSize == int( sizeof( Real64 ) ) && TablesSize == Int64( Buffer.Size - Buffer.Pos ) && TablesSum == IDDByteChecksum( Buffer.Bytes + Buffer.Pos, Buffer.Size - Buffer.Pos ) ) {
+			IDDSum = IDDFileChecksum( IDDFileName, IDDSize );
+			if ( IDDSize == CachedIDDSize && IDDSum == CachedIDDSum ) {
+				TransferIDDTables( Buffer );
+				Loaded = ( ! Buffer.Short && Buffer.Pos == Buffer.Size && NumObjectDefs > 0 );
+				if ( ! Loaded ) {
+					SectionDef.deallocate();
+					ObjectDef.deallocate();
+					NumSectionDefs = 0;
+					NumObjectDefs = 0;
+					NumObsoleteObjects = 0;
+					ObsoleteObjectsRepNames.deallocate();
+					MaxAlphaArgsFound = 0;
+					MaxNumericArgsFound = 0;
+					NumAlphaArgsFound = 0;
+					NumNumericArgsFound = 0;
+				}
+			}
+		}
+
+#ifdef __unix__
+		munmap( Mapped, CacheStat.st_size );
+#endif
+
+		return Loaded;
+
+	}
+
+	bool
+	WriteIDDCache(
+		std::string const & CacheFileName, // binary cache of the IDD
+		std::string const & IDDFileName // IDD the tables were processed from
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes the data dictionary tables just processed from the text IDD to the binary
+		// IDD cache. Returns false if the cache could not be written (for example, the
+		// program folder is read-only); the run is not affected.
+
+		// METHODOLOGY EMPLOYED:
+		// The cache is written to a file private to this process and then renamed over the
+		// cache, so that runs started at the same time never read a partly written cache.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		bool Written( false );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static std::string const CacheMagic( "EnergyPlus IDD cache" );
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		IDDCacheBuffer Header; // cache identification and checksums
+		IDDCacheBuffer Tables; // packed data dictionary tables
+		std::string Magic( CacheMagic ); // cache file identification
+		int Version( IDDCacheVersion ); // cache layout version
+		int RealSize( sizeof( Real64 ) ); // size of Real64
+		Int64 IDDSize; // size of the IDD
+		Int64 IDDSum; // checksum of the IDD
+		Int64 TablesSize; // size of the packed tables
+		Int64 TablesSum; // checksum of the packed tables
+		std::string TempFileName; // file written before it is renamed to the cache
+
+		IDDSum = IDDFileChecksum( IDDFileName, IDDSize );
+		if ( IDDSize < 0 ) return Written;
+
+		TransferIDDTables( Tables );
+		TablesSize = Tables.Data.length();
+		TablesSum = IDDByteChecksum( Tables.Data.data(), Tables.Data.length() );
+
+		Header.Transfer( Magic );
+		Header.Transfer( Version );
+		Header.Transfer( RealSize );
+		Header.Transfer( IDDSize );
+		Header.Transfer( IDDSum );
+		Header.Transfer( TablesSize );
+		Header.Transfer( TablesSum );
+
+#ifdef __unix__
+		TempFileName = CacheFileName + '.' + IPTrimSigDigits( int( getpid() ) );
+#else
+		TempFileName = CacheFileName + ".tmp";
+#endif
+		{
+			std::ofstream CacheStream( TempFileName, std::ios_base::binary | std::ios_base::trunc );
+			if ( ! CacheStream ) return Written;
+			CacheStream.write( Header.Data.data(), Header.Data.length() );
+			CacheStream.write( Tables.Data.data(), Tables.Data.length() );
+			CacheStream.close();
+			if ( ! CacheStream ) {
+				std::remove( TempFileName.c_str() );
+				return Written;
+			}
+		}
+#ifndef __unix__
+		std::remove( CacheFileName.c_str() );
+#endif
+		if ( std::rename( TempFileName.c_str(), CacheFileName.c_str() ) != 0 ) {
+			std::remove( TempFileName.c_str() );
+			return Written;
+		}
+		Written = true;
+
+		return Written;
+
+	}
+
 	void
 	AddSectionDef(
 		std::string const & ProposedSection, // Proposed Section to be added
@@ -1162,37 +1785,559 @@ namespace InputProcessor {
 			}
 		}
 
-		if ( errFlag ) {
-			ShowContinueError( "IP: Errors occured in ObjectDefinition for Class=" + ObjectDef( NumObjectDefs ).Name + ", Object not available for IDF processing.", EchoInputFile );
-			ObjectDef( NumObjectDefs ).AlphaOrNumeric.deallocate();
-			ObjectDef( NumObjectDefs ).NumRangeChks.deallocate();
-			ObjectDef( NumObjectDefs ).AlphFieldChks.deallocate();
-			ObjectDef( NumObjectDefs ).AlphFieldDefs.deallocate();
-			ObjectDef( NumObjectDefs ).ReqField.deallocate();
-			ObjectDef( NumObjectDefs ).AlphRetainCase.deallocate();
-			--NumObjectDefs;
-			ErrorsFound = true;
+		if ( errFlag ) {
+			ShowContinueError( "IP: Errors occured in ObjectDefinition for Class=" + ObjectDef( NumObjectDefs ).Name + ", Object not available for IDF processing.", EchoInputFile );
+			ObjectDef( NumObjectDefs ).AlphaOrNumeric.deallocate();
+			ObjectDef( NumObjectDefs ).NumRangeChks.deallocate();
+			ObjectDef( NumObjectDefs ).AlphFieldChks.deallocate();
+			ObjectDef( NumObjectDefs ).AlphFieldDefs.deallocate();
+			ObjectDef( NumObjectDefs ).ReqField.deallocate();
+			ObjectDef( NumObjectDefs ).AlphRetainCase.deallocate();
+			--NumObjectDefs;
+			ErrorsFound = true;
+		}
+
+	}
+
+	void
+	ProcessInputDataFile()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Linda K. Lawrie
+		//       DATE WRITTEN   August 1997
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine processes input data file for EnergyPlus.  Each "record" is
+		// parsed into the LineItem data structure and, if okay, put into the
+		// IDFRecords data structure.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+
+		static bool EndofFile( false );
+		bool BlankLine;
+		std::string::size_type Pos;
+
+		// Object Data
+		FArray1D< FileSectionsDefinition > TempSectionsonFile; // Used during reallocation procedure
+		FArray1D< LineDefinition > TempIDFRecords; // Used during reallocation procedure
+
+		MaxIDFRecords = ObjectsIDFAllocInc;
+		NumIDFRecords = 0;
+		MaxIDFSections = SectionsIDFAllocInc;
+		NumIDFSections = 0;
+
+		SectionsOnFile.allocate( MaxIDFSections );
+		IDFRecords.allocate( MaxIDFRecords );
+		LineItem.Numbers.allocate( MaxNumericArgsFound );
+		LineItem.NumBlank.allocate( MaxNumericArgsFound );
+		LineItem.Alphas.allocate( MaxAlphaArgsFound );
+		LineItem.AlphBlank.allocate( MaxAlphaArgsFound );
+		EndofFile = false;
+
+		while ( ! EndofFile ) {
+			ReadInputLine( IDFFile, Pos, BlankLine, InputLineLength, EndofFile );
+			if ( BlankLine || EndofFile ) continue;
+			Pos = scan( InputLine, ",;" );
+			if ( Pos != std::string::npos ) {
+				if ( InputLine[ Pos ] == ';' ) {
+					ValidateSection( InputLine.substr( 0, Pos ), NumLines );
+					if ( NumIDFSections == MaxIDFSections ) {
+						TempSectionsonFile.allocate( MaxIDFSections + SectionsIDFAllocInc );
+						TempSectionsonFile( {1,MaxIDFSections} ) = SectionsOnFile;
+						SectionsOnFile.deallocate();
+						SectionsOnFile.allocate( MaxIDFSections + SectionsIDFAllocInc );
+						SectionsOnFile = TempSectionsonFile;
+						TempSectionsonFile.deallocate();
+						MaxIDFSections += SectionsIDFAllocInc;
+					}
+				} else {
+					ValidateObjectandParse( InputLine.substr( 0, Pos ), Pos, EndofFile );
+					if ( NumIDFRecords == MaxIDFRecords ) {
+						TempIDFRecords.allocate( MaxIDFRecords + ObjectsIDFAllocInc );
+						TempIDFRecords( {1,MaxIDFRecords} ) = IDFRecords;
+						IDFRecords.deallocate();
+						IDFRecords.allocate( MaxIDFRecords + ObjectsIDFAllocInc );
+						IDFRecords = TempIDFRecords;
+						TempIDFRecords.deallocate();
+						MaxIDFRecords += ObjectsIDFAllocInc;
+					}
+				}
+			} else {
+				//Error condition, no , or ; on first line
+				ShowMessage( "IP: IDF Line~" + IPTrimSigDigits( NumLines ) + ' ' + InputLine );
+				ShowSevereError( ", or ; expected on this line", EchoInputFile );
+			}
+
+		}
+
+		//   IF (NumIDFSections > 0) THEN
+		//     SectionsOnFile(NumIDFSections)%LastRecord=NumIDFRecords
+		//   ENDIF
+
+		if ( NumIDFRecords > 0 ) {
+			for ( int i = 1; i <= NumObjectDefs; ++i ) {
+				if ( ObjectDef( i ).RequiredObject && ObjectDef( i ).NumFound == 0 ) {
+					ShowSevereError( "IP: No items found for Required Object=" + ObjectDef( i ).Name );
+					++NumMiscErrorsFound;
+				}
+			}
+		}
+
+	}
+
+	bool
+	StartIDFScan(
+		std::string const & FileName, // IDF to be scanned
+		int const NumThreads // Number of threads scanning the chunks
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sets up the streaming IDF reader: the IDF is brought into memory and its lines
+		// are scanned ahead of ProcessInputDataFile, converting every field that looks
+		// like a number. Returns false (the IDF is then read line by line) if the file
+		// cannot be brought into memory.
+
+		// METHODOLOGY EMPLOYED:
+		// The file is mapped (read in whole where mapping is not available) and split at
+		// line ends into chunks of at least MinIDFScanChunk bytes, a few per thread so that
+		// uneven chunks balance out. Splitting a line into fields does not depend on the
+		// object the line belongs to, so the chunks are scanned independently, in parallel
+		// where OpenMP is available. Validation against the object definitions is still
+		// done in order by ValidateObjectandParse, so records and messages are unchanged.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		bool Started( false );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int NumChunks; // Number of chunks the IDF is split into
+		int ChunkNum; // Loop index over the chunks
+		int LineNum; // Line number of the first line of a chunk
+		std::string::size_type ChunkSize; // Nominal size of a chunk
+		std::string::size_type Pos; // End of the chunk being set up
+		char const * NewLine; // End of the line crossing the nominal chunk end
+#ifdef __unix__
+		int FD; // descriptor of the IDF
+		struct stat IDFStat; // status of the IDF
+		void * Mapped; // mapped IDF
+#endif
+
+		IDFScanActive = false;
+		IDFScanChunks.clear();
+
+#ifdef __unix__
+		FD = open( FileName.c_str(), O_RDONLY );
+		if ( FD < 0 ) return Started;
+		if ( fstat( FD, &IDFStat ) != 0 || IDFStat.st_size <= 0 ) {
+			close( FD );
+			return Started;
+		}
+		Mapped = mmap( nullptr, IDFStat.st_size, PROT_READ, MAP_PRIVATE, FD, 0 );
+		close( FD );
+		if ( Mapped == MAP_FAILED ) return Started;
+		IDFScanBytes = static_cast< char const * >( Mapped );
+		IDFScanSize = IDFStat.st_size;
+#else
+		std::ifstream IDFStream( FileName, std::ios_base::binary );
+		if ( ! IDFStream ) return Started;
+		IDFScanCopy.assign( std::istreambuf_iterator< char >( IDFStream ), std::istreambuf_iterator< char >() );
+		if ( IDFScanCopy.empty() ) return Started;
+		IDFScanBytes = IDFScanCopy.data();
+		IDFScanSize = IDFScanCopy.length();
+#endif
+
+		NumChunks = max( 1, min( 4 * NumThreads, int( IDFScanSize / MinIDFScanChunk ) ) );
+		ChunkSize = IDFScanSize / NumChunks;
+		IDFScanChunks.resize( NumChunks );
+		Pos = 0;
+		for ( ChunkNum = 0; ChunkNum < NumChunks; ++ChunkNum ) {
+			IDFScanChunks[ ChunkNum ].Start = Pos;
+			if ( ChunkNum == NumChunks - 1 ) {
+				Pos = IDFScanSize;
+			} else if ( Pos < ( ChunkNum + 1 ) * ChunkSize ) {
+				Pos = ( ChunkNum + 1 ) * ChunkSize;
+				NewLine = static_cast< char const * >( std::memchr( IDFScanBytes + Pos, '\n', IDFScanSize - Pos ) );
+				Pos = ( NewLine != nullptr ) ? NewLine - IDFScanBytes + 1 : IDFScanSize;
+			}
+			IDFScanChunks[ ChunkNum ].End = Pos;
+		}
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( NumThreads ) schedule( dynamic, 1 )
+#endif
+		for ( int Chunk = 0; Chunk < NumChunks; ++Chunk ) {
+			ScanIDFChunk( IDFScanChunks[ Chunk ] );
+		}
+
+		LineNum = 1;
+		for ( ChunkNum = 0; ChunkNum < NumChunks; ++ChunkNum ) {
+			IDFScanChunks[ ChunkNum ].FirstLine = LineNum;
+			LineNum += IDFScanChunks[ ChunkNum ].NumLines;
+		}
+
+		IDFScanPos = 0;
+		IDFScanLineNum = 0;
+		IDFScanChunkNum = 0;
+		IDFScanItemNum = 0;
+		IDFScanNumbersUsed = 0;
+		IDFScanActive = true;
+		Started = true;
+
+		return Started;
+
+	}
+
+	void
+	ScanIDFChunk( IDFScanChunk & Chunk ) // Chunk to be scanned
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Counts the lines of one chunk of the IDF and converts each of its fields that
+		// looks like a number, recording the line and position of the field.
+
+		// METHODOLOGY EMPLOYED:
+		// Fields are split the way ValidateObjectandParse splits them: at "," and ";",
+		// ignoring everything after "!" and beyond MaxInputLineLength. This routine may
+		// run on several threads at once, so it touches nothing but its own chunk and the
+		// (read only) memory image.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		char const * Bytes( IDFScanBytes ); // Memory image of the IDF
+		char const * Found; // End of line or comment character
+		std::string::size_type LineStart; // First byte of the line
+		std::string::size_type LineEnd; // End of the line (its new line character)
+		std::string::size_type DataEnd; // End of the part of the line holding fields
+		std::string::size_type FieldStart; // First byte of the field
+		std::string::size_type First; // First non-blank byte of the field
+		std::string::size_type Last; // One past the last non-blank byte of the field
+		std::string::size_type Pos; // Byte being scanned
+		int LineNum( 0 ); // Line being scanned (zero based within the chunk)
+		Real64 Value; // Converted field
+
+		LineStart = Chunk.Start;
+		while ( LineStart < Chunk.End ) {
+			Found = static_cast< char const * >( std::memchr( Bytes + LineStart, '\n', Chunk.End - LineStart ) );
+			LineEnd = ( Found != nullptr ) ? Found - Bytes : Chunk.End;
+			DataEnd = min( LineEnd, LineStart + MaxInputLineLength );
+			Found = static_cast< char const * >( std::memchr( Bytes + LineStart, '!', DataEnd - LineStart ) );
+			if ( Found != nullptr ) DataEnd = Found - Bytes;
+
+			FieldStart = LineStart;
+			for ( Pos = LineStart; Pos <= DataEnd; ++Pos ) {
+				if ( Pos < DataEnd && Bytes[ Pos ] != ',' && Bytes[ Pos ] != ';' ) continue;
+				First = FieldStart;
+				Last = Pos;
+				while ( First < Last && ( Bytes[ First ] == ' ' || Bytes[ First ] == '\t' ) ) ++First;
+				while ( Last > First && ( Bytes[ Last - 1 ] == ' ' || Bytes[ Last - 1 ] == '\t' || Bytes[ Last - 1 ] == '\r' ) ) --Last;
+				if ( Last > First && ConvertIDFNumber( Bytes + First, Last - First, Value ) ) {
+					Chunk.NumberLine.push_back( LineNum );
+					Chunk.NumberStart.push_back( FieldStart - LineStart );
+					Chunk.NumberValue.push_back( Value );
+				}
+				FieldStart = Pos + 1;
+			}
+
+			++LineNum;
+			LineStart = LineEnd + 1;
+		}
+		Chunk.NumLines = LineNum;
+
+	}
+
+	bool
+	ConvertIDFNumber(
+		char const * Field, // Start of the field
+		std::string::size_type const Length, // Length of the field
+		Real64 & Value // Value of the field
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Converts a stripped IDF field to a number without using the Fortran style
+		// input routines, so that it can be called from several threads at once.
+
+		// METHODOLOGY EMPLOYED:
+		// Only fields made up of the characters ProcessNumber accepts, that are read
+		// completely as a decimal number, are converted. Anything else returns false and is
+		// left for ProcessNumber, which then produces the usual value or error message.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		bool Converted( false );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static char const ValidNumerics[] = "0123456789.+-EeDd"; // as in ProcessNumber
+		std::string::size_type const MaxNumberLength( 63 ); // Longer fields are left to ProcessNumber
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char Number[ MaxNumberLength + 1 ]; // Field with a Fortran "D" exponent changed to "E"
+		char * NumberEnd; // End of the part of Number converted
+		std::string::size_type Pos;
+
+		if ( Length > MaxNumberLength ) return Converted;
+		for ( Pos = 0; Pos < Length; ++Pos ) {
+			if ( Field[ Pos ] == '\0' || std::strchr( ValidNumerics, Field[ Pos ] ) == nullptr ) return Converted;
+			Number[ Pos ] = ( Field[ Pos ] == 'D' || Field[ Pos ] == 'd' ) ? 'E' : Field[ Pos ];
+		}
+		Number[ Length ] = '\0';
+
+		errno = 0;
+		Value = std::strtod( Number, &NumberEnd );
+		Converted = ( NumberEnd == Number + Length && errno == 0 );
+
+		return Converted;
+
+	}
+
+	int
+	ReadScannedIDFLine( std::string & Line ) // Next line of the IDF
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Serves the next line of the IDF from its memory image, in place of reading it
+		// from the file. Returns 0, or -1 at the end of the file (as the read status would).
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char const * NewLine; // End of the line
+		std::string::size_type LineEnd; // End of the line
+		std::string::size_type Length; // Length of the line without its line terminator
+
+		if ( IDFScanPos >= IDFScanSize ) {
+			Line.clear();
+			return -1;
+		}
+		NewLine = static_cast< char const * >( std::memchr( IDFScanBytes + IDFScanPos, '\n', IDFScanSize - IDFScanPos ) );
+		LineEnd = ( NewLine != nullptr ) ? NewLine - IDFScanBytes : IDFScanSize;
+		Length = LineEnd - IDFScanPos;
+		if ( Length > 0 && IDFScanBytes[ LineEnd - 1 ] == '\r' ) --Length;
+		Line.assign( IDFScanBytes + IDFScanPos, Length );
+		IDFScanPos = LineEnd + 1;
+		++IDFScanLineNum;
+
+		return 0;
+
+	}
+
+	bool
+	ScannedIDFNumber(
+		std::string::size_type const FieldStart, // Position of the field on the current line
+		Real64 & Value // Pre-converted value of the field
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Looks up the value the scan converted for the field starting at FieldStart on the
+		// line last served. Returns false if the field was not converted.
+
+		// METHODOLOGY EMPLOYED:
+		// Fields are asked for in file order, so the lookup only moves a cursor forward
+		// through the converted fields of the chunks.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Line; // Line of the converted field under the cursor
+		int Start; // Position of the converted field under the cursor
+
+		while ( IDFScanChunkNum < int( IDFScanChunks.size() ) ) {
+			IDFScanChunk const & Chunk( IDFScanChunks[ IDFScanChunkNum ] );
+			if ( IDFScanItemNum >= Chunk.NumberLine.size() ) {
+				++IDFScanChunkNum;
+				IDFScanItemNum = 0;
+				continue;
+			}
+			Line = Chunk.FirstLine + Chunk.NumberLine[ IDFScanItemNum ];
+			Start = Chunk.NumberStart[ IDFScanItemNum ];
+			if ( Line < IDFScanLineNum || ( Line == IDFScanLineNum && Start < int( FieldStart ) ) ) {
+				++IDFScanItemNum;
+				continue;
+			}
+			if ( Line == IDFScanLineNum && Start == int( FieldStart ) ) {
+				Value = Chunk.NumberValue[ IDFScanItemNum ];
+				++IDFScanItemNum;
+				return true;
+			}
+			break;
+		}
+
+		return false;
+
+	}
+
+	Real64
+	ProcessIDFNumber(
+		std::string const & String, // Field (upper case, stripped)
+		std::string::size_type const FieldStart, // Position of the field on the current line
+		bool & ErrorFlag
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// ProcessNumber for a numeric IDF field: the value converted by the scan is used
+		// when there is one.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 Value;
+
+		if ( IDFScanActive && ScannedIDFNumber( FieldStart, Value ) ) {
+			ErrorFlag = false;
+			++IDFScanNumbersUsed;
+			return Value;
 		}
 
+		return ProcessNumber( String, ErrorFlag );
+
 	}
 
 	void
-	ProcessInputDataFile()
+	EndIDFScan()
 	{
 
 		// SUBROUTINE INFORMATION:
-		//       AUTHOR         Linda K. Lawrie
-		//       DATE WRITTEN   August 1997
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
 		//       MODIFIED       na
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
-		// This subroutine processes input data file for EnergyPlus.  Each "record" is
-		// parsed into the LineItem data structure and, if okay, put into the
-		// IDFRecords data structure.
+		// Releases the memory image of the IDF and the scanned chunks.
+
+		if ( ! IDFScanActive ) return;
+#ifdef __unix__
+		munmap( const_cast< char * >( IDFScanBytes ), IDFScanSize );
+#else
+		std::string().swap( IDFScanCopy );
+#endif
+		std::vector< IDFScanChunk >().swap( IDFScanChunks );
+		IDFScanBytes = nullptr;
+		IDFScanActive = false;
+
+	}
+
+	void
+	IndexIDFRecordsByObject()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Groups the IDF records by object definition once the input file has been
+		// processed, so that the Nth object of a type can be located directly instead of
+		// by scanning IDFRecords.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// Counting sort on ObjectDefPtr: the records of object definition i are
+		// ObjectRecordList( ObjectRecordStart( i ) ) .. ObjectRecordList( ObjectRecordStart( i + 1 ) - 1 ),
+		// in the order they appear in the input.
 
 		// REFERENCES:
 		// na
@@ -1201,6 +2346,9 @@ namespace InputProcessor {
 		// na
 
 		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		// na
 
@@ -1208,77 +2356,31 @@ namespace InputProcessor {
 		// na
 
 		// DERIVED TYPE DEFINITIONS
+		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Loop;
+		int Which;
+		FArray1D_int NextPosition; // next free position of each object definition in ObjectRecordList
 
-		static bool EndofFile( false );
-		bool BlankLine;
-		std::string::size_type Pos;
-
-		// Object Data
-		FArray1D< FileSectionsDefinition > TempSectionsonFile; // Used during reallocation procedure
-		FArray1D< LineDefinition > TempIDFRecords; // Used during reallocation procedure
-
-		MaxIDFRecords = ObjectsIDFAllocInc;
-		NumIDFRecords = 0;
-		MaxIDFSections = SectionsIDFAllocInc;
-		NumIDFSections = 0;
-
-		SectionsOnFile.allocate( MaxIDFSections );
-		IDFRecords.allocate( MaxIDFRecords );
-		LineItem.Numbers.allocate( MaxNumericArgsFound );
-		LineItem.NumBlank.allocate( MaxNumericArgsFound );
-		LineItem.Alphas.allocate( MaxAlphaArgsFound );
-		LineItem.AlphBlank.allocate( MaxAlphaArgsFound );
-		EndofFile = false;
-
-		while ( ! EndofFile ) {
-			ReadInputLine( IDFFile, Pos, BlankLine, InputLineLength, EndofFile );
-			if ( BlankLine || EndofFile ) continue;
-			Pos = scan( InputLine, ",;" );
-			if ( Pos != std::string::npos ) {
-				if ( InputLine[ Pos ] == ';' ) {
-					ValidateSection( InputLine.substr( 0, Pos ), NumLines );
-					if ( NumIDFSections == MaxIDFSections ) {
-						TempSectionsonFile.allocate( MaxIDFSections + SectionsIDFAllocInc );
-						TempSectionsonFile( {1,MaxIDFSections} ) = SectionsOnFile;
-						SectionsOnFile.deallocate();
-						SectionsOnFile.allocate( MaxIDFSections + SectionsIDFAllocInc );
-						SectionsOnFile = TempSectionsonFile;
-						TempSectionsonFile.deallocate();
-						MaxIDFSections += SectionsIDFAllocInc;
-					}
-				} else {
-					ValidateObjectandParse( InputLine.substr( 0, Pos ), Pos, EndofFile );
-					if ( NumIDFRecords == MaxIDFRecords ) {
-						TempIDFRecords.allocate( MaxIDFRecords + ObjectsIDFAllocInc );
-						TempIDFRecords( {1,MaxIDFRecords} ) = IDFRecords;
-						IDFRecords.deallocate();
-						IDFRecords.allocate( MaxIDFRecords + ObjectsIDFAllocInc );
-						IDFRecords = TempIDFRecords;
-						TempIDFRecords.deallocate();
-						MaxIDFRecords += ObjectsIDFAllocInc;
-					}
-				}
-			} else {
-				//Error condition, no , or ; on first line
-				ShowMessage( "IP: IDF Line~" + IPTrimSigDigits( NumLines ) + ' ' + InputLine );
-				ShowSevereError( ", or ; expected on this line", EchoInputFile );
-			}
-
+		ObjectRecordStart.allocate( NumObjectDefs + 1 );
+		ObjectRecordStart = 0;
+		for ( Loop = 1; Loop <= NumIDFRecords; ++Loop ) {
+			++ObjectRecordStart( IDFRecords( Loop ).ObjectDefPtr );
+		}
+		Which = 1;
+		for ( Loop = 1; Loop <= NumObjectDefs + 1; ++Loop ) {
+			Which += ObjectRecordStart( Loop );
+			ObjectRecordStart( Loop ) = Which - ObjectRecordStart( Loop );
 		}
 
-		//   IF (NumIDFSections > 0) THEN
-		//     SectionsOnFile(NumIDFSections)%LastRecord=NumIDFRecords
-		//   ENDIF
-
-		if ( NumIDFRecords > 0 ) {
-			for ( int i = 1; i <= NumObjectDefs; ++i ) {
-				if ( ObjectDef( i ).RequiredObject && ObjectDef( i ).NumFound == 0 ) {
-					ShowSevereError( "IP: No items found for Required Object=" + ObjectDef( i ).Name );
-					++NumMiscErrorsFound;
-				}
-			}
+		NextPosition.allocate( NumObjectDefs );
+		NextPosition = ObjectRecordStart( {1,NumObjectDefs} );
+		ObjectRecordList.allocate( NumIDFRecords );
+		for ( Loop = 1; Loop <= NumIDFRecords; ++Loop ) {
+			Which = IDFRecords( Loop ).ObjectDefPtr;
+			ObjectRecordList( NextPosition( Which ) ) = Loop;
+			++NextPosition( Which );
 		}
 
 	}
@@ -1718,13 +2820,13 @@ namespace InputProcessor {
 								LineItem.NumNumbers = NumNumeric;
 								if ( ! SqueezedArg.empty() ) {
 									if ( ! ObjectDef( Found ).NumRangeChks( NumNumeric ).AutoSizable && ! ObjectDef( Found ).NumRangeChks( NumNumeric ).AutoCalculatable ) {
-										LineItem.Numbers( NumNumeric ) = ProcessNumber( SqueezedArg, errFlag );
+										LineItem.Numbers( NumNumeric ) = ProcessIDFNumber( SqueezedArg, CurPos, errFlag );
 									} else if ( SqueezedArg == "AUTOSIZE" ) {
 										LineItem.Numbers( NumNumeric ) = ObjectDef( Found ).NumRangeChks( NumNumeric ).AutoSizeValue;
 									} else if ( SqueezedArg == "AUTOCALCULATE" ) {
 										LineItem.Numbers( NumNumeric ) = ObjectDef( Found ).NumRangeChks( NumNumeric ).AutoCalculateValue;
 									} else {
-										LineItem.Numbers( NumNumeric ) = ProcessNumber( SqueezedArg, errFlag );
+										LineItem.Numbers( NumNumeric ) = ProcessIDFNumber( SqueezedArg, CurPos, errFlag );
 									}
 								} else { // numeric arg is blank.
 									if ( ObjectDef( Found ).NumRangeChks( NumNumeric ).DefaultChk ) { // blank arg has default
@@ -1876,6 +2978,7 @@ namespace InputProcessor {
 		if ( ! errFlag && ! IDidntMeanIt ) {
 			if ( TransitionDefer ) {
 				MakeTransition( Found );
+				LineItem.ObjectDefPtr = Found;
 			}
 			++NumIDFRecords;
 			if ( ObjectStartRecord( Found ) == 0 ) ObjectStartRecord( Found ) = NumIDFRecords;
@@ -2272,7 +3375,6 @@ namespace InputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Count;
 		int LoopIndex;
 		std::string ObjectWord;
 		std::string UCObject;
@@ -2283,7 +3385,6 @@ namespace InputProcessor {
 		int MaxAlphas;
 		int MaxNumbers;
 		int Found;
-		int StartRecord;
 		std::string cfld1;
 		std::string cfld2;
 		bool GoodItem;
@@ -2308,7 +3409,6 @@ namespace InputProcessor {
 			AlphaArgsBlank.allocate( MaxAlphaArgsFound );
 		}
 
-		Count = 0;
 		Status = -1;
 		UCObject = MakeUPPERCase( Object );
 		if ( SortedIDD ) {
@@ -2338,11 +3438,9 @@ namespace InputProcessor {
 			Numbers( {1,ObjectDef( Found ).NumNumeric} ) = 0.0;
 		}
 
-		StartRecord = ObjectStartRecord( Found );
-		if ( StartRecord == 0 ) {
+		if ( ObjectStartRecord( Found ) == 0 ) {
 			ShowWarningError( "IP: GetObjectItem: Requested object=" + UCObject + ", not found in IDF." );
 			Status = -1;
-			StartRecord = NumIDFRecords + 1;
 		}
 
 		if ( ObjectGotCount( Found ) == 0 ) {
@@ -2350,43 +3448,39 @@ namespace InputProcessor {
 		}
 		++ObjectGotCount( Found );
 
-		for ( LoopIndex = StartRecord; LoopIndex <= NumIDFRecords; ++LoopIndex ) {
-			if ( IDFRecords( LoopIndex ).Name == UCObject ) {
-				++Count;
-				if ( Count == Number ) {
-					IDFRecordsGotten( LoopIndex ) = true; // only object level "gets" recorded
-					// Read this one
-					GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlphas, NumNumbers, AlphaArgs, NumberArgs, AlphaArgsBlank, NumberArgsBlank );
-					if ( NumAlphas > MaxAlphas || NumNumbers > MaxNumbers ) {
-						ShowFatalError( "IP: GetObjectItem: Too many actual arguments for those expected on Object: " + ObjectWord, EchoInputFile );
-					}
-					NumAlphas = min( MaxAlphas, NumAlphas );
-					NumNumbers = min( MaxNumbers, NumNumbers );
-					GoodItem = true;
-					if ( NumAlphas > 0 ) {
-						Alphas( {1,NumAlphas} ) = AlphaArgs( {1,NumAlphas} );
-					}
-					if ( NumNumbers > 0 ) {
-						Numbers( {1,NumNumbers} ) = NumberArgs( {1,NumNumbers} );
-					}
-					if ( present( NumBlank ) ) {
-						NumBlank = true;
-						if ( NumNumbers > 0 ) NumBlank()( {1,NumNumbers} ) = NumberArgsBlank( {1,NumNumbers} );
-					}
-					if ( present( AlphaBlank ) ) {
-						AlphaBlank = true;
-						if ( NumAlphas > 0 ) AlphaBlank()( {1,NumAlphas} ) = AlphaArgsBlank( {1,NumAlphas} );
-					}
-					if ( present( AlphaFieldNames ) ) {
-						AlphaFieldNames()( {1,ObjectDef( Found ).NumAlpha} ) = ObjectDef( Found ).AlphFieldChks( {1,ObjectDef( Found ).NumAlpha} );
-					}
-					if ( present( NumericFieldNames ) ) {
-						NumericFieldNames()( {1,ObjectDef( Found ).NumNumeric} ) = ObjectDef( Found ).NumRangeChks( {1,ObjectDef( Found ).NumNumeric} ).FieldName();
-					}
-					Status = 1;
-					break;
-				}
+		// The records of each object type are indexed by IndexIDFRecordsByObject
+		if ( Number >= 1 && Number <= ObjectRecordStart( Found + 1 ) - ObjectRecordStart( Found ) ) {
+			LoopIndex = ObjectRecordList( ObjectRecordStart( Found ) + Number - 1 );
+			IDFRecordsGotten( LoopIndex ) = true; // only object level "gets" recorded
+			// Read this one
+			GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlphas, NumNumbers, AlphaArgs, NumberArgs, AlphaArgsBlank, NumberArgsBlank );
+			if ( NumAlphas > MaxAlphas || NumNumbers > MaxNumbers ) {
+				ShowFatalError( "IP: GetObjectItem: Too many actual arguments for those expected on Object: " + ObjectWord, EchoInputFile );
+			}
+			NumAlphas = min( MaxAlphas, NumAlphas );
+			NumNumbers = min( MaxNumbers, NumNumbers );
+			GoodItem = true;
+			if ( NumAlphas > 0 ) {
+				Alphas( {1,NumAlphas} ) = AlphaArgs( {1,NumAlphas} );
+			}
+			if ( NumNumbers > 0 ) {
+				Numbers( {1,NumNumbers} ) = NumberArgs( {1,NumNumbers} );
+			}
+			if ( present( NumBlank ) ) {
+				NumBlank = true;
+				if ( NumNumbers > 0 ) NumBlank()( {1,NumNumbers} ) = NumberArgsBlank( {1,NumNumbers} );
 			}
+			if ( present( AlphaBlank ) ) {
+				AlphaBlank = true;
+				if ( NumAlphas > 0 ) AlphaBlank()( {1,NumAlphas} ) = AlphaArgsBlank( {1,NumAlphas} );
+			}
+			if ( present( AlphaFieldNames ) ) {
+				AlphaFieldNames()( {1,ObjectDef( Found ).NumAlpha} ) = ObjectDef( Found ).AlphFieldChks( {1,ObjectDef( Found ).NumAlpha} );
+			}
+			if ( present( NumericFieldNames ) ) {
+				NumericFieldNames()( {1,ObjectDef( Found ).NumNumeric} ) = ObjectDef( Found ).NumRangeChks( {1,ObjectDef( Found ).NumNumeric} ).FieldName();
+			}
+			Status = 1;
 		}
 
 #ifdef IDDTEST
@@ -2484,14 +3578,13 @@ namespace InputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DEFINITIONS
-		int NumObjOfType; // Total number of Object Type in IDF
 		int ObjNum; // Loop index variable
 		int ItemNum; // Item number for Object Name
 		int Found; // Indicator for Object Type in list of Valid Objects
 		std::string UCObjType; // Upper Case for ObjType
 		bool ItemFound; // Set to true if item found
 		bool ObjectFound; // Set to true if object found
-		int StartRecord; // Start record for objects
+		int RecPos; // Position in ObjectRecordList
 
 		ItemNum = 0;
 		ItemFound = false;
@@ -2507,19 +3600,14 @@ namespace InputProcessor {
 		if ( Found != 0 ) {
 
 			ObjectFound = true;
-			NumObjOfType = ObjectDef( Found ).NumFound;
 			ItemNum = 0;
-			StartRecord = ObjectStartRecord( Found );
-
-			if ( StartRecord > 0 ) {
-				for ( ObjNum = StartRecord; ObjNum <= NumIDFRecords; ++ObjNum ) {
-					if ( IDFRecords( ObjNum ).Name != UCObjType ) continue;
-					++ItemNum;
-					if ( ItemNum > NumObjOfType ) break;
-					if ( IDFRecords( ObjNum ).Alphas( 1 ) == ObjName ) {
-						ItemFound = true;
-						break;
-					}
+
+			for ( RecPos = ObjectRecordStart( Found ); RecPos < ObjectRecordStart( Found + 1 ); ++RecPos ) {
+				ObjNum = ObjectRecordList( RecPos );
+				++ItemNum;
+				if ( IDFRecords( ObjNum ).Alphas( 1 ) == ObjName ) {
+					ItemFound = true;
+					break;
 				}
 			}
 		}
@@ -2578,23 +3666,103 @@ namespace InputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Count;
 		int LoopIndex;
+		int Found;
 		std::string ObjectWord;
+		std::string UCObject;
 
-		Count = 0;
 		Status = -1;
-		for ( LoopIndex = 1; LoopIndex <= NumIDFRecords; ++LoopIndex ) {
-			if ( SameString( IDFRecords( LoopIndex ).Name, Object ) ) {
-				++Count;
-				if ( Count == Number ) {
-					// Read this one
-					GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlpha, NumNumbers );
-					Status = 1;
-					break;
-				}
-			}
+		UCObject = MakeUPPERCase( Object );
+		if ( SortedIDD ) {
+			Found = FindItemInSortedList( UCObject, ListOfObjects, NumObjectDefs );
+			if ( Found != 0 ) Found = iListOfObjects( Found );
+		} else {
+			Found = FindItemInList( UCObject, ListOfObjects, NumObjectDefs );
+		}
+		if ( Found == 0 ) return;
+		if ( Number >= 1 && Number <= ObjectRecordStart( Found + 1 ) - ObjectRecordStart( Found ) ) {
+			LoopIndex = ObjectRecordList( ObjectRecordStart( Found ) + Number - 1 );
+			// Read this one
+			GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlpha, NumNumbers );
+			Status = 1;
+		}
+
+	}
+
+	LineDefinition const &
+	GetObjectItemRecord(
+		std::string const & Object, // Object type (IDD name)
+		int const Number // Which object of the type (1 = first)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the stored IDF record of the 'number' 'object' without copying its
+		// fields, for GetInput routines that only read the values.
+
+		// METHODOLOGY EMPLOYED:
+		// Same lookup and bookkeeping as GetObjectItem. The record holds NumAlphas and
+		// NumNumbers fields as entered in the IDF (with IDD defaults filled in for blank
+		// fields); trailing fields that were not entered are not present, so callers must
+		// check the counts (and use ObjectDef defaults) instead of relying on blank-padded
+		// arrays. The reference is valid until the IDF records are deallocated.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::string UCObject;
+		int Found;
+		int Which;
+
+		if ( NumObjectDefs == 0 ) {
+			ProcessInput();
+		}
+
+		UCObject = MakeUPPERCase( Object );
+		if ( SortedIDD ) {
+			Found = FindItemInSortedList( UCObject, ListOfObjects, NumObjectDefs );
+			if ( Found != 0 ) Found = iListOfObjects( Found );
+		} else {
+			Found = FindItemInList( UCObject, ListOfObjects, NumObjectDefs );
+		}
+		if ( Found == 0 ) { //  This is more of a developer problem
+			ShowFatalError( "IP: GetObjectItemRecord: Requested object=" + UCObject + ", not found in Object Definitions -- incorrect IDD attached." );
 		}
+		if ( Number < 1 || Number > ObjectRecordStart( Found + 1 ) - ObjectRecordStart( Found ) ) {
+			ShowFatalError( "IP: GetObjectItemRecord: Requested object=" + UCObject + ", number=" + IPTrimSigDigits( Number ) + " not found in IDF." );
+		}
+
+		if ( ObjectGotCount( Found ) == 0 ) {
+			gio::write( EchoInputFile, fmtLD ) << "Getting object=" << UCObject;
+		}
+		++ObjectGotCount( Found );
+
+		Which = ObjectRecordList( ObjectRecordStart( Found ) + Number - 1 );
+		IDFRecordsGotten( Which ) = true; // only object level "gets" recorded
+
+		return IDFRecords( Which );
 
 	}
 
@@ -2645,11 +3813,8 @@ namespace InputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		// Object Data
-		LineDefinition xLineItem; // Description of current record
-
 		if ( Which > 0 && Which <= NumIDFRecords ) {
-			xLineItem = IDFRecords( Which );
+			LineDefinition const & xLineItem( IDFRecords( Which ) ); // Description of current record (not copied)
 			ObjectWord = xLineItem.Name;
 			NumAlpha = xLineItem.NumAlphas;
 			NumNumeric = xLineItem.NumNumbers;
@@ -2738,7 +3903,11 @@ namespace InputProcessor {
 
 		errFlag = false;
 		LineTooLong = false;
-		{ IOFlags flags; gio::read_line( UnitNumber, flags, InputLine ); ReadStat = flags.ios(); }
+		if ( IDFScanActive && UnitNumber == IDFFile ) {
+			ReadStat = ReadScannedIDFLine( InputLine );
+		} else {
+			{ IOFlags flags; gio::read_line( UnitNumber, flags, InputLine ); ReadStat = flags.ios(); }
+		}
 
 		if ( ReadStat != 0 ) InputLine.clear();
 
@@ -4397,6 +5566,72 @@ namespace InputProcessor {
 
 	}
 
+	void
+	GetObjectDefFieldNames(
+		std::string const & ObjectWord, // Object for definition
+		FArray1S_string AlphaFieldNames, // Alpha field names (from IDD)
+		FArray1S_string NumericFieldNames // Numeric field names (from IDD)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine returns the alpha and numeric field names of an Object from the IDD, the same
+		// names GetObjectItem fills in on every call. GetInput routines that read records through
+		// GetObjectItemRecord get them once per object type for their error messages.
+
+		// METHODOLOGY EMPLOYED:
+		// Essentially allows outside access to internal variables of the InputProcessor.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Which; // to determine which object definition to use
+
+		if ( SortedIDD ) {
+			Which = FindItemInSortedList( MakeUPPERCase( ObjectWord ), ListOfObjects, NumObjectDefs );
+			if ( Which != 0 ) Which = iListOfObjects( Which );
+		} else {
+			Which = FindItemInList( MakeUPPERCase( ObjectWord ), ListOfObjects, NumObjectDefs );
+		}
+
+		if ( Which > 0 ) {
+			if ( ObjectDef( Which ).NumAlpha > size( AlphaFieldNames, 1 ) || ObjectDef( Which ).NumNumeric > size( NumericFieldNames, 1 ) ) {
+				ShowFatalError( "IP: GetObjectDefFieldNames: " + ObjectWord + ", Number of ObjectDef Args > Size of field name arrays." );
+			}
+			if ( ObjectDef( Which ).NumAlpha > 0 ) {
+				AlphaFieldNames( {1,ObjectDef( Which ).NumAlpha} ) = ObjectDef( Which ).AlphFieldChks( {1,ObjectDef( Which ).NumAlpha} );
+			}
+			if ( ObjectDef( Which ).NumNumeric > 0 ) {
+				NumericFieldNames( {1,ObjectDef( Which ).NumNumeric} ) = ObjectDef( Which ).NumRangeChks( {1,ObjectDef( Which ).NumNumeric} ).FieldName();
+			}
+		} else {
+			ShowSevereError( "GetObjectDefFieldNames: Did not find object=\"" + ObjectWord + "\" in list of objects." );
+		}
+
+	}
+
 	void
 	GetIDFRecordsStats(
 		int & iNumberOfRecords, // Number of IDF Records
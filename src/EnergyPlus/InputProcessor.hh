@@ -1,6 +1,10 @@
 #ifndef InputProcessor_hh_INCLUDED
 #define InputProcessor_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/FArray1S.hh>
@@ -37,6 +41,9 @@ namespace InputProcessor {
 	extern std::string const Blank;
 	extern Real64 const DefAutoSizeValue;
 	extern Real64 const DefAutoCalculateValue;
+	extern int const IDDCacheVersion; // Layout version of the binary data dictionary cache
+	extern std::string const IDDCacheSuffix; // Appended to the IDD file name to name its binary cache
+	extern std::string::size_type const MinIDFScanChunk; // Smallest part of the IDF scanned as one chunk (bytes)
 
 	// DERIVED TYPE DEFINITIONS
 
@@ -75,6 +82,18 @@ namespace InputProcessor {
 	extern int TotalAuditErrors; // Counting some warnings that go onto only the audit file
 	extern int NumSecretObjects; // Number of objects in "Secret Mode"
 	extern bool ProcessingIDD; // True when processing IDD, false when processing IDF
+	extern bool IDDFromCache; // True when the data dictionary tables were loaded from the binary cache
+	extern Real64 IDDLoadTime; // Time to set up the data dictionary tables (s)
+	extern bool IDFScanActive; // True while in.idf lines are served from the scanned memory image
+	extern char const * IDFScanBytes; // Memory image of in.idf
+	extern std::string IDFScanCopy; // Contents of in.idf where it cannot be mapped
+	extern std::string::size_type IDFScanSize; // Size of in.idf (bytes)
+	extern std::string::size_type IDFScanPos; // Start of the next line to be served
+	extern int IDFScanLineNum; // Line last served (first line = 1)
+	extern int IDFScanChunkNum; // Chunk holding the next pre-converted number (zero based)
+	extern std::vector< int >::size_type IDFScanItemNum; // Next pre-converted number of that chunk (zero based)
+	extern Int64 IDFScanNumbersUsed; // Numeric fields taken from the pre-converted numbers
+	extern Real64 IDFLoadTime; // Time to read and process in.idf (s)
 
 	//Real Variables for Module
 	//na
@@ -86,6 +105,8 @@ namespace InputProcessor {
 	extern FArray1D_int iListOfObjects;
 	extern FArray1D_int ObjectGotCount;
 	extern FArray1D_int ObjectStartRecord;
+	extern FArray1D_int ObjectRecordStart; // Start of each object definition's records in ObjectRecordList (NumObjectDefs + 1 entries)
+	extern FArray1D_int ObjectRecordList; // IDF record numbers grouped by object definition, in input order
 	extern std::string CurrentFieldName; // Current Field Name (IDD)
 	extern FArray1D_string ObsoleteObjectsRepNames; // Array of Replacement names for Obsolete objects
 	extern std::string ReplacementName;
@@ -400,6 +421,79 @@ namespace InputProcessor {
 
 	};
 
+	struct IDDCacheBuffer
+	{
+		// Members
+		std::string Data; // Packed data dictionary tables (while packing)
+		char const * Bytes; // Start of the packed tables (while extracting)
+		std::string::size_type Size; // Number of packed bytes (while extracting)
+		std::string::size_type Pos; // Next byte to extract
+		bool Packing; // True while values are appended, false while they are extracted
+		bool Short; // Set when an extraction ran past the end of the packed bytes
+
+		// Default Constructor
+		IDDCacheBuffer() :
+			Bytes( nullptr ),
+			Size( 0 ),
+			Pos( 0 ),
+			Packing( true ),
+			Short( false )
+		{}
+
+		// Append Value to Data, or extract it at Pos
+		void
+		Transfer( int & Value );
+
+		void
+		Transfer( Int64 & Value );
+
+		void
+		Transfer( bool & Value );
+
+		void
+		Transfer( Real64 & Value );
+
+		void
+		Transfer( std::string & Value );
+
+		void
+		Transfer( FArray1D_bool & Values );
+
+		void
+		Transfer( FArray1D_int & Values );
+
+		void
+		Transfer( FArray1D< Real64 > & Values );
+
+		void
+		Transfer( FArray1D_string & Values );
+
+		bool
+		Extract( void * Value, std::string::size_type const Length );
+
+	};
+
+	struct IDFScanChunk
+	{
+		// Members
+		std::string::size_type Start; // First byte of the chunk in the memory image
+		std::string::size_type End; // One past the last byte of the chunk
+		int FirstLine; // Line number of the first line of the chunk
+		int NumLines; // Number of lines in the chunk
+		std::vector< int > NumberLine; // Line of each field converted (zero based within the chunk)
+		std::vector< int > NumberStart; // Position of each field converted on its line (zero based)
+		std::vector< Real64 > NumberValue; // Value of each field converted
+
+		// Default Constructor
+		IDFScanChunk() :
+			Start( 0 ),
+			End( 0 ),
+			FirstLine( 0 ),
+			NumLines( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< ObjectsDefinition > ObjectDef; // Contains all the Valid Objects on the IDD
 	extern FArray1D< SectionsDefinition > SectionDef; // Contains all the Valid Sections on the IDD
@@ -407,6 +501,7 @@ namespace InputProcessor {
 	extern LineDefinition LineItem; // Description of current record
 	extern FArray1D< LineDefinition > IDFRecords; // All the objects read from the IDF
 	extern FArray1D< SecretObjects > RepObjects; // Secret Objects that could replace old ones
+	extern std::vector< IDFScanChunk > IDFScanChunks; // Parts of in.idf scanned in parallel
 
 	// Functions
 
@@ -416,6 +511,33 @@ namespace InputProcessor {
 	void
 	ProcessDataDicFile( bool & ErrorsFound ); // set to true if any errors flagged during IDD processing
 
+	void
+	TransferIDDTables( IDDCacheBuffer & Buffer ); // packed data dictionary tables
+
+	Int64
+	IDDByteChecksum(
+		char const * Bytes, // bytes to be summed
+		std::string::size_type const Length // number of bytes
+	);
+
+	Int64
+	IDDFileChecksum(
+		std::string const & FileName, // IDD file
+		Int64 & FileSize // Size of the file in bytes (-1 if it cannot be read)
+	);
+
+	bool
+	LoadIDDCache(
+		std::string const & CacheFileName, // binary cache of the IDD
+		std::string const & IDDFileName // IDD the cache must have been made from
+	);
+
+	bool
+	WriteIDDCache(
+		std::string const & CacheFileName, // binary cache of the IDD
+		std::string const & IDDFileName // IDD the tables were processed from
+	);
+
 	void
 	AddSectionDef(
 		std::string const & ProposedSection, // Proposed Section to be added
@@ -433,6 +555,44 @@ namespace InputProcessor {
 	void
 	ProcessInputDataFile();
 
+	bool
+	StartIDFScan(
+		std::string const & FileName, // IDF to be scanned
+		int const NumThreads // Number of threads scanning the chunks
+	);
+
+	void
+	ScanIDFChunk( IDFScanChunk & Chunk ); // Chunk to be scanned
+
+	bool
+	ConvertIDFNumber(
+		char const * Field, // Start of the field
+		std::string::size_type const Length, // Length of the field
+		Real64 & Value // Value of the field
+	);
+
+	int
+	ReadScannedIDFLine( std::string & Line ); // Next line of the IDF
+
+	bool
+	ScannedIDFNumber(
+		std::string::size_type const FieldStart, // Position of the field on the current line
+		Real64 & Value // Pre-converted value of the field
+	);
+
+	Real64
+	ProcessIDFNumber(
+		std::string const & String, // Field (upper case, stripped)
+		std::string::size_type const FieldStart, // Position of the field on the current line
+		bool & ErrorFlag
+	);
+
+	void
+	EndIDFScan();
+
+	void
+	IndexIDFRecordsByObject();
+
 	void
 	ValidateSection(
 		std::string const & ProposedSection,
@@ -501,6 +661,12 @@ namespace InputProcessor {
 		int & Status
 	);
 
+	LineDefinition const &
+	GetObjectItemRecord(
+		std::string const & Object, // Object type (IDD name)
+		int const Number // Which object of the type (1 = first)
+	);
+
 	void
 	GetObjectItemfromFile(
 		int const Which,
@@ -789,6 +955,13 @@ namespace InputProcessor {
 		int & NumNumeric // How many Numeric arguments (max) this Object can have
 	);
 
+	void
+	GetObjectDefFieldNames(
+		std::string const & ObjectWord, // Object for definition
+		FArray1S_string AlphaFieldNames, // Alpha field names (from IDD)
+		FArray1S_string NumericFieldNames // Numeric field names (from IDD)
+	);
+
 	void
 	GetIDFRecordsStats(
 		int & iNumberOfRecords, // Number of IDF Records
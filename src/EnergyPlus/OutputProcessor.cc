@@ -225,6 +225,7 @@ namespace OutputProcessor {
 	//  GetCurrentMeterValue
 	//  GetInstantMeterValue
 	//  GetInternalVariableValue
+	//  GetInternalVariablePointer
 	//  GetInternalVariableValueExternalInterface
 	//  GetMeteredVariables
 	//  GetMeterIndex
@@ -7311,6 +7312,61 @@ GetInternalVariableValue(
 	return resultVal;
 }
 
+Real64 const *
+GetInternalVariablePointer(
+	int const varType, // 1=integer, 2=real, 3=meter
+	int const keyVarIndex // Array index
+)
+{
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2014
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// This function returns the address of the variable holding the current value of a real
+	// report variable, for callers that read the same variable every time step. It returns
+	// a null pointer for the other types, whose values must be taken from
+	// GetInternalVariableValue.
+
+	// METHODOLOGY EMPLOYED:
+	// The address is the target of %Which, which stays valid for the whole simulation
+	// just as the report variable itself does.
+
+	// REFERENCES:
+	// na
+
+	// Using/Aliasing
+	using namespace OutputProcessor;
+
+	// Return value
+	Real64 const * resultPtr; // address of the value, null if not a real report variable
+
+	// Locals
+	// FUNCTION ARGUMENT DEFINITIONS:
+
+	// FUNCTION PARAMETER DEFINITIONS:
+	// na
+
+	// INTERFACE BLOCK SPECIFICATIONS:
+	// na
+
+	// DERIVED TYPE DEFINITIONS:
+	// na
+
+	// FUNCTION LOCAL VARIABLE DECLARATIONS:
+	// na
+
+	if ( varType == 2 && keyVarIndex >= 1 && keyVarIndex <= NumOfRVariable ) {
+		resultPtr = &RVariableTypes( keyVarIndex ).VarPtr().Which();
+	} else {
+		resultPtr = nullptr;
+	}
+
+	return resultPtr;
+}
+
 Real64
 GetInternalVariableValueExternalInterface(
 	int const varType, // 1=integer, 2=REAL(r64), 3=meter
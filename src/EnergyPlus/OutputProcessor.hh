@@ -1351,6 +1351,12 @@ GetInternalVariableValue(
 	int const keyVarIndex // Array index
 );
 
+Real64 const *
+GetInternalVariablePointer(
+	int const varType, // 1=integer, 2=real, 3=meter
+	int const keyVarIndex // Array index
+);
+
 Real64
 GetInternalVariableValueExternalInterface(
 	int const varType, // 1=integer, 2=REAL(r64), 3=meter
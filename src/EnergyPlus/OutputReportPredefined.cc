@@ -325,6 +325,13 @@ namespace OutputReportPredefined {
 	int pdchHVACcntVal;
 	int pdstFieldCnt;
 	int pdchFieldCntVal;
+	int pdstRootSolver;
+	int pdchRootSolves;
+	int pdchRootResiduals;
+	int pdchRootResidualsPerSolve;
+	int pdchRootWarmStartHits;
+	int pdchRootNotConverged;
+	int pdchRootNotBracketed;
 
 	// Energy Meters Report
 	int pdrEnergyMeters;
@@ -1042,6 +1049,14 @@ namespace OutputReportPredefined {
 		pdstFieldCnt = newPreDefSubTable( pdrObjCnt, "Input Fields" );
 		pdchFieldCntVal = newPreDefColumn( pdstFieldCnt, "Count" );
 
+		pdstRootSolver = newPreDefSubTable( pdrObjCnt, "Root Solver Calls" );
+		pdchRootSolves = newPreDefColumn( pdstRootSolver, "Solves" );
+		pdchRootResiduals = newPreDefColumn( pdstRootSolver, "Residual Evaluations" );
+		pdchRootResidualsPerSolve = newPreDefColumn( pdstRootSolver, "Residual Evaluations per Solve" );
+		pdchRootWarmStartHits = newPreDefColumn( pdstRootSolver, "Warm Start Hits" );
+		pdchRootNotConverged = newPreDefColumn( pdstRootSolver, "Not Converged" );
+		pdchRootNotBracketed = newPreDefColumn( pdstRootSolver, "Not Bracketed" );
+
 		// Energy Meters report
 		pdrEnergyMeters = newPreDefReport( "EnergyMeters", "Meters", "Energy Meters" );
 
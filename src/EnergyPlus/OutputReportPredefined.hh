@@ -316,6 +316,13 @@ namespace OutputReportPredefined {
 	extern int pdchHVACcntVal;
 	extern int pdstFieldCnt;
 	extern int pdchFieldCntVal;
+	extern int pdstRootSolver;
+	extern int pdchRootSolves;
+	extern int pdchRootResiduals;
+	extern int pdchRootResidualsPerSolve;
+	extern int pdchRootWarmStartHits;
+	extern int pdchRootNotConverged;
+	extern int pdchRootNotBracketed;
 
 	// Energy Meters Report
 	extern int pdrEnergyMeters;
@@ -1,4 +1,5 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <map>
@@ -25,10 +26,13 @@
 #include <DataIPShortCuts.hh>
 #include <DataOutputs.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataRootFinder.hh>
 #include <DataShadowingCombinations.hh>
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataWater.hh>
 #include <DataZoneEquipment.hh>
 #include <DisplayRoutines.hh>
@@ -41,6 +45,7 @@
 #include <OutputReportPredefined.hh>
 #include <PollutionModule.hh>
 #include <Psychrometrics.hh>
+#include <RunPeriodChunks.hh>
 #include <ScheduleManager.hh>
 #include <SQLiteProcedures.hh>
 #include <UtilityRoutines.hh>
@@ -144,6 +149,11 @@ namespace OutputReportTabular {
 	int const isAverage( 1 );
 	int const isSum( 2 );
 
+	int const recordReportHeaders( 1 ); // kinds of TabularRecordType
+	int const recordSubtitle( 2 );
+	int const recordTextLine( 3 );
+	int const recordTable( 4 );
+
 	int const stepTypeZone( ZoneTSReporting );
 	int const stepTypeHVAC( HVACTSReporting );
 
@@ -196,6 +206,10 @@ namespace OutputReportTabular {
 
 	Real64 timeInYear( 0.0 );
 
+	// Timing of the gathering for the tabular benchmark
+	Real64 gatherTimeMonthlyBinned( 0.0 ); // time spent gathering the monthly and binned tables (s)
+	Real64 gatherTimeOther( 0.0 ); // time spent gathering the other tabular reports (s)
+
 	// Flags for predefined tabular reports
 	bool displayTabularBEPS( false );
 	bool displayLEEDSummary( false );
@@ -398,6 +412,8 @@ namespace OutputReportTabular {
 	FArray1D< MonthlyInputType > MonthlyInputCopy;
 	FArray1D< MonthlyTablesType > MonthlyTables;
 	FArray1D< MonthlyColumnsType > MonthlyColumns;
+	FArray1D< MonthlyPlanType > MonthlyPlan; // compiled monthly gathering for the zone and HVAC time steps
+	std::vector< TabularRecordType > TabularRecords; // headers, lines and tables not yet written to the tabular files
 	FArray1D< TOCEntriesType > TOCEntries;
 	FArray1D< TOCEntriesType > CopyOfTOCEntries;
 	FArray1D< UnitConvType > UnitConv;
@@ -413,7 +429,8 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   July 2003
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, time the gathering for the tabular benchmark
+		//                      October 2014, nothing gathered over the overlap days of a run period chunk
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -422,12 +439,16 @@ namespace OutputReportTabular {
 		// into the tabular reports.
 
 		// METHODOLOGY EMPLOYED:
+		// The overlap days that a run period chunk simulates ahead of its own dates belong to the
+		// previous chunk, which gathers them (see RunPeriodChunks).
 
 		// REFERENCES:
 		// na
 
 		// USE STATEMENTS:
-		// na
+		using DataSystemVariables::TabularBenchmark;
+		using DataTimings::epElapsedTime;
+		using RunPeriodChunks::InChunkOverlap;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -443,6 +464,7 @@ namespace OutputReportTabular {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool GetInput( true );
+		Real64 TimeStart; // start of a timed part of the gathering (s)
 
 		if ( IndexTypeKey != ZoneTSReporting && IndexTypeKey != HVACTSReporting ) {
 			ShowFatalError( "Invalid reporting requested -- UpdateTabularReports" );
@@ -461,16 +483,22 @@ namespace OutputReportTabular {
 			GetInput = false;
 			date_and_time_string( _, _, _, td );
 		}
-		if ( DoOutputReporting && WriteTabularFiles && ( KindOfSim == ksRunPeriodWeather ) ) {
+		if ( DoOutputReporting && WriteTabularFiles && ( KindOfSim == ksRunPeriodWeather ) && ! InChunkOverlap() ) {
 			if ( IndexTypeKey == stepTypeZone ) {
 				gatherElapsedTimeBEPS += TimeStepZone;
 			}
+			if ( TabularBenchmark ) TimeStart = epElapsedTime();
 			GatherMonthlyResultsForTimestep( IndexTypeKey );
 			GatherBinResultsForTimestep( IndexTypeKey );
+			if ( TabularBenchmark ) {
+				gatherTimeMonthlyBinned += epElapsedTime() - TimeStart;
+				TimeStart = epElapsedTime();
+			}
 			GatherBEPSResultsForTimestep( IndexTypeKey );
 			GatherSourceEnergyEndUseResultsForTimestep( IndexTypeKey );
 			GatherPeakDemandForTimestep( IndexTypeKey );
 			GatherHeatGainReport( IndexTypeKey );
+			if ( TabularBenchmark ) gatherTimeOther += epElapsedTime() - TimeStart;
 		}
 	}
 
@@ -1181,6 +1209,242 @@ namespace OutputReportTabular {
 		//#endif
 
 		if ( allocated( UniqueKeyNames ) ) UniqueKeyNames.deallocate();
+
+		CompileMonthlyPlans();
+	}
+
+	void
+	CompileMonthlyPlans()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Compiles the columns of the monthly tables into a plan for the zone
+		//   time step and a plan for the HVAC time step, which
+		//   GatherMonthlyResultsForTimestep steps through.
+
+		// METHODOLOGY EMPLOYED:
+		//   Each column gathered at the time step is an entry of the plan that holds
+		//   what the gathering needs: the results column, the aggregation type,
+		//   whether the variable is summed and, for real report variables, the
+		//   address of the value. The entries are grouped by aggregation type and
+		//   keep the column order within a group. The columns scanned after another
+		//   column (ValueWhenMaxMin and the hours shown types) are listed on each
+		//   entry that scans them, and the entries of the tables that have such
+		//   columns are listed in table and column order in the sequence.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iStepType; // loop variable for the kind of time step
+		int iTable; // loop variable for monthlyTables
+		int jColumn; // loop variable for monthlyColumns
+		int curCol;
+		int curAggType;
+		int iEntry;
+		bool tableHasScans; // table has ValueWhenMaxMin or hours shown columns
+		bool firstInTable;
+		FArray1D_int nextEntryOfAgg; // next entry of each aggregation type to fill
+		FArray1D_bool hasScans; // tableHasScans of each table
+
+		MonthlyPlan.allocate( 2 ); // stepTypeZone, stepTypeHVAC
+		nextEntryOfAgg.allocate( aggTypeMinimumDuringHoursShown + 1 );
+		hasScans.allocate( MonthlyTablesCount );
+		hasScans = false;
+		for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
+			for ( jColumn = 1; jColumn <= MonthlyTables( iTable ).numColumns; ++jColumn ) {
+				curAggType = MonthlyColumns( jColumn + MonthlyTables( iTable ).firstColumn - 1 ).aggType;
+				if ( ( curAggType == aggTypeValueWhenMaxMin ) || ( curAggType >= aggTypeSumOrAverageHoursShown ) ) {
+					hasScans( iTable ) = true;
+				}
+			}
+		}
+
+		for ( iStepType = stepTypeZone; iStepType <= stepTypeHVAC; ++iStepType ) {
+			auto & curPlan( MonthlyPlan( iStepType ) );
+			// count the entries of each aggregation type
+			nextEntryOfAgg = 0;
+			curPlan.numSequence = 0;
+			for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
+				for ( jColumn = 1; jColumn <= MonthlyTables( iTable ).numColumns; ++jColumn ) {
+					curCol = jColumn + MonthlyTables( iTable ).firstColumn - 1;
+					curAggType = MonthlyColumns( curCol ).aggType;
+					if ( MonthlyColumns( curCol ).stepType != iStepType ) continue;
+					if ( ( curAggType < aggTypeSumOrAvg ) || ( curAggType > aggTypeMinimumDuringHoursShown ) ) continue;
+					++nextEntryOfAgg( curAggType );
+					if ( hasScans( iTable ) ) ++curPlan.numSequence;
+				}
+			}
+			curPlan.firstEntryOfAgg.allocate( aggTypeMinimumDuringHoursShown + 1 );
+			curPlan.firstEntryOfAgg( aggTypeSumOrAvg ) = 1;
+			for ( curAggType = aggTypeSumOrAvg; curAggType <= aggTypeMinimumDuringHoursShown; ++curAggType ) {
+				curPlan.firstEntryOfAgg( curAggType + 1 ) = curPlan.firstEntryOfAgg( curAggType ) + nextEntryOfAgg( curAggType );
+			}
+			curPlan.numEntries = curPlan.firstEntryOfAgg( aggTypeMinimumDuringHoursShown + 1 ) - 1;
+			nextEntryOfAgg = curPlan.firstEntryOfAgg;
+
+			// fill the entries
+			curPlan.entry.allocate( curPlan.numEntries );
+			curPlan.sequence.allocate( curPlan.numSequence );
+			curPlan.numSequence = 0;
+			for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
+				tableHasScans = hasScans( iTable );
+				firstInTable = true;
+				for ( jColumn = 1; jColumn <= MonthlyTables( iTable ).numColumns; ++jColumn ) {
+					curCol = jColumn + MonthlyTables( iTable ).firstColumn - 1;
+					curAggType = MonthlyColumns( curCol ).aggType;
+					if ( MonthlyColumns( curCol ).stepType != iStepType ) continue;
+					if ( ( curAggType < aggTypeSumOrAvg ) || ( curAggType > aggTypeMinimumDuringHoursShown ) ) continue;
+					iEntry = nextEntryOfAgg( curAggType );
+					++nextEntryOfAgg( curAggType );
+					auto & curEntry( curPlan.entry( iEntry ) );
+					curEntry.column = curCol;
+					curEntry.aggType = curAggType;
+					curEntry.summed = ( MonthlyColumns( curCol ).avgSum == isSum );
+					curEntry.typeOfVar = MonthlyColumns( curCol ).typeOfVar;
+					curEntry.varNum = MonthlyColumns( curCol ).varNum;
+					curEntry.valuePtr = GetInternalVariablePointer( curEntry.typeOfVar, curEntry.varNum );
+					if ( tableHasScans ) {
+						curEntry.firstInTable = firstInTable;
+						firstInTable = false;
+						SetMonthlyPlanScans( iTable, jColumn, curEntry );
+						++curPlan.numSequence;
+						curPlan.sequence( curPlan.numSequence ) = iEntry;
+					}
+				}
+			}
+		}
+	}
+
+	void
+	SetMonthlyPlanScans(
+		int const iTable, // index in MonthlyTables
+		int const jColumn, // column of the table
+		MonthlyPlanEntryType & curEntry // entry that receives the scanned columns
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Lists the columns of the table that the gathering scans after the
+		//   column: the ValueWhenMaxMin columns up to the next maximum or minimum
+		//   column, and the hours shown columns up to the next hours column.
+
+		// METHODOLOGY EMPLOYED:
+		//   The scan for the hours shown clears the hours shown flag after it has
+		//   passed the next column, unless it stops there at an hours column.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int kOtherColumn; // variable used in loop to scan through additional columns
+		int scanColumn;
+		int scanAggType;
+		int numScan;
+		int kScan;
+		FArray1D_int scanColumns; // columns found by the scan
+
+		scanColumns.allocate( MonthlyTables( iTable ).numColumns );
+
+		numScan = 0;
+		for ( kOtherColumn = jColumn + 1; kOtherColumn <= MonthlyTables( iTable ).numColumns; ++kOtherColumn ) {
+			scanColumn = kOtherColumn + MonthlyTables( iTable ).firstColumn - 1;
+			scanAggType = MonthlyColumns( scanColumn ).aggType;
+			if ( ( scanAggType == aggTypeMaximum ) || ( scanAggType == aggTypeMinimum ) ) break;
+			if ( scanAggType == aggTypeValueWhenMaxMin ) {
+				++numScan;
+				scanColumns( numScan ) = scanColumn;
+			}
+		}
+		curEntry.maxMinScan.allocate( numScan );
+		for ( kScan = 1; kScan <= numScan; ++kScan ) {
+			SetMonthlyPlanScan( scanColumns( kScan ), curEntry.maxMinScan( kScan ) );
+		}
+
+		numScan = 0;
+		for ( kOtherColumn = jColumn + 1; kOtherColumn <= MonthlyTables( iTable ).numColumns; ++kOtherColumn ) {
+			scanColumn = kOtherColumn + MonthlyTables( iTable ).firstColumn - 1;
+			scanAggType = MonthlyColumns( scanColumn ).aggType;
+			if ( ( scanAggType >= aggTypeHoursZero ) && ( scanAggType <= aggTypeHoursNonNegative ) ) break;
+			if ( ( scanAggType >= aggTypeSumOrAverageHoursShown ) && ( scanAggType <= aggTypeMinimumDuringHoursShown ) ) {
+				++numScan;
+				scanColumns( numScan ) = scanColumn;
+			}
+		}
+		curEntry.hoursScan.allocate( numScan );
+		for ( kScan = 1; kScan <= numScan; ++kScan ) {
+			SetMonthlyPlanScan( scanColumns( kScan ), curEntry.hoursScan( kScan ) );
+		}
+
+		curEntry.hoursScanResets = false;
+		if ( jColumn < MonthlyTables( iTable ).numColumns ) {
+			scanAggType = MonthlyColumns( jColumn + MonthlyTables( iTable ).firstColumn ).aggType;
+			curEntry.hoursScanResets = ( ( scanAggType < aggTypeHoursZero ) || ( scanAggType > aggTypeHoursNonNegative ) );
+		}
+	}
+
+	void
+	SetMonthlyPlanScan(
+		int const scanColumn, // index in MonthlyColumns
+		MonthlyPlanScanType & curScan // scanned column of the plan
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Copies what the gathering needs of a scanned column into the plan.
+
+		curScan.column = scanColumn;
+		curScan.aggType = MonthlyColumns( scanColumn ).aggType;
+		curScan.summed = ( MonthlyColumns( scanColumn ).avgSum == isSum );
+		curScan.typeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
+		curScan.varNum = MonthlyColumns( scanColumn ).varNum;
+		curScan.valuePtr = GetInternalVariablePointer( curScan.typeOfVar, curScan.varNum );
 	}
 
 	void
@@ -1329,6 +1593,7 @@ namespace OutputReportTabular {
 					repIndex = firstReport + ( iTable - 1 );
 					BinObjVarID( repIndex ).namesOfObj = objNames( iTable );
 					BinObjVarID( repIndex ).varMeterNum = objVarIDs( iTable );
+					BinObjVarID( repIndex ).varPtr = GetInternalVariablePointer( OutputTableBinned( iInObj ).typeOfVar, objVarIDs( iTable ) );
 					// check if valid meter or number
 					if ( objVarIDs( iTable ) == 0 ) {
 						ShowWarningError( CurrentModuleObject + ": Specified variable or meter not found: " + objNames( iTable ) );
@@ -1347,10 +1612,12 @@ namespace OutputReportTabular {
 				if ( found != 0 ) {
 					BinObjVarID( firstReport ).namesOfObj = objNames( found );
 					BinObjVarID( firstReport ).varMeterNum = objVarIDs( found );
+					BinObjVarID( firstReport ).varPtr = GetInternalVariablePointer( OutputTableBinned( iInObj ).typeOfVar, objVarIDs( found ) );
 				} else {
 					ShowWarningError( CurrentModuleObject + ": Specified key not found, the first key will be used: " + OutputTableBinned( iInObj ).keyValue );
 					BinObjVarID( firstReport ).namesOfObj = objNames( 1 );
 					BinObjVarID( firstReport ).varMeterNum = objVarIDs( 1 );
+					BinObjVarID( firstReport ).varPtr = GetInternalVariablePointer( OutputTableBinned( iInObj ).typeOfVar, objVarIDs( 1 ) );
 					if ( objVarIDs( 1 ) == 0 ) {
 						ShowWarningError( CurrentModuleObject + ": Specified meter or variable not found: " + objNames( 1 ) );
 					}
@@ -3218,7 +3485,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   July 2003
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, write the recorded tables before the ending info
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3251,6 +3518,7 @@ namespace OutputReportTabular {
 		int iStyle;
 
 		if ( WriteTabularFiles ) {
+			WriteTabularRecords();
 			for ( iStyle = 1; iStyle <= numStyles; ++iStyle ) {
 				// if HTML file put ending info
 				if ( TableStyle( iStyle ) == tableStyleHTML ) {
@@ -3273,7 +3541,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   June 2005
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, write the recorded tables first
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3316,6 +3584,8 @@ namespace OutputReportTabular {
 		std::string curName;
 		int indexUnitConv;
 
+		// the reports before the table of contents must be in the files first
+		WriteTabularRecords();
 		for ( iStyle = 1; iStyle <= numStyles; ++iStyle ) {
 			if ( TableStyle( iStyle ) == tableStyleHTML ) {
 				curFH = TabularOutputFile( iStyle );
@@ -3417,7 +3687,8 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2003
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, skip objects of the other time step first, read real
+		//                      report variables through their address
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3465,7 +3736,15 @@ namespace OutputReportTabular {
 		if ( ! DoWeathSim ) return;
 		elapsedTime = TimeStepSys;
 		timeInYear += elapsedTime;
+		// per MJW when a summed variable is used divide it by the length of the time step
+		if ( IndexTypeKey == HVACTSReporting ) {
+			elapsedTime = TimeStepSys;
+		} else {
+			elapsedTime = TimeStepZone;
+		}
 		for ( iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj ) {
+			curStepType = OutputTableBinned( iInObj ).stepType;
+			if ( ! ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) ) continue;
 			// get values of array for current object being referenced
 			curIntervalStart = OutputTableBinned( iInObj ).intervalStart;
 			curIntervalSize = OutputTableBinned( iInObj ).intervalSize;
@@ -3474,7 +3753,6 @@ namespace OutputReportTabular {
 			curNumTables = OutputTableBinned( iInObj ).numTables;
 			topValue = curIntervalStart + curIntervalSize * curIntervalCount;
 			curTypeOfVar = OutputTableBinned( iInObj ).typeOfVar;
-			curStepType = OutputTableBinned( iInObj ).stepType;
 			curScheduleIndex = OutputTableBinned( iInObj ).scheduleIndex;
 			//if a schedule was used, check if it was non-zero value
 			if ( curScheduleIndex != 0 ) {
@@ -3489,42 +3767,38 @@ namespace OutputReportTabular {
 			if ( gatherThisTime ) {
 				for ( jTable = 1; jTable <= curNumTables; ++jTable ) {
 					repIndex = curResIndex + ( jTable - 1 );
-					if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
-						// put actual value from OutputProcesser arrays
+					// put actual value from OutputProcesser arrays
+					if ( BinObjVarID( repIndex ).varPtr != nullptr ) {
+						curValue = *BinObjVarID( repIndex ).varPtr;
+					} else {
 						curValue = GetInternalVariableValue( curTypeOfVar, BinObjVarID( repIndex ).varMeterNum );
-						// per MJW when a summed variable is used divide it by the length of the time step
-						if ( IndexTypeKey == HVACTSReporting ) {
-							elapsedTime = TimeStepSys;
-						} else {
-							elapsedTime = TimeStepZone;
-						}
-						if ( OutputTableBinned( iInObj ).avgSum == isSum ) { // if it is a summed variable
-							curValue /= ( elapsedTime * SecInHour );
-						}
-						// check if the value is above the maximum or below the minimum value
-						// first before binning the value within the range.
-						if ( curValue < curIntervalStart ) {
-							BinResultsBelow( repIndex ).mnth( Month ) += elapsedTime;
-							BinResultsBelow( repIndex ).hrly( HourOfDay ) += elapsedTime;
-						} else if ( curValue >= topValue ) {
-							BinResultsAbove( repIndex ).mnth( Month ) += elapsedTime;
-							BinResultsAbove( repIndex ).hrly( HourOfDay ) += elapsedTime;
-						} else {
-							// determine which bin the results are in
-							binNum = int( ( curValue - curIntervalStart ) / curIntervalSize ) + 1;
-							BinResults( repIndex, binNum ).mnth( Month ) += elapsedTime;
-							BinResults( repIndex, binNum ).hrly( HourOfDay ) += elapsedTime;
-						}
-						// add to statistics array
-						++BinStatistics( repIndex ).n;
-						BinStatistics( repIndex ).sum += curValue;
-						BinStatistics( repIndex ).sum2 += curValue * curValue;
-						if ( curValue < BinStatistics( repIndex ).minimum ) {
-							BinStatistics( repIndex ).minimum = curValue;
-						}
-						if ( curValue > BinStatistics( repIndex ).maximum ) {
-							BinStatistics( repIndex ).maximum = curValue;
-						}
+					}
+					if ( OutputTableBinned( iInObj ).avgSum == isSum ) { // if it is a summed variable
+						curValue /= ( elapsedTime * SecInHour );
+					}
+					// check if the value is above the maximum or below the minimum value
+					// first before binning the value within the range.
+					if ( curValue < curIntervalStart ) {
+						BinResultsBelow( repIndex ).mnth( Month ) += elapsedTime;
+						BinResultsBelow( repIndex ).hrly( HourOfDay ) += elapsedTime;
+					} else if ( curValue >= topValue ) {
+						BinResultsAbove( repIndex ).mnth( Month ) += elapsedTime;
+						BinResultsAbove( repIndex ).hrly( HourOfDay ) += elapsedTime;
+					} else {
+						// determine which bin the results are in
+						binNum = int( ( curValue - curIntervalStart ) / curIntervalSize ) + 1;
+						BinResults( repIndex, binNum ).mnth( Month ) += elapsedTime;
+						BinResults( repIndex, binNum ).hrly( HourOfDay ) += elapsedTime;
+					}
+					// add to statistics array
+					++BinStatistics( repIndex ).n;
+					BinStatistics( repIndex ).sum += curValue;
+					BinStatistics( repIndex ).sum2 += curValue * curValue;
+					if ( curValue < BinStatistics( repIndex ).minimum ) {
+						BinStatistics( repIndex ).minimum = curValue;
+					}
+					if ( curValue > BinStatistics( repIndex ).maximum ) {
+						BinStatistics( repIndex ).maximum = curValue;
 					}
 				}
 			}
@@ -3537,16 +3811,25 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   September 2003
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, gather through the compiled monthly plans
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		//   Gathers the data each timestep and updates the arrays
 		//   holding the data that will be reported later.
 
+		// METHODOLOGY EMPLOYED:
+		//   Steps through the plan of the time step (see CompileMonthlyPlans). Each
+		//   aggregation type is applied to its entries in a loop of its own. Then the
+		//   sequence repeats the column by column scanning of the tables that have
+		//   ValueWhenMaxMin or hours shown columns: after a new maximum or minimum the
+		//   ValueWhenMaxMin columns are set, and while the hours of an hours column are
+		//   shown the hours shown columns are accumulated. The flags carry from column
+		//   to column of a table as they did when every column was handled in turn, so
+		//   the results are the same.
+
 		// Using/Aliasing
 		using DataHVACGlobals::TimeStepSys;
-		using DataHVACGlobals::SysTimeElapsed;
 		using DataEnvironment::Month;
 		using DataEnvironment::DayOfMonth;
 		using General::EncodeMonDayHrMin;
@@ -3565,295 +3848,160 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int iTable; // loop variable for monthlyTables
-		int jColumn; // loop variable for monthlyColumns
-		int curCol;
+		int iEntry; // loop variable for the entries of an aggregation type
+		int iSeq; // loop variable for the plan sequence
+		int kScan; // loop variable for the scanned columns of an entry
+		int curAggType;
 		Real64 curValue;
-		int curTypeOfVar;
-		int curVarNum;
 		Real64 elapsedTime;
-		Real64 oldResultValue;
-		int oldTimeStamp;
-		Real64 oldDuration;
-		Real64 newResultValue;
-		int newTimeStamp;
-		Real64 newDuration;
 		int timestepTimeStamp;
+		int minuteCalculated;
 		bool activeMinMax;
-		//LOGICAL,SAVE  :: activeHoursShown=.FALSE.  !fix by LKL addressing CR6482
 		bool activeHoursShown;
-		bool activeNewValue;
-		int curStepType;
-		int minuteCalculated;
-		int kOtherColumn; // variable used in loop to scan through additional columns
-		int scanColumn;
 		Real64 scanValue;
-		int scanTypeOfVar;
-		int scanVarNum;
 		Real64 oldScanValue;
-		// local copies of some of the MonthlyColumns array references since
-		// profiling showed that they were slow.
-		static bool RunOnce( true );
-		static FArray1D_int MonthlyColumnsTypeOfVar;
-		static FArray1D_int MonthlyColumnsStepType;
-		static FArray1D_int MonthlyColumnsAggType;
-		static FArray1D_int MonthlyColumnsVarNum;
-		static FArray1D_int MonthlyTablesNumColumns;
-		static int curFirstColumn( 0 );
 
 		if ( ! DoWeathSim ) return;
 
-		//create temporary arrays to speed processing of these arrays
-		if ( RunOnce ) {
-			//MonthlyColumns
-			MonthlyColumnsTypeOfVar.allocate( MonthlyColumnsCount );
-			MonthlyColumnsTypeOfVar = MonthlyColumns.typeOfVar();
-			MonthlyColumnsStepType.allocate( MonthlyColumnsCount );
-			MonthlyColumnsStepType = MonthlyColumns.stepType();
-			MonthlyColumnsAggType.allocate( MonthlyColumnsCount );
-			MonthlyColumnsAggType = MonthlyColumns.aggType();
-			MonthlyColumnsVarNum.allocate( MonthlyColumnsCount );
-			MonthlyColumnsVarNum = MonthlyColumns.varNum();
-			//MonthlyTables
-			MonthlyTablesNumColumns.allocate( MonthlyTablesCount );
-			MonthlyTablesNumColumns = MonthlyTables.numColumns();
-
-			//set flag so this block is only executed once
-			RunOnce = false;
-		}
-
-		elapsedTime = TimeStepSys;
 		if ( IndexTypeKey == HVACTSReporting ) {
 			elapsedTime = TimeStepSys;
 		} else {
 			elapsedTime = TimeStepZone;
 		}
 		IsMonthGathered( Month ) = true;
-		for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
-			activeMinMax = false; //at the beginning of the new timestep
-			activeHoursShown = false; //fix by JG addressing CR6482
-			curFirstColumn = MonthlyTables( iTable ).firstColumn;
-			for ( jColumn = 1; jColumn <= MonthlyTablesNumColumns( iTable ); ++jColumn ) {
-				curCol = jColumn + curFirstColumn - 1;
-				curTypeOfVar = MonthlyColumnsTypeOfVar( curCol );
-				curStepType = MonthlyColumnsStepType( curCol );
-				if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
-					//  the above condition used to include the following prior to new scan method
-					//  (MonthlyColumns(curCol)%aggType .EQ. aggTypeValueWhenMaxMin)
-					curVarNum = MonthlyColumnsVarNum( curCol );
-					curValue = GetInternalVariableValue( curTypeOfVar, curVarNum );
-					// Get the value from the result array
-					oldResultValue = MonthlyColumns( curCol ).reslt( Month );
-					oldTimeStamp = MonthlyColumns( curCol ).timeStamp( Month );
-					oldDuration = MonthlyColumns( curCol ).duration( Month );
-					// Zero the revised values (as default if not set later in SELECT)
-					newResultValue = 0.0;
-					newTimeStamp = 0;
-					newDuration = 0.0;
-					activeNewValue = false;
-					// the current timestamp
-					minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
-					//      minuteCalculated = (CurrentTime - INT(CurrentTime))*60
-					//      IF (IndexTypeKey .EQ. stepTypeHVAC) minuteCalculated = minuteCalculated + SysTimeElapsed * 60
-					//      minuteCalculated = INT((TimeStep-1) * TimeStepZone * 60) + INT((SysTimeElapsed + TimeStepSys) * 60)
-					EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
-					// perform the selected aggregation type
-					// use next lines since it is faster was: SELECT CASE (MonthlyColumns(curCol)%aggType)
-					{ auto const SELECT_CASE_var( MonthlyColumnsAggType( curCol ) );
-					if ( SELECT_CASE_var == aggTypeSumOrAvg ) {
-						if ( MonthlyColumns( curCol ).avgSum == isSum ) { // if it is a summed variable
-							newResultValue = oldResultValue + curValue;
-						} else {
-							newResultValue = oldResultValue + curValue * elapsedTime; //for averaging - weight by elapsed time
-						}
-						newDuration = oldDuration + elapsedTime;
-						activeNewValue = true;
-					} else if ( SELECT_CASE_var == aggTypeMaximum ) {
-						// per MJW when a summed variable is used divide it by the length of the time step
-						if ( MonthlyColumns( curCol ).avgSum == isSum ) { // if it is a summed variable
-							if ( IndexTypeKey == HVACTSReporting ) {
-								curValue /= ( TimeStepSys * SecInHour );
-							} else {
-								curValue /= ( TimeStepZone * SecInHour );
-							}
-						}
-						if ( curValue > oldResultValue ) {
-							newResultValue = curValue;
-							newTimeStamp = timestepTimeStamp;
-							activeMinMax = true;
-							activeNewValue = true;
-						} else {
-							activeMinMax = false; //reset this
-						}
-					} else if ( SELECT_CASE_var == aggTypeMinimum ) {
-						// per MJW when a summed variable is used divide it by the length of the time step
-						if ( MonthlyColumns( curCol ).avgSum == isSum ) { // if it is a summed variable
-							if ( IndexTypeKey == HVACTSReporting ) {
-								curValue /= ( TimeStepSys * SecInHour );
-							} else {
-								curValue /= ( TimeStepZone * SecInHour );
-							}
-						}
-						if ( curValue < oldResultValue ) {
-							newResultValue = curValue;
-							newTimeStamp = timestepTimeStamp;
-							activeMinMax = true;
-							activeNewValue = true;
-						} else {
-							activeMinMax = false; //reset this
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursZero ) {
-						if ( curValue == 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursNonZero ) {
-						if ( curValue != 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursPositive ) {
-						if ( curValue > 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursNonPositive ) {
-						if ( curValue <= 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursNegative ) {
-						if ( curValue < 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursNonNegative ) {
-						if ( curValue >= 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
+
+		auto & curPlan( MonthlyPlan( IndexTypeKey ) );
+		if ( curPlan.numEntries == 0 ) return;
+
+		// the current timestamp
+		minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
+		EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
+
+		for ( iEntry = curPlan.firstEntryOfAgg( aggTypeSumOrAvg ); iEntry < curPlan.firstEntryOfAgg( aggTypeSumOrAvg + 1 ); ++iEntry ) {
+			auto const & curEntry( curPlan.entry( iEntry ) );
+			auto & curColumn( MonthlyColumns( curEntry.column ) );
+			curValue = ( curEntry.valuePtr != nullptr ) ? *curEntry.valuePtr : GetInternalVariableValue( curEntry.typeOfVar, curEntry.varNum );
+			if ( curEntry.summed ) { // if it is a summed variable
+				curColumn.reslt( Month ) += curValue;
+			} else {
+				curColumn.reslt( Month ) += curValue * elapsedTime; //for averaging - weight by elapsed time
+			}
+			curColumn.timeStamp( Month ) = 0;
+			curColumn.duration( Month ) += elapsedTime;
+		}
+
+		for ( iEntry = curPlan.firstEntryOfAgg( aggTypeMaximum ); iEntry < curPlan.firstEntryOfAgg( aggTypeMaximum + 1 ); ++iEntry ) {
+			auto & curEntry( curPlan.entry( iEntry ) );
+			auto & curColumn( MonthlyColumns( curEntry.column ) );
+			curValue = ( curEntry.valuePtr != nullptr ) ? *curEntry.valuePtr : GetInternalVariableValue( curEntry.typeOfVar, curEntry.varNum );
+			// per MJW when a summed variable is used divide it by the length of the time step
+			if ( curEntry.summed ) curValue /= ( elapsedTime * SecInHour );
+			curEntry.active = ( curValue > curColumn.reslt( Month ) );
+			if ( curEntry.active ) {
+				curColumn.reslt( Month ) = curValue;
+				curColumn.timeStamp( Month ) = timestepTimeStamp;
+				curColumn.duration( Month ) = 0.0;
+			}
+		}
+
+		for ( iEntry = curPlan.firstEntryOfAgg( aggTypeMinimum ); iEntry < curPlan.firstEntryOfAgg( aggTypeMinimum + 1 ); ++iEntry ) {
+			auto & curEntry( curPlan.entry( iEntry ) );
+			auto & curColumn( MonthlyColumns( curEntry.column ) );
+			curValue = ( curEntry.valuePtr != nullptr ) ? *curEntry.valuePtr : GetInternalVariableValue( curEntry.typeOfVar, curEntry.varNum );
+			// per MJW when a summed variable is used divide it by the length of the time step
+			if ( curEntry.summed ) curValue /= ( elapsedTime * SecInHour );
+			curEntry.active = ( curValue < curColumn.reslt( Month ) );
+			if ( curEntry.active ) {
+				curColumn.reslt( Month ) = curValue;
+				curColumn.timeStamp( Month ) = timestepTimeStamp;
+				curColumn.duration( Month ) = 0.0;
+			}
+		}
+
+		for ( curAggType = aggTypeHoursZero; curAggType <= aggTypeHoursNonNegative; ++curAggType ) {
+			for ( iEntry = curPlan.firstEntryOfAgg( curAggType ); iEntry < curPlan.firstEntryOfAgg( curAggType + 1 ); ++iEntry ) {
+				auto & curEntry( curPlan.entry( iEntry ) );
+				curValue = ( curEntry.valuePtr != nullptr ) ? *curEntry.valuePtr : GetInternalVariableValue( curEntry.typeOfVar, curEntry.varNum );
+				if ( curAggType == aggTypeHoursZero ) {
+					curEntry.active = ( curValue == 0 );
+				} else if ( curAggType == aggTypeHoursNonZero ) {
+					curEntry.active = ( curValue != 0 );
+				} else if ( curAggType == aggTypeHoursPositive ) {
+					curEntry.active = ( curValue > 0 );
+				} else if ( curAggType == aggTypeHoursNonPositive ) {
+					curEntry.active = ( curValue <= 0 );
+				} else if ( curAggType == aggTypeHoursNegative ) {
+					curEntry.active = ( curValue < 0 );
+				} else {
+					curEntry.active = ( curValue >= 0 );
+				}
+				if ( curEntry.active ) {
+					auto & curColumn( MonthlyColumns( curEntry.column ) );
+					curColumn.reslt( Month ) += elapsedTime;
+					curColumn.timeStamp( Month ) = 0;
+					curColumn.duration( Month ) = 0.0;
+				}
+			}
+		}
+
+		// The valueWhenMaxMin and the agg*HoursShown columns are set by scanning
+		// from the column before them.
+		activeMinMax = false;
+		activeHoursShown = false;
+		for ( iSeq = 1; iSeq <= curPlan.numSequence; ++iSeq ) {
+			auto const & curEntry( curPlan.entry( curPlan.sequence( iSeq ) ) );
+			if ( curEntry.firstInTable ) {
+				activeMinMax = false; //at the beginning of the new timestep
+				activeHoursShown = false; //fix by JG addressing CR6482
+			}
+			curAggType = curEntry.aggType;
+			if ( ( curAggType == aggTypeMaximum ) || ( curAggType == aggTypeMinimum ) ) {
+				activeMinMax = curEntry.active;
+			} else if ( ( curAggType >= aggTypeHoursZero ) && ( curAggType <= aggTypeHoursNonNegative ) ) {
+				activeHoursShown = curEntry.active;
+			}
+			// if a minimum or maximum value was set this timeStep then set the
+			// ValueWhenMaxMin columns up to the next minimum or maximum column
+			if ( activeMinMax ) {
+				for ( kScan = 1; kScan <= isize( curEntry.maxMinScan ); ++kScan ) {
+					auto const & curScan( curEntry.maxMinScan( kScan ) );
+					scanValue = ( curScan.valuePtr != nullptr ) ? *curScan.valuePtr : GetInternalVariableValue( curScan.typeOfVar, curScan.varNum );
+					// When a summed variable is used divide it by the length of the time step
+					if ( curScan.summed ) scanValue /= ( elapsedTime * SecInHour );
+					MonthlyColumns( curScan.column ).reslt( Month ) = scanValue;
+				}
+			}
+			// If the hours variable is active then accumulate the hours shown
+			// columns up to the next hours column
+			if ( activeHoursShown ) {
+				for ( kScan = 1; kScan <= isize( curEntry.hoursScan ); ++kScan ) {
+					auto const & curScan( curEntry.hoursScan( kScan ) );
+					auto & scanColumn( MonthlyColumns( curScan.column ) );
+					scanValue = ( curScan.valuePtr != nullptr ) ? *curScan.valuePtr : GetInternalVariableValue( curScan.typeOfVar, curScan.varNum );
+					oldScanValue = scanColumn.reslt( Month );
+					if ( curScan.aggType == aggTypeSumOrAverageHoursShown ) {
+						if ( curScan.summed ) { // if it is a summed variable
+							scanColumn.reslt( Month ) = oldScanValue + scanValue;
 						} else {
-							activeHoursShown = false;
+							//for averaging - weight by elapsed time
+							scanColumn.reslt( Month ) = oldScanValue + scanValue * elapsedTime;
 						}
-						// The valueWhenMaxMin is picked up now during the activeMinMax if block below.
-						//CASE (aggTypeValueWhenMaxMin)
-						//CASE (aggTypeSumOrAverageHoursShown)
-						//CASE (aggTypeMaximumDuringHoursShown)
-						//CASE (aggTypeMinimumDuringHoursShown)
-					}}
-					// if the new value has been set then set the monthly values to the
-					// new columns. This skips the aggregation types that don't even get
-					// triggered now such as valueWhenMinMax and all the agg*HoursShown
-					if ( activeNewValue ) {
-						MonthlyColumns( curCol ).reslt( Month ) = newResultValue;
-						MonthlyColumns( curCol ).timeStamp( Month ) = newTimeStamp;
-						MonthlyColumns( curCol ).duration( Month ) = newDuration;
-					}
-					// if a minimum or maximum value was set this timeStep then
-					// scan the remaining columns of the table looking for values
-					// that are aggregation type "ValueWhenMaxMin" and set their values
-					// if another minimum or maximum column is found then end
-					// the scan (it will be taken care of when that column is done)
-					if ( activeMinMax ) {
-						for ( kOtherColumn = jColumn + 1; kOtherColumn <= MonthlyTables( iTable ).numColumns; ++kOtherColumn ) {
-							scanColumn = kOtherColumn + MonthlyTables( iTable ).firstColumn - 1;
-							{ auto const SELECT_CASE_var( MonthlyColumns( scanColumn ).aggType );
-							if ( ( SELECT_CASE_var == aggTypeMaximum ) || ( SELECT_CASE_var == aggTypeMinimum ) ) {
-								// end scanning since these might reset
-								break; //do
-							} else if ( SELECT_CASE_var == aggTypeValueWhenMaxMin ) {
-								// this case is when the value should be set
-								scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
-								scanVarNum = MonthlyColumns( scanColumn ).varNum;
-								scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
-								// When a summed variable is used divide it by the length of the time step
-								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
-									if ( IndexTypeKey == HVACTSReporting ) {
-										scanValue /= ( TimeStepSys * SecInHour );
-									} else {
-										scanValue /= ( TimeStepZone * SecInHour );
-									}
-								}
-								MonthlyColumns( scanColumn ).reslt( Month ) = scanValue;
-							} else {
-								// do nothing
-							}}
+						scanColumn.duration( Month ) += elapsedTime;
+					} else if ( curScan.aggType == aggTypeMaximumDuringHoursShown ) {
+						if ( curScan.summed ) scanValue /= ( elapsedTime * SecInHour );
+						if ( scanValue > oldScanValue ) {
+							scanColumn.reslt( Month ) = scanValue;
+							scanColumn.timeStamp( Month ) = timestepTimeStamp;
 						}
-					}
-					// If the hours variable is active then scan through the rest of the variables
-					// and accumulate
-					if ( activeHoursShown ) {
-						for ( kOtherColumn = jColumn + 1; kOtherColumn <= MonthlyTables( iTable ).numColumns; ++kOtherColumn ) {
-							scanColumn = kOtherColumn + MonthlyTables( iTable ).firstColumn - 1;
-							scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
-							scanVarNum = MonthlyColumns( scanColumn ).varNum;
-							scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
-							oldScanValue = MonthlyColumns( scanColumn ).reslt( Month );
-							{ auto const SELECT_CASE_var( MonthlyColumns( scanColumn ).aggType );
-							if ( ( SELECT_CASE_var == aggTypeHoursZero ) || ( SELECT_CASE_var == aggTypeHoursNonZero ) ) {
-								// end scanning since these might reset
-								break; //do
-							} else if ( ( SELECT_CASE_var == aggTypeHoursPositive ) || ( SELECT_CASE_var == aggTypeHoursNonPositive ) ) {
-								// end scanning since these might reset
-								break; //do
-							} else if ( ( SELECT_CASE_var == aggTypeHoursNegative ) || ( SELECT_CASE_var == aggTypeHoursNonNegative ) ) {
-								// end scanning since these might reset
-								break; //do
-							} else if ( SELECT_CASE_var == aggTypeSumOrAverageHoursShown ) {
-								// this case is when the value should be set
-								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
-									MonthlyColumns( scanColumn ).reslt( Month ) = oldScanValue + scanValue;
-								} else {
-									//for averaging - weight by elapsed time
-									MonthlyColumns( scanColumn ).reslt( Month ) = oldScanValue + scanValue * elapsedTime;
-								}
-								MonthlyColumns( scanColumn ).duration( Month ) += elapsedTime;
-							} else if ( SELECT_CASE_var == aggTypeMaximumDuringHoursShown ) {
-								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
-									if ( IndexTypeKey == HVACTSReporting ) {
-										scanValue /= ( TimeStepSys * SecInHour );
-									} else {
-										scanValue /= ( TimeStepZone * SecInHour );
-									}
-								}
-								if ( scanValue > oldScanValue ) {
-									MonthlyColumns( scanColumn ).reslt( Month ) = scanValue;
-									MonthlyColumns( scanColumn ).timeStamp( Month ) = timestepTimeStamp;
-								}
-							} else if ( SELECT_CASE_var == aggTypeMinimumDuringHoursShown ) {
-								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
-									if ( IndexTypeKey == HVACTSReporting ) {
-										scanValue /= ( TimeStepSys * SecInHour );
-									} else {
-										scanValue /= ( TimeStepZone * SecInHour );
-									}
-								}
-								if ( scanValue < oldScanValue ) {
-									MonthlyColumns( scanColumn ).reslt( Month ) = scanValue;
-									MonthlyColumns( scanColumn ).timeStamp( Month ) = timestepTimeStamp;
-								}
-							} else {
-								// do nothing
-							}}
-							activeHoursShown = false; //fixed CR8317
+					} else if ( curScan.aggType == aggTypeMinimumDuringHoursShown ) {
+						if ( curScan.summed ) scanValue /= ( elapsedTime * SecInHour );
+						if ( scanValue < oldScanValue ) {
+							scanColumn.reslt( Month ) = scanValue;
+							scanColumn.timeStamp( Month ) = timestepTimeStamp;
 						}
 					}
 				}
+				if ( curEntry.hoursScanResets ) activeHoursShown = false; //fixed CR8317
 			}
 		}
 	}
@@ -4794,7 +4942,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2003
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, write the tabular benchmark and the recorded tables
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4802,8 +4950,19 @@ namespace OutputReportTabular {
 		//   types of tabular reports are each created. If another type of
 		//   report is added it can be added to the list here.
 
+		// Using/Aliasing
+		using DataSystemVariables::TabularBenchmark;
+		using DataSystemVariables::Time_Start;
+		using DataTimings::epElapsedTime;
+		using General::RoundSigDigits;
+		using General::TrimSigDigits;
+
 		// Locals
 		int EchoInputFile; // found unit number for 'eplusout.audit'
+		int numZoneEntries; // monthly plan entries gathered at the zone time step
+		int numHVACEntries; // monthly plan entries gathered at the HVAC time step
+		int numPointerEntries; // monthly plan entries read through the address of the value
+		int iEntry;
 
 		FillWeatherPredefinedEntries();
 		FillRemainingPredefinedEntries();
@@ -4824,6 +4983,7 @@ namespace OutputReportTabular {
 				WriteMonthlyTables();
 				WriteTimeBinTables();
 			}
+			WriteTabularRecords();
 		}
 		EchoInputFile = FindUnitNumber( "eplusout.audit" );
 		gio::write( EchoInputFile, fmtLD ) << "MonthlyInputCount=" << MonthlyInputCount;
@@ -4843,6 +5003,26 @@ namespace OutputReportTabular {
 		gio::write( EchoInputFile, fmtLD ) << "sizeCompSizeTableEntry=" << sizeCompSizeTableEntry;
 		gio::write( EchoInputFile, fmtLD ) << "numCompSizeTableEntry=" << numCompSizeTableEntry;
 
+		// Time spent gathering: compare runs with and without the monthly reports
+		// (for example AllSummaryAndMonthly against AllSummary)
+		if ( TabularBenchmark ) {
+			numZoneEntries = 0;
+			numHVACEntries = 0;
+			numPointerEntries = 0;
+			if ( allocated( MonthlyPlan ) ) {
+				numZoneEntries = MonthlyPlan( stepTypeZone ).numEntries;
+				numHVACEntries = MonthlyPlan( stepTypeHVAC ).numEntries;
+				for ( iEntry = 1; iEntry <= numZoneEntries; ++iEntry ) {
+					if ( MonthlyPlan( stepTypeZone ).entry( iEntry ).valuePtr != nullptr ) ++numPointerEntries;
+				}
+				for ( iEntry = 1; iEntry <= numHVACEntries; ++iEntry ) {
+					if ( MonthlyPlan( stepTypeHVAC ).entry( iEntry ).valuePtr != nullptr ) ++numPointerEntries;
+				}
+			}
+			gio::write( EchoInputFile, fmtA ) << "Tabular Gather Benchmark,Monthly Tables,Monthly Columns,Zone Plan Entries,HVAC Plan Entries,Entries Read by Address,Binned Tables,Monthly and Binned Gather Time {s},Other Gather Time {s},Elapsed Time {s}";
+			gio::write( EchoInputFile, fmtA ) << "Tabular Gather Benchmark," + TrimSigDigits( MonthlyTablesCount ) + ',' + TrimSigDigits( MonthlyColumnsCount ) + ',' + TrimSigDigits( numZoneEntries ) + ',' + TrimSigDigits( numHVACEntries ) + ',' + TrimSigDigits( numPointerEntries ) + ',' + TrimSigDigits( BinResultsTableCount ) + ',' + RoundSigDigits( gatherTimeMonthlyBinned, 3 ) + ',' + RoundSigDigits( gatherTimeOther, 3 ) + ',' + RoundSigDigits( epElapsedTime() - Time_Start, 3 );
+		}
+
 	}
 
 	void
@@ -5495,7 +5675,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   May 2007
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, root solver call counts
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5531,6 +5711,7 @@ namespace OutputReportTabular {
 		using DataOutputs::iTotalAutoSizableFields;
 		using DataOutputs::iNumberOfAutoCalcedFields;
 		using DataOutputs::iTotalAutoCalculatableFields;
+		using DataRootFinder::RootSolverCaller;
 		using ZonePlenum::NumZoneReturnPlenums;
 		using ZonePlenum::NumZoneSupplyPlenums;
 		using DataEnvironment::EnvironmentName;
@@ -5720,6 +5901,17 @@ namespace OutputReportTabular {
 		PreDefTableEntry( pdchFieldCntVal, "Autocalculated Fields", iNumberOfAutoCalcedFields );
 		PreDefTableEntry( pdchFieldCntVal, "Autocalculatable Fields", iTotalAutoCalculatableFields );
 
+		// Residual evaluations of each General::SolveRoot call site
+		for ( auto const & caller : RootSolverCaller ) {
+			if ( caller.NumSolves == 0 ) continue;
+			PreDefTableEntry( pdchRootSolves, caller.Name, double( caller.NumSolves ), 0 );
+			PreDefTableEntry( pdchRootResiduals, caller.Name, double( caller.NumResidualCalls ), 0 );
+			PreDefTableEntry( pdchRootResidualsPerSolve, caller.Name, double( caller.NumResidualCalls ) / double( caller.NumSolves ), 2 );
+			PreDefTableEntry( pdchRootWarmStartHits, caller.Name, double( caller.NumWarmStartHits ), 0 );
+			PreDefTableEntry( pdchRootNotConverged, caller.Name, double( caller.NumNotConverged ), 0 );
+			PreDefTableEntry( pdchRootNotBracketed, caller.Name, double( caller.NumNotBracketed ), 0 );
+		}
+
 		for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
 			//annual
 			PreDefTableEntry( pdchSHGSAnHvacHt, Zone( iZone ).Name, ZonePreDefRep( iZone ).SHGSAnHvacHt * convertJtoGJ, 3 );
@@ -12234,12 +12426,17 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2003
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, record the headers for WriteTabularRecords
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		//   Write the first few lines of each report with headers to the output
 		//   file for tabular reports.
+
+		// METHODOLOGY EMPLOYED:
+		//   The headers are recorded and written with the tables that follow
+		//   them by WriteTabularRecords.
+
 		// Using/Aliasing
 		using DataStringGlobals::VerString;
 		using DataHeatBalance::BuildingName;
@@ -12260,42 +12457,28 @@ namespace OutputReportTabular {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		std::string modifiedReportName;
 		int iStyle;
-		int curFH;
-		std::string curDel;
 
 		if ( averageOrSum == isSum ) { // if it is a summed variable CR5959
 			modifiedReportName = reportName + " per second";
 		} else {
 			modifiedReportName = reportName;
 		}
-		for ( iStyle = 1; iStyle <= numStyles; ++iStyle ) {
-			curFH = TabularOutputFile( iStyle );
-			curDel = del( iStyle );
-			{ auto const SELECT_CASE_var( TableStyle( iStyle ) );
-			if ( ( SELECT_CASE_var == tableStyleComma ) || ( SELECT_CASE_var == tableStyleTab ) ) {
-				gio::write( curFH, fmtA ) << "--------------------------------------------------" "--------------------------------------------------";
-				gio::write( curFH, fmtA ) << "REPORT:" + curDel + modifiedReportName;
-				gio::write( curFH, fmtA ) << "FOR:" + curDel + objectName;
-			} else if ( SELECT_CASE_var == tableStyleFixed ) {
-				gio::write( curFH, fmtA ) << "--------------------------------------------------" "--------------------------------------------------";
-				gio::write( curFH, fmtA ) << "REPORT:      " + curDel + modifiedReportName;
-				gio::write( curFH, fmtA ) << "FOR:         " + curDel + objectName;
-			} else if ( SELECT_CASE_var == tableStyleHTML ) {
-				gio::write( curFH, fmtA ) << "<hr>";
-				gio::write( curFH, fmtA ) << "<p><a href=\"#toc\" style=\"float: right\">Table of Contents</a></p>";
-				gio::write( curFH, fmtA ) << "<a name=" + MakeAnchorName( reportName, objectName ) + "></a>";
-				gio::write( curFH, fmtA ) << "<p>Report:<b>" + curDel + modifiedReportName + "</b></p>";
-				gio::write( curFH, fmtA ) << "<p>For:<b>" + curDel + objectName + "</b></p>";
-				gio::write( curFH, TimeStampFmt1 ) << "<p>Timestamp: <b>" << td( 1 ) << "-" << td( 2 ) << "-" << td( 3 );
-				gio::write( curFH, TimeStampFmt2 ) << "  " << td( 5 ) << ":" << td( 6 ) << ":" << td( 7 ) << "</b></p>";
-			} else if ( SELECT_CASE_var == tableStyleXML ) {
-				if ( len( prevReportName ) != 0 ) {
-					gio::write( curFH, fmtA ) << "</" + prevReportName + '>'; //close the last element if it was used.
+		if ( numStyles > 0 ) {
+			TabularRecords.push_back( TabularRecordType() );
+			TabularRecordType & record( TabularRecords.back() );
+			record.kind = recordReportHeaders;
+			record.text = modifiedReportName;
+			record.forName = objectName;
+			record.anchorName = MakeAnchorName( reportName, objectName );
+			gio::write( record.timeStampDate, TimeStampFmt1 ) << "<p>Timestamp: <b>" << td( 1 ) << "-" << td( 2 ) << "-" << td( 3 );
+			gio::write( record.timeStampTime, TimeStampFmt2 ) << "  " << td( 5 ) << ":" << td( 6 ) << ":" << td( 7 ) << "</b></p>";
+			for ( iStyle = 1; iStyle <= numStyles; ++iStyle ) {
+				if ( TableStyle( iStyle ) == tableStyleXML ) {
+					record.prevElementName = prevReportName; //close the last element if it was used.
+					record.elementName = ConvertToElementTag( modifiedReportName );
+					prevReportName = record.elementName; //save the name for next time
 				}
-				gio::write( curFH, fmtA ) << "<" + ConvertToElementTag( modifiedReportName ) + '>';
-				gio::write( curFH, fmtA ) << "  <for>" + objectName + "</for>";
-				prevReportName = ConvertToElementTag( modifiedReportName ); //save the name for next time
-			}}
+			}
 		}
 		//clear the active subtable name for the XML reporting
 		activeSubTableName = "";
@@ -12311,7 +12494,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   November 2003
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, record the subtitle for WriteTabularRecords
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -12332,18 +12515,19 @@ namespace OutputReportTabular {
 		int iStyle;
 
 		for ( iStyle = 1; iStyle <= numStyles; ++iStyle ) {
-			{ auto const SELECT_CASE_var( TableStyle( iStyle ) );
-			if ( ( SELECT_CASE_var == tableStyleComma ) || ( SELECT_CASE_var == tableStyleTab ) || ( SELECT_CASE_var == tableStyleFixed ) ) {
-				gio::write( TabularOutputFile( iStyle ), fmtA ) << subtitle;
-				gio::write( TabularOutputFile( iStyle ), fmtA ) << "";
-			} else if ( SELECT_CASE_var == tableStyleHTML ) {
-				gio::write( TabularOutputFile( iStyle ), fmtA ) << "<b>" + subtitle + "</b><br><br>";
-				gio::write( TabularOutputFile( iStyle ), fmtA ) << "<!-- FullName:" + activeReportName + '_' + activeForName + '_' + subtitle + "-->";
-			} else if ( SELECT_CASE_var == tableStyleXML ) {
+			if ( TableStyle( iStyle ) == tableStyleXML ) {
 				//save the active subtable name for the XML reporting
 				activeSubTableName = subtitle;
 				//no other output is needed since WriteTable uses the subtable name for each record.
-			}}
+			}
+		}
+		if ( numStyles > 0 ) {
+			TabularRecords.push_back( TabularRecordType() );
+			TabularRecordType & record( TabularRecords.back() );
+			record.kind = recordSubtitle;
+			record.text = subtitle;
+			record.reportName = activeReportName;
+			record.forName = activeForName;
 		}
 	}
 
@@ -12356,7 +12540,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   April 2007
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, record the line for WriteTabularRecords
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -12374,7 +12558,6 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int iStyle;
 		bool useBold;
 
 		if ( present( isBold ) ) {
@@ -12383,21 +12566,12 @@ namespace OutputReportTabular {
 			useBold = false;
 		}
 
-		for ( iStyle = 1; iStyle <= numStyles; ++iStyle ) {
-			{ auto const SELECT_CASE_var( TableStyle( iStyle ) );
-			if ( ( SELECT_CASE_var == tableStyleComma ) || ( SELECT_CASE_var == tableStyleTab ) || ( SELECT_CASE_var == tableStyleFixed ) ) {
-				gio::write( TabularOutputFile( iStyle ), fmtA ) << lineOfText;
-			} else if ( SELECT_CASE_var == tableStyleHTML ) {
-				if ( useBold ) {
-					gio::write( TabularOutputFile( iStyle ), fmtA ) << "<b>" + lineOfText + "</b><br><br>";
-				} else {
-					gio::write( TabularOutputFile( iStyle ), fmtA ) << lineOfText + "<br>";
-				}
-			} else if ( SELECT_CASE_var == tableStyleXML ) {
-				if ( len( lineOfText ) != 0 ) {
-					gio::write( TabularOutputFile( iStyle ), fmtA ) << "<note>" + lineOfText + "</note>";
-				}
-			}}
+		if ( numStyles > 0 ) {
+			TabularRecords.push_back( TabularRecordType() );
+			TabularRecordType & record( TabularRecords.back() );
+			record.kind = recordTextLine;
+			record.text = lineOfText;
+			record.isBold = useBold;
 		}
 	}
 
@@ -12414,7 +12588,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2003
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, record the table for WriteTabularRecords
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -12430,6 +12604,11 @@ namespace OutputReportTabular {
 		//   symbol for the currency will be included. For TXT files, the ASCII symbol
 		//   will be used.
 
+		// METHODOLOGY EMPLOYED:
+		//   The table is copied into a record, with the column labels already broken
+		//   into rows, and each style is written from the record by RenderTable when
+		//   WriteTabularRecords is called.
+
 		// Argument array dimensioning
 
 		// Locals
@@ -12445,18 +12624,9 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		FArray2D_string colLabelMulti;
 		std::string workColumn;
-		FArray1D_string rowLabelTags;
-		FArray1D_string columnLabelTags;
-		FArray1D_string rowUnitStrings;
-		FArray1D_string columnUnitStrings;
-		FArray2D_string bodyEsc;
-
 		int numColLabelRows;
 		int maxNumColLabelRows;
-		std::string::size_type widthRowLabel;
-		std::string::size_type maxWidthRowLabel;
 
 		int rowsBody;
 		int colsBody;
@@ -12466,27 +12636,18 @@ namespace OutputReportTabular {
 
 		int iCol;
 		int jRow;
-		int colWidthLimit;
 		std::string::size_type barLoc;
 
-		std::string outputLine;
-		std::string spaces;
 		int iStyle;
-		int curFH;
-		std::string curDel;
-		std::string tagWithAttrib;
-		std::string::size_type col1start;
+		std::string xmlSubTableName;
 		bool doTransposeXML;
 		bool isTableBlank;
-		bool isRecordBlank;
 
 		if ( present( transposeXML ) ) {
 			doTransposeXML = transposeXML;
 		} else {
 			doTransposeXML = false; //if not present assume that the XML table should not be transposed
 		}
-		// create blank string
-		spaces = blank; // REPEAT(' ',1000)
 		// get sizes of arrays
 		rowsBody = isize( body, 1 );
 		colsBody = isize( body, 2 );
@@ -12506,301 +12667,542 @@ namespace OutputReportTabular {
 			colsWidthColumn = colsBody;
 			colsColumnLabels = colsBody;
 		}
-		// create arrays to hold the XML tags
-		rowLabelTags.allocate( rowsBody );
-		columnLabelTags.allocate( colsBody );
-		rowUnitStrings.allocate( rowsBody );
-		columnUnitStrings.allocate( colsBody );
-		bodyEsc.allocate( rowsBody, colsBody );
-		// create new array to hold multiple line column lables
-		colLabelMulti.allocate( 50, colsColumnLabels );
-		colLabelMulti = blank; //set array to blank
-		numColLabelRows = 0; //default value
-		maxNumColLabelRows = 0;
+		if ( numStyles == 0 ) return;
+
 		for ( iStyle = 1; iStyle <= numStyles; ++iStyle ) {
-			curFH = TabularOutputFile( iStyle );
-			curDel = del( iStyle );
-			// go through the columns and break them into multiple lines
-			// if bar '|' is found in a row then break into two lines
-			// if longer than the column width break into two lines for fixed style only
-			for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
-				numColLabelRows = 0;
-				workColumn = columnLabels( iCol );
-				widthColumn( iCol ) = max( widthColumn( iCol ), static_cast< int >( len( columnLabels( iCol ) ) ) );
-				while ( true ) {
-					barLoc = index( workColumn, '|' );
-					if ( barLoc != std::string::npos ) {
-						++numColLabelRows;
-						colLabelMulti( numColLabelRows, iCol ) = workColumn.substr( 0, barLoc );
-						workColumn.erase( 0, barLoc + 1 );
-					} else {
-						++numColLabelRows;
-						colLabelMulti( numColLabelRows, iCol ) = workColumn;
-						break; //inner do loop
+			if ( TableStyle( iStyle ) == tableStyleXML ) {
+				//check if entire table is blank and it if is skip generating anything
+				isTableBlank = true;
+				for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
+					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
+						if ( len( body( jRow, iCol ) ) > 0 ) {
+							isTableBlank = false;
+							break;
+						}
 					}
+					if ( ! isTableBlank ) break;
 				}
-				if ( numColLabelRows > maxNumColLabelRows ) {
-					maxNumColLabelRows = numColLabelRows;
-				}
-			}
-			// extra preprocessing for fixed style reports
-			if ( TableStyle( iStyle ) == tableStyleFixed ) {
-				// break column headings into multiple rows if long (for fixed) or contain two spaces in a row.
-				for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
-					colWidthLimit = widthColumn( iCol );
-					for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
-						pare( colLabelMulti( jRow, iCol ), colWidthLimit );
+				// if non-blank cells in the table body were found create the table.
+				if ( ! isTableBlank ) {
+					//if report name and subtable name the same add "record" to the end
+					activeSubTableName = ConvertToElementTag( activeSubTableName );
+					activeReportNameNoSpace = ConvertToElementTag( activeReportName );
+					if ( SameString( activeSubTableName, activeReportNameNoSpace ) ) {
+						activeSubTableName += "Record";
 					}
-				}
-				maxWidthRowLabel = 0;
-				for ( jRow = 1; jRow <= rowsRowLabels; ++jRow ) {
-					widthRowLabel = len( rowLabels( jRow ) );
-					if ( widthRowLabel > maxWidthRowLabel ) {
-						maxWidthRowLabel = widthRowLabel;
+					//if no subtable name use the report name and add "record" to the end
+					if ( len( activeSubTableName ) == 0 ) {
+						activeSubTableName = activeReportNameNoSpace + "Record";
 					}
+					xmlSubTableName = activeSubTableName;
 				}
 			}
-			// output depending on style of format
-			{ auto const SELECT_CASE_var( TableStyle( iStyle ) );
+		}
+
+		// break the column labels into multiple lines where a bar '|' is found
+		maxNumColLabelRows = 0;
+		for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
+			numColLabelRows = 1 + static_cast< int >( std::count( columnLabels( iCol ).begin(), columnLabels( iCol ).end(), '|' ) );
+			if ( numColLabelRows > maxNumColLabelRows ) {
+				maxNumColLabelRows = numColLabelRows;
+			}
+		}
+
+		TabularRecords.push_back( TabularRecordType() );
+		TabularRecordType & record( TabularRecords.back() );
+		record.kind = recordTable;
+		record.elementName = xmlSubTableName;
+		record.transposeXML = doTransposeXML;
+		if ( present( footnoteText ) ) {
+			record.footnoteText = footnoteText;
+		}
+		record.body.allocate( rowsBody, colsBody );
+		record.rowLabels.allocate( rowsRowLabels );
+		record.columnLabels.allocate( colsColumnLabels );
+		record.widthColumn.allocate( colsWidthColumn );
+		record.colLabelMulti.allocate( maxNumColLabelRows, colsColumnLabels );
+		record.colLabelMulti = blank; //set array to blank
+		record.maxNumColLabelRows = maxNumColLabelRows;
+		for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
+			for ( iCol = 1; iCol <= colsBody; ++iCol ) {
+				record.body( jRow, iCol ) = body( jRow, iCol );
+			}
+			record.rowLabels( jRow ) = rowLabels( jRow );
+		}
+		for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
+			numColLabelRows = 0;
+			workColumn = columnLabels( iCol );
+			widthColumn( iCol ) = max( widthColumn( iCol ), static_cast< int >( len( columnLabels( iCol ) ) ) );
+			while ( true ) {
+				barLoc = index( workColumn, '|' );
+				if ( barLoc != std::string::npos ) {
+					++numColLabelRows;
+					record.colLabelMulti( numColLabelRows, iCol ) = workColumn.substr( 0, barLoc );
+					workColumn.erase( 0, barLoc + 1 );
+				} else {
+					++numColLabelRows;
+					record.colLabelMulti( numColLabelRows, iCol ) = workColumn;
+					break; //inner do loop
+				}
+			}
+			record.columnLabels( iCol ) = columnLabels( iCol );
+			record.widthColumn( iCol ) = widthColumn( iCol );
+		}
+	}
+
+	void
+	WriteTabularRecords()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Write the headers, subtitles, lines of text and tables recorded by
+		//   WriteReportHeaders, WriteSubtitle, WriteTextLine and WriteTable to
+		//   the tabular output files.
+
+		// METHODOLOGY EMPLOYED:
+		//   Each style is rendered from the records into its own list of lines,
+		//   so the styles are rendered at the same time on NumTabularThreads
+		//   threads. The lines are then written one file after the other since
+		//   the gio units cannot be written from several threads.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::NumTabularThreads;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iStyle;
+		int curFH;
 
+		if ( TabularRecords.empty() ) return;
+
+		std::vector< std::vector< std::string > > styleLines( numStyles ); // rendered lines of each style
+		int const NumThreads( max( 1, min( NumTabularThreads, numStyles ) ) );
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( NumThreads ) schedule( dynamic, 1 )
+#endif
+		for ( int Loop = 1; Loop <= numStyles; ++Loop ) {
+			for ( auto const & record : TabularRecords ) {
+				RenderTabularRecord( record, Loop, styleLines[ Loop - 1 ] );
+			}
+		}
+
+		for ( iStyle = 1; iStyle <= numStyles; ++iStyle ) {
+			curFH = TabularOutputFile( iStyle );
+			for ( auto const & line : styleLines[ iStyle - 1 ] ) {
+				gio::write( curFH, fmtA ) << line;
+			}
+		}
+		TabularRecords.clear();
+	}
+
+	void
+	RenderTabularRecord(
+		TabularRecordType const & record, // header, subtitle, line of text or table
+		int const iStyle, // style rendered
+		std::vector< std::string > & lines // lines of the style
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Add the lines of a recorded header, subtitle, line of text or table
+		//   in one style to the lines of the style.
+
+		// METHODOLOGY EMPLOYED:
+		//   Only reads the record and the style, so it may be called for different
+		//   styles at the same time.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string const & curDel( del( iStyle ) );
+
+		if ( record.kind == recordReportHeaders ) {
+			{ auto const SELECT_CASE_var( TableStyle( iStyle ) );
 			if ( ( SELECT_CASE_var == tableStyleComma ) || ( SELECT_CASE_var == tableStyleTab ) ) {
-				// column headers
-				for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
-					outputLine = curDel; // one leading delimiters on column header lines
-					for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
-						outputLine += curDel + stripped( colLabelMulti( jRow, iCol ) );
-					}
-					gio::write( curFH, fmtA ) << InsertCurrencySymbol( outputLine, false );
+				lines.push_back( "--------------------------------------------------" "--------------------------------------------------" );
+				lines.push_back( "REPORT:" + curDel + record.text );
+				lines.push_back( "FOR:" + curDel + record.forName );
+			} else if ( SELECT_CASE_var == tableStyleFixed ) {
+				lines.push_back( "--------------------------------------------------" "--------------------------------------------------" );
+				lines.push_back( "REPORT:      " + curDel + record.text );
+				lines.push_back( "FOR:         " + curDel + record.forName );
+			} else if ( SELECT_CASE_var == tableStyleHTML ) {
+				lines.push_back( "<hr>" );
+				lines.push_back( "<p><a href=\"#toc\" style=\"float: right\">Table of Contents</a></p>" );
+				lines.push_back( "<a name=" + record.anchorName + "></a>" );
+				lines.push_back( "<p>Report:<b>" + curDel + record.text + "</b></p>" );
+				lines.push_back( "<p>For:<b>" + curDel + record.forName + "</b></p>" );
+				lines.push_back( record.timeStampDate );
+				lines.push_back( record.timeStampTime );
+			} else if ( SELECT_CASE_var == tableStyleXML ) {
+				if ( len( record.prevElementName ) != 0 ) {
+					lines.push_back( "</" + record.prevElementName + '>' ); //close the last element if it was used.
 				}
-				// body with row headers
-				for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-					outputLine = curDel + rowLabels( jRow ); // one leading delimiters on table body lines
-					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-						outputLine += curDel + stripped( body( jRow, iCol ) );
-					}
-					gio::write( curFH, fmtA ) << InsertCurrencySymbol( outputLine, false );
+				lines.push_back( "<" + record.elementName + '>' );
+				lines.push_back( "  <for>" + record.forName + "</for>" );
+			}}
+		} else if ( record.kind == recordSubtitle ) {
+			{ auto const SELECT_CASE_var( TableStyle( iStyle ) );
+			if ( ( SELECT_CASE_var == tableStyleComma ) || ( SELECT_CASE_var == tableStyleTab ) || ( SELECT_CASE_var == tableStyleFixed ) ) {
+				lines.push_back( record.text );
+				lines.push_back( "" );
+			} else if ( SELECT_CASE_var == tableStyleHTML ) {
+				lines.push_back( "<b>" + record.text + "</b><br><br>" );
+				lines.push_back( "<!-- FullName:" + record.reportName + '_' + record.forName + '_' + record.text + "-->" );
+			}}
+		} else if ( record.kind == recordTextLine ) {
+			{ auto const SELECT_CASE_var( TableStyle( iStyle ) );
+			if ( ( SELECT_CASE_var == tableStyleComma ) || ( SELECT_CASE_var == tableStyleTab ) || ( SELECT_CASE_var == tableStyleFixed ) ) {
+				lines.push_back( record.text );
+			} else if ( SELECT_CASE_var == tableStyleHTML ) {
+				if ( record.isBold ) {
+					lines.push_back( "<b>" + record.text + "</b><br><br>" );
+				} else {
+					lines.push_back( record.text + "<br>" );
 				}
-				if ( present( footnoteText ) ) {
-					if ( len( footnoteText ) > 0 ) {
-						gio::write( curFH, fmtA ) << footnoteText;
-					}
+			} else if ( SELECT_CASE_var == tableStyleXML ) {
+				if ( len( record.text ) != 0 ) {
+					lines.push_back( "<note>" + record.text + "</note>" );
 				}
-				gio::write( curFH );
-				gio::write( curFH );
+			}}
+		} else if ( record.kind == recordTable ) {
+			RenderTable( record, iStyle, lines );
+		}
+	}
 
-			} else if ( SELECT_CASE_var == tableStyleFixed ) {
-				// column headers
+	void
+	RenderTable(
+		TabularRecordType const & record, // recorded table
+		int const iStyle, // style rendered
+		std::vector< std::string > & lines // lines of the style
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Jason Glazer
+		//       DATE WRITTEN   August 2003
+		//       MODIFIED       October 2014, moved from WriteTable to render a recorded table
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Add the lines of a table recorded by WriteTable in one style
+		//   (comma, tab, space, html, xml) to the lines of the style.
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const blank;
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray2D_string colLabelFixed;
+		FArray1D_string rowLabelTags;
+		FArray1D_string columnLabelTags;
+		FArray1D_string rowUnitStrings;
+		FArray1D_string columnUnitStrings;
+		FArray2D_string bodyEsc;
+
+		std::string::size_type widthRowLabel;
+		std::string::size_type maxWidthRowLabel;
+
+		int iCol;
+		int jRow;
+		int colWidthLimit;
+
+		std::string outputLine;
+		std::string tagWithAttrib;
+		std::string::size_type col1start;
+		bool doTransposeXML;
+		bool isRecordBlank;
+
+		FArray2D_string const & body( record.body );
+		FArray1D_string const & rowLabels( record.rowLabels );
+		FArray1D_string const & columnLabels( record.columnLabels );
+		FArray1D_int const & widthColumn( record.widthColumn );
+		FArray2D_string const & colLabelMulti( record.colLabelMulti );
+		int const rowsBody( isize( body, 1 ) );
+		int const colsBody( isize( body, 2 ) );
+		int const colsColumnLabels( isize( columnLabels ) );
+		int const rowsRowLabels( isize( rowLabels ) );
+		int const maxNumColLabelRows( record.maxNumColLabelRows );
+		std::string const & curDel( del( iStyle ) );
+		std::string const & footnoteText( record.footnoteText );
+
+		// output depending on style of format
+		{ auto const SELECT_CASE_var( TableStyle( iStyle ) );
+
+		if ( ( SELECT_CASE_var == tableStyleComma ) || ( SELECT_CASE_var == tableStyleTab ) ) {
+			// column headers
+			for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
+				outputLine = curDel; // one leading delimiters on column header lines
+				for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
+					outputLine += curDel + stripped( colLabelMulti( jRow, iCol ) );
+				}
+				lines.push_back( InsertCurrencySymbol( outputLine, false ) );
+			}
+			// body with row headers
+			for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
+				outputLine = curDel + rowLabels( jRow ); // one leading delimiters on table body lines
+				for ( iCol = 1; iCol <= colsBody; ++iCol ) {
+					outputLine += curDel + stripped( body( jRow, iCol ) );
+				}
+				lines.push_back( InsertCurrencySymbol( outputLine, false ) );
+			}
+			if ( len( footnoteText ) > 0 ) {
+				lines.push_back( footnoteText );
+			}
+			lines.push_back( "" );
+			lines.push_back( "" );
+
+		} else if ( SELECT_CASE_var == tableStyleFixed ) {
+			// break column headings into multiple rows if long (for fixed) or contain two spaces in a row.
+			colLabelFixed.allocate( maxNumColLabelRows, colsColumnLabels );
+			colLabelFixed = colLabelMulti;
+			for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
+				colWidthLimit = widthColumn( iCol );
 				for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
-					outputLine = blank; // spaces(:maxWidthRowLabel+2)  // two extra spaces and leave blank area for row labels
-					col1start = max( maxWidthRowLabel + 2u, static_cast< std::string::size_type >( 3u ) );
-					for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
-						if ( iCol != 1 ) {
-							outputLine += "  " + rjustified( sized( colLabelMulti( jRow, iCol ), widthColumn( iCol ) ) );
-						} else {
-							outputLine = std::string( col1start - 1, ' ' ) + "  " + rjustified( sized( colLabelMulti( jRow, iCol ), widthColumn( iCol ) ) );
-						}
-					}
-					gio::write( curFH, fmtA ) << InsertCurrencySymbol( outputLine, false );
+					pare( colLabelFixed( jRow, iCol ), colWidthLimit );
 				}
-				// body with row headers
-				for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-					outputLine = "  " + rjustified( sized( rowLabels( jRow ), maxWidthRowLabel ) ); // two blank spaces on table body lines
-					//col1start = max( len( outputLine ) + 2u, maxWidthRowLabel + 2u );
-					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-						if ( iCol != 1 ) {
-							outputLine += "  " + rjustified( sized( body( jRow, iCol ), widthColumn( iCol ) ) );
-						} else {
-							outputLine += "   " + rjustified( sized( body( jRow, iCol ), widthColumn( iCol ) ) );
-						}
+			}
+			maxWidthRowLabel = 0;
+			for ( jRow = 1; jRow <= rowsRowLabels; ++jRow ) {
+				widthRowLabel = len( rowLabels( jRow ) );
+				if ( widthRowLabel > maxWidthRowLabel ) {
+					maxWidthRowLabel = widthRowLabel;
+				}
+			}
+			// column headers
+			for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
+				outputLine = blank; // spaces(:maxWidthRowLabel+2)  // two extra spaces and leave blank area for row labels
+				col1start = max( maxWidthRowLabel + 2u, static_cast< std::string::size_type >( 3u ) );
+				for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
+					if ( iCol != 1 ) {
+						outputLine += "  " + rjustified( sized( colLabelFixed( jRow, iCol ), widthColumn( iCol ) ) );
+					} else {
+						outputLine = std::string( col1start - 1, ' ' ) + "  " + rjustified( sized( colLabelFixed( jRow, iCol ), widthColumn( iCol ) ) );
 					}
-					gio::write( curFH, fmtA ) << InsertCurrencySymbol( outputLine, false );
 				}
-				if ( present( footnoteText ) ) {
-					if ( len( footnoteText ) > 0 ) {
-						gio::write( curFH, fmtA ) << footnoteText;
+				lines.push_back( InsertCurrencySymbol( outputLine, false ) );
+			}
+			// body with row headers
+			for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
+				outputLine = "  " + rjustified( sized( rowLabels( jRow ), maxWidthRowLabel ) ); // two blank spaces on table body lines
+				//col1start = max( len( outputLine ) + 2u, maxWidthRowLabel + 2u );
+				for ( iCol = 1; iCol <= colsBody; ++iCol ) {
+					if ( iCol != 1 ) {
+						outputLine += "  " + rjustified( sized( body( jRow, iCol ), widthColumn( iCol ) ) );
+					} else {
+						outputLine += "   " + rjustified( sized( body( jRow, iCol ), widthColumn( iCol ) ) );
 					}
 				}
-				gio::write( curFH );
-				gio::write( curFH );
+				lines.push_back( InsertCurrencySymbol( outputLine, false ) );
+			}
+			if ( len( footnoteText ) > 0 ) {
+				lines.push_back( footnoteText );
+			}
+			lines.push_back( "" );
+			lines.push_back( "" );
 
-			} else if ( SELECT_CASE_var == tableStyleHTML ) {
-				// set up it being a table
-				gio::write( curFH, fmtA ) << "<table border=\"1\" cellpadding=\"4\" cellspacing=\"0\">";
-				// column headers
-				gio::write( curFH, fmtA ) << "  <tr><td></td>"; // start new row and leave empty cell
-				for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
-					outputLine = "    <td align=\"right\">";
-					for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
-						outputLine += colLabelMulti( jRow, iCol );
-						if ( jRow < maxNumColLabelRows ) {
-							outputLine += "<br>";
-						}
+		} else if ( SELECT_CASE_var == tableStyleHTML ) {
+			// set up it being a table
+			lines.push_back( "<table border=\"1\" cellpadding=\"4\" cellspacing=\"0\">" );
+			// column headers
+			lines.push_back( "  <tr><td></td>" ); // start new row and leave empty cell
+			for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
+				outputLine = "    <td align=\"right\">";
+				for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
+					outputLine += colLabelMulti( jRow, iCol );
+					if ( jRow < maxNumColLabelRows ) {
+						outputLine += "<br>";
 					}
-					gio::write( curFH, fmtA ) << InsertCurrencySymbol( outputLine, true ) + "</td>";
 				}
-				gio::write( curFH, fmtA ) << "  </tr>";
-				// body with row headers
-				for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-					gio::write( curFH, fmtA ) << "  <tr>";
-					if ( rowLabels( jRow ) != "" ) {
-						gio::write( curFH, fmtA ) << "    <td align=\"right\">" + InsertCurrencySymbol( rowLabels( jRow ), true ) + "</td>";
+				lines.push_back( InsertCurrencySymbol( outputLine, true ) + "</td>" );
+			}
+			lines.push_back( "  </tr>" );
+			// body with row headers
+			for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
+				lines.push_back( "  <tr>" );
+				if ( rowLabels( jRow ) != "" ) {
+					lines.push_back( "    <td align=\"right\">" + InsertCurrencySymbol( rowLabels( jRow ), true ) + "</td>" );
+				} else {
+					lines.push_back( "    <td align=\"right\">&nbsp;</td>" );
+				}
+				for ( iCol = 1; iCol <= colsBody; ++iCol ) {
+					if ( body( jRow, iCol ) != "" ) {
+						lines.push_back( "    <td align=\"right\">" + InsertCurrencySymbol( body( jRow, iCol ), true ) + "</td>" );
 					} else {
-						gio::write( curFH, fmtA ) << "    <td align=\"right\">&nbsp;</td>";
+						lines.push_back( "    <td align=\"right\">&nbsp;</td>" );
+					}
+				}
+				lines.push_back( "  </tr>" );
+			}
+			// end the table
+			lines.push_back( "</table>" );
+			if ( len( footnoteText ) > 0 ) {
+				lines.push_back( "<i>" + footnoteText + "</i>" );
+			}
+			lines.push_back( "<br><br>" );
+		} else if ( SELECT_CASE_var == tableStyleXML ) {
+			// WriteTable leaves the element name blank if the entire table is blank
+			if ( len( record.elementName ) > 0 ) {
+				doTransposeXML = record.transposeXML;
+				// if a single column table, transpose it automatically
+				if ( ( colsBody == 1 ) && ( rowsBody > 1 ) ) {
+					doTransposeXML = true;
+				}
+				// create arrays to hold the XML tags
+				rowLabelTags.allocate( rowsBody );
+				columnLabelTags.allocate( colsBody );
+				rowUnitStrings.allocate( rowsBody );
+				columnUnitStrings.allocate( colsBody );
+				bodyEsc.allocate( rowsBody, colsBody );
+				// first convert all row and column headers into tags compatible with XML strings
+				for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
+					rowLabelTags( jRow ) = ConvertToElementTag( rowLabels( jRow ) );
+					if ( len( rowLabelTags( jRow ) ) == 0 ) {
+						rowLabelTags( jRow ) = "none";
 					}
-					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-						if ( body( jRow, iCol ) != "" ) {
-							gio::write( curFH, fmtA ) << "    <td align=\"right\">" + InsertCurrencySymbol( body( jRow, iCol ), true ) + "</td>";
-						} else {
-							gio::write( curFH, fmtA ) << "    <td align=\"right\">&nbsp;</td>";
-						}
+					rowUnitStrings( jRow ) = GetUnitSubString( rowLabels( jRow ) );
+					if ( SameString( rowUnitStrings( jRow ), "Invalid/Undefined" ) ) {
+						rowUnitStrings( jRow ) = "";
 					}
-					gio::write( curFH, fmtA ) << "  </tr>";
 				}
-				// end the table
-				gio::write( curFH, fmtA ) << "</table>";
-				if ( present( footnoteText ) ) {
-					if ( len( footnoteText ) > 0 ) {
-						gio::write( curFH, fmtA ) << "<i>" + footnoteText + "</i>";
+				for ( iCol = 1; iCol <= colsBody; ++iCol ) {
+					columnLabelTags( iCol ) = ConvertToElementTag( columnLabels( iCol ) );
+					if ( len( columnLabelTags( iCol ) ) == 0 ) {
+						columnLabelTags( iCol ) = "none";
+					}
+					columnUnitStrings( iCol ) = GetUnitSubString( columnLabels( iCol ) );
+					if ( SameString( columnUnitStrings( iCol ), "Invalid/Undefined" ) ) {
+						columnUnitStrings( iCol ) = "";
 					}
 				}
-				gio::write( curFH, fmtA ) << "<br><br>";
-			} else if ( SELECT_CASE_var == tableStyleXML ) {
-				//check if entire table is blank and it if is skip generating anything
-				isTableBlank = true;
+				// convert entire table body to one with escape characters (no " ' < > &)
 				for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
 					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-						if ( len( body( jRow, iCol ) ) > 0 ) {
-							isTableBlank = false;
-							break;
-						}
+						bodyEsc( jRow, iCol ) = ConvertToEscaped( body( jRow, iCol ) );
 					}
-					if ( ! isTableBlank ) break;
 				}
-				// if non-blank cells in the table body were found create the table.
-				if ( ! isTableBlank ) {
-					//if report name and subtable name the same add "record" to the end
-					activeSubTableName = ConvertToElementTag( activeSubTableName );
-					activeReportNameNoSpace = ConvertToElementTag( activeReportName );
-					if ( SameString( activeSubTableName, activeReportNameNoSpace ) ) {
-						activeSubTableName += "Record";
-					}
-					//if no subtable name use the report name and add "record" to the end
-					if ( len( activeSubTableName ) == 0 ) {
-						activeSubTableName = activeReportNameNoSpace + "Record";
-					}
-					// if a single column table, transpose it automatically
-					if ( ( colsBody == 1 ) && ( rowsBody > 1 ) ) {
-						doTransposeXML = true;
-					}
-					// first convert all row and column headers into tags compatible with XML strings
-					for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-						rowLabelTags( jRow ) = ConvertToElementTag( rowLabels( jRow ) );
-						if ( len( rowLabelTags( jRow ) ) == 0 ) {
-							rowLabelTags( jRow ) = "none";
-						}
-						rowUnitStrings( jRow ) = GetUnitSubString( rowLabels( jRow ) );
-						if ( SameString( rowUnitStrings( jRow ), "Invalid/Undefined" ) ) {
-							rowUnitStrings( jRow ) = "";
-						}
-					}
-					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-						columnLabelTags( iCol ) = ConvertToElementTag( columnLabels( iCol ) );
-						if ( len( columnLabelTags( iCol ) ) == 0 ) {
-							columnLabelTags( iCol ) = "none";
-						}
-						columnUnitStrings( iCol ) = GetUnitSubString( columnLabels( iCol ) );
-						if ( SameString( columnUnitStrings( iCol ), "Invalid/Undefined" ) ) {
-							columnUnitStrings( iCol ) = "";
-						}
-					}
-					// convert entire table body to one with escape characters (no " ' < > &)
+				if ( ! doTransposeXML ) {
+					// body with row headers
 					for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
+						//check if record is blank and it if is skip generating anything
+						isRecordBlank = true;
 						for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-							bodyEsc( jRow, iCol ) = ConvertToEscaped( body( jRow, iCol ) );
+							if ( len( bodyEsc( jRow, iCol ) ) > 0 ) {
+								isRecordBlank = false;
+								break;
+							}
 						}
-					}
-					if ( ! doTransposeXML ) {
-						// body with row headers
-						for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-							//check if record is blank and it if is skip generating anything
-							isRecordBlank = true;
-							for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-								if ( len( bodyEsc( jRow, iCol ) ) > 0 ) {
-									isRecordBlank = false;
-									break;
-								}
+						if ( ! isRecordBlank ) {
+							lines.push_back( "  <" + record.elementName + '>' );
+							if ( len( rowLabelTags( jRow ) ) > 0 ) {
+								lines.push_back( "    <name>" + rowLabelTags( jRow ) + "</name>" );
 							}
-							if ( ! isRecordBlank ) {
-								gio::write( curFH, fmtA ) << "  <" + activeSubTableName + '>';
-								if ( len( rowLabelTags( jRow ) ) > 0 ) {
-									gio::write( curFH, fmtA ) << "    <name>" + rowLabelTags( jRow ) + "</name>";
-								}
-								for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-									if ( len( stripped( bodyEsc( jRow, iCol ) ) ) > 0 ) { //skip blank cells
-										tagWithAttrib = "<" + columnLabelTags( iCol );
-										if ( len( columnUnitStrings( iCol ) ) > 0 ) {
-											tagWithAttrib += " units=" + CHAR( 34 ) + columnUnitStrings( iCol ) + CHAR( 34 ) + '>'; //if units are present add them as an attribute
-										} else {
-											tagWithAttrib += ">";
-										}
-										gio::write( curFH, fmtA ) << "    " + tagWithAttrib + stripped( bodyEsc( jRow, iCol ) ) + "</" + columnLabelTags( iCol ) + '>';
+							for ( iCol = 1; iCol <= colsBody; ++iCol ) {
+								if ( len( stripped( bodyEsc( jRow, iCol ) ) ) > 0 ) { //skip blank cells
+									tagWithAttrib = "<" + columnLabelTags( iCol );
+									if ( len( columnUnitStrings( iCol ) ) > 0 ) {
+										tagWithAttrib += " units=" + CHAR( 34 ) + columnUnitStrings( iCol ) + CHAR( 34 ) + '>'; //if units are present add them as an attribute
+									} else {
+										tagWithAttrib += ">";
 									}
+									lines.push_back( "    " + tagWithAttrib + stripped( bodyEsc( jRow, iCol ) ) + "</" + columnLabelTags( iCol ) + '>' );
 								}
-								gio::write( curFH, fmtA ) << "  </" + activeSubTableName + '>';
 							}
+							lines.push_back( "  </" + record.elementName + '>' );
 						}
-					} else { //transpose XML table
-						// body with row headers
-						for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-							//check if record is blank and it if is skip generating anything
-							isRecordBlank = true;
-							for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-								if ( len( bodyEsc( jRow, iCol ) ) > 0 ) {
-									isRecordBlank = false;
-									break;
+					}
+				} else { //transpose XML table
+					// body with row headers
+					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
+						//check if record is blank and it if is skip generating anything
+						isRecordBlank = true;
+						for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
+							if ( len( bodyEsc( jRow, iCol ) ) > 0 ) {
+								isRecordBlank = false;
+								break;
+							}
+						}
+						if ( ! isRecordBlank ) {
+							lines.push_back( "  <" + record.elementName + '>' );
+							// if the column has units put them into the name tag
+							if ( len( columnLabelTags( iCol ) ) > 0 ) {
+								if ( len( columnUnitStrings( iCol ) ) > 0 ) {
+									lines.push_back( "    <name units=" + CHAR( 34 ) + columnUnitStrings( iCol ) + CHAR( 34 ) + '>' + columnLabelTags( iCol ) + "</name>" );
+								} else {
+									lines.push_back( "    <name>" + columnLabelTags( iCol ) + "</name>" );
 								}
 							}
-							if ( ! isRecordBlank ) {
-								gio::write( curFH, fmtA ) << "  <" + activeSubTableName + '>';
-								// if the column has units put them into the name tag
-								if ( len( columnLabelTags( iCol ) ) > 0 ) {
-									if ( len( columnUnitStrings( iCol ) ) > 0 ) {
-										gio::write( curFH, fmtA ) << "    <name units=" + CHAR( 34 ) + columnUnitStrings( iCol ) + CHAR( 34 ) + '>' + columnLabelTags( iCol ) + "</name>";
+							for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
+								if ( len( bodyEsc( jRow, iCol ) ) > 0 ) { //skip blank cells
+									tagWithAttrib = "<" + rowLabelTags( jRow );
+									if ( len( rowUnitStrings( jRow ) ) > 0 ) {
+										tagWithAttrib += " units=" + CHAR( 34 ) + rowUnitStrings( jRow ) + CHAR( 34 ) + '>'; //if units are present add them as an attribute
 									} else {
-										gio::write( curFH, fmtA ) << "    <name>" + columnLabelTags( iCol ) + "</name>";
-									}
-								}
-								for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-									if ( len( bodyEsc( jRow, iCol ) ) > 0 ) { //skip blank cells
-										tagWithAttrib = "<" + rowLabelTags( jRow );
-										if ( len( rowUnitStrings( jRow ) ) > 0 ) {
-											tagWithAttrib += " units=" + CHAR( 34 ) + rowUnitStrings( jRow ) + CHAR( 34 ) + '>'; //if units are present add them as an attribute
-										} else {
-											tagWithAttrib += ">";
-										}
-										gio::write( curFH, fmtA ) << "    " + tagWithAttrib + stripped( bodyEsc( jRow, iCol ) ) + "</" + rowLabelTags( jRow ) + '>';
+										tagWithAttrib += ">";
 									}
+									lines.push_back( "    " + tagWithAttrib + stripped( bodyEsc( jRow, iCol ) ) + "</" + rowLabelTags( jRow ) + '>' );
 								}
-								gio::write( curFH, fmtA ) << "  </" + activeSubTableName + '>';
 							}
-						}
-					}
-					if ( present( footnoteText ) ) {
-						if ( len( footnoteText ) > 0 ) {
-							gio::write( curFH, fmtA ) << "  <footnote>" + footnoteText + "</footnote>";
+							lines.push_back( "  </" + record.elementName + '>' );
 						}
 					}
 				}
-			} else {
+				if ( len( footnoteText ) > 0 ) {
+					lines.push_back( "  <footnote>" + footnoteText + "</footnote>" );
+				}
+			}
+		} else {
 
-			}}
-		}
-		colLabelMulti.deallocate();
-		rowLabelTags.deallocate();
-		columnLabelTags.deallocate();
-		rowUnitStrings.deallocate();
-		columnUnitStrings.deallocate();
-		bodyEsc.deallocate();
+		}}
 	}
 
 	std::string
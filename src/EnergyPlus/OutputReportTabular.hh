@@ -3,6 +3,7 @@
 
 // C++ Headers
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
@@ -57,6 +58,11 @@ namespace OutputReportTabular {
 	extern int const isAverage;
 	extern int const isSum;
 
+	extern int const recordReportHeaders; // kinds of TabularRecordType
+	extern int const recordSubtitle;
+	extern int const recordTextLine;
+	extern int const recordTable;
+
 	extern int const stepTypeZone;
 	extern int const stepTypeHVAC;
 
@@ -106,6 +112,10 @@ namespace OutputReportTabular {
 
 	extern Real64 timeInYear;
 
+	// Timing of the gathering for the tabular benchmark
+	extern Real64 gatherTimeMonthlyBinned; // time spent gathering the monthly and binned tables (s)
+	extern Real64 gatherTimeOther; // time spent gathering the other tabular reports (s)
+
 	// Flags for predefined tabular reports
 	extern bool displayTabularBEPS;
 	extern bool displayLEEDSummary;
@@ -388,10 +398,12 @@ namespace OutputReportTabular {
 		// Members
 		std::string namesOfObj; // name of the object
 		int varMeterNum; // variable or meter number
+		Real64 const * varPtr; // value of a real report variable (null to use GetInternalVariableValue)
 
 		// Default Constructor
 		BinObjVarIDType() :
-			varMeterNum( 0 )
+			varMeterNum( 0 ),
+			varPtr( nullptr )
 		{}
 
 		// Member Constructor
@@ -400,7 +412,8 @@ namespace OutputReportTabular {
 			int const varMeterNum // variable or meter number
 		) :
 			namesOfObj( namesOfObj ),
-			varMeterNum( varMeterNum )
+			varMeterNum( varMeterNum ),
+			varPtr( nullptr )
 		{}
 
 	};
@@ -640,6 +653,107 @@ namespace OutputReportTabular {
 
 	};
 
+	struct MonthlyPlanScanType
+	{
+		// Members
+		int column; // index in MonthlyColumns of the scanned column
+		int aggType; // index to the type of aggregation (see list of parameters)
+		bool summed; // true if the variable is summed
+		int typeOfVar; // 0=not found, 1=integer, 2=real, 3=meter
+		int varNum; // variable or meter number
+		Real64 const * valuePtr; // value of a real report variable (null to use GetInternalVariableValue)
+
+		// Default Constructor
+		MonthlyPlanScanType() :
+			column( 0 ),
+			aggType( 0 ),
+			summed( false ),
+			typeOfVar( 0 ),
+			varNum( 0 ),
+			valuePtr( nullptr )
+		{}
+
+	};
+
+	struct MonthlyPlanEntryType
+	{
+		// Members
+		int column; // index in MonthlyColumns that holds the results
+		int aggType; // index to the type of aggregation (see list of parameters)
+		bool summed; // true if the variable is summed
+		int typeOfVar; // 0=not found, 1=integer, 2=real, 3=meter
+		int varNum; // variable or meter number
+		Real64 const * valuePtr; // value of a real report variable (null to use GetInternalVariableValue)
+		bool firstInTable; // first entry of its table in the plan sequence
+		FArray1D< MonthlyPlanScanType > maxMinScan; // ValueWhenMaxMin columns up to the next maximum or minimum column
+		FArray1D< MonthlyPlanScanType > hoursScan; // hours shown columns up to the next hours column
+		bool hoursScanResets; // the hours scan clears the hours shown flag (the next column is not an hours column)
+		bool active; // new maximum or minimum, or hours shown, at the current time step
+
+		// Default Constructor
+		MonthlyPlanEntryType() :
+			column( 0 ),
+			aggType( 0 ),
+			summed( false ),
+			typeOfVar( 0 ),
+			varNum( 0 ),
+			valuePtr( nullptr ),
+			firstInTable( false ),
+			hoursScanResets( false ),
+			active( false )
+		{}
+
+	};
+
+	struct MonthlyPlanType
+	{
+		// Members
+		int numEntries; // number of columns gathered at this kind of time step
+		FArray1D< MonthlyPlanEntryType > entry; // gathered columns, grouped by aggregation type
+		FArray1D_int firstEntryOfAgg; // first entry of each aggregation type (one more for the end)
+		int numSequence; // number of entries in the sequence
+		FArray1D_int sequence; // entries of the tables with scanned columns, in table and column order
+
+		// Default Constructor
+		MonthlyPlanType() :
+			numEntries( 0 ),
+			numSequence( 0 )
+		{}
+
+	};
+
+	struct TabularRecordType
+	{
+		// Members
+		int kind; // recordReportHeaders, recordSubtitle, recordTextLine or recordTable
+		std::string text; // report name, subtitle or line of text
+		std::string forName; // object name of the report
+		std::string reportName; // report name for the HTML comment of a subtitle
+		std::string anchorName; // HTML anchor of the report
+		std::string timeStampDate; // HTML timestamp lines of the report
+		std::string timeStampTime;
+		std::string prevElementName; // XML element of the previous report to close
+		std::string elementName; // XML element of the report or of the records of the table (blank if the table is blank)
+		bool isBold; // show the line of text in bold
+		FArray2D_string body; // row,column
+		FArray1D_string rowLabels;
+		FArray1D_string columnLabels;
+		FArray1D_int widthColumn; // column widths, at least as wide as the column labels
+		FArray2D_string colLabelMulti; // column labels broken into rows at each '|'
+		int maxNumColLabelRows; // rows of colLabelMulti
+		bool transposeXML;
+		std::string footnoteText;
+
+		// Default Constructor
+		TabularRecordType() :
+			kind( 0 ),
+			isBold( false ),
+			maxNumColLabelRows( 0 ),
+			transposeXML( false )
+		{}
+
+	};
+
 	struct TOCEntriesType
 	{
 		// Members
@@ -719,6 +833,8 @@ namespace OutputReportTabular {
 	extern FArray1D< MonthlyInputType > MonthlyInputCopy;
 	extern FArray1D< MonthlyTablesType > MonthlyTables;
 	extern FArray1D< MonthlyColumnsType > MonthlyColumns;
+	extern FArray1D< MonthlyPlanType > MonthlyPlan; // compiled monthly gathering for the zone and HVAC time steps
+	extern std::vector< TabularRecordType > TabularRecords; // headers, lines and tables not yet written to the tabular files
 	extern FArray1D< TOCEntriesType > TOCEntries;
 	extern FArray1D< TOCEntriesType > CopyOfTOCEntries;
 	extern FArray1D< UnitConvType > UnitConv;
@@ -756,6 +872,22 @@ namespace OutputReportTabular {
 	void
 	InitializeTabularMonthly();
 
+	void
+	CompileMonthlyPlans();
+
+	void
+	SetMonthlyPlanScans(
+		int const iTable, // index in MonthlyTables
+		int const jColumn, // column of the table
+		MonthlyPlanEntryType & curEntry // entry that receives the scanned columns
+	);
+
+	void
+	SetMonthlyPlanScan(
+		int const scanColumn, // index in MonthlyColumns
+		MonthlyPlanScanType & curScan // scanned column of the plan
+	);
+
 	void
 	GetInputTabularTimeBins();
 
@@ -926,6 +1058,23 @@ namespace OutputReportTabular {
 		Optional_string_const footnoteText = _
 	);
 
+	void
+	WriteTabularRecords();
+
+	void
+	RenderTabularRecord(
+		TabularRecordType const & record, // header, subtitle, line of text or table
+		int const iStyle, // style rendered
+		std::vector< std::string > & lines // lines of the style
+	);
+
+	void
+	RenderTable(
+		TabularRecordType const & record, // recorded table
+		int const iStyle, // style rendered
+		std::vector< std::string > & lines // lines of the style
+	);
+
 	std::string
 	MakeAnchorName(
 		std::string const & reportString,
@@ -3967,7 +3967,7 @@ namespace PackagedTerminalHeatPump {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Richard Raustad
 		//       DATE WRITTEN   July 2005
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, General::SolveRoot with heating and cooling PLR hints
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3980,7 +3980,8 @@ namespace PackagedTerminalHeatPump {
 		// na
 
 		// Using/Aliasing
-		using General::SolveRegulaFalsi;
+		using General::SolveRoot;
+		using General::RegisterRootSolverCaller;
 		using General::RoundSigDigits;
 		using General::TrimSigDigits;
 		using DataGlobals::WarmupFlag;
@@ -3999,6 +4000,8 @@ namespace PackagedTerminalHeatPump {
 		int const MaxIte( 500 ); // maximum number of iterations
 		Real64 const MinPLF( 0.0 ); // minimum part load factor allowed
 		static gio::Fmt const fmtLD( "*" );
+		static int const HeatSolveIndex( RegisterRootSolverCaller( "PackagedTerminalUnit:HeatingPLR" ) ); // root solver statistics index
+		static int const CoolSolveIndex( RegisterRootSolverCaller( "PackagedTerminalUnit:CoolingPLR" ) ); // root solver statistics index
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -4012,7 +4015,7 @@ namespace PackagedTerminalHeatPump {
 		Real64 NoCompOutput; // output when no active compressor [W]
 		Real64 ErrorToler; // error tolerance
 		int SolFla; // Flag of RegulaFalsi solver
-		FArray1D< Real64 > Par( 8 ); // Parameters passed to RegulaFalsi
+		PTUnitLoadParams LoadPar; // Parameters passed to PLRResidual
 		std::string IterNum; // Max number of iterations for warning message
 		Real64 CpAir; // air specific heat
 		Real64 OutsideDryBulbTemp; // Outside air temperature at external node height
@@ -4082,23 +4085,19 @@ namespace PackagedTerminalHeatPump {
 
 		if ( ( HeatingLoad && QZnReq < FullOutput ) || ( CoolingLoad && QZnReq > FullOutput ) ) {
 
-			Par( 1 ) = PTUnitNum;
-			Par( 2 ) = ZoneNum;
-			if ( FirstHVACIteration ) {
-				Par( 3 ) = 1.0;
+			LoadPar.PTUnitNum = PTUnitNum;
+			LoadPar.ZoneNum = ZoneNum;
+			LoadPar.FirstHVACIteration = FirstHVACIteration;
+			LoadPar.OpMode = OpMode;
+			LoadPar.QZnReq = QZnReq;
+			LoadPar.OnOffAirFlowRatio = OnOffAirFlowRatio;
+			LoadPar.SupHeaterLoad = SupHeaterLoad;
+			LoadPar.HXUnitOn = HXUnitOn;
+			if ( CoolingLoad ) {
+				SolveRoot( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, 0.0, 1.0, LoadPar, PTUnit( PTUnitNum ).CoolPLRHint, CoolSolveIndex );
 			} else {
-				Par( 3 ) = 0.0;
+				SolveRoot( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, 0.0, 1.0, LoadPar, PTUnit( PTUnitNum ).HeatPLRHint, HeatSolveIndex );
 			}
-			Par( 4 ) = OpMode;
-			Par( 5 ) = QZnReq;
-			Par( 6 ) = OnOffAirFlowRatio;
-			Par( 7 ) = SupHeaterLoad;
-			if ( HXUnitOn ) {
-				Par( 8 ) = 1.0;
-			} else {
-				Par( 8 ) = 0.0;
-			}
-			SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, 0.0, 1.0, Par );
 			if ( SolFla == -1 ) {
 				//     Very low loads may not converge quickly. Tighten PLR boundary and try again.
 				TempMaxPLR = -0.1;
@@ -4117,7 +4116,11 @@ namespace PackagedTerminalHeatPump {
 					if ( HeatingLoad && TempOutput < QZnReq ) ContinueIter = false;
 					if ( CoolingLoad && TempOutput > QZnReq ) ContinueIter = false;
 				}
-				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, TempMinPLR, TempMaxPLR, Par );
+				if ( CoolingLoad ) {
+					SolveRoot( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, TempMinPLR, TempMaxPLR, LoadPar, PTUnit( PTUnitNum ).CoolPLRHint, CoolSolveIndex );
+				} else {
+					SolveRoot( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, TempMinPLR, TempMaxPLR, LoadPar, PTUnit( PTUnitNum ).HeatPLRHint, HeatSolveIndex );
+				}
 				if ( SolFla == -1 ) {
 					if ( ! FirstHVACIteration && ! WarmupFlag ) {
 						CalcPTUnit( PTUnitNum, FirstHVACIteration, PartLoadFrac, TempOutput, QZnReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
@@ -4791,13 +4794,13 @@ namespace PackagedTerminalHeatPump {
 	Real64
 	PLRResidual(
 		Real64 const PartLoadFrac, // compressor cycling ratio (1.0 is continuous, 0.0 is off)
-		Optional< FArray1S< Real64 > const > Par // par(1) = PTUnitNum
+		PTUnitLoadParams const & Par // Function parameters
 	)
 	{
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Richard Raustad
 		//       DATE WRITTEN   July 2005
-		//       MODIFIED
+		//       MODIFIED       Oct 2014: typed parameters for General::SolveRoot
 		//       RE-ENGINEERED
 
 		// PURPOSE OF THIS FUNCTION:
@@ -4822,12 +4825,7 @@ namespace PackagedTerminalHeatPump {
 		Real64 SupHeaterLoad; // load passed to supplemental heater (W)
 
 		// SUBROUTINE ARGUMENT DEFINITIONS:
-		// par(2) = Zone Num
-		// par(3) = FirstHVACIteration
-		// par(4) = OpMode
-		// par(5) = QZnReq
-		// par(6) = OnOffAirFlowRatio
-		// par(7) = SupHeaterLoad
+		// Parameters are described in PTUnitLoadParams
 
 		// FUNCTION PARAMETER DEFINITIONS:
 		//  na
@@ -4849,25 +4847,16 @@ namespace PackagedTerminalHeatPump {
 		Real64 ActualOutput; // delivered capacity of PTHP
 		bool HXUnitOn; // flag to enable heat exchanger
 
-		PTUnitNum = int( Par()( 1 ) );
-		ZoneNum = int( Par()( 2 ) );
-		// FirstHVACIteration is a logical, Par is real, so make 1.0=TRUE and 0.0=FALSE
-		if ( Par()( 3 ) == 1.0 ) {
-			FirstHVACIteration = true;
-		} else {
-			FirstHVACIteration = false;
-		}
-		OpMode = int( Par()( 4 ) );
-		QZnReq = Par()( 5 );
+		PTUnitNum = Par.PTUnitNum;
+		ZoneNum = Par.ZoneNum;
+		FirstHVACIteration = Par.FirstHVACIteration;
+		OpMode = Par.OpMode;
+		QZnReq = Par.QZnReq;
 		QZnReqTemp = QZnReq;
 		if ( std::abs( QZnReq ) < 100.0 ) QZnReqTemp = sign( 100.0, QZnReq );
-		OnOffAirFlowRatio = Par()( 6 );
-		SupHeaterLoad = Par()( 7 ) * PartLoadFrac;
-		if ( Par()( 8 ) == 1.0 ) {
-			HXUnitOn = true;
-		} else {
-			HXUnitOn = false;
-		}
+		OnOffAirFlowRatio = Par.OnOffAirFlowRatio;
+		SupHeaterLoad = Par.SupHeaterLoad * PartLoadFrac;
+		HXUnitOn = Par.HXUnitOn;
 
 		CalcPTUnit( PTUnitNum, FirstHVACIteration, PartLoadFrac, ActualOutput, QZnReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
 		PLRResidual = ( ActualOutput - QZnReq ) / QZnReqTemp;
@@ -9,6 +9,7 @@
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 #include <DataGlobals.hh>
+#include <DataRootFinder.hh>
 #include <VariableSpeedCoils.hh>
 
 namespace EnergyPlus {
@@ -136,6 +137,8 @@ namespace PackagedTerminalHeatPump {
 		Real64 HeatConvergenceTol; // Convergence tolerance, fraction (ZoneLoad - Equip Output)/ZoneLoad
 		Real64 MinOATCompressor; // Minimum OAT for compressor operation [C]
 		int IterErrIndex; // index for recurring warnings
+		DataRootFinder::RootSolverHintType HeatPLRHint; // last converged heating part load fraction
+		DataRootFinder::RootSolverHintType CoolPLRHint; // last converged cooling part load fraction
 		std::string AvailManagerListName; // Name of an availability manager list object
 		int WaterCyclingMode; // Heat Pump Coil water flow mode; See definitions in DataHVACGlobals,
 		// 1=water cycling, 2=water constant, 3=water constant on demand (old mode)
@@ -618,6 +621,32 @@ namespace PackagedTerminalHeatPump {
 
 	};
 
+	struct PTUnitLoadParams // Parameters of PLRResidual
+	{
+		// Members
+		int PTUnitNum; // Index to this packaged terminal unit
+		int ZoneNum; // Zone index
+		bool FirstHVACIteration; // FirstHVACIteration flag
+		int OpMode; // Compressor operating mode
+		Real64 QZnReq; // Zone load (W)
+		Real64 OnOffAirFlowRatio; // Ratio of compressor ON airflow to average airflow over timestep
+		Real64 SupHeaterLoad; // Supplemental heater load at a part load fraction of 1 (W)
+		bool HXUnitOn; // flag to enable heat exchanger
+
+		// Default Constructor
+		PTUnitLoadParams() :
+			PTUnitNum( 0 ),
+			ZoneNum( 0 ),
+			FirstHVACIteration( false ),
+			OpMode( 0 ),
+			QZnReq( 0.0 ),
+			OnOffAirFlowRatio( 1.0 ),
+			SupHeaterLoad( 0.0 ),
+			HXUnitOn( false )
+		{}
+
+	};
+
 	struct PTUnitNumericFieldData
 	{
 		// Members
@@ -733,7 +762,7 @@ namespace PackagedTerminalHeatPump {
 	Real64
 	PLRResidual(
 		Real64 const PartLoadFrac, // compressor cycling ratio (1.0 is continuous, 0.0 is off)
-		Optional< FArray1S< Real64 > const > Par = _ // par(1) = PTUnitNum
+		PTUnitLoadParams const & Par // Function parameters
 	);
 
 	void
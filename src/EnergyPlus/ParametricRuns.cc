@@ -0,0 +1,1184 @@
+// C++ Headers
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#ifdef __unix__
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray.functions.hh>
+#include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/gio.hh>
+#include <ObjexxFCL/string.functions.hh>
+
+// EnergyPlus Headers
+#include <ParametricRuns.hh>
+#include <DataGlobals.hh>
+#include <DataPrecisionGlobals.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
+#include <DisplayRoutines.hh>
+#include <General.hh>
+#include <InputProcessor.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace ParametricRuns {
+
+	// MODULE INFORMATION
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2014
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Runs a batch of variants of one input file, each variant differing from the base
+	// input only in a few field values, without repeating the processing of the IDD and
+	// the IDF for every variant.
+
+	// METHODOLOGY EMPLOYED:
+	// The field changes of all variants are read from the file named by EP_PARAMETRIC_DELTAS,
+	// one change per line:
+	//    VariantName, ObjectType, ObjectName, FieldNumber, Value
+	// where ObjectName is the first alpha field of the object (or * for every object of the
+	// type) and FieldNumber counts all fields of the IDD definition, alpha and numeric, from 1.
+	// Blank lines and text following ! are ignored. The parent process forks one process per
+	// variant (at most EP_PARAMETRIC_JOBS at a time). Each variant process moves into a folder
+	// named after the variant, changes the processed IDF records in place and then carries on
+	// with the normal simulation, so that the parsed input is shared copy-on-write by all
+	// variants. The parent only waits for the variants and reports their outcome in its audit
+	// file.
+	// A variant is forked from one of two points. Variants that change constructions,
+	// materials or surfaces, and every variant of a run that uses SQLite output, the external
+	// interface, checkpoints, shared warmup or run period chunks, are forked right after
+	// ProcessInput. The others are forked after the geometry and CTF setup, so that it is done
+	// once for all of them: the parent forks a setup process, which simulates the base input
+	// in the folder SetupFolder up to the end of the first heat balance initialization
+	// (ForkParametricVariantsAfterSetup) and forks these variants there. A variant whose changed
+	// records were already retrieved by then is handed back to the parent and forked after
+	// ProcessInput instead.
+	// The changes are applied to the processed records and therefore bypass the IDD
+	// range checks of ProcessInput; objects retrieved during ProcessInput itself (Version,
+	// Output:PreprocessorMessage, the Output:Variable prescan) are not affected by them.
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// na
+
+	// Using/Aliasing
+	using namespace DataPrecisionGlobals;
+	using General::RoundSigDigits;
+	using General::TrimSigDigits;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const NumCarriedFiles( 21 ); // Number of output files carried into each variant folder
+	int const NumInputCarriedFiles( 4 ); // Number of those written by ProcessInput
+	FArray1D_string const CarriedFiles( NumCarriedFiles, { "eplusout.audit", "eplusout.dbg", "eplusout.err", "eplusout.iperr", "eplusout.eio", "eplusout.eso", "eplusout.mtr", "eplusout.bnd", "eplusout.mtd", "eplusout.shd", "eplusout.edd", "eplusout.dfs", "eplusout.sci", "epluszsz.csv", "epluszsz.tab", "epluszsz.txt", "eplusssz.csv", "eplusssz.tab", "eplusssz.txt", "TarcogIterations.dbg", "eplusscreen.csv" } );
+	int const iForkAfterInput( 1 ); // Variant forked after ProcessInput
+	int const iForkAfterSetup( 2 ); // Variant forked after the geometry and CTF setup
+	std::string const SetupFolder( ".parametric-setup" ); // Folder of the process that runs to the setup fork point
+	int const NumInputForkTypes( 14 ); // Number of object type prefixes that force the fork after ProcessInput
+	FArray1D_string const InputForkTypes( NumInputForkTypes, { "CONSTRUCTION", "MATERIAL", "WINDOW", "BUILDINGSURFACE", "FENESTRATIONSURFACE", "WALL", "ROOF", "CEILING", "FLOOR", "DOOR", "GLAZEDDOOR", "SHADING", "SURFACE", "INTERNALMASS" } );
+
+	// DERIVED TYPE DEFINITIONS:
+	// na
+
+	// MODULE VARIABLE DECLARATIONS:
+	std::string VariantName; // Variant simulated by this process (blank in the batch parent)
+	bool SetupForkPending( false ); // True in the setup process until the setup fork point
+
+	// SUBROUTINE SPECIFICATIONS FOR MODULE ParametricRuns:
+
+	// Object Data
+	std::vector< ParametricVariant > Variants;
+
+	// Functions
+
+	void
+	RunParametricVariants()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       October 2014, fork after the geometry and CTF setup
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Drives a parametric batch run. Returns only in a variant process, with the variant
+		// input in place, or in the setup process; the parent process ends the program when all
+		// variants are done.
+
+		// METHODOLOGY EMPLOYED:
+		// The output files already written by ProcessInput are flushed (closed and reopened
+		// for append) so that no buffered output is duplicated into the forked processes.
+		// The variants forked after ProcessInput are run first, then the setup process runs the
+		// others, and last the variants the setup process handed back are run.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::cParametricDeltas;
+		using DataSystemVariables::Time_Start;
+		using DataTimings::epElapsedTime;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 SetupTime; // time spent before the first variant is started (s)
+		int VariantNum; // variant index (zero based)
+		int NumVariants; // number of variants in the batch
+		bool AnySetupFork( false ); // true if any variant is forked after the setup
+
+		GetParametricDeltas();
+
+#ifdef __unix__
+		SetupTime = epElapsedTime() - Time_Start;
+		if ( SetupTime < 0.0 ) SetupTime += 24.0 * 3600.0;
+
+		FlushCarriedFiles();
+
+		if ( RunParametricBatch( iForkAfterInput ) ) return;
+
+		NumVariants = Variants.size();
+		for ( VariantNum = 0; VariantNum < NumVariants; ++VariantNum ) {
+			if ( Variants[ VariantNum ].ForkPoint == iForkAfterSetup ) AnySetupFork = true;
+		}
+		if ( AnySetupFork ) {
+			if ( StartSetupProcess() ) return;
+			GatherSetupProcess();
+			if ( RunParametricBatch( iForkAfterInput ) ) return;
+		}
+
+		ReportParametricVariants( SetupTime );
+		EndEnergyPlus();
+#else
+		ShowFatalError( "RunParametricVariants: parametric batch runs (" + cParametricDeltas + ") are only available on unix platforms." );
+#endif
+
+	}
+
+	bool
+	RunParametricBatch( int const ForkPoint ) // iForkAfterInput or iForkAfterSetup
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Runs the variants of one fork point that were not started yet. Returns true in a
+		// variant process and false in the forking process once all of them are done.
+
+		// METHODOLOGY EMPLOYED:
+		// Variants are started in input order, keeping at most NumParametricJobs running.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::NumParametricJobs;
+		using DataTimings::epElapsedTime;
+
+		// Return value
+		bool IsVariant( false );
+
+#ifdef __unix__
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int NumVariants( Variants.size() ); // number of variants in the batch
+		int NextVariant( 0 ); // next variant to be started (zero based)
+		int NumRunning( 0 ); // number of variant processes running
+		int VariantNum; // variant index (zero based)
+		std::string ExitString; // exit status for the progress display
+		pid_t PID; // process id of a finished variant
+		int Status; // wait status of a finished variant
+
+		while ( true ) {
+			while ( NumRunning < NumParametricJobs ) {
+				while ( NextVariant < NumVariants && ( Variants[ NextVariant ].ForkPoint != ForkPoint || Variants[ NextVariant ].Started ) ) ++NextVariant;
+				if ( NextVariant == NumVariants ) break;
+				if ( StartParametricVariant( NextVariant ) ) {
+					IsVariant = true;
+					return IsVariant;
+				}
+				if ( Variants[ NextVariant ].PID > 0 ) ++NumRunning;
+				++NextVariant;
+			}
+			if ( NumRunning == 0 ) break;
+
+			PID = waitpid( -1, &Status, 0 );
+			if ( PID < 0 ) {
+				if ( errno == EINTR ) continue;
+				break;
+			}
+			for ( VariantNum = 0; VariantNum < NumVariants; ++VariantNum ) {
+				if ( Variants[ VariantNum ].PID != PID ) continue;
+				Variants[ VariantNum ].PID = 0;
+				Variants[ VariantNum ].RunTime = epElapsedTime() - Variants[ VariantNum ].StartTime;
+				if ( Variants[ VariantNum ].RunTime < 0.0 ) Variants[ VariantNum ].RunTime += 24.0 * 3600.0;
+				if ( WIFEXITED( Status ) ) {
+					Variants[ VariantNum ].ExitStatus = WEXITSTATUS( Status );
+					ExitString = TrimSigDigits( Variants[ VariantNum ].ExitStatus );
+				} else {
+					ExitString = "terminated";
+				}
+				DisplayString( "Parametric variant " + Variants[ VariantNum ].Name + " finished, exit status=" + ExitString );
+				--NumRunning;
+				break;
+			}
+		}
+#endif
+
+		return IsVariant;
+
+	}
+
+	bool
+	StartSetupProcess()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Forks the setup process. Returns true in the setup process, which then simulates the
+		// base input in SetupFolder up to the setup fork point, and false in the parent.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Return value
+		bool IsSetup( false );
+
+#ifdef __unix__
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		pid_t PID; // process id returned by fork
+		int Status; // wait status of the setup process
+		int VariantNum; // variant index (zero based)
+		int NumVariants( Variants.size() ); // number of variants in the batch
+
+		RemoveSetupFolder(); // left over from an earlier batch
+		FlushCarriedFiles();
+		PID = fork();
+		if ( PID < 0 ) {
+			ShowWarningError( "RunParametricVariants: Could not start the setup process, all variants are forked after the input processing." );
+			for ( VariantNum = 0; VariantNum < NumVariants; ++VariantNum ) {
+				Variants[ VariantNum ].ForkPoint = iForkAfterInput;
+			}
+			return IsSetup;
+		}
+		if ( PID > 0 ) {
+			DisplayString( "Parametric setup process started" );
+			while ( waitpid( PID, &Status, 0 ) < 0 && errno == EINTR ) {}
+			return IsSetup;
+		}
+
+		// Setup process
+		IsSetup = true;
+		MoveToRunFolder( SetupFolder, "parametric setup process", false );
+		SetupForkPending = true;
+#endif
+
+		return IsSetup;
+
+	}
+
+	void
+	ForkParametricVariantsAfterSetup()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Runs the variants forked after the geometry and CTF setup. Called in the setup
+		// process at the end of the first heat balance initialization; returns only in a
+		// variant process, the setup process ends when its variants are done.
+
+		// METHODOLOGY EMPLOYED:
+		// A variant that changes a record retrieved before this point is not run here. The
+		// outcome of every variant of this fork point is written to the results file of the
+		// setup folder, which GatherSetupProcess reads.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+#ifdef __unix__
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int VariantNum; // variant index (zero based)
+		int NumVariants( Variants.size() ); // number of variants in the batch
+		std::vector< FieldDelta >::size_type DeltaNum; // change index (zero based)
+		std::vector< bool > HandedBack( NumVariants, false ); // true if a variant is run by the parent
+
+		SetupForkPending = false;
+
+		for ( VariantNum = 0; VariantNum < NumVariants; ++VariantNum ) {
+			if ( Variants[ VariantNum ].ForkPoint != iForkAfterSetup ) continue;
+			for ( DeltaNum = 0; DeltaNum < Variants[ VariantNum ].Deltas.size(); ++DeltaNum ) {
+				if ( ! FieldDeltaGotten( Variants[ VariantNum ].Deltas[ DeltaNum ] ) ) continue;
+				HandedBack[ VariantNum ] = true;
+				Variants[ VariantNum ].ForkPoint = iForkAfterInput;
+				break;
+			}
+		}
+
+		FlushCarriedFiles();
+		if ( RunParametricBatch( iForkAfterSetup ) ) return;
+
+		std::ofstream ResultsFile( "parametric.results", std::ios_base::trunc );
+		for ( VariantNum = 0; VariantNum < NumVariants; ++VariantNum ) {
+			if ( Variants[ VariantNum ].ForkPoint == iForkAfterSetup ) {
+				ResultsFile << VariantNum << ' ' << iForkAfterSetup << ' ' << Variants[ VariantNum ].ExitStatus << ' ' << Variants[ VariantNum ].RunTime << '\n';
+			} else if ( HandedBack[ VariantNum ] ) {
+				ResultsFile << VariantNum << ' ' << iForkAfterInput << " -1 0\n";
+			}
+		}
+		ResultsFile.close();
+		std::_Exit( ResultsFile ? EXIT_SUCCESS : EXIT_FAILURE );
+#endif
+
+	}
+
+	void
+	GatherSetupProcess()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the outcome of the variants run by the setup process and removes the setup
+		// folder.
+
+		// METHODOLOGY EMPLOYED:
+		// Variants handed back by the setup process are left to be forked after ProcessInput.
+		// If the setup process did not report a variant (it ended before the setup fork point),
+		// the variant counts as failed and the setup folder is kept for inspection.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+
+#ifdef __unix__
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int VariantNum; // variant index (zero based)
+		int NumVariants( Variants.size() ); // number of variants in the batch
+		int ForkPoint; // fork point reported for a variant
+		int ExitStatus; // exit status reported for a variant
+		Real64 RunTime; // run time reported for a variant (s)
+		bool SetupFailed( false ); // true if a variant was not reported
+
+		std::ifstream ResultsFile( SetupFolder + pathChar + "parametric.results" );
+		while ( ResultsFile >> VariantNum >> ForkPoint >> ExitStatus >> RunTime ) {
+			if ( VariantNum < 0 || VariantNum >= NumVariants ) continue;
+			if ( Variants[ VariantNum ].ForkPoint != iForkAfterSetup ) continue;
+			if ( ForkPoint == iForkAfterInput ) {
+				Variants[ VariantNum ].ForkPoint = iForkAfterInput;
+				DisplayString( "Parametric variant " + Variants[ VariantNum ].Name + " changes input read during the setup, forked after the input processing" );
+				continue;
+			}
+			Variants[ VariantNum ].Started = true;
+			Variants[ VariantNum ].ExitStatus = ExitStatus;
+			Variants[ VariantNum ].RunTime = RunTime;
+		}
+		ResultsFile.close();
+
+		for ( VariantNum = 0; VariantNum < NumVariants; ++VariantNum ) {
+			if ( Variants[ VariantNum ].ForkPoint != iForkAfterSetup || Variants[ VariantNum ].Started ) continue;
+			Variants[ VariantNum ].Started = true;
+			SetupFailed = true;
+		}
+		if ( SetupFailed ) {
+			ShowSevereError( "RunParametricVariants: The setup process did not run all of its variants, see the output in the folder " + SetupFolder );
+			return;
+		}
+		RemoveSetupFolder();
+#endif
+
+	}
+
+	void
+	RemoveSetupFolder()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Deletes the setup folder and the files in it.
+
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+
+#ifdef __unix__
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string FileName; // name of a file in the setup folder
+		DIR * Dir; // directory stream of the setup folder
+		struct dirent * Entry; // entry of the setup folder
+
+		Dir = opendir( SetupFolder.c_str() );
+		if ( Dir == nullptr ) return;
+		while ( ( Entry = readdir( Dir ) ) != nullptr ) {
+			FileName = Entry->d_name;
+			if ( FileName == "." || FileName == ".." ) continue;
+			unlink( ( SetupFolder + pathChar + FileName ).c_str() );
+		}
+		closedir( Dir );
+		rmdir( SetupFolder.c_str() );
+#endif
+
+	}
+
+	void
+	GetParametricDeltas()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the field changes of all variants from the parametric delta file and checks
+		// them against the processed input before any variant is started.
+
+		// METHODOLOGY EMPLOYED:
+		// Lines are grouped into variants by the variant name, in order of first appearance.
+		// Every change is checked with ApplyFieldDelta without changing the records, so that
+		// a bad change stops the batch instead of failing in every variant. The fork point of
+		// each variant is chosen from the object types it changes and the options of the run.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataGlobals::GoodIOStatValue;
+		using DataSystemVariables::ParametricDeltaFile;
+		using DataSystemVariables::SortedIDD;
+		using DataSystemVariables::NumRunPeriodChunks;
+		using DataSystemVariables::CheckpointDate;
+		using DataSystemVariables::RestartFile;
+		using DataSystemVariables::SharedWarmup;
+		using InputProcessor::FindItemInList;
+		using InputProcessor::FindItemInSortedList;
+		using InputProcessor::GetNumObjectsFound;
+		using InputProcessor::ListOfObjects;
+		using InputProcessor::iListOfObjects;
+		using InputProcessor::MakeUPPERCase;
+		using InputProcessor::NumObjectDefs;
+		using InputProcessor::ObjectDef;
+		using InputProcessor::SameString;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+		static gio::Fmt const fmtLD( "*" );
+		static std::string const RoutineName( "GetParametricDeltas: " );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int DeltaFile; // unit number of the delta file
+		int ReadStat; // status of a read
+		int LineNum( 0 ); // current line of the delta file
+		std::string Line; // current line of the delta file
+		std::string LineLoc; // line location for error messages
+		std::string::size_type Pos; // position of a separator
+		std::vector< std::string > Fields; // comma separated fields of a line
+		FieldDelta Delta; // change read from the current line
+		int VariantNum; // variant index (zero based)
+		int NumVariants; // number of variants
+		std::vector< FieldDelta >::size_type DeltaNum; // change index (zero based)
+		int TypeNum; // index into InputForkTypes
+		bool FileExists; // true if the delta file exists
+		bool ErrorsFound( false ); // true if any change is invalid
+		bool InputForkOnly; // true if no variant of the run can be forked after the setup
+
+		{ IOFlags flags; gio::inquire( ParametricDeltaFile, flags ); FileExists = flags.exists(); }
+		if ( ! FileExists ) {
+			ShowFatalError( RoutineName + "Could not find the parametric delta file \"" + ParametricDeltaFile + "\"." );
+		}
+		DeltaFile = GetNewUnitNumber();
+		{ IOFlags flags; flags.ACTION( "read" ); gio::open( DeltaFile, ParametricDeltaFile, flags ); ReadStat = flags.ios(); }
+		if ( ReadStat != 0 ) {
+			ShowFatalError( RoutineName + "Could not open the parametric delta file \"" + ParametricDeltaFile + "\" for input (read)." );
+		}
+
+		while ( true ) {
+			{ IOFlags flags; gio::read( DeltaFile, fmtA, flags ) >> Line; ReadStat = flags.ios(); }
+			if ( ReadStat < GoodIOStatValue ) break;
+			++LineNum;
+			LineLoc = ParametricDeltaFile + ", line " + TrimSigDigits( LineNum );
+			Pos = index( Line, '!' );
+			if ( Pos != std::string::npos ) Line.erase( Pos );
+			strip( Line );
+			if ( Line.empty() ) continue;
+
+			Fields.clear();
+			while ( true ) {
+				Pos = index( Line, ',' );
+				if ( Pos == std::string::npos ) {
+					Fields.push_back( stripped( Line ) );
+					break;
+				}
+				Fields.push_back( stripped( Line.substr( 0, Pos ) ) );
+				Line.erase( 0, Pos + 1 );
+			}
+			if ( Fields.size() != 5 ) {
+				ShowSevereError( RoutineName + LineLoc + ": expected VariantName, ObjectType, ObjectName, FieldNumber, Value." );
+				ErrorsFound = true;
+				continue;
+			}
+			if ( Fields[ 0 ].empty() || Fields[ 0 ][ 0 ] == '.' || Fields[ 0 ].find_first_of( "/\\:" ) != std::string::npos ) {
+				ShowSevereError( RoutineName + LineLoc + ": invalid variant name=\"" + Fields[ 0 ] + "\", it is used as a folder name." );
+				ErrorsFound = true;
+				continue;
+			}
+
+			Delta = FieldDelta();
+			Delta.LineNumber = LineNum;
+			Delta.ObjectType = MakeUPPERCase( Fields[ 1 ] );
+			if ( SortedIDD ) {
+				Delta.ObjectDefNum = FindItemInSortedList( Delta.ObjectType, ListOfObjects, NumObjectDefs );
+				if ( Delta.ObjectDefNum != 0 ) Delta.ObjectDefNum = iListOfObjects( Delta.ObjectDefNum );
+			} else {
+				Delta.ObjectDefNum = FindItemInList( Delta.ObjectType, ListOfObjects, NumObjectDefs );
+			}
+			if ( Delta.ObjectDefNum == 0 ) {
+				ShowSevereError( RoutineName + LineLoc + ": object type=\"" + Fields[ 1 ] + "\" is not in the IDD." );
+				ErrorsFound = true;
+				continue;
+			}
+			Delta.ObjectName = ( Fields[ 2 ].empty() ? "*" : Fields[ 2 ] );
+			{ IOFlags flags; gio::read( Fields[ 3 ], fmtLD, flags ) >> Delta.FieldNumber; ReadStat = flags.ios(); }
+			if ( ReadStat != 0 || Delta.FieldNumber < 1 || Delta.FieldNumber > ObjectDef( Delta.ObjectDefNum ).NumParams ) {
+				ShowSevereError( RoutineName + LineLoc + ": invalid field number=\"" + Fields[ 3 ] + "\" for object type=" + ObjectDef( Delta.ObjectDefNum ).Name + '.' );
+				ShowContinueError( "...Fields are numbered from 1 to " + TrimSigDigits( ObjectDef( Delta.ObjectDefNum ).NumParams ) + " for this object type." );
+				ErrorsFound = true;
+				continue;
+			}
+			Delta.Value = Fields[ 4 ];
+
+			NumVariants = Variants.size();
+			for ( VariantNum = 0; VariantNum < NumVariants; ++VariantNum ) {
+				if ( SameString( Variants[ VariantNum ].Name, Fields[ 0 ] ) ) break;
+			}
+			if ( VariantNum == NumVariants ) {
+				Variants.push_back( ParametricVariant() );
+				Variants.back().Name = Fields[ 0 ];
+			}
+			Variants[ VariantNum ].Deltas.push_back( Delta );
+		}
+		gio::close( DeltaFile );
+
+		NumVariants = Variants.size();
+		for ( VariantNum = 0; VariantNum < NumVariants; ++VariantNum ) {
+			for ( DeltaNum = 0; DeltaNum < Variants[ VariantNum ].Deltas.size(); ++DeltaNum ) {
+				if ( ApplyFieldDelta( Variants[ VariantNum ].Deltas[ DeltaNum ], true, ErrorsFound ) == 0 ) {
+					ShowSevereError( RoutineName + ParametricDeltaFile + ", line " + TrimSigDigits( Variants[ VariantNum ].Deltas[ DeltaNum ].LineNumber ) + ": no " + Variants[ VariantNum ].Deltas[ DeltaNum ].ObjectType + " object named \"" + Variants[ VariantNum ].Deltas[ DeltaNum ].ObjectName + "\" has this field in the input." );
+					ErrorsFound = true;
+				}
+			}
+		}
+
+		if ( NumVariants == 0 && ! ErrorsFound ) {
+			ShowSevereError( RoutineName + "No variants found in the parametric delta file \"" + ParametricDeltaFile + "\"." );
+			ErrorsFound = true;
+		}
+		if ( ErrorsFound ) {
+			ShowFatalError( RoutineName + "Errors found in the parametric delta file. Program terminates." );
+		}
+
+		// Runs whose setup cannot be shared by forked processes fork every variant after ProcessInput
+		InputForkOnly = ( NumRunPeriodChunks > 1 || ! CheckpointDate.empty() || ! RestartFile.empty() || SharedWarmup );
+		if ( GetNumObjectsFound( "Output:SQLite" ) > 0 || GetNumObjectsFound( "ExternalInterface" ) > 0 ) InputForkOnly = true;
+		for ( VariantNum = 0; VariantNum < NumVariants; ++VariantNum ) {
+			if ( InputForkOnly ) {
+				Variants[ VariantNum ].ForkPoint = iForkAfterInput;
+				continue;
+			}
+			for ( DeltaNum = 0; DeltaNum < Variants[ VariantNum ].Deltas.size(); ++DeltaNum ) {
+				for ( TypeNum = 1; TypeNum <= NumInputForkTypes; ++TypeNum ) {
+					if ( has_prefix( Variants[ VariantNum ].Deltas[ DeltaNum ].ObjectType, InputForkTypes( TypeNum ) ) ) Variants[ VariantNum ].ForkPoint = iForkAfterInput;
+				}
+			}
+		}
+
+	}
+
+	bool
+	FieldDeltaGotten( FieldDelta const & Delta ) // Field change to be checked
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if a record changed by a field change has already been retrieved by a
+		// GetInput routine, so that changing it now would have no effect.
+
+		// METHODOLOGY EMPLOYED:
+		// The records are selected as in ApplyFieldDelta and checked with IDFRecordsGotten.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using InputProcessor::IDFRecords;
+		using InputProcessor::IDFRecordsGotten;
+		using InputProcessor::ObjectRecordList;
+		using InputProcessor::ObjectRecordStart;
+		using InputProcessor::SameString;
+
+		// Return value
+		bool Gotten( false );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int RecPos; // position in ObjectRecordList
+		int RecNum; // IDF record index
+
+		for ( RecPos = ObjectRecordStart( Delta.ObjectDefNum ); RecPos < ObjectRecordStart( Delta.ObjectDefNum + 1 ); ++RecPos ) {
+			RecNum = ObjectRecordList( RecPos );
+			if ( Delta.ObjectName != "*" ) {
+				if ( IDFRecords( RecNum ).NumAlphas < 1 ) continue;
+				if ( ! SameString( IDFRecords( RecNum ).Alphas( 1 ), Delta.ObjectName ) ) continue;
+			}
+			if ( IDFRecordsGotten( RecNum ) ) {
+				Gotten = true;
+				break;
+			}
+		}
+
+		return Gotten;
+
+	}
+
+	int
+	ApplyFieldDelta(
+		FieldDelta const & Delta, // Field change to be applied
+		bool const CheckOnly, // True to check the change without changing the records
+		bool & ErrorsFound // Set to true if the change is invalid
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sets one field of the processed IDF records of an object type, for one named object
+		// or for all objects of the type. Returns the number of records that have the field.
+
+		// METHODOLOGY EMPLOYED:
+		// The IDD field number is turned into an alpha or numeric argument number with the
+		// AlphaOrNumeric flags of the object definition. Numeric values are converted the way
+		// ProcessInputDataFile converts them, including autosize and autocalculate; alpha
+		// values are upper cased unless the field retains case. A field that is not present
+		// on a record (beyond its last entered field) is not added.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using InputProcessor::IDFRecords;
+		using InputProcessor::MakeUPPERCase;
+		using InputProcessor::ObjectDef;
+		using InputProcessor::ObjectRecordList;
+		using InputProcessor::ObjectRecordStart;
+		using InputProcessor::ProcessNumber;
+		using InputProcessor::SameString;
+
+		// Return value
+		int NumFound( 0 );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "ApplyFieldDelta: " );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Found( Delta.ObjectDefNum ); // object definition of the change
+		bool IsAlpha; // true if the field is an alpha field
+		int ArgNum( 0 ); // alpha or numeric argument number of the field
+		int FieldNum; // field counter
+		int RecPos; // position in ObjectRecordList
+		int RecNum; // IDF record index
+		Real64 NumValue( 0.0 ); // value of a numeric field
+		std::string UCValue; // upper case value
+		bool ErrFlag( false ); // true if a numeric value cannot be processed
+
+		IsAlpha = ObjectDef( Found ).AlphaOrNumeric( Delta.FieldNumber );
+		for ( FieldNum = 1; FieldNum <= Delta.FieldNumber; ++FieldNum ) {
+			if ( ObjectDef( Found ).AlphaOrNumeric( FieldNum ) == IsAlpha ) ++ArgNum;
+		}
+
+		UCValue = MakeUPPERCase( Delta.Value );
+		if ( ! IsAlpha ) {
+			if ( UCValue.empty() ) {
+				ErrFlag = true;
+			} else if ( UCValue == "AUTOSIZE" && ObjectDef( Found ).NumRangeChks( ArgNum ).AutoSizable ) {
+				NumValue = ObjectDef( Found ).NumRangeChks( ArgNum ).AutoSizeValue;
+			} else if ( UCValue == "AUTOCALCULATE" && ObjectDef( Found ).NumRangeChks( ArgNum ).AutoCalculatable ) {
+				NumValue = ObjectDef( Found ).NumRangeChks( ArgNum ).AutoCalculateValue;
+			} else {
+				NumValue = ProcessNumber( UCValue, ErrFlag );
+			}
+			if ( ErrFlag ) {
+				ShowSevereError( RoutineName + "Invalid value=\"" + Delta.Value + "\" for numeric field " + TrimSigDigits( Delta.FieldNumber ) + " (" + ObjectDef( Found ).NumRangeChks( ArgNum ).FieldName + ") of " + ObjectDef( Found ).Name + '.' );
+				ErrorsFound = true;
+				return NumFound;
+			}
+		}
+
+		for ( RecPos = ObjectRecordStart( Found ); RecPos < ObjectRecordStart( Found + 1 ); ++RecPos ) {
+			RecNum = ObjectRecordList( RecPos );
+			if ( Delta.ObjectName != "*" ) {
+				if ( IDFRecords( RecNum ).NumAlphas < 1 ) continue;
+				if ( ! SameString( IDFRecords( RecNum ).Alphas( 1 ), Delta.ObjectName ) ) continue;
+			}
+			if ( IsAlpha ) {
+				if ( ArgNum > IDFRecords( RecNum ).NumAlphas ) continue;
+				++NumFound;
+				if ( CheckOnly ) continue;
+				if ( Delta.Value.empty() ) {
+					IDFRecords( RecNum ).Alphas( ArgNum ) = ObjectDef( Found ).AlphFieldDefs( ArgNum );
+				} else if ( ObjectDef( Found ).AlphRetainCase( ArgNum ) ) {
+					IDFRecords( RecNum ).Alphas( ArgNum ) = Delta.Value;
+				} else {
+					IDFRecords( RecNum ).Alphas( ArgNum ) = UCValue;
+				}
+				IDFRecords( RecNum ).AlphBlank( ArgNum ) = Delta.Value.empty();
+			} else {
+				if ( ArgNum > IDFRecords( RecNum ).NumNumbers ) continue;
+				++NumFound;
+				if ( CheckOnly ) continue;
+				IDFRecords( RecNum ).Numbers( ArgNum ) = NumValue;
+				IDFRecords( RecNum ).NumBlank( ArgNum ) = false;
+			}
+		}
+
+		return NumFound;
+
+	}
+
+	bool
+	StartParametricVariant( int const VariantNum ) // Index into Variants (zero based)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Forks the process of one variant. Returns true in the variant process, which is then
+		// running in the variant folder with the variant input in place, and false in the parent.
+
+		// METHODOLOGY EMPLOYED:
+		// The variant process moves into its folder with MoveToRunFolder and then changes the
+		// processed IDF records. A variant forked by the setup process takes all output written
+		// so far in the setup folder with it, and its folder is next to the setup folder.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+		using DataTimings::epElapsedTime;
+
+		// Return value
+		bool IsVariant( false );
+
+#ifdef __unix__
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		pid_t PID; // process id returned by fork
+		bool ErrorsFound( false ); // true if a change could not be applied
+		std::vector< FieldDelta >::size_type DeltaNum; // change index (zero based)
+
+		Variants[ VariantNum ].Started = true;
+		PID = fork();
+		if ( PID < 0 ) {
+			ShowSevereError( "RunParametricVariants: Could not start the process for variant=" + Variants[ VariantNum ].Name );
+			return IsVariant;
+		}
+		if ( PID > 0 ) {
+			Variants[ VariantNum ].PID = PID;
+			Variants[ VariantNum ].StartTime = epElapsedTime();
+			DisplayString( "Parametric variant " + Variants[ VariantNum ].Name + " started" );
+			return IsVariant;
+		}
+
+		// Variant process
+		IsVariant = true;
+		VariantName = Variants[ VariantNum ].Name;
+		if ( Variants[ VariantNum ].ForkPoint == iForkAfterSetup ) {
+			MoveToRunFolder( ".." + std::string( 1, pathChar ) + VariantName, "variant " + VariantName, true );
+		} else {
+			MoveToRunFolder( VariantName, "variant " + VariantName, false );
+		}
+
+		for ( DeltaNum = 0; DeltaNum < Variants[ VariantNum ].Deltas.size(); ++DeltaNum ) {
+			ApplyFieldDelta( Variants[ VariantNum ].Deltas[ DeltaNum ], false, ErrorsFound );
+		}
+		if ( ErrorsFound ) {
+			ShowFatalError( "RunParametricVariants: Errors found applying the field changes of variant=" + VariantName );
+		}
+		ShowMessage( "Parametric variant=" + VariantName + ", " + TrimSigDigits( int( Variants[ VariantNum ].Deltas.size() ) ) + " field changes applied to the base input." );
+#endif
+
+		return IsVariant;
+
+	}
+
+	void
+	FlushCarriedFiles()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Flushes the output files written so far before processes are forked, so that no
+		// buffered output is duplicated into the forked processes.
+
+		// METHODOLOGY EMPLOYED:
+		// Each open carried file is closed and reopened for append.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int FileNum; // index into CarriedFiles
+		int Unit; // unit number of a carried file
+		bool Opened; // true if a carried file is open
+
+		for ( FileNum = 1; FileNum <= NumCarriedFiles; ++FileNum ) {
+			{ IOFlags flags; gio::inquire( CarriedFiles( FileNum ), flags ); Opened = flags.open(); }
+			if ( ! Opened ) continue;
+			Unit = FindUnitNumber( CarriedFiles( FileNum ) );
+			gio::close( Unit );
+			{ IOFlags flags; flags.POSITION( "APPEND" ); gio::open( Unit, CarriedFiles( FileNum ), flags ); }
+		}
+		std::cout.flush();
+		std::cerr.flush();
+
+	}
+
+	void
+	MoveToRunFolder(
+		std::string const & FolderName, // Folder of the forked process, relative to the current folder
+		std::string const & RunName, // Description of the forked process for messages
+		bool const CopyOutput // True to copy all output files of the current folder
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       October 2014, output of the setup process
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Moves a forked process into its own folder, so that all of its output is written there.
+
+		// METHODOLOGY EMPLOYED:
+		// The process closes the inherited output files, moves into its folder, copies the
+		// output written so far into it and reopens the files there for append. The output
+		// copied is that of ProcessInput and any other carried file the process has open or,
+		// with CopyOutput, every file of the base folder.
+		// The input files of the base folder (in.* and Energy+.ini) are linked into the folder
+		// so that the weather file and other inputs opened later are found. Any failure to set
+		// up the folder ends the process with a nonzero exit status.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataStringGlobals::CurrentWorkingFolder;
+		using DataStringGlobals::pathChar;
+
+#ifdef __unix__
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray1D_int CarriedUnit( NumCarriedFiles, 0 ); // unit number of an open carried file
+		int FileNum; // index into CarriedFiles
+		bool Opened; // true if a carried file is open
+		char Folder[ 4096 ]; // current working directory
+		std::string BaseFolder; // folder of the forking process
+		std::string FileName; // name of a file in the base folder
+		DIR * BaseDir; // directory stream of the base folder
+		struct dirent * Entry; // entry of the base folder
+		struct stat FileStat; // status of a file in the base folder
+
+		for ( FileNum = 1; FileNum <= NumCarriedFiles; ++FileNum ) {
+			{ IOFlags flags; gio::inquire( CarriedFiles( FileNum ), flags ); Opened = flags.open(); }
+			if ( ! Opened ) continue;
+			CarriedUnit( FileNum ) = FindUnitNumber( CarriedFiles( FileNum ) );
+			gio::close( CarriedUnit( FileNum ) );
+		}
+
+		if ( getcwd( Folder, sizeof( Folder ) ) == nullptr ) {
+			std::cerr << "EnergyPlus " << RunName << ": could not get the current folder." << std::endl;
+			std::_Exit( EXIT_FAILURE );
+		}
+		BaseFolder = Folder;
+		if ( mkdir( FolderName.c_str(), 0777 ) != 0 && errno != EEXIST ) {
+			std::cerr << "EnergyPlus " << RunName << ": could not create the folder " << FolderName << '.' << std::endl;
+			std::_Exit( EXIT_FAILURE );
+		}
+		if ( chdir( FolderName.c_str() ) != 0 ) {
+			std::cerr << "EnergyPlus " << RunName << ": could not move to the folder " << FolderName << '.' << std::endl;
+			std::_Exit( EXIT_FAILURE );
+		}
+		CurrentWorkingFolder = BaseFolder + pathChar + FolderName + pathChar;
+
+		for ( FileNum = 1; FileNum <= NumCarriedFiles; ++FileNum ) {
+			if ( FileNum > NumInputCarriedFiles && CarriedUnit( FileNum ) == 0 && ! CopyOutput ) continue;
+			std::ifstream BaseFile( BaseFolder + pathChar + CarriedFiles( FileNum ), std::ios_base::binary );
+			if ( BaseFile ) {
+				std::ofstream RunFile( CarriedFiles( FileNum ), std::ios_base::binary | std::ios_base::trunc );
+				RunFile << BaseFile.rdbuf();
+			}
+			if ( CarriedUnit( FileNum ) == 0 ) continue;
+			{ IOFlags flags; flags.POSITION( "APPEND" ); gio::open( CarriedUnit( FileNum ), CarriedFiles( FileNum ), flags ); }
+		}
+
+		BaseDir = opendir( BaseFolder.c_str() );
+		if ( BaseDir != nullptr ) {
+			while ( ( Entry = readdir( BaseDir ) ) != nullptr ) {
+				FileName = Entry->d_name;
+				if ( has_prefix( FileName, "in." ) || FileName == "Energy+.ini" ) {
+					unlink( FileName.c_str() );
+					if ( symlink( ( BaseFolder + pathChar + FileName ).c_str(), FileName.c_str() ) != 0 ) {
+						ShowWarningError( "MoveToRunFolder: Could not link input file \"" + FileName + "\" into the folder of " + RunName );
+					}
+				} else if ( CopyOutput && ! any_eq( CarriedFiles, FileName ) ) {
+					if ( stat( ( BaseFolder + pathChar + FileName ).c_str(), &FileStat ) != 0 || ! S_ISREG( FileStat.st_mode ) ) continue;
+					std::ifstream BaseFile( BaseFolder + pathChar + FileName, std::ios_base::binary );
+					std::ofstream RunFile( FileName, std::ios_base::binary | std::ios_base::trunc );
+					RunFile << BaseFile.rdbuf();
+				}
+			}
+			closedir( BaseDir );
+		}
+#endif
+
+	}
+
+	void
+	ReportParametricVariants( Real64 const SetupTime ) // Time spent before the first variant was started (s)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the outcome of each variant of a parametric batch to the audit file of the
+		// parent and reports failed variants as severe errors.
+
+		// Using/Aliasing
+		using DataSystemVariables::ParametricDeltaFile;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int EchoInputFile; // found unit number for "eplusout.audit"
+		int VariantNum; // variant index (zero based)
+		int NumVariants( Variants.size() ); // number of variants
+		int NumFailed( 0 ); // number of variants that did not end with a zero exit status
+
+		EchoInputFile = FindUnitNumber( "eplusout.audit" );
+
+		gio::write( EchoInputFile, fmtA ) << "Parametric Batch,Delta File,#Variants,Input Processing Time {s}";
+		gio::write( EchoInputFile, fmtA ) << "Parametric Batch," + ParametricDeltaFile + ',' + TrimSigDigits( NumVariants ) + ',' + RoundSigDigits( SetupTime, 2 );
+		gio::write( EchoInputFile, fmtA ) << "Parametric Variant,Name,#Field Changes,Fork Point,Exit Status,Run Time {s}";
+		for ( VariantNum = 0; VariantNum < NumVariants; ++VariantNum ) {
+			gio::write( EchoInputFile, fmtA ) << "Parametric Variant," + Variants[ VariantNum ].Name + ',' + TrimSigDigits( int( Variants[ VariantNum ].Deltas.size() ) ) + ',' + ( Variants[ VariantNum ].ForkPoint == iForkAfterSetup ? "Setup" : "Input" ) + ',' + TrimSigDigits( Variants[ VariantNum ].ExitStatus ) + ',' + RoundSigDigits( Variants[ VariantNum ].RunTime, 2 );
+			if ( Variants[ VariantNum ].ExitStatus != 0 ) {
+				ShowSevereError( "RunParametricVariants: Variant=" + Variants[ VariantNum ].Name + " did not complete successfully, see the output in its folder." );
+				++NumFailed;
+			}
+		}
+		ShowMessage( "Parametric batch: " + TrimSigDigits( NumVariants - NumFailed ) + " of " + TrimSigDigits( NumVariants ) + " variants completed successfully." );
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in EnergyPlus.f90.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // ParametricRuns
+
+} // EnergyPlus
@@ -0,0 +1,130 @@
+#ifndef ParametricRuns_hh_INCLUDED
+#define ParametricRuns_hh_INCLUDED
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace ParametricRuns {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern int const NumCarriedFiles; // Number of output files carried into each variant folder
+	extern int const NumInputCarriedFiles; // Number of those written by ProcessInput
+	extern int const iForkAfterInput; // Variant forked after ProcessInput
+	extern int const iForkAfterSetup; // Variant forked after the geometry and CTF setup
+	extern std::string const SetupFolder; // Folder of the process that runs to the setup fork point
+
+	// DERIVED TYPE DEFINITIONS
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern std::string VariantName; // Variant simulated by this process (blank in the batch parent)
+	extern bool SetupForkPending; // True in the setup process until the setup fork point
+
+	// Types
+
+	struct FieldDelta
+	{
+		// Members
+		std::string ObjectType; // Object type (upper case)
+		std::string ObjectName; // Name (first alpha) of the object, "*" for all objects of the type
+		int FieldNumber; // Field number in the IDD definition of the object (first field = 1)
+		std::string Value; // New value of the field
+		int ObjectDefNum; // Object definition of ObjectType
+		int LineNumber; // Line of the delta file
+
+		// Default Constructor
+		FieldDelta() :
+			FieldNumber( 0 ),
+			ObjectDefNum( 0 ),
+			LineNumber( 0 )
+		{}
+
+	};
+
+	struct ParametricVariant
+	{
+		// Members
+		std::string Name; // Name of the variant, also its output folder
+		std::vector< FieldDelta > Deltas; // Field changes applied to the base input
+		int ForkPoint; // iForkAfterInput or iForkAfterSetup
+		bool Started; // True once the variant process was started (or could not be)
+		int PID; // Process id while the variant is running
+		int ExitStatus; // Exit status of the variant process (-1 = did not run to an exit)
+		Real64 StartTime; // Elapsed time when the variant was started (s)
+		Real64 RunTime; // Wall clock time of the variant (s)
+
+		// Default Constructor
+		ParametricVariant() :
+			ForkPoint( iForkAfterSetup ),
+			Started( false ),
+			PID( 0 ),
+			ExitStatus( -1 ),
+			StartTime( 0.0 ),
+			RunTime( 0.0 )
+		{}
+
+	};
+
+	// Object Data
+	extern std::vector< ParametricVariant > Variants;
+
+	// Functions
+
+	void
+	RunParametricVariants();
+
+	bool
+	RunParametricBatch( int const ForkPoint ); // iForkAfterInput or iForkAfterSetup
+
+	void
+	ForkParametricVariantsAfterSetup();
+
+	bool
+	StartSetupProcess();
+
+	void
+	GatherSetupProcess();
+
+	void
+	RemoveSetupFolder();
+
+	void
+	GetParametricDeltas();
+
+	bool
+	FieldDeltaGotten( FieldDelta const & Delta ); // Field change to be checked
+
+	int
+	ApplyFieldDelta(
+		FieldDelta const & Delta, // Field change to be applied
+		bool const CheckOnly, // True to check the change without changing the records
+		bool & ErrorsFound // Set to true if the change is invalid
+	);
+
+	bool
+	StartParametricVariant( int const VariantNum ); // Index into Variants (zero based)
+
+	void
+	FlushCarriedFiles();
+
+	void
+	MoveToRunFolder(
+		std::string const & FolderName, // Folder of the forked process, relative to the current folder
+		std::string const & RunName, // Description of the forked process for messages
+		bool const CopyOutput // True to copy all output files of the current folder
+	);
+
+	void
+	ReportParametricVariants( Real64 const SetupTime ); // Time spent before the first variant was started (s)
+
+} // ParametricRuns
+
+} // EnergyPlus
+
+#endif
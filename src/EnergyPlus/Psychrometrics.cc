@@ -20,9 +20,13 @@ namespace EnergyPlus {
 #ifdef EP_nocache_Psychrometrics
 #undef EP_cache_PsyTwbFnTdbWPb
 #undef EP_cache_PsyPsatFnTemp
+#undef EP_cache_PsyTsatFnPb
+#undef EP_cache_PsyTsatFnHPb
 #else
 #define EP_cache_PsyTwbFnTdbWPb
 #define EP_cache_PsyPsatFnTemp
+#define EP_cache_PsyTsatFnPb
+#define EP_cache_PsyTsatFnHPb
 #endif
 #define EP_psych_errors
 
@@ -84,12 +88,18 @@ namespace Psychrometrics {
 	int const iPsyRhFnTdbRhovLBnd0C( 13 );
 	int const iPsyTwbFnTdbWPb_cache( 18 );
 	int const iPsyPsatFnTemp_cache( 19 );
-	int const NumPsychMonitors( 19 ); // Parameterization of Number of psychrometric routines that
+	int const iPsyTsatFnPb_cache( 20 );
+	int const iPsyTsatFnHPb_cache( 21 );
+	int const iPsyRhoAirFnPbTdbW_arr( 22 );
+	int const iPsyHFnTdbW_arr( 23 );
+	int const iPsyCpAirFnWTdb_arr( 24 );
+	int const iPsyWFnTdbRhPb_arr( 25 );
+	int const NumPsychMonitors( 25 ); // Parameterization of Number of psychrometric routines that
 	std::string const blank_string;
 #ifdef EP_psych_stats
-	FArray1D_string const PsyRoutineNames( NumPsychMonitors, { "PsyTdpFnTdbTwbPb", "PsyRhFnTdbWPb", "PsyTwbFnTdbWPb", "PsyVFnTdbWPb", "PsyWFnTdpPb", "PsyWFnTdbH", "PsyWFnTdbTwbPb", "PsyWFnTdbRhPb", "PsyPsatFnTemp", "PsyTsatFnHPb", "PsyTsatFnPb", "PsyRhFnTdbRhov", "PsyRhFnTdbRhovLBnd0C", "PsyTwbFnTdbWPb", "PsyTwbFnTdbWPb", "PsyWFnTdbTwbPb", "PsyTsatFnPb", "PsyTwbFnTdbWPb_cache", "PsyPsatFnTemp_cache" } ); // 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | 10 | 11 | 12 | 13 | 14 - HR | 15 - max iter | 16 - HR | 17 - max iter | 18 - PsyTwbFnTdbWPb_raw (raw calc) | 19 - PsyPsatFnTemp_raw (raw calc)
+	FArray1D_string const PsyRoutineNames( NumPsychMonitors, { "PsyTdpFnTdbTwbPb", "PsyRhFnTdbWPb", "PsyTwbFnTdbWPb", "PsyVFnTdbWPb", "PsyWFnTdpPb", "PsyWFnTdbH", "PsyWFnTdbTwbPb", "PsyWFnTdbRhPb", "PsyPsatFnTemp", "PsyTsatFnHPb", "PsyTsatFnPb", "PsyRhFnTdbRhov", "PsyRhFnTdbRhovLBnd0C", "PsyTwbFnTdbWPb", "PsyTwbFnTdbWPb", "PsyWFnTdbTwbPb", "PsyTsatFnPb", "PsyTwbFnTdbWPb_cache", "PsyPsatFnTemp_cache", "PsyTsatFnPb_cache", "PsyTsatFnHPb_cache", "PsyRhoAirFnPbTdbW_arr", "PsyHFnTdbW_arr", "PsyCpAirFnWTdb_arr", "PsyWFnTdbRhPb_arr" } ); // 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | 10 | 11 | 12 | 13 | 14 - HR | 15 - max iter | 16 - HR | 17 - max iter | 18 - PsyTwbFnTdbWPb_raw (raw calc) | 19 - PsyPsatFnTemp_raw (raw calc) | 20 - PsyTsatFnPb_raw (raw calc) | 21 - PsyTsatFnHPb_raw (raw calc) | 22-25 - array versions (iterations = elements)
 
-	FArray1D_bool const PsyReportIt( NumPsychMonitors, { true, true, true, true, true, true, true, true, true, true, true, true, true, false, false, false, false, true, true } ); // PsyTdpFnTdbTwbPb     1 | PsyRhFnTdbWPb        2 | PsyTwbFnTdbWPb       3 | PsyVFnTdbWPb         4 | PsyWFnTdpPb          5 | PsyWFnTdbH           6 | PsyWFnTdbTwbPb       7 | PsyWFnTdbRhPb        8 | PsyPsatFnTemp        9 | PsyTsatFnHPb         10 | PsyTsatFnPb          11 | PsyRhFnTdbRhov       12 | PsyRhFnTdbRhovLBnd0C 13 | PsyTwbFnTdbWPb       14 - HR | PsyTwbFnTdbWPb       15 - max iter | PsyWFnTdbTwbPb       16 - HR | PsyTsatFnPb          17 - max iter | PsyTwbFnTdbWPb_cache 18 - PsyTwbFnTdbWPb_raw (raw calc) | PsyPsatFnTemp_cache  19 - PsyPsatFnTemp_raw (raw calc)
+	FArray1D_bool const PsyReportIt( NumPsychMonitors, { true, true, true, true, true, true, true, true, true, true, true, true, true, false, false, false, false, true, true, true, true, true, true, true, true } ); // PsyTdpFnTdbTwbPb     1 | PsyRhFnTdbWPb        2 | PsyTwbFnTdbWPb       3 | PsyVFnTdbWPb         4 | PsyWFnTdpPb          5 | PsyWFnTdbH           6 | PsyWFnTdbTwbPb       7 | PsyWFnTdbRhPb        8 | PsyPsatFnTemp        9 | PsyTsatFnHPb         10 | PsyTsatFnPb          11 | PsyRhFnTdbRhov       12 | PsyRhFnTdbRhovLBnd0C 13 | PsyTwbFnTdbWPb       14 - HR | PsyTwbFnTdbWPb       15 - max iter | PsyWFnTdbTwbPb       16 - HR | PsyTsatFnPb          17 - max iter | PsyTwbFnTdbWPb_cache 18 - PsyTwbFnTdbWPb_raw (raw calc) | PsyPsatFnTemp_cache  19 - PsyPsatFnTemp_raw (raw calc) | PsyTsatFnPb_cache    20 - PsyTsatFnPb_raw (raw calc) | PsyTsatFnHPb_cache   21 - PsyTsatFnHPb_raw (raw calc) | PsyRhoAirFnPbTdbW_arr 22 | PsyHFnTdbW_arr       23 | PsyCpAirFnWTdb_arr   24 | PsyWFnTdbRhPb_arr    25
 #endif
 
 #ifndef EP_psych_errors
@@ -105,6 +115,15 @@ namespace Psychrometrics {
 	int const psatprecision_bits( 24 ); // 28  // 24  // 32
 	Int64 const psatcache_mask( psatcache_size - 1 );
 #endif
+#ifdef EP_cache_PsyTsatFnPb
+	int const tsatcache_size( 1024 * 1024 );
+	int const tsatprecision_bits( 24 );
+	Int64 const tsatcache_mask( tsatcache_size - 1 );
+#endif
+#ifdef EP_cache_PsyTsatFnHPb
+	int const tsathcache_size( 1024 * 1024 );
+	int const tsathprecision_bits( 20 );
+#endif
 
 	// MODULE VARIABLE DECLARATIONS:
 	// na
@@ -115,7 +134,7 @@ namespace Psychrometrics {
 	FArray1D_int iPsyErrIndex( NumPsychMonitors, NumPsychMonitors * 0 ); // Number of times error occurred
 #ifdef EP_psych_stats
 	FArray1D< Int64 > NumTimesCalled( NumPsychMonitors, NumPsychMonitors * 0 );
-	FArray1D_int NumIterations( NumPsychMonitors, NumPsychMonitors * 0 );
+	FArray1D< Int64 > NumIterations( NumPsychMonitors, NumPsychMonitors * 0 );
 #endif
 
 	// Object Data
@@ -125,6 +144,12 @@ namespace Psychrometrics {
 #ifdef EP_cache_PsyPsatFnTemp
 	FArray1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size)
 #endif
+#ifdef EP_cache_PsyTsatFnPb
+	FArray1D< cached_tsat_t > cached_Tsat; // DIMENSION(0:tsatcache_size)
+#endif
+#ifdef EP_cache_PsyTsatFnHPb
+	FArray1D< cached_tsath_t > cached_TsatH; // DIMENSION(0:tsathcache_size)
+#endif
 
 	// Subroutine Specifications for the Module
 
@@ -173,6 +198,12 @@ namespace Psychrometrics {
 #ifdef EP_cache_PsyPsatFnTemp
 		cached_Psat.allocate( {0,psatcache_size} );
 #endif
+#ifdef EP_cache_PsyTsatFnPb
+		cached_Tsat.allocate( {0,tsatcache_size} );
+#endif
+#ifdef EP_cache_PsyTsatFnHPb
+		cached_TsatH.allocate( {0,tsathcache_size} );
+#endif
 
 	}
 
@@ -892,12 +923,86 @@ namespace Psychrometrics {
 	}
 #endif
 
+#ifdef EP_cache_PsyTsatFnHPb
+
 	Real64
 	PsyTsatFnHPb(
 		Real64 const H, // enthalpy {J/kg}
 		Real64 const PB, // barometric pressure {Pascals}
 		std::string const & CalledFrom // routine this function was called from (error messages)
 	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Provide a "cache" of results for the given arguments and saturation temperature output result.
+
+		// METHODOLOGY EMPLOYED:
+		// Use grid shifting and masking to provide hash into the cache, as in PsyTwbFnTdbWPb.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		Int64 const Grid_Shift( ( 64 - 12 - tsathprecision_bits ) );
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Int64 H_tag;
+		Int64 Pb_tag;
+		Int64 hash;
+		Real64 H_tag_r;
+		Real64 Pb_tag_r;
+
+#ifdef EP_psych_stats
+		++NumTimesCalled( iPsyTsatFnHPb_cache );
+#endif
+
+		H_tag = TRANSFER( H, H_tag );
+		Pb_tag = TRANSFER( PB, Pb_tag );
+
+		H_tag = bit::bit_shift( H_tag, -Grid_Shift );
+		Pb_tag = bit::bit_shift( Pb_tag, -Grid_Shift );
+		hash = bit::bit_and( bit::bit_xor( H_tag, Pb_tag ), Int64( tsathcache_size - 1 ) );
+
+		auto & cTsat( cached_TsatH( hash ) );
+		if ( cTsat.iH != H_tag || cTsat.iPb != Pb_tag ) {
+			cTsat.iH = H_tag;
+			cTsat.iPb = Pb_tag;
+
+			H_tag_r = TRANSFER( bit::bit_shift( H_tag, Grid_Shift ), H_tag_r );
+			Pb_tag_r = TRANSFER( bit::bit_shift( Pb_tag, Grid_Shift ), Pb_tag_r );
+
+			cTsat.Tsat = PsyTsatFnHPb_raw( H_tag_r, Pb_tag_r, CalledFrom );
+		}
+
+		return cTsat.Tsat; // saturation temperature {C}
+
+	}
+
+	Real64
+	PsyTsatFnHPb_raw(
+		Real64 const H, // enthalpy {J/kg}
+		Real64 const PB, // barometric pressure {Pascals}
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+
+#else
+
+	Real64
+	PsyTsatFnHPb(
+		Real64 const H, // enthalpy {J/kg}
+		Real64 const PB, // barometric pressure {Pascals}
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+#endif
 	{
 
 		// FUNCTION INFORMATION:
@@ -1228,11 +1333,19 @@ Label170: ;
 	}
 #endif
 
+#ifdef EP_cache_PsyTsatFnPb
+	Real64
+	PsyTsatFnPb_raw(
+		Real64 const Press, // barometric pressure {Pascals}
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+#else
 	Real64
 	PsyTsatFnPb(
 		Real64 const Press, // barometric pressure {Pascals}
 		std::string const & CalledFrom // routine this function was called from (error messages)
 	)
+#endif
 	{
 
 		// FUNCTION INFORMATION:
@@ -1392,6 +1505,187 @@ Label170: ;
 
 	}
 
+	void
+	PsyRhoAirFnPbTdbW(
+		Real64 const pb, // barometric pressure (Pascals)
+		FArray1< Real64 > const & tdb, // dry bulb temperatures (Celsius)
+		FArray1< Real64 > const & dw, // humidity ratios (kgWater/kgDryAir)
+		FArray1< Real64 > & rhoair, // densities of air
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Array version of PsyRhoAirFnPbTdbW for zone and node array loops.
+
+		// METHODOLOGY EMPLOYED:
+		// The arrays are walked by linear index with no branches or calls in the loop body so
+		// that the compiler can vectorize it. Results are identical to the scalar function;
+		// the error check is done in a separate pass.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray1< Real64 >::size_type const n( tdb.size() );
+
+		assert( dw.size() == n );
+		assert( rhoair.size() == n );
+
+#ifdef EP_psych_stats
+		++NumTimesCalled( iPsyRhoAirFnPbTdbW_arr );
+		NumIterations( iPsyRhoAirFnPbTdbW_arr ) += n;
+#endif
+
+		for ( FArray1< Real64 >::size_type i = 0; i < n; ++i ) {
+			rhoair[ i ] = pb / ( 287.0 * ( tdb[ i ] + KelvinConv ) * ( 1.0 + 1.6077687 * max( dw[ i ], 1.0e-5 ) ) );
+		}
+
+#ifdef EP_psych_errors
+		for ( FArray1< Real64 >::size_type i = 0; i < n; ++i ) {
+			if ( rhoair[ i ] < 0.0 ) PsyRhoAirFnPbTdbW_error( pb, tdb[ i ], dw[ i ], rhoair[ i ], CalledFrom );
+		}
+#endif
+
+	}
+
+	void
+	PsyHFnTdbW(
+		FArray1< Real64 > const & TDB, // dry-bulb temperatures {C}
+		FArray1< Real64 > const & dW, // humidity ratios
+		FArray1< Real64 > & H // enthalpies {J/kg}
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Array version of PsyHFnTdbW.
+
+		// METHODOLOGY EMPLOYED:
+		// Branch free loop over the linear index, see PsyRhoAirFnPbTdbW (array).
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray1< Real64 >::size_type const n( TDB.size() );
+
+		assert( dW.size() == n );
+		assert( H.size() == n );
+
+#ifdef EP_psych_stats
+		++NumTimesCalled( iPsyHFnTdbW_arr );
+		NumIterations( iPsyHFnTdbW_arr ) += n;
+#endif
+
+		for ( FArray1< Real64 >::size_type i = 0; i < n; ++i ) {
+			H[ i ] = PsyHFnTdbW( TDB[ i ], dW[ i ] );
+		}
+
+	}
+
+	void
+	PsyCpAirFnWTdb(
+		FArray1< Real64 > const & dw, // humidity ratios {kgWater/kgDryAir}
+		FArray1< Real64 > const & T, // input temperatures {Celsius}
+		FArray1< Real64 > & cpa // heat capacities of air {J/kg-C}
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Array version of PsyCpAirFnWTdb.
+
+		// METHODOLOGY EMPLOYED:
+		// Same numerical derivative of PsyHFnTdbW as the scalar function, without the
+		// last-call memo (which would serialize the loop).
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray1< Real64 >::size_type const n( T.size() );
+
+		assert( dw.size() == n );
+		assert( cpa.size() == n );
+
+#ifdef EP_psych_stats
+		++NumTimesCalled( iPsyCpAirFnWTdb_arr );
+		NumIterations( iPsyCpAirFnWTdb_arr ) += n;
+#endif
+
+		for ( FArray1< Real64 >::size_type i = 0; i < n; ++i ) {
+			Real64 const w( max( dw[ i ], 1.0e-5 ) );
+			cpa[ i ] = ( PsyHFnTdbW( T[ i ] + 0.1, w ) - PsyHFnTdbW( T[ i ], w ) ) * 10.0;
+		}
+
+	}
+
+	void
+	PsyWFnTdbRhPb(
+		FArray1< Real64 > const & TDB, // dry-bulb temperatures {C}
+		FArray1< Real64 > const & RH, // relative humidity values (0.0-1.0)
+		Real64 const PB, // barometric pressure {Pascals}
+		FArray1< Real64 > & W, // humidity ratios
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Array version of PsyWFnTdbRhPb.
+
+		// METHODOLOGY EMPLOYED:
+		// The saturation pressures come from the (cached) PsyPsatFnTemp in a first pass and are
+		// held in W; the humidity ratio loop is then branch free and the validity test and
+		// error reporting are done in a last pass.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "PsyWFnTdbRhPb" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray1< Real64 >::size_type const n( TDB.size() );
+
+		assert( RH.size() == n );
+		assert( W.size() == n );
+
+#ifdef EP_psych_stats
+		++NumTimesCalled( iPsyWFnTdbRhPb_arr );
+		NumIterations( iPsyWFnTdbRhPb_arr ) += n;
+#endif
+
+		for ( FArray1< Real64 >::size_type i = 0; i < n; ++i ) {
+			W[ i ] = PsyPsatFnTemp( TDB[ i ], ( CalledFrom.empty() ? RoutineName : CalledFrom ) );
+		}
+
+		for ( FArray1< Real64 >::size_type i = 0; i < n; ++i ) {
+			Real64 const PDEW( RH[ i ] * W[ i ] ); // Pressure at dew-point temperature {Pascals}
+			W[ i ] = PDEW * 0.62198 / max( PB - PDEW, 1000.0 );
+		}
+
+		for ( FArray1< Real64 >::size_type i = 0; i < n; ++i ) {
+			if ( W[ i ] < 1.0e-5 ) {
+#ifdef EP_psych_errors
+				if ( W[ i ] <= -0.0001 ) PsyWFnTdbRhPb_error( TDB[ i ], RH[ i ], PB, W[ i ], CalledFrom );
+#endif
+				W[ i ] = 1.0e-5;
+			}
+		}
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
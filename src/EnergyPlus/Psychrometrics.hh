@@ -7,6 +7,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/bit.hh>
+#include <ObjexxFCL/FArray1.hh>
 #include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/Fmath.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -21,9 +22,13 @@ namespace EnergyPlus {
 #ifdef EP_nocache_Psychrometrics
 #undef EP_cache_PsyTwbFnTdbWPb
 #undef EP_cache_PsyPsatFnTemp
+#undef EP_cache_PsyTsatFnPb
+#undef EP_cache_PsyTsatFnHPb
 #else
 #define EP_cache_PsyTwbFnTdbWPb
 #define EP_cache_PsyPsatFnTemp
+#define EP_cache_PsyTsatFnPb
+#define EP_cache_PsyTsatFnHPb
 #endif
 #define EP_psych_errors
 
@@ -55,12 +60,18 @@ namespace Psychrometrics {
 	extern int const iPsyRhFnTdbRhovLBnd0C;
 	extern int const iPsyTwbFnTdbWPb_cache;
 	extern int const iPsyPsatFnTemp_cache;
+	extern int const iPsyTsatFnPb_cache;
+	extern int const iPsyTsatFnHPb_cache;
+	extern int const iPsyRhoAirFnPbTdbW_arr;
+	extern int const iPsyHFnTdbW_arr;
+	extern int const iPsyCpAirFnWTdb_arr;
+	extern int const iPsyWFnTdbRhPb_arr;
 	extern int const NumPsychMonitors; // Parameterization of Number of psychrometric routines that
 	extern std::string const blank_string;
 #ifdef EP_psych_stats
-	extern FArray1D_string const PsyRoutineNames; // 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | 10 | 11 | 12 | 13 | 14 - HR | 15 - max iter | 16 - HR | 17 - max iter | 18 - PsyTwbFnTdbWPb_raw (raw calc) | 19 - PsyPsatFnTemp_raw (raw calc)
+	extern FArray1D_string const PsyRoutineNames; // 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | 10 | 11 | 12 | 13 | 14 - HR | 15 - max iter | 16 - HR | 17 - max iter | 18 - PsyTwbFnTdbWPb_raw (raw calc) | 19 - PsyPsatFnTemp_raw (raw calc) | 20 - PsyTsatFnPb_raw (raw calc) | 21 - PsyTsatFnHPb_raw (raw calc) | 22-25 - array versions (iterations = elements)
 
-	extern FArray1D_bool const PsyReportIt; // PsyTdpFnTdbTwbPb     1 | PsyRhFnTdbWPb        2 | PsyTwbFnTdbWPb       3 | PsyVFnTdbWPb         4 | PsyWFnTdpPb          5 | PsyWFnTdbH           6 | PsyWFnTdbTwbPb       7 | PsyWFnTdbRhPb        8 | PsyPsatFnTemp        9 | PsyTsatFnHPb         10 | PsyTsatFnPb          11 | PsyRhFnTdbRhov       12 | PsyRhFnTdbRhovLBnd0C 13 | PsyTwbFnTdbWPb       14 - HR | PsyTwbFnTdbWPb       15 - max iter | PsyWFnTdbTwbPb       16 - HR | PsyTsatFnPb          17 - max iter | PsyTwbFnTdbWPb_cache 18 - PsyTwbFnTdbWPb_raw (raw calc) | PsyPsatFnTemp_cache  19 - PsyPsatFnTemp_raw (raw calc)
+	extern FArray1D_bool const PsyReportIt; // PsyTdpFnTdbTwbPb     1 | PsyRhFnTdbWPb        2 | PsyTwbFnTdbWPb       3 | PsyVFnTdbWPb         4 | PsyWFnTdpPb          5 | PsyWFnTdbH           6 | PsyWFnTdbTwbPb       7 | PsyWFnTdbRhPb        8 | PsyPsatFnTemp        9 | PsyTsatFnHPb         10 | PsyTsatFnPb          11 | PsyRhFnTdbRhov       12 | PsyRhFnTdbRhovLBnd0C 13 | PsyTwbFnTdbWPb       14 - HR | PsyTwbFnTdbWPb       15 - max iter | PsyWFnTdbTwbPb       16 - HR | PsyTsatFnPb          17 - max iter | PsyTwbFnTdbWPb_cache 18 - PsyTwbFnTdbWPb_raw (raw calc) | PsyPsatFnTemp_cache  19 - PsyPsatFnTemp_raw (raw calc) | PsyTsatFnPb_cache    20 - PsyTsatFnPb_raw (raw calc) | PsyTsatFnHPb_cache   21 - PsyTsatFnHPb_raw (raw calc) | PsyRhoAirFnPbTdbW_arr 22 | PsyHFnTdbW_arr       23 | PsyCpAirFnWTdb_arr   24 | PsyWFnTdbRhPb_arr    25
 #endif
 
 #ifndef EP_psych_errors
@@ -76,6 +87,15 @@ namespace Psychrometrics {
 	extern int const psatprecision_bits; // 28  //24  //32
 	extern Int64 const psatcache_mask;
 #endif
+#ifdef EP_cache_PsyTsatFnPb
+	extern int const tsatcache_size;
+	extern int const tsatprecision_bits;
+	extern Int64 const tsatcache_mask;
+#endif
+#ifdef EP_cache_PsyTsatFnHPb
+	extern int const tsathcache_size;
+	extern int const tsathprecision_bits;
+#endif
 
 	// MODULE VARIABLE DECLARATIONS:
 	// na
@@ -86,7 +106,7 @@ namespace Psychrometrics {
 	extern FArray1D_int iPsyErrIndex; // Number of times error occurred
 #ifdef EP_psych_stats
 	extern FArray1D< Int64 > NumTimesCalled;
-	extern FArray1D_int NumIterations;
+	extern FArray1D< Int64 > NumIterations;
 #endif
 
 	// DERIVED TYPE DEFINITIONS
@@ -151,6 +171,60 @@ namespace Psychrometrics {
 	};
 #endif
 
+#ifdef EP_cache_PsyTsatFnPb
+	struct cached_tsat_t
+	{
+		// Members
+		Int64 iPb;
+		Real64 Tsat;
+
+		// Default Constructor
+		cached_tsat_t() :
+			iPb( -1000 ),
+			Tsat( 0.0 )
+		{}
+
+		// Member Constructor
+		cached_tsat_t(
+			Int64 const iPb,
+			Real64 const Tsat
+		) :
+			iPb( iPb ),
+			Tsat( Tsat )
+		{}
+
+	};
+#endif
+
+#ifdef EP_cache_PsyTsatFnHPb
+	struct cached_tsath_t
+	{
+		// Members
+		Int64 iH;
+		Int64 iPb;
+		Real64 Tsat;
+
+		// Default Constructor
+		cached_tsath_t() :
+			iH( -1000 ),
+			iPb( -1000 ),
+			Tsat( 0.0 )
+		{}
+
+		// Member Constructor
+		cached_tsath_t(
+			Int64 const iH,
+			Int64 const iPb,
+			Real64 const Tsat
+		) :
+			iH( iH ),
+			iPb( iPb ),
+			Tsat( Tsat )
+		{}
+
+	};
+#endif
+
 	// Object Data
 #ifdef EP_cache_PsyTwbFnTdbWPb
 	extern FArray1D< cached_twb_t > cached_Twb; // DIMENSION(0:twbcache_size)
@@ -158,6 +232,12 @@ namespace Psychrometrics {
 #ifdef EP_cache_PsyPsatFnTemp
 	extern FArray1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size)
 #endif
+#ifdef EP_cache_PsyTsatFnPb
+	extern FArray1D< cached_tsat_t > cached_Tsat; // DIMENSION(0:tsatcache_size)
+#endif
+#ifdef EP_cache_PsyTsatFnHPb
+	extern FArray1D< cached_tsath_t > cached_TsatH; // DIMENSION(0:tsathcache_size)
+#endif
 
 	// Subroutine Specifications for the Module
 
@@ -215,6 +295,15 @@ namespace Psychrometrics {
 		return rhoair;
 	}
 
+	void
+	PsyRhoAirFnPbTdbW(
+		Real64 const pb, // barometric pressure (Pascals)
+		FArray1< Real64 > const & tdb, // dry bulb temperatures (Celsius)
+		FArray1< Real64 > const & dw, // humidity ratios (kgWater/kgDryAir)
+		FArray1< Real64 > & rhoair, // densities of air
+		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
+	);
+
 	inline
 	Real64
 	PsyHfgAirFnWTdb(
@@ -299,6 +388,13 @@ namespace Psychrometrics {
 		return 1.00484e3 * TDB + max( dW, 1.0e-5 ) * ( 2.50094e6 + 1.85895e3 * TDB ); // enthalpy {J/kg}
 	}
 
+	void
+	PsyHFnTdbW(
+		FArray1< Real64 > const & TDB, // dry-bulb temperatures {C}
+		FArray1< Real64 > const & dW, // humidity ratios
+		FArray1< Real64 > & H // enthalpies {J/kg}
+	);
+
 	inline
 	Real64
 	PsyCpAirFnWTdb(
@@ -326,6 +422,10 @@ namespace Psychrometrics {
 		static Real64 dwSave( -100.0 );
 		static Real64 Tsave( -100.0 );
 		static Real64 cpaSave( -100.0 );
+#ifdef _OPENMP
+		// each thread keeps its own last call (zone equipment simulated concurrently)
+#pragma omp threadprivate( dwSave, Tsave, cpaSave )
+#endif
 
 		// check if last call had the same input and if it did just use the saved output
 		if ( ( Tsave == T ) && ( dwSave == dw ) ) return cpaSave;
@@ -342,6 +442,13 @@ namespace Psychrometrics {
 		return cpa;
 	}
 
+	void
+	PsyCpAirFnWTdb(
+		FArray1< Real64 > const & dw, // humidity ratios {kgWater/kgDryAir}
+		FArray1< Real64 > const & T, // input temperatures {Celsius}
+		FArray1< Real64 > & cpa // heat capacities of air {J/kg-C}
+	);
+
 	inline
 	Real64
 	PsyTdbFnHW(
@@ -669,6 +776,17 @@ namespace Psychrometrics {
 		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
 	);
 
+#endif
+
+#ifdef EP_cache_PsyTsatFnHPb
+
+	Real64
+	PsyTsatFnHPb_raw(
+		Real64 const H, // enthalpy {J/kg}
+		Real64 const PB, // barometric pressure {Pascals}
+		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
+	);
+
 #endif
 
 	Real64
@@ -940,6 +1058,15 @@ namespace Psychrometrics {
 		}
 	}
 
+	void
+	PsyWFnTdbRhPb(
+		FArray1< Real64 > const & TDB, // dry-bulb temperatures {C}
+		FArray1< Real64 > const & RH, // relative humidity values (0.0-1.0)
+		Real64 const PB, // barometric pressure {Pascals}
+		FArray1< Real64 > & W, // humidity ratios
+		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
+	);
+
 #ifdef EP_psych_errors
 
 	void
@@ -1044,12 +1171,67 @@ namespace Psychrometrics {
 		return PsyHFnTdbW( TDB, max( PsyWFnTdbRhPb( TDB, RH, PB, CalledFrom ), 1.0e-5 ) ); // enthalpy {J/kg}
 	}
 
+#ifdef EP_cache_PsyTsatFnPb
+
+	Real64
+	PsyTsatFnPb_raw(
+		Real64 const Press, // barometric pressure {Pascals}
+		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
+	);
+
+	inline
+	Real64
+	PsyTsatFnPb(
+		Real64 const Press, // barometric pressure {Pascals}
+		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Provide a "cache" of results for the given argument (pressure) and saturation temperature output result.
+
+		// METHODOLOGY EMPLOYED:
+		// Use grid shifting and masking to provide hash into the cache, as in PsyPsatFnTemp.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		Int64 const Grid_Shift( 28 );
+		assert( Grid_Shift == 64 - 12 - tsatprecision_bits ); // Force Grid_Shift updates when precision bits changes
+
+#ifdef EP_psych_stats
+		++NumTimesCalled( iPsyTsatFnPb_cache );
+#endif
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+
+		Int64 const Pb_tag( bit::bit_shift( TRANSFER( Press, Grid_Shift ), -Grid_Shift ) ); // Note that 2nd arg to TRANSFER is not used: Only type matters
+		Int64 const hash( Pb_tag & tsatcache_mask );
+		auto & cTsat( cached_Tsat( hash ) );
+
+		if ( cTsat.iPb != Pb_tag ) {
+			cTsat.iPb = Pb_tag;
+			Real64 Pb_tag_r;
+			Pb_tag_r = TRANSFER( bit::bit_shift( Pb_tag, Grid_Shift ), Pb_tag_r );
+			cTsat.Tsat = PsyTsatFnPb_raw( Pb_tag_r, CalledFrom );
+		}
+
+		return cTsat.Tsat; // saturation temperature {C}
+	}
+
+#else
+
 	Real64
 	PsyTsatFnPb(
 		Real64 const Press, // barometric pressure {Pascals}
 		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
 	);
 
+#endif
+
 	inline
 	Real64
 	PsyTdpFnWPb(
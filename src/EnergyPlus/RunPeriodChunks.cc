@@ -0,0 +1,1484 @@
+// C++ Headers
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <vector>
+#ifdef __unix__
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/Fmath.hh>
+#include <ObjexxFCL/gio.hh>
+#include <ObjexxFCL/string.functions.hh>
+
+// EnergyPlus Headers
+#include <RunPeriodChunks.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataIPShortCuts.hh>
+#include <DataPrecisionGlobals.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
+#include <DisplayRoutines.hh>
+#include <General.hh>
+#include <InputProcessor.hh>
+#include <OutputReportTabular.hh>
+#include <ParametricRuns.hh>
+#include <UtilityRoutines.hh>
+#include <WeatherManager.hh>
+
+namespace EnergyPlus {
+
+namespace RunPeriodChunks {
+
+	// MODULE INFORMATION
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2014
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Splits the weather file run period of an input into month aligned chunks that are
+	// simulated at the same time in separate processes, and merges the chunk output back
+	// into one time series.
+
+	// METHODOLOGY EMPLOYED:
+	// EP_RUNPERIOD_CHUNKS gives the number of chunks. After ProcessInput the parent process
+	// divides the months of the run period as evenly as possible over the chunks and forks
+	// one process per chunk, in the same way as a parametric batch. Each chunk process moves
+	// into a folder named after the chunk and changes the dates of the RunPeriod record to
+	// its own months, starting EP_RUNPERIOD_OVERLAP days early (7 by default) so that the
+	// building has built up its thermal history, beyond the normal warmup, when the chunk
+	// reaches its own dates. The overlap days are simulated but not kept in the merged output.
+	// When all chunks are done the parent merges eplusout.eso and eplusout.mtr in date order:
+	// the data dictionary and design day environments come from the first chunk, the run
+	// period of every chunk is taken from its own first day on, with the day of simulation
+	// shifted to count from the start of the whole run period. The zone mean air temperatures of each chunk over the overlap
+	// window are compared with those of the previous chunk for the same hours, and the
+	// differences are reported in the audit file of the parent as a measure of how well the
+	// overlap has made up for the missing history.
+	// The Output:Table:Monthly and Output:Table:TimeBins results are merged by the last chunk
+	// before it writes its tabular reports: every earlier chunk leaves its monthly and binned
+	// accumulators in its folder, the last chunk takes the months owned by each chunk and adds
+	// (or takes the minimum or maximum of) the values that are not kept by month, and the
+	// parent copies the tabular files of the last chunk. Chunks do not gather tabular results
+	// over their overlap days, so every month is gathered by exactly one chunk.
+	// Only a single RunPeriod with one repetition within one calendar year can be chunked;
+	// otherwise the run is simulated serially as usual. Dates are handled on the non-leap
+	// calendar. The other outputs that hold totals over the whole run period (the predefined
+	// summary reports, tariffs, life cycle costs, run period frequency variables and meters)
+	// and the SQLite output cannot be rebuilt from the chunks, so inputs that request them
+	// are also simulated serially (see UnmergedOutputRequested).
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// na
+
+	// Using/Aliasing
+	using namespace DataPrecisionGlobals;
+	using General::RoundSigDigits;
+	using General::TrimSigDigits;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	std::string const SeamFileName( "eplusout.seam" ); // Zone temperatures of the overlap windows, written by each chunk
+	std::string const TabularFileName( "eplusout.chunktab" ); // Monthly and binned tabular results, written by each chunk but the last
+	std::string const TabularHeader( "ChunkTabularResults" ); // First word of a tabular results file
+	std::string const TabularMissing( "ChunkTabularResultsMissing" ); // Written by the parent for a chunk that ended without its results
+
+	// DERIVED TYPE DEFINITIONS:
+	// na
+
+	// MODULE VARIABLE DECLARATIONS:
+	int ChunkNum( 0 ); // Chunk simulated by this process (0 in the parent and in serial runs)
+	int SeamFile( 0 ); // Unit number of the seam file of a chunk process
+
+	// SUBROUTINE SPECIFICATIONS FOR MODULE RunPeriodChunks:
+
+	// Object Data
+	std::vector< RunPeriodChunk > Chunks;
+
+	// Functions
+
+	void
+	SimulateRunPeriodChunks()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Drives a chunked run period. Returns in a chunk process, with the chunk dates in
+		// place, and when the run period cannot be chunked; the parent process ends the
+		// program when all chunks are done.
+
+		// METHODOLOGY EMPLOYED:
+		// All chunks are started at once, after the output written so far has been flushed.
+		// The chunk outputs are merged only if every chunk completed successfully. For an
+		// earlier chunk that ends without leaving its tabular results, a file saying so is
+		// written in its place so that the last chunk does not wait for it.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+		using DataSystemVariables::cRunPeriodChunks;
+		using DataSystemVariables::Time_Start;
+		using DataTimings::epElapsedTime;
+		using ParametricRuns::FlushCarriedFiles;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 SetupTime; // time spent before the first chunk is started (s)
+		int NumChunks; // number of chunks
+		int NumRunning; // number of chunk processes running
+		int ChunkIndex; // chunk index (zero based)
+		int NumESORecords( 0 ); // records written to the merged eplusout.eso
+		int NumMTRRecords( 0 ); // records written to the merged eplusout.mtr
+		bool AllCompleted( true ); // true if every chunk ended with a zero exit status
+		std::string ExitString; // exit status for the progress display
+		std::string FileName; // tabular results file of a chunk
+
+#ifdef __unix__
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		pid_t PID; // process id of a finished chunk
+		int Status; // wait status of a finished chunk
+
+		if ( ! SetupRunPeriodChunks() ) return;
+
+		SetupTime = epElapsedTime() - Time_Start;
+		if ( SetupTime < 0.0 ) SetupTime += 24.0 * 3600.0;
+
+		FlushCarriedFiles();
+
+		NumChunks = Chunks.size();
+		NumRunning = 0;
+		for ( ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex ) {
+			if ( StartRunPeriodChunk( ChunkIndex ) ) return;
+			if ( Chunks[ ChunkIndex ].PID > 0 ) ++NumRunning;
+		}
+
+		while ( NumRunning > 0 ) {
+			PID = waitpid( -1, &Status, 0 );
+			if ( PID < 0 ) {
+				if ( errno == EINTR ) continue;
+				break;
+			}
+			for ( ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex ) {
+				if ( Chunks[ ChunkIndex ].PID != PID ) continue;
+				Chunks[ ChunkIndex ].PID = 0;
+				Chunks[ ChunkIndex ].RunTime = epElapsedTime() - Chunks[ ChunkIndex ].StartTime;
+				if ( Chunks[ ChunkIndex ].RunTime < 0.0 ) Chunks[ ChunkIndex ].RunTime += 24.0 * 3600.0;
+				if ( WIFEXITED( Status ) ) {
+					Chunks[ ChunkIndex ].ExitStatus = WEXITSTATUS( Status );
+					ExitString = TrimSigDigits( Chunks[ ChunkIndex ].ExitStatus );
+				} else {
+					ExitString = "terminated";
+				}
+				DisplayString( "Run period chunk " + Chunks[ ChunkIndex ].Name + " finished, exit status=" + ExitString );
+				// The last chunk waits for the tabular results of the earlier ones
+				if ( ChunkIndex + 1 < NumChunks ) {
+					FileName = Chunks[ ChunkIndex ].Name + pathChar + TabularFileName;
+					std::ifstream ResultsFile( FileName );
+					if ( ! ResultsFile ) {
+						std::ofstream MissingFile( FileName );
+						MissingFile << TabularMissing << '\n';
+					}
+				}
+				--NumRunning;
+				break;
+			}
+		}
+
+		for ( ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex ) {
+			if ( Chunks[ ChunkIndex ].ExitStatus != 0 ) AllCompleted = false;
+		}
+		if ( AllCompleted ) {
+			DisplayString( "Merging run period chunk output" );
+			NumESORecords = MergeChunkOutputFile( "eplusout.eso" );
+			NumMTRRecords = MergeChunkOutputFile( "eplusout.mtr" );
+			CopyChunkTabularFiles();
+			for ( ChunkIndex = 1; ChunkIndex < NumChunks; ++ChunkIndex ) {
+				CompareChunkSeam( ChunkIndex );
+			}
+		}
+
+		ReportRunPeriodChunks( SetupTime, NumESORecords, NumMTRRecords );
+		EndEnergyPlus();
+#else
+		ShowWarningError( "SimulateRunPeriodChunks: run period chunks (" + cRunPeriodChunks + ") are only available on unix platforms, the run period is simulated in one process." );
+#endif
+
+	}
+
+	bool
+	SetupRunPeriodChunks()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Checks that the run period of the input can be chunked and sets up the dates of the
+		// chunks. Returns false, after a warning, if the run is to be simulated serially.
+
+		// METHODOLOGY EMPLOYED:
+		// The months of the run period are divided over the chunks, so that every chunk after
+		// the first starts on the first of a month. Each chunk after the first is simulated
+		// from RunPeriodOverlapDays before its start, but not before the start of the run period.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataIPShortCuts::cAlphaArgs;
+		using DataIPShortCuts::cAlphaFieldNames;
+		using DataIPShortCuts::cNumericFieldNames;
+		using DataIPShortCuts::lAlphaFieldBlanks;
+		using DataIPShortCuts::lNumericFieldBlanks;
+		using DataIPShortCuts::rNumericArgs;
+		using DataSystemVariables::DDOnly;
+		using DataSystemVariables::FullAnnualRun;
+		using DataSystemVariables::NumRunPeriodChunks;
+		using DataSystemVariables::RunPeriodOverlapDays;
+		using General::JulianDay;
+		using InputProcessor::GetNumObjectsFound;
+		using InputProcessor::GetObjectItem;
+
+		// Return value
+		bool CanChunk( false );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "SimulateRunPeriodChunks: " );
+		static std::string const SerialMessage( "...The run period is simulated in one process." );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int NumAlpha; // number of alphas of an object
+		int NumNumber; // number of numbers of an object
+		int IOStat; // status of GetObjectItem
+		int StartMonth; // first month of the run period
+		int EndMonth; // last month of the run period
+		int StartDate; // first day of year of the run period
+		int EndDate; // last day of year of the run period
+		int NumMonths; // number of calendar months touched by the run period
+		int NumChunks; // number of chunks
+		int ChunkIndex; // chunk index (zero based)
+		int FirstMonth; // first month of a chunk
+		std::string UnmergedObject; // object requesting output that cannot be merged
+
+		if ( DDOnly || FullAnnualRun ) {
+			ShowWarningError( RoutineName + "Run period chunks cannot be used when the design day only or full annual run option is set." );
+			ShowContinueError( SerialMessage );
+			return CanChunk;
+		}
+		if ( GetNumObjectsFound( "SimulationControl" ) > 0 ) {
+			GetObjectItem( "SimulationControl", 1, cAlphaArgs, NumAlpha, rNumericArgs, NumNumber, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+			if ( NumAlpha >= 5 && cAlphaArgs( 5 ) == "NO" ) {
+				ShowWarningError( RoutineName + "SimulationControl does not request weather file run periods, there is no run period to chunk." );
+				ShowContinueError( SerialMessage );
+				return CanChunk;
+			}
+		}
+		UnmergedObject = UnmergedOutputRequested( false, true );
+		if ( ! UnmergedObject.empty() ) {
+			ShowWarningError( RoutineName + "Run period chunks cannot be used with " + UnmergedObject + ", its output cannot be merged from the chunks." );
+			ShowContinueError( SerialMessage );
+			return CanChunk;
+		}
+		if ( GetNumObjectsFound( "RunPeriod" ) != 1 || GetNumObjectsFound( "RunPeriod:CustomRange" ) > 0 ) {
+			ShowWarningError( RoutineName + "Run period chunks require exactly one RunPeriod object and no RunPeriod:CustomRange objects." );
+			ShowContinueError( SerialMessage );
+			return CanChunk;
+		}
+
+		GetObjectItem( "RunPeriod", 1, cAlphaArgs, NumAlpha, rNumericArgs, NumNumber, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+		StartMonth = int( rNumericArgs( 1 ) );
+		EndMonth = int( rNumericArgs( 3 ) );
+		StartDate = JulianDay( StartMonth, int( rNumericArgs( 2 ) ), 0 );
+		EndDate = JulianDay( EndMonth, int( rNumericArgs( 4 ) ), 0 );
+		if ( NumNumber >= 5 && int( rNumericArgs( 5 ) ) > 1 ) {
+			ShowWarningError( RoutineName + "Run period chunks cannot be used with a repeated RunPeriod, " + cNumericFieldNames( 5 ) + '=' + TrimSigDigits( int( rNumericArgs( 5 ) ) ) + '.' );
+			ShowContinueError( SerialMessage );
+			return CanChunk;
+		}
+		if ( StartMonth < 1 || EndMonth > 12 || EndDate < StartDate ) {
+			ShowWarningError( RoutineName + "Run period chunks require a RunPeriod within one calendar year." );
+			ShowContinueError( SerialMessage );
+			return CanChunk;
+		}
+		NumMonths = EndMonth - StartMonth + 1;
+		NumChunks = min( NumRunPeriodChunks, NumMonths );
+		if ( NumChunks < 2 ) {
+			ShowWarningError( RoutineName + "The RunPeriod is shorter than two months and is not split into chunks." );
+			ShowContinueError( SerialMessage );
+			return CanChunk;
+		}
+
+		Chunks.clear();
+		Chunks.resize( NumChunks );
+		for ( ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex ) {
+			Chunks[ ChunkIndex ].Name = "chunk" + std::string( ChunkIndex + 1 < 10 ? "0" : "" ) + TrimSigDigits( ChunkIndex + 1 );
+			if ( ChunkIndex == 0 ) {
+				Chunks[ ChunkIndex ].StartDate = StartDate;
+			} else {
+				FirstMonth = StartMonth + ( ChunkIndex * NumMonths ) / NumChunks;
+				Chunks[ ChunkIndex ].StartDate = JulianDay( FirstMonth, 1, 0 );
+				Chunks[ ChunkIndex - 1 ].EndDate = Chunks[ ChunkIndex ].StartDate - 1;
+			}
+			Chunks[ ChunkIndex ].RunStartDate = max( StartDate, Chunks[ ChunkIndex ].StartDate - RunPeriodOverlapDays );
+		}
+		Chunks[ NumChunks - 1 ].EndDate = EndDate;
+
+		CanChunk = true;
+		return CanChunk;
+
+	}
+
+	std::string
+	UnmergedOutputRequested(
+		bool const MonthlyTotals, // True if monthly totals are also split
+		bool const TablesMerged // True if the monthly and binned tabular results are merged
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       October 2014, also used for a restart from a checkpoint
+		//                      October 2014, monthly and binned tables merged for chunks
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the first object of the input that requests output that the chunk merge
+		// cannot rebuild, or blank if there is none. A restart from a checkpoint has the same
+		// problem, and also with monthly totals when it starts within a month.
+
+		// METHODOLOGY EMPLOYED:
+		// The tabular reports (and the utility tariffs and life cycle costs, which write tabular
+		// reports) and the run period frequency variables and meters are totals over the whole
+		// run period; each chunk only knows its own months (MonthlyTotals adds the monthly
+		// frequency for a split within a month). TablesMerged leaves out Output:Table:Monthly
+		// and Output:Table:TimeBins, whose results the chunks merge. The SQLite output is not
+		// merged. The reporting frequency fields are checked on their first four letters, as in
+		// DetermineFrequency.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataIPShortCuts::cAlphaArgs;
+		using DataIPShortCuts::cAlphaFieldNames;
+		using DataIPShortCuts::cNumericFieldNames;
+		using DataIPShortCuts::lAlphaFieldBlanks;
+		using DataIPShortCuts::lNumericFieldBlanks;
+		using DataIPShortCuts::rNumericArgs;
+		using InputProcessor::GetNumObjectsFound;
+		using InputProcessor::GetObjectItem;
+		using InputProcessor::MakeUPPERCase;
+
+		// Return value
+		std::string UnmergedObject;
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static FArray1D_string const TotalObjects( 6, { "Output:Table:SummaryReports", "Output:Table:Monthly", "Output:Table:TimeBins", "UtilityCost:Tariff", "LifeCycleCost:Parameters", "Output:SQLite" } );
+		static FArray1D_string const FrequencyObjects( 5, { "Output:Variable", "Output:Meter", "Output:Meter:MeterFileOnly", "Output:Meter:Cumulative", "Output:Meter:Cumulative:MeterFileOnly" } );
+		static FArray1D_int const FrequencyField( 5, { 3, 2, 2, 2, 2 } ); // alpha field of the reporting frequency
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int NumAlpha; // number of alphas of an object
+		int NumNumber; // number of numbers of an object
+		int IOStat; // status of GetObjectItem
+		int ObjType; // index into TotalObjects or FrequencyObjects
+		int ObjNum; // object counter
+		std::string Frequency; // reporting frequency of a variable or meter
+
+		for ( ObjType = 1; ObjType <= 6; ++ObjType ) {
+			if ( TablesMerged && ( ObjType == 2 || ObjType == 3 ) ) continue;
+			if ( GetNumObjectsFound( TotalObjects( ObjType ) ) > 0 ) {
+				UnmergedObject = TotalObjects( ObjType );
+				return UnmergedObject;
+			}
+		}
+		for ( ObjType = 1; ObjType <= 5; ++ObjType ) {
+			for ( ObjNum = 1; ObjNum <= GetNumObjectsFound( FrequencyObjects( ObjType ) ); ++ObjNum ) {
+				GetObjectItem( FrequencyObjects( ObjType ), ObjNum, cAlphaArgs, NumAlpha, rNumericArgs, NumNumber, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+				if ( NumAlpha < FrequencyField( ObjType ) ) continue;
+				Frequency = MakeUPPERCase( cAlphaArgs( FrequencyField( ObjType ) ) );
+				if ( has_prefix( Frequency, "RUNP" ) || has_prefix( Frequency, "ENVI" ) || has_prefix( Frequency, "ANNU" ) || ( MonthlyTotals && has_prefix( Frequency, "MONT" ) ) ) {
+					UnmergedObject = FrequencyObjects( ObjType ) + " at " + cAlphaArgs( FrequencyField( ObjType ) ) + " frequency";
+					return UnmergedObject;
+				}
+			}
+		}
+		return UnmergedObject;
+
+	}
+
+	bool
+	StartRunPeriodChunk( int const ChunkIndex ) // Index into Chunks (zero based)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Forks the process of one chunk. Returns true in the chunk process, which is then
+		// running in the chunk folder with the chunk dates in place, and false in the parent.
+
+		// METHODOLOGY EMPLOYED:
+		// The chunk process moves into its folder with ParametricRuns::MoveToRunFolder and then
+		// changes the dates of the processed RunPeriod record. The tabular results file of an
+		// earlier run in the chunk folder is removed first.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+		using DataTimings::epElapsedTime;
+		using ParametricRuns::MoveToRunFolder;
+
+		// Return value
+		bool IsChunk( false );
+
+#ifdef __unix__
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		pid_t PID; // process id returned by fork
+
+		std::remove( ( Chunks[ ChunkIndex ].Name + pathChar + TabularFileName ).c_str() );
+		PID = fork();
+		if ( PID < 0 ) {
+			ShowSevereError( "SimulateRunPeriodChunks: Could not start the process for chunk=" + Chunks[ ChunkIndex ].Name );
+			return IsChunk;
+		}
+		if ( PID > 0 ) {
+			Chunks[ ChunkIndex ].PID = PID;
+			Chunks[ ChunkIndex ].StartTime = epElapsedTime();
+			DisplayString( "Run period chunk " + Chunks[ ChunkIndex ].Name + " started, " + ChunkDateString( Chunks[ ChunkIndex ].StartDate ) + " to " + ChunkDateString( Chunks[ ChunkIndex ].EndDate ) );
+			return IsChunk;
+		}
+
+		// Chunk process
+		IsChunk = true;
+		ChunkNum = ChunkIndex + 1;
+		MoveToRunFolder( Chunks[ ChunkIndex ].Name, "run period chunk " + Chunks[ ChunkIndex ].Name, false );
+		SetRunPeriodDates( Chunks[ ChunkIndex ].RunStartDate, Chunks[ ChunkIndex ].EndDate );
+		ShowMessage( "Run period chunk=" + Chunks[ ChunkIndex ].Name + ", simulating " + ChunkDateString( Chunks[ ChunkIndex ].RunStartDate ) + " to " + ChunkDateString( Chunks[ ChunkIndex ].EndDate ) + ", reporting from " + ChunkDateString( Chunks[ ChunkIndex ].StartDate ) + '.' );
+#endif
+
+		return IsChunk;
+
+	}
+
+	void
+	SetRunPeriodDates(
+		int const StartDate, // New first day of year of the run period
+		int const EndDate // New last day of year of the run period
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the dates of the processed (single) RunPeriod record, for a run period chunk or
+		// a restart from a checkpoint.
+
+		// METHODOLOGY EMPLOYED:
+		// The begin and end month and day (the first four numeric arguments) are replaced. A day
+		// of week given for the start day is moved on by the days between the old and the new
+		// start date, so that the shortened run keeps the calendar of the whole run period.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::SortedIDD;
+		using General::InvJulianDay;
+		using General::JulianDay;
+		using InputProcessor::FindItemInList;
+		using InputProcessor::FindItemInSortedList;
+		using InputProcessor::IDFRecords;
+		using InputProcessor::iListOfObjects;
+		using InputProcessor::ListOfObjects;
+		using InputProcessor::NumObjectDefs;
+		using InputProcessor::ObjectRecordList;
+		using InputProcessor::ObjectRecordStart;
+		using WeatherManager::DaysOfWeek;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Found; // object definition of RunPeriod
+		int RecNum; // IDF record of the RunPeriod
+		int Month; // month of a date
+		int Day; // day of month of a date
+		int DayOfWeek; // day of week of the start day of the run period
+		int DayShift; // days from the old to the new start date
+
+		if ( SortedIDD ) {
+			Found = FindItemInSortedList( "RUNPERIOD", ListOfObjects, NumObjectDefs );
+			if ( Found != 0 ) Found = iListOfObjects( Found );
+		} else {
+			Found = FindItemInList( "RUNPERIOD", ListOfObjects, NumObjectDefs );
+		}
+		if ( Found == 0 || ObjectRecordStart( Found ) == ObjectRecordStart( Found + 1 ) ) return;
+		RecNum = ObjectRecordList( ObjectRecordStart( Found ) );
+		if ( IDFRecords( RecNum ).NumNumbers < 4 ) return;
+
+		DayShift = StartDate - JulianDay( int( IDFRecords( RecNum ).Numbers( 1 ) ), int( IDFRecords( RecNum ).Numbers( 2 ) ), 0 );
+		InvJulianDay( StartDate, Month, Day, 0 );
+		IDFRecords( RecNum ).Numbers( 1 ) = Month;
+		IDFRecords( RecNum ).Numbers( 2 ) = Day;
+		InvJulianDay( EndDate, Month, Day, 0 );
+		IDFRecords( RecNum ).Numbers( 3 ) = Month;
+		IDFRecords( RecNum ).Numbers( 4 ) = Day;
+
+		if ( IDFRecords( RecNum ).NumAlphas < 2 ) return;
+		DayOfWeek = FindItemInList( IDFRecords( RecNum ).Alphas( 2 ), DaysOfWeek, 7 );
+		if ( DayOfWeek == 0 || DayShift < 0 ) return;
+		IDFRecords( RecNum ).Alphas( 2 ) = DaysOfWeek( ( DayOfWeek - 1 + DayShift ) % 7 + 1 );
+
+	}
+
+	void
+	RecordChunkSeamTemperatures()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the zone mean air temperatures at the end of each hour of the overlap windows
+		// of a chunk to its seam file, for comparison by the parent when all chunks are done.
+
+		// METHODOLOGY EMPLOYED:
+		// A chunk records the days it simulates ahead of its own start (compared with the
+		// previous chunk) and the days of its own dates that the next chunk simulates ahead of
+		// its start. Each line holds the day of year, the hour and the temperature of every zone.
+		// The file is closed after the last hour to be recorded.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::DayOfYear;
+		using DataGlobals::HourOfDay;
+		using DataGlobals::KindOfSim;
+		using DataGlobals::ksRunPeriodWeather;
+		using DataGlobals::NumOfZones;
+		using DataGlobals::WarmupFlag;
+		using DataHeatBalFanSys::MAT;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ChunkIndex( ChunkNum - 1 ); // chunk simulated by this process (zero based)
+		int NumChunks( Chunks.size() ); // number of chunks
+		bool HasNextChunk; // true if a chunk follows this one
+		int LastSeamDay; // last day of year recorded by this chunk
+		int ZoneNum; // zone counter
+		int IOStat; // status of opening the seam file
+		std::string Line; // line of the seam file
+
+		if ( WarmupFlag || KindOfSim != ksRunPeriodWeather ) return;
+		if ( SeamFile < 0 ) return;
+
+		HasNextChunk = ( ChunkIndex + 1 < NumChunks );
+		if ( DayOfYear >= Chunks[ ChunkIndex ].StartDate ) {
+			if ( ! HasNextChunk ) return;
+			if ( DayOfYear < Chunks[ ChunkIndex + 1 ].RunStartDate ) return;
+		}
+
+		if ( SeamFile == 0 ) {
+			SeamFile = GetNewUnitNumber();
+			{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( SeamFile, SeamFileName, flags ); IOStat = flags.ios(); }
+			if ( IOStat != 0 ) {
+				ShowWarningError( "RecordChunkSeamTemperatures: Could not open file \"" + SeamFileName + "\" for output (write), the seam of this chunk is not compared." );
+				SeamFile = -1;
+				return;
+			}
+		}
+
+		Line = TrimSigDigits( DayOfYear ) + ',' + TrimSigDigits( HourOfDay );
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			Line += ',' + RoundSigDigits( MAT( ZoneNum ), 4 );
+		}
+		gio::write( SeamFile, fmtA ) << Line;
+
+		LastSeamDay = ( HasNextChunk ? Chunks[ ChunkIndex ].EndDate : Chunks[ ChunkIndex ].StartDate - 1 );
+		if ( DayOfYear == LastSeamDay && HourOfDay == 24 ) {
+			gio::close( SeamFile );
+			SeamFile = -1;
+		}
+
+	}
+
+	bool
+	InChunkOverlap()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true in a chunk process while it simulates the overlap days ahead of its own
+		// dates. The tabular results of these days belong to the previous chunk.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::DayOfYear;
+
+		// Return value
+		bool InOverlap( false );
+
+		if ( ChunkNum > 0 ) InOverlap = ( DayOfYear < Chunks[ ChunkNum - 1 ].StartDate );
+		return InOverlap;
+
+	}
+
+	int
+	ChunkOfMonth( int const Month ) // Month of the year
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the index (zero based) of the chunk that gathers the tabular results of a month.
+
+		// METHODOLOGY EMPLOYED:
+		// Every chunk after the first starts on the first of a month; months outside the run
+		// period are given to the first chunk.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::JulianDay;
+
+		// Return value
+		int Owner( 0 );
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int ChunkIndex; // chunk index (zero based)
+		int NumChunks( Chunks.size() ); // number of chunks
+
+		for ( ChunkIndex = 1; ChunkIndex < NumChunks; ++ChunkIndex ) {
+			if ( Chunks[ ChunkIndex ].StartDate <= JulianDay( Month, 1, 0 ) ) Owner = ChunkIndex;
+		}
+		return Owner;
+
+	}
+
+	void
+	ExchangeChunkTabularResults()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Called by a chunk process before it writes its tabular reports. Every chunk but the
+		// last leaves its Output:Table:Monthly and Output:Table:TimeBins results in its folder;
+		// the last chunk waits for those of the earlier chunks and merges them into its own.
+
+		// METHODOLOGY EMPLOYED:
+		// The last chunk checks for the file of each earlier chunk once a second; the parent
+		// writes a file saying the results are missing for a chunk that ended without them.
+		// The header (the array sizes) of every file is checked before any of them is merged,
+		// so that the tables are either fully merged or hold the months of the last chunk only.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+		using OutputReportTabular::BinResultsIntervalCount;
+		using OutputReportTabular::BinResultsTableCount;
+		using OutputReportTabular::MonthlyColumnsCount;
+		using OutputReportTabular::WriteTabularFiles;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ChunkIndex( ChunkNum - 1 ); // chunk simulated by this process (zero based)
+		int NumChunks( Chunks.size() ); // number of chunks
+		int Earlier; // earlier chunk (zero based)
+		std::string FileName; // tabular results file of an earlier chunk
+		std::string Header; // first word of a tabular results file
+		int NumColumns; // MonthlyColumnsCount of an earlier chunk
+		int NumTables; // BinResultsTableCount of an earlier chunk
+		int NumIntervals; // BinResultsIntervalCount of an earlier chunk
+		bool Waiting; // true once the wait for an earlier chunk has been displayed
+		bool AllValid( true ); // true if the results of every earlier chunk can be merged
+
+		if ( ChunkNum == 0 || ! WriteTabularFiles ) return;
+		if ( MonthlyColumnsCount == 0 && BinResultsTableCount == 0 ) return;
+
+		if ( ChunkIndex + 1 < NumChunks ) {
+			WriteChunkTabularResults();
+			return;
+		}
+
+#ifdef __unix__
+		for ( Earlier = 0; Earlier < ChunkIndex; ++Earlier ) {
+			FileName = std::string( ".." ) + pathChar + Chunks[ Earlier ].Name + pathChar + TabularFileName;
+			Waiting = false;
+			while ( true ) {
+				std::ifstream ResultsFile( FileName );
+				if ( ResultsFile ) {
+					Header.clear();
+					NumColumns = -1;
+					NumTables = -1;
+					NumIntervals = -1;
+					ResultsFile >> Header >> NumColumns >> NumTables >> NumIntervals;
+					if ( Header == TabularMissing ) {
+						ShowWarningError( "ExchangeChunkTabularResults: Chunk=" + Chunks[ Earlier ].Name + " ended without leaving its tabular results." );
+						AllValid = false;
+					} else if ( Header != TabularHeader || NumColumns != MonthlyColumnsCount || NumTables != BinResultsTableCount || NumIntervals != BinResultsIntervalCount ) {
+						ShowWarningError( "ExchangeChunkTabularResults: The tabular results of chunk=" + Chunks[ Earlier ].Name + " do not match the tables of this chunk." );
+						AllValid = false;
+					}
+					break;
+				}
+				if ( ! Waiting ) DisplayString( "Run period chunk " + Chunks[ ChunkIndex ].Name + " waiting for the tabular results of chunk " + Chunks[ Earlier ].Name );
+				Waiting = true;
+				sleep( 1 );
+			}
+		}
+		if ( ! AllValid ) {
+			ShowContinueError( "...The monthly and binned tables only hold the months of chunk=" + Chunks[ ChunkIndex ].Name + '.' );
+			return;
+		}
+
+		for ( Earlier = 0; Earlier < ChunkIndex; ++Earlier ) {
+			MergeChunkTabularResults( Earlier, std::string( ".." ) + pathChar + Chunks[ Earlier ].Name + pathChar + TabularFileName );
+		}
+		ShowMessage( "Run period chunk=" + Chunks[ ChunkIndex ].Name + ", the monthly and binned tabular results of " + TrimSigDigits( ChunkIndex ) + " earlier chunks were merged." );
+#endif
+
+	}
+
+	void
+	WriteChunkTabularResults()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the Output:Table:Monthly and Output:Table:TimeBins accumulators of a chunk to
+		// its tabular results file, for the merge by the last chunk.
+
+		// METHODOLOGY EMPLOYED:
+		// A header with the array sizes is followed by the monthly results, duration and time
+		// stamp of each monthly column, then for each binned table the monthly and hourly time
+		// below the bins, in each bin and above the bins, and its statistics. Values are written
+		// with 17 significant digits so that they are read back unchanged. The file is written
+		// under a temporary name and renamed when complete, so that the last chunk never reads
+		// part of it.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using OutputReportTabular::BinResults;
+		using OutputReportTabular::BinResultsAbove;
+		using OutputReportTabular::BinResultsBelow;
+		using OutputReportTabular::BinResultsIntervalCount;
+		using OutputReportTabular::BinResultsTableCount;
+		using OutputReportTabular::BinResultsType;
+		using OutputReportTabular::BinStatistics;
+		using OutputReportTabular::MonthlyColumns;
+		using OutputReportTabular::MonthlyColumnsCount;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string TempFileName( TabularFileName + ".tmp" ); // file name while it is written
+		std::ofstream ResultsFile; // tabular results file
+		int Column; // monthly column
+		int Table; // binned table
+		int Interval; // bin (0 = below the bins, BinResultsIntervalCount + 1 = above)
+		int Month; // month of the year
+		int Hour; // hour of the day
+
+		ResultsFile.open( TempFileName, std::ios_base::trunc );
+		if ( ! ResultsFile ) {
+			ShowWarningError( "WriteChunkTabularResults: Could not open file \"" + TempFileName + "\" for output (write), the tabular results of this chunk are not merged." );
+			return;
+		}
+		ResultsFile << std::setprecision( 17 );
+		ResultsFile << TabularHeader << ' ' << MonthlyColumnsCount << ' ' << BinResultsTableCount << ' ' << BinResultsIntervalCount << '\n';
+		for ( Column = 1; Column <= MonthlyColumnsCount; ++Column ) {
+			for ( Month = 1; Month <= 12; ++Month ) {
+				ResultsFile << MonthlyColumns( Column ).reslt( Month ) << ' ' << MonthlyColumns( Column ).duration( Month ) << ' ' << MonthlyColumns( Column ).timeStamp( Month ) << '\n';
+			}
+		}
+		for ( Table = 1; Table <= BinResultsTableCount; ++Table ) {
+			for ( Interval = 0; Interval <= BinResultsIntervalCount + 1; ++Interval ) {
+				BinResultsType const & Bins( Interval == 0 ? BinResultsBelow( Table ) : ( Interval > BinResultsIntervalCount ? BinResultsAbove( Table ) : BinResults( Table, Interval ) ) );
+				for ( Month = 1; Month <= 12; ++Month ) {
+					ResultsFile << Bins.mnth( Month ) << '\n';
+				}
+				for ( Hour = 1; Hour <= 24; ++Hour ) {
+					ResultsFile << Bins.hrly( Hour ) << '\n';
+				}
+			}
+			ResultsFile << BinStatistics( Table ).sum << ' ' << BinStatistics( Table ).sum2 << ' ' << BinStatistics( Table ).n << ' ' << BinStatistics( Table ).minimum << ' ' << BinStatistics( Table ).maximum << '\n';
+		}
+		ResultsFile.close();
+
+		if ( std::rename( TempFileName.c_str(), TabularFileName.c_str() ) != 0 ) {
+			ShowWarningError( "WriteChunkTabularResults: Could not rename file \"" + TempFileName + "\", the tabular results of this chunk are not merged." );
+		}
+
+	}
+
+	void
+	MergeChunkTabularResults(
+		int const Earlier, // Index into Chunks of the earlier chunk (zero based)
+		std::string const & FileName // Tabular results file of the earlier chunk
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Merges the tabular results file of an earlier chunk into the Output:Table:Monthly and
+		// Output:Table:TimeBins accumulators of the last chunk.
+
+		// METHODOLOGY EMPLOYED:
+		// The values kept by month (monthly columns and the monthly time of each bin) are taken
+		// from the chunk that gathered the month (ChunkOfMonth). The hourly time of each bin and
+		// the count, sum and sum of squares of the statistics are added; the minimum and maximum
+		// are the smaller and the larger of the two. The header was checked by
+		// ExchangeChunkTabularResults.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using OutputReportTabular::BinResults;
+		using OutputReportTabular::BinResultsAbove;
+		using OutputReportTabular::BinResultsBelow;
+		using OutputReportTabular::BinResultsIntervalCount;
+		using OutputReportTabular::BinResultsTableCount;
+		using OutputReportTabular::BinResultsType;
+		using OutputReportTabular::BinStatistics;
+		using OutputReportTabular::MonthlyColumns;
+		using OutputReportTabular::MonthlyColumnsCount;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::ifstream ResultsFile( FileName ); // tabular results file
+		std::string Header; // first line of the file
+		FArray1D_bool Owned( 12 ); // true for the months gathered by the earlier chunk
+		int Column; // monthly column
+		int Table; // binned table
+		int Interval; // bin (0 = below the bins, BinResultsIntervalCount + 1 = above)
+		int Month; // month of the year
+		int Hour; // hour of the day
+		Real64 Result; // monthly result of a column
+		Real64 Duration; // duration of a monthly result
+		int TimeStamp; // time stamp of a monthly result
+		Real64 Value; // time in a bin, or a statistic
+		Real64 Sum2; // sum of squares of a binned variable
+		int Count; // number of values of a binned variable
+		Real64 Minimum; // minimum of a binned variable
+		Real64 Maximum; // maximum of a binned variable
+
+		for ( Month = 1; Month <= 12; ++Month ) {
+			Owned( Month ) = ( ChunkOfMonth( Month ) == Earlier );
+		}
+
+		std::getline( ResultsFile, Header );
+		for ( Column = 1; Column <= MonthlyColumnsCount; ++Column ) {
+			for ( Month = 1; Month <= 12; ++Month ) {
+				ResultsFile >> Result >> Duration >> TimeStamp;
+				if ( ! Owned( Month ) ) continue;
+				MonthlyColumns( Column ).reslt( Month ) = Result;
+				MonthlyColumns( Column ).duration( Month ) = Duration;
+				MonthlyColumns( Column ).timeStamp( Month ) = TimeStamp;
+			}
+		}
+		for ( Table = 1; Table <= BinResultsTableCount; ++Table ) {
+			for ( Interval = 0; Interval <= BinResultsIntervalCount + 1; ++Interval ) {
+				BinResultsType & Bins( Interval == 0 ? BinResultsBelow( Table ) : ( Interval > BinResultsIntervalCount ? BinResultsAbove( Table ) : BinResults( Table, Interval ) ) );
+				for ( Month = 1; Month <= 12; ++Month ) {
+					ResultsFile >> Value;
+					if ( Owned( Month ) ) Bins.mnth( Month ) = Value;
+				}
+				for ( Hour = 1; Hour <= 24; ++Hour ) {
+					ResultsFile >> Value;
+					Bins.hrly( Hour ) += Value;
+				}
+			}
+			ResultsFile >> Value >> Sum2 >> Count >> Minimum >> Maximum;
+			BinStatistics( Table ).sum += Value;
+			BinStatistics( Table ).sum2 += Sum2;
+			BinStatistics( Table ).n += Count;
+			BinStatistics( Table ).minimum = min( BinStatistics( Table ).minimum, Minimum );
+			BinStatistics( Table ).maximum = max( BinStatistics( Table ).maximum, Maximum );
+		}
+
+		if ( ! ResultsFile ) {
+			ShowSevereError( "MergeChunkTabularResults: The tabular results file of chunk=" + Chunks[ Earlier ].Name + " ended early, the monthly and binned tables are incomplete." );
+		}
+
+	}
+
+	void
+	CopyChunkTabularFiles()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Copies the tabular report files of the last chunk, which hold the merged monthly and
+		// binned tables, to the folder of the parent.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static FArray1D_string const TabularFiles( 5, { "eplustbl.csv", "eplustbl.tab", "eplustbl.txt", "eplustbl.htm", "eplustbl.xml" } );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int FileNum; // index into TabularFiles
+
+		for ( FileNum = 1; FileNum <= 5; ++FileNum ) {
+			std::ifstream ChunkFile( Chunks.back().Name + pathChar + TabularFiles( FileNum ), std::ios_base::binary );
+			if ( ! ChunkFile ) continue;
+			std::ofstream ParentFile( TabularFiles( FileNum ), std::ios_base::binary | std::ios_base::trunc );
+			ParentFile << ChunkFile.rdbuf();
+		}
+
+	}
+
+	int
+	MergeChunkOutputFile( std::string const & FileName ) // Output file found in every chunk folder
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Merges an ESO format output file (eplusout.eso or eplusout.mtr) of all chunks into
+		// one file in the folder of the parent. Returns the number of data records written.
+
+		// METHODOLOGY EMPLOYED:
+		// The data dictionary and the design day environments are copied from the first chunk.
+		// Each chunk file is read twice: first to find the header line of its last environment,
+		// the run period, and then to copy the run period data. Time stamp lines (2 = timestep
+		// or hourly, 3 = daily, 4 = monthly) decide whether the value lines that follow them
+		// are kept: stamps before the first day of a later chunk belong to its overlap window
+		// and are dropped, as is every run period stamp (5) with its values. The day of
+		// simulation of a kept stamp is shifted by the days between the start of the run period
+		// and the start of the chunk simulation.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+		using General::JulianDay;
+
+		// Return value
+		int NumRecords( 0 );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static std::string const EndOfDictionary( "End of Data Dictionary" );
+		static std::string const EndOfData( "End of Data" );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int NumChunks( Chunks.size() ); // number of chunks
+		int ChunkIndex; // chunk index (zero based)
+		std::ifstream ChunkFile; // output file of a chunk
+		std::ofstream MergedFile; // merged output file
+		std::string Line; // line of a chunk file
+		std::string::size_type Pos1; // position of the comma after the record code
+		std::string::size_type Pos2; // position of the comma after the day of simulation
+		std::string::size_type Pos3; // position of the comma after the month
+		int LineNum; // line of a chunk file
+		int LastEnvrnLine; // line of the header of the last environment of a chunk file
+		int Code; // record code of a line (1 = environment, 2-5 = time stamps, others = values)
+		int Month; // month of a time stamp
+		int Day; // day of month of a time stamp
+		int DayOffset; // shift of the day of simulation of a chunk
+		bool InDictionary; // true while reading the data dictionary
+		bool Keep; // true while the values of the current time stamp are kept
+
+		{ std::ifstream FirstFile( Chunks[ 0 ].Name + pathChar + FileName ); if ( ! FirstFile ) return NumRecords; }
+		MergedFile.open( FileName, std::ios_base::trunc );
+
+		for ( ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex ) {
+			ChunkFile.clear();
+			ChunkFile.open( Chunks[ ChunkIndex ].Name + pathChar + FileName );
+			if ( ! ChunkFile ) {
+				ShowSevereError( "MergeChunkOutputFile: Could not open " + FileName + " of chunk=" + Chunks[ ChunkIndex ].Name + ", its dates are missing from the merged file." );
+				continue;
+			}
+
+			// First pass: find the run period environment
+			LineNum = 0;
+			LastEnvrnLine = 0;
+			InDictionary = true;
+			while ( std::getline( ChunkFile, Line ) ) {
+				++LineNum;
+				if ( InDictionary ) {
+					if ( Line == EndOfDictionary ) InDictionary = false;
+					continue;
+				}
+				if ( has_prefix( Line, "1," ) ) LastEnvrnLine = LineNum;
+			}
+			ChunkFile.clear();
+			ChunkFile.seekg( 0 );
+
+			// Second pass: copy the data
+			DayOffset = Chunks[ ChunkIndex ].RunStartDate - Chunks[ 0 ].StartDate;
+			LineNum = 0;
+			InDictionary = true;
+			Keep = ( ChunkIndex == 0 );
+			while ( std::getline( ChunkFile, Line ) ) {
+				++LineNum;
+				if ( InDictionary ) {
+					if ( ChunkIndex == 0 ) MergedFile << Line << '\n';
+					if ( Line == EndOfDictionary ) InDictionary = false;
+					continue;
+				}
+				if ( Line == EndOfData ) break;
+				if ( LineNum <= LastEnvrnLine ) {
+					if ( ChunkIndex > 0 ) continue;
+					MergedFile << Line << '\n';
+					++NumRecords;
+					continue;
+				}
+
+				Pos1 = Line.find( ',' );
+				Code = std::atoi( Line.substr( 0, Pos1 ).c_str() );
+				if ( Code >= 2 && Code <= 5 && Pos1 != std::string::npos ) {
+					Pos2 = Line.find( ',', Pos1 + 1 );
+					Pos3 = ( Pos2 == std::string::npos ? Pos2 : Line.find( ',', Pos2 + 1 ) );
+					if ( Code == 5 || Pos2 == std::string::npos ) {
+						Keep = false;
+					} else if ( Code == 4 ) {
+						Month = std::atoi( Line.c_str() + Pos2 + 1 );
+						Keep = ( ChunkIndex == 0 || JulianDay( Month, 1, 0 ) >= Chunks[ ChunkIndex ].StartDate );
+					} else if ( Pos3 == std::string::npos ) {
+						Keep = false;
+					} else {
+						Month = std::atoi( Line.c_str() + Pos2 + 1 );
+						Day = std::atoi( Line.c_str() + Pos3 + 1 );
+						Keep = ( JulianDay( Month, Day, 0 ) >= Chunks[ ChunkIndex ].StartDate );
+					}
+					if ( Keep && DayOffset != 0 ) {
+						Line = Line.substr( 0, Pos1 + 1 ) + TrimSigDigits( std::atoi( Line.c_str() + Pos1 + 1 ) + DayOffset ) + Line.substr( Pos2 );
+					}
+				}
+				if ( ! Keep ) continue;
+				MergedFile << Line << '\n';
+				++NumRecords;
+			}
+			ChunkFile.close();
+		}
+
+		MergedFile << EndOfData << '\n';
+		MergedFile << " Number of Records Written=" << NumRecords << '\n';
+		MergedFile.close();
+
+		return NumRecords;
+
+	}
+
+	void
+	CompareChunkSeam( int const ChunkIndex ) // Index into Chunks of the later chunk (zero based)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Compares the zone mean air temperatures of a chunk over its overlap window with those
+		// of the previous chunk for the same hours.
+
+		// METHODOLOGY EMPLOYED:
+		// The hours of the previous chunk from the start of the overlap window on are read
+		// from its seam file into a map keyed by day and hour; the hours of the later chunk
+		// before its own start are then compared zone by zone. The largest and RMS differences
+		// over the window and the largest difference in its last hour, just before the seam,
+		// are kept with the later chunk.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::map< int, std::vector< Real64 > > PreviousTemps; // zone temperatures of the previous chunk by day and hour
+		std::map< int, std::vector< Real64 > >::const_iterator Previous; // hour of the previous chunk
+		std::vector< Real64 > Temps; // zone temperatures of a seam file line
+		std::string Line; // line of a seam file
+		char const * Ptr; // start of a field
+		char * End; // end of a field
+		int Day; // day of year of a seam file line
+		int Hour; // hour of a seam file line
+		int Key; // day and hour of a seam file line
+		int Pass; // 1 = previous chunk, 2 = this chunk
+		int LastKey( 0 ); // last hour compared
+		int ZoneIndex; // zone index (zero based)
+		int NumZones; // number of zones compared in an hour
+		int NumDiffs( 0 ); // number of zone hours compared
+		Real64 Diff; // zone temperature difference (deltaC)
+		Real64 HourMaxDiff; // largest difference in the current hour (deltaC)
+		Real64 SumSqDiff( 0.0 ); // sum of squared differences (deltaC2)
+		RunPeriodChunk & Chunk( Chunks[ ChunkIndex ] );
+
+		if ( Chunk.RunStartDate >= Chunk.StartDate ) return;
+
+		for ( Pass = 1; Pass <= 2; ++Pass ) {
+			std::ifstream SeamInput( Chunks[ ChunkIndex + ( Pass == 1 ? -1 : 0 ) ].Name + pathChar + SeamFileName );
+			if ( ! SeamInput ) return;
+			while ( std::getline( SeamInput, Line ) ) {
+				Ptr = Line.c_str();
+				Day = std::strtol( Ptr, &End, 10 );
+				if ( End == Ptr || *End != ',' ) continue;
+				Ptr = End + 1;
+				Hour = std::strtol( Ptr, &End, 10 );
+				if ( End == Ptr ) continue;
+				if ( Day < Chunk.RunStartDate || Day >= Chunk.StartDate ) continue;
+				Key = Day * 100 + Hour;
+				Temps.clear();
+				while ( *End == ',' ) {
+					Ptr = End + 1;
+					Temps.push_back( std::strtod( Ptr, &End ) );
+				}
+				if ( Pass == 1 ) {
+					PreviousTemps[ Key ] = Temps;
+					continue;
+				}
+				Previous = PreviousTemps.find( Key );
+				if ( Previous == PreviousTemps.end() ) continue;
+				NumZones = min( int( Temps.size() ), int( Previous->second.size() ) );
+				HourMaxDiff = 0.0;
+				for ( ZoneIndex = 0; ZoneIndex < NumZones; ++ZoneIndex ) {
+					Diff = std::abs( Temps[ ZoneIndex ] - Previous->second[ ZoneIndex ] );
+					HourMaxDiff = max( HourMaxDiff, Diff );
+					SumSqDiff += Diff * Diff;
+					++NumDiffs;
+				}
+				++Chunk.SeamHours;
+				Chunk.SeamMaxDiff = max( Chunk.SeamMaxDiff, HourMaxDiff );
+				if ( Key > LastKey ) {
+					LastKey = Key;
+					Chunk.SeamEndDiff = HourMaxDiff;
+				}
+			}
+		}
+		if ( NumDiffs > 0 ) Chunk.SeamRMSDiff = std::sqrt( SumSqDiff / NumDiffs );
+
+	}
+
+	std::string
+	ChunkDateString( int const Date ) // Day of year (non-leap)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Formats a chunk date as month/day.
+
+		// Using/Aliasing
+		using General::InvJulianDay;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Month; // month of the date
+		int Day; // day of month of the date
+
+		InvJulianDay( Date, Month, Day, 0 );
+		return TrimSigDigits( Month ) + '/' + TrimSigDigits( Day );
+
+	}
+
+	void
+	ReportRunPeriodChunks(
+		Real64 const SetupTime, // Time spent before the first chunk was started (s)
+		int const NumESORecords, // Records written to the merged eplusout.eso
+		int const NumMTRRecords // Records written to the merged eplusout.mtr
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the outcome of each chunk, with the zone temperature differences at its seam
+		// with the previous chunk, to the audit file of the parent and reports failed chunks
+		// as severe errors.
+
+		// Using/Aliasing
+		using DataSystemVariables::RunPeriodOverlapDays;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int EchoInputFile; // found unit number for "eplusout.audit"
+		int ChunkIndex; // chunk index (zero based)
+		int NumChunks( Chunks.size() ); // number of chunks
+		int NumFailed( 0 ); // number of chunks that did not end with a zero exit status
+
+		EchoInputFile = FindUnitNumber( "eplusout.audit" );
+
+		gio::write( EchoInputFile, fmtA ) << "Run Period Chunks,#Chunks,Overlap {days},Input Processing Time {s},#ESO Records Merged,#MTR Records Merged";
+		gio::write( EchoInputFile, fmtA ) << "Run Period Chunks," + TrimSigDigits( NumChunks ) + ',' + TrimSigDigits( RunPeriodOverlapDays ) + ',' + RoundSigDigits( SetupTime, 2 ) + ',' + TrimSigDigits( NumESORecords ) + ',' + TrimSigDigits( NumMTRRecords );
+		gio::write( EchoInputFile, fmtA ) << "Run Period Chunk,Name,Start Date,End Date,Simulation Start Date,Exit Status,Run Time {s},#Seam Hours Compared,Max Seam Zone Temperature Difference {deltaC},RMS Seam Zone Temperature Difference {deltaC},Last Seam Hour Zone Temperature Difference {deltaC}";
+		for ( ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex ) {
+			gio::write( EchoInputFile, fmtA ) << "Run Period Chunk," + Chunks[ ChunkIndex ].Name + ',' + ChunkDateString( Chunks[ ChunkIndex ].StartDate ) + ',' + ChunkDateString( Chunks[ ChunkIndex ].EndDate ) + ',' + ChunkDateString( Chunks[ ChunkIndex ].RunStartDate ) + ',' + TrimSigDigits( Chunks[ ChunkIndex ].ExitStatus ) + ',' + RoundSigDigits( Chunks[ ChunkIndex ].RunTime, 2 ) + ',' + TrimSigDigits( Chunks[ ChunkIndex ].SeamHours ) + ',' + RoundSigDigits( Chunks[ ChunkIndex ].SeamMaxDiff, 3 ) + ',' + RoundSigDigits( Chunks[ ChunkIndex ].SeamRMSDiff, 3 ) + ',' + RoundSigDigits( Chunks[ ChunkIndex ].SeamEndDiff, 3 );
+			if ( Chunks[ ChunkIndex ].ExitStatus != 0 ) {
+				ShowSevereError( "SimulateRunPeriodChunks: Chunk=" + Chunks[ ChunkIndex ].Name + " did not complete successfully, see the output in its folder." );
+				++NumFailed;
+			}
+		}
+		if ( NumFailed > 0 ) {
+			ShowContinueError( "...The chunk outputs were not merged." );
+		}
+		ShowMessage( "Run period chunks: " + TrimSigDigits( NumChunks - NumFailed ) + " of " + TrimSigDigits( NumChunks ) + " chunks completed successfully." );
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in EnergyPlus.f90.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // RunPeriodChunks
+
+} // EnergyPlus
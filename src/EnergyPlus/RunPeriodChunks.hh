@@ -0,0 +1,133 @@
+#ifndef RunPeriodChunks_hh_INCLUDED
+#define RunPeriodChunks_hh_INCLUDED
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace RunPeriodChunks {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern std::string const SeamFileName; // Zone temperatures of the overlap windows, written by each chunk
+	extern std::string const TabularFileName; // Monthly and binned tabular results, written by each chunk but the last
+	extern std::string const TabularHeader; // First word of a tabular results file
+	extern std::string const TabularMissing; // Written by the parent for a chunk that ended without its results
+
+	// DERIVED TYPE DEFINITIONS
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern int ChunkNum; // Chunk simulated by this process (0 in the parent and in serial runs)
+	extern int SeamFile; // Unit number of the seam file of a chunk process
+
+	// Types
+
+	struct RunPeriodChunk
+	{
+		// Members
+		std::string Name; // Name of the chunk, also its output folder
+		int StartDate; // First day of year reported by the chunk
+		int EndDate; // Last day of year of the chunk
+		int RunStartDate; // First day of year simulated by the chunk (StartDate less the overlap)
+		int PID; // Process id while the chunk is running
+		int ExitStatus; // Exit status of the chunk process (-1 = did not run to an exit)
+		Real64 StartTime; // Elapsed time when the chunk was started (s)
+		Real64 RunTime; // Wall clock time of the chunk (s)
+		int SeamHours; // Hours of the overlap window compared with the previous chunk
+		Real64 SeamMaxDiff; // Largest zone mean air temperature difference over the overlap window (deltaC)
+		Real64 SeamRMSDiff; // RMS zone mean air temperature difference over the overlap window (deltaC)
+		Real64 SeamEndDiff; // Largest zone mean air temperature difference in the last overlap hour (deltaC)
+
+		// Default Constructor
+		RunPeriodChunk() :
+			StartDate( 0 ),
+			EndDate( 0 ),
+			RunStartDate( 0 ),
+			PID( 0 ),
+			ExitStatus( -1 ),
+			StartTime( 0.0 ),
+			RunTime( 0.0 ),
+			SeamHours( 0 ),
+			SeamMaxDiff( 0.0 ),
+			SeamRMSDiff( 0.0 ),
+			SeamEndDiff( 0.0 )
+		{}
+
+	};
+
+	// Object Data
+	extern std::vector< RunPeriodChunk > Chunks;
+
+	// Functions
+
+	void
+	SimulateRunPeriodChunks();
+
+	bool
+	SetupRunPeriodChunks();
+
+	std::string
+	UnmergedOutputRequested(
+		bool const MonthlyTotals, // True if monthly totals are also split
+		bool const TablesMerged // True if the monthly and binned tabular results are merged
+	);
+
+	bool
+	StartRunPeriodChunk( int const ChunkIndex ); // Index into Chunks (zero based)
+
+	void
+	SetRunPeriodDates(
+		int const StartDate, // New first day of year of the run period
+		int const EndDate // New last day of year of the run period
+	);
+
+	void
+	RecordChunkSeamTemperatures();
+
+	bool
+	InChunkOverlap();
+
+	int
+	ChunkOfMonth( int const Month ); // Month of the year
+
+	void
+	ExchangeChunkTabularResults();
+
+	void
+	WriteChunkTabularResults();
+
+	void
+	MergeChunkTabularResults(
+		int const Earlier, // Index into Chunks of the earlier chunk (zero based)
+		std::string const & FileName // Tabular results file of the earlier chunk
+	);
+
+	void
+	CopyChunkTabularFiles();
+
+	int
+	MergeChunkOutputFile( std::string const & FileName ); // Output file found in every chunk folder
+
+	void
+	CompareChunkSeam( int const ChunkIndex ); // Index into Chunks of the later chunk (zero based)
+
+	std::string
+	ChunkDateString( int const Date ); // Day of year (non-leap)
+
+	void
+	ReportRunPeriodChunks(
+		Real64 const SetupTime, // Time spent before the first chunk was started (s)
+		int const NumESORecords, // Records written to the merged eplusout.eso
+		int const NumMTRRecords // Records written to the merged eplusout.mtr
+	);
+
+} // RunPeriodChunks
+
+} // EnergyPlus
+
+#endif
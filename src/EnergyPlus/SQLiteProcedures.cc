@@ -65,6 +65,7 @@ SQLite::SQLite()
 	m_zoneSizingInsertStmt(nullptr),
 	m_systemSizingInsertStmt(nullptr),
 	m_componentSizingInsertStmt(nullptr),
+	m_controllerTelemetryInsertStmt(nullptr),
 	m_roomAirModelInsertStmt(nullptr),
 	m_groundTemperatureInsertStmt(nullptr),
 	m_weatherFileInsertStmt(nullptr),
@@ -188,6 +189,7 @@ SQLite::SQLite()
 			initializeZoneSizingTable();
 			initializeSystemSizingTable();
 			initializeComponentSizingTable();
+			initializeControllerTelemetryTable();
 			initializeRoomAirModelTable();
 			initializeSchedulesTable();
 			initializeDaylightMapTables();
@@ -234,6 +236,7 @@ SQLite::~SQLite()
 	sqlite3_finalize(m_zoneSizingInsertStmt);
 	sqlite3_finalize(m_systemSizingInsertStmt);
 	sqlite3_finalize(m_componentSizingInsertStmt);
+	sqlite3_finalize(m_controllerTelemetryInsertStmt);
 	sqlite3_finalize(m_roomAirModelInsertStmt);
 	sqlite3_finalize(m_groundTemperatureInsertStmt);
 	sqlite3_finalize(m_weatherFileInsertStmt);
@@ -948,6 +951,22 @@ void SQLite::initializeComponentSizingTable()
 	sqlitePrepareStatement(m_componentSizingInsertStmt,componentSizingInsertSQL);
 }
 
+void SQLite::initializeControllerTelemetryTable()
+{
+	const std::string controllerTelemetryTableSQL =
+		"CREATE TABLE ControllerTelemetry (ControllerName TEXT, AirLoopName TEXT, "
+		"NumSolves INTEGER, NumIterations INTEGER, AvgIterations REAL, MaxIterations INTEGER, "
+		"NumWarmRestarts INTEGER, WarmRestartSuccessRate REAL, NumNotConverged INTEGER, "
+		"NumBracketReuses INTEGER, SolveTime REAL);";
+
+	sqliteExecuteCommand(controllerTelemetryTableSQL);
+
+	const std::string controllerTelemetryInsertSQL =
+		"INSERT INTO ControllerTelemetry VALUES(?,?,?,?,?,?,?,?,?,?,?);";
+
+	sqlitePrepareStatement(m_controllerTelemetryInsertStmt,controllerTelemetryInsertSQL);
+}
+
 void SQLite::initializeRoomAirModelTable()
 {
 	const std::string roomAirModelsTableSQL =
@@ -1668,6 +1687,45 @@ void SQLite::addSQLiteComponentSizingRecord(
 	}
 }
 
+void SQLite::addSQLiteControllerTelemetryRecord(
+	std::string const & controllerName, // the name of the controller
+	std::string const & airLoopName, // the name of the air loop the controller is on
+	int const numSolves, // number of cold starts and warm restarts
+	int const numIterations, // total number of controller iterations
+	int const maxIterations, // maximum number of iterations for one solution
+	int const numWarmRestarts, // number of speculative warm restarts attempted
+	int const numSuccessfulWarmRestarts, // number of speculative warm restarts that converged
+	int const numNotConverged, // number of solutions not converged at the final check
+	int const numBracketReuses, // number of times the previous brackets were tried
+	Real64 const solveTime // wall clock time spent iterating the controller [s]
+)
+{
+	if( m_writeOutputToSQLite ) {
+		sqliteBindText(m_controllerTelemetryInsertStmt, 1, controllerName);
+		sqliteBindText(m_controllerTelemetryInsertStmt, 2, airLoopName);
+		sqliteBindInteger(m_controllerTelemetryInsertStmt, 3, numSolves);
+		sqliteBindInteger(m_controllerTelemetryInsertStmt, 4, numIterations);
+		if( numSolves > 0 ) {
+			sqliteBindDouble(m_controllerTelemetryInsertStmt, 5, double(numIterations) / double(numSolves));
+		} else {
+			sqliteBindNULL(m_controllerTelemetryInsertStmt, 5);
+		}
+		sqliteBindInteger(m_controllerTelemetryInsertStmt, 6, maxIterations);
+		sqliteBindInteger(m_controllerTelemetryInsertStmt, 7, numWarmRestarts);
+		if( numWarmRestarts > 0 ) {
+			sqliteBindDouble(m_controllerTelemetryInsertStmt, 8, double(numSuccessfulWarmRestarts) / double(numWarmRestarts));
+		} else {
+			sqliteBindNULL(m_controllerTelemetryInsertStmt, 8);
+		}
+		sqliteBindInteger(m_controllerTelemetryInsertStmt, 9, numNotConverged);
+		sqliteBindInteger(m_controllerTelemetryInsertStmt, 10, numBracketReuses);
+		sqliteBindDouble(m_controllerTelemetryInsertStmt, 11, solveTime);
+
+		sqliteStepCommand(m_controllerTelemetryInsertStmt);
+		sqliteResetCommand(m_controllerTelemetryInsertStmt);
+	}
+}
+
 void SQLite::createSQLiteRoomAirModelTable()
 {
 	if( m_writeOutputToSQLite ) {
@@ -98,6 +98,19 @@ public:
 		Real64 const VarValue // the value from the sizing calculation
 	);
 
+	void addSQLiteControllerTelemetryRecord(
+		std::string const & ControllerName, // the name of the controller
+		std::string const & AirLoopName, // the name of the air loop the controller is on
+		int const NumSolves, // number of cold starts and warm restarts
+		int const NumIterations, // total number of controller iterations
+		int const MaxIterations, // maximum number of iterations for one solution
+		int const NumWarmRestarts, // number of speculative warm restarts attempted
+		int const NumSuccessfulWarmRestarts, // number of speculative warm restarts that converged
+		int const NumNotConverged, // number of solutions not converged at the final check
+		int const NumBracketReuses, // number of times the previous brackets were tried
+		Real64 const SolveTime // wall clock time spent iterating the controller [s]
+	);
+
 	void createSQLiteRoomAirModelTable();
 
 	void createSQLiteMeterDictionaryRecord(
@@ -250,6 +263,7 @@ private:
 	void initializeZoneSizingTable();
 	void initializeSystemSizingTable();
 	void initializeComponentSizingTable();
+	void initializeControllerTelemetryTable();
 	void initializeRoomAirModelTable();
 	void initializeSchedulesTable();
 	void initializeDaylightMapTables();
@@ -290,6 +304,7 @@ private:
 	sqlite3_stmt * m_zoneSizingInsertStmt;
 	sqlite3_stmt * m_systemSizingInsertStmt;
 	sqlite3_stmt * m_componentSizingInsertStmt;
+	sqlite3_stmt * m_controllerTelemetryInsertStmt;
 	sqlite3_stmt * m_roomAirModelInsertStmt;
 	sqlite3_stmt * m_groundTemperatureInsertStmt;
 	sqlite3_stmt * m_weatherFileInsertStmt;
@@ -118,6 +118,7 @@ namespace ScheduleManager {
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   September 1997
 		//       MODIFIED       Rui Zhang February 2010
+		//                      October 2014: read Schedule:Compact through GetObjectItemRecord
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -132,10 +133,13 @@ namespace ScheduleManager {
 		// Using/Aliasing
 		using InputProcessor::GetNumObjectsFound;
 		using InputProcessor::GetObjectItem;
+		using InputProcessor::GetObjectItemRecord;
+		using InputProcessor::LineDefinition;
 		using InputProcessor::FindItemInList;
 		using InputProcessor::ProcessNumber;
 		using InputProcessor::VerifyName;
 		using InputProcessor::GetObjectDefMaxArgs;
+		using InputProcessor::GetObjectDefFieldNames;
 		using InputProcessor::SameString;
 		using InputProcessor::FindItem;
 		using General::ProcessDateString;
@@ -224,6 +228,7 @@ namespace ScheduleManager {
 		int NumExpectedItems;
 		int MaxNums;
 		int MaxAlps;
+		int LastNumAlphas; // Alpha fields that may still hold the previous object's values
 		int AddWeekSch;
 		int AddDaySch;
 		FArray1D_bool AllDays( MaxDayTypes );
@@ -981,8 +986,17 @@ namespace ScheduleManager {
 		AddWeekSch = NumRegWeekSchedules;
 		AddDaySch = NumRegDaySchedules;
 		CurrentModuleObject = "Schedule:Compact";
+		if ( NumCptSchedules > 0 ) GetObjectDefFieldNames( CurrentModuleObject, cAlphaFields, cNumericFields );
+		LastNumAlphas = MaxAlps;
 		for ( LoopIndex = 1; LoopIndex <= NumCptSchedules; ++LoopIndex ) {
-			GetObjectItem( CurrentModuleObject, LoopIndex, Alphas, NumAlphas, Numbers, NumNumbers, Status, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
+			// Compact schedules can have thousands of fields; GetObjectItem would blank and fill the full
+			// IDD field list (and its field names) for each one. Only the entered fields are copied (the
+			// processing below edits them) and only the ones the previous object used are blanked.
+			LineDefinition const & ScheduleRec( GetObjectItemRecord( CurrentModuleObject, LoopIndex ) );
+			NumAlphas = ScheduleRec.NumAlphas;
+			if ( NumAlphas > 0 ) Alphas( {1,NumAlphas} ) = ScheduleRec.Alphas( {1,NumAlphas} );
+			if ( LastNumAlphas > NumAlphas ) Alphas( {NumAlphas + 1,LastNumAlphas} ) = BlankString;
+			LastNumAlphas = NumAlphas;
 			IsNotOK = false;
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), Schedule( {1,NumSchedules} ).Name(), SchNum, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
@@ -996,7 +1010,7 @@ namespace ScheduleManager {
 			// Validate ScheduleType
 			CheckIndex = FindItemInList( Alphas( 2 ), ScheduleType( {1,NumScheduleTypes} ).Name(), NumScheduleTypes );
 			if ( CheckIndex == 0 ) {
-				if ( ! lAlphaBlanks( 2 ) ) {
+				if ( NumAlphas >= 2 && ! ScheduleRec.AlphBlank( 2 ) ) {
 					ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\" not found -- will not be validated" );
 				} else {
 					ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", Blank " + cAlphaFields( 2 ) + " input -- will not be validated." );
@@ -1,4 +1,5 @@
 // C++ Headers
+#include <chrono>
 #include <cmath>
 
 // ObjexxFCL Headers
@@ -2265,6 +2266,7 @@ namespace SimAirServingZones {
 		using namespace DataSystemVariables;
 		using HVACControllers::TrackAirLoopControllers;
 		using HVACControllers::TraceAirLoopControllers;
+		using HVACControllers::ControllerTelemetry;
 		using General::CreateSysTimeIntervalString;
 
 		// Locals
@@ -2341,6 +2343,10 @@ namespace SimAirServingZones {
 
 			// Retry with cold start using default initial values if speculative warm restart did not work
 			if ( ! AirLoopConvergedFlag ) {
+				// The cold start completes the solutions already counted by the warm restart
+				for ( int AirLoopControlNum = 1; AirLoopControlNum <= PrimaryAirSystem( AirLoopNum ).NumControllers; ++AirLoopControlNum ) {
+					ControllerTelemetry( PrimaryAirSystem( AirLoopNum ).ControllerIndex( AirLoopControlNum ) ).ColdStartRetry = true;
+				}
 				SolveAirLoopControllers( FirstHVACIteration, AirLoopPass, AirLoopNum, AirLoopConvergedFlag, IterMax, IterTot, NumCalls );
 
 				// Update air loop trackers
@@ -2410,6 +2416,7 @@ namespace SimAirServingZones {
 		// Using/Aliasing
 		using namespace DataHVACControllers;
 		using HVACControllers::ManageControllers;
+		using HVACControllers::ControllerTelemetry;
 		using General::CreateSysTimeIntervalString;
 
 		// Locals
@@ -2500,6 +2507,9 @@ namespace SimAirServingZones {
 				continue;
 			}
 
+			// Wall clock time for the controller telemetry, including the air loop evaluations
+			auto const IterStartTime( std::chrono::steady_clock::now() );
+
 			// For each controller in sequence, iterate until convergence
 			while ( ! ControllerConvergedFlag ) {
 
@@ -2547,6 +2557,8 @@ namespace SimAirServingZones {
 
 			} // End of the Convergence Iteration
 
+			ControllerTelemetry( PrimaryAirSystem( AirLoopNum ).ControllerIndex( AirLoopControlNum ) ).SolveTime += std::chrono::duration< Real64 >( std::chrono::steady_clock::now() - IterStartTime ).count();
+
 			// Update tracker for max iteration counter across all controllers on this air loops
 			IterMax = max( IterMax, Iter );
 			// Update tracker for aggregated counter of air loop inner iterations across controllers
@@ -2593,7 +2605,7 @@ namespace SimAirServingZones {
 		// SUBROUTINE INFORMATION
 		//             AUTHOR:  Dimitri Curtil (LBNL)
 		//       DATE WRITTEN:  Feb 2006
-		//           MODIFIED:
+		//           MODIFIED:  October 2014, controller solve time telemetry
 		//      RE-ENGINEERED:  This is new code
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2614,6 +2626,7 @@ namespace SimAirServingZones {
 		// Using/Aliasing
 		using namespace DataHVACControllers;
 		using HVACControllers::ManageControllers;
+		using HVACControllers::ControllerTelemetry;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2652,6 +2665,9 @@ namespace SimAirServingZones {
 		IsUpToDateFlag = false;
 		PrimaryAirSystem( AirLoopNum ).ControlConverged = false;
 
+		// The warm restart evaluates the air loop once for all its controllers
+		auto const ReSolveStartTime( std::chrono::steady_clock::now() );
+
 		// This call to ManageControllers reinitializes the controllers actuated variables to zero
 		// E.g., actuator inlet water flow
 		for ( AirLoopControlNum = 1; AirLoopControlNum <= PrimaryAirSystem( AirLoopNum ).NumControllers; ++AirLoopControlNum ) {
@@ -2684,6 +2700,14 @@ namespace SimAirServingZones {
 
 		} // end of controller loop
 
+		// Share the warm restart time evenly among the controllers it served
+		if ( PrimaryAirSystem( AirLoopNum ).NumControllers > 0 ) {
+			Real64 const ReSolveTime( std::chrono::duration< Real64 >( std::chrono::steady_clock::now() - ReSolveStartTime ).count() / PrimaryAirSystem( AirLoopNum ).NumControllers );
+			for ( AirLoopControlNum = 1; AirLoopControlNum <= PrimaryAirSystem( AirLoopNum ).NumControllers; ++AirLoopControlNum ) {
+				ControllerTelemetry( PrimaryAirSystem( AirLoopNum ).ControllerIndex( AirLoopControlNum ) ).SolveTime += ReSolveTime;
+			}
+		}
+
 	}
 
 	void
@@ -0,0 +1,1204 @@
+// C++ Headers
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray.functions.hh>
+#include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/Fmath.hh>
+#include <ObjexxFCL/gio.hh>
+#include <ObjexxFCL/string.functions.hh>
+
+// EnergyPlus Headers
+#include <SimulationCheckpoint.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataHeatBalSurface.hh>
+#include <DataIPShortCuts.hh>
+#include <DataLoopNode.hh>
+#include <DataPlant.hh>
+#include <DataPrecisionGlobals.hh>
+#include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
+#include <DisplayRoutines.hh>
+#include <General.hh>
+#include <HVACControllers.hh>
+#include <InputProcessor.hh>
+#include <RunPeriodChunks.hh>
+#include <UtilityRoutines.hh>
+#include <WaterThermalTanks.hh>
+#include <WeatherManager.hh>
+
+namespace EnergyPlus {
+
+namespace SimulationCheckpoint {
+
+	// MODULE INFORMATION
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2014
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Writes the state of a weather file run period to a checkpoint file after warmup or at
+	// the end of a given day, and restarts a later run of the same input from such a file
+	// without repeating the warmup and the days before the checkpoint. The same state is
+	// also kept in memory after each converged warmup, so that later environments that
+	// start identically can skip their own warmup.
+
+	// METHODOLOGY EMPLOYED:
+	// EP_CHECKPOINT=WARMUP writes eplusout.ckpt when the warmup of the run period has
+	// converged, EP_CHECKPOINT=month/day writes it after the last timestep of that day.
+	// The file holds the history terms the building and system solution carries from one
+	// timestep to the next: the surface conduction (CTF) temperature and flux histories,
+	// the zone air temperature and humidity ratio histories of the predictor-corrector, the
+	// state of every loop node, the common pipe tank temperatures of the plant loops, the
+	// window layer face temperatures, the temperatures and heater modes of the water
+	// thermal tanks (and their stratified nodes) and the saved solutions of the air loop
+	// controllers. Each block is written with its length, so that a file written for another
+	// input is rejected when it is read back.
+	// EP_RESTART=file restarts from a checkpoint: after ProcessInput the RunPeriod is set
+	// to start on the day after the checkpoint (or on its first day for a warmup checkpoint),
+	// sizing and design days run as usual, and at the end of the first warmup day of the
+	// run period the checkpointed state replaces the warmup convergence check and ends the
+	// warmup. Reporting restarts at the restart date, so a restart after the first day of
+	// the run period is refused when the input requests totals that would span the restart
+	// date (tabular and SQLite output, run period and annual variables and meters, and
+	// monthly ones when the restart date is not the first of a month).
+	// With EP_SHARED_WARMUP the state is copied into memory whenever the warmup of an
+	// environment has converged, keyed by WarmupStateKey: the day of year and calendar of
+	// the warmup day, a content hash of its weather, whether the zones are conditioned by
+	// ideal loads or by the HVAC system, and a content hash of the input objects. An
+	// environment with the same key, whatever its kind or name, restores the copy at
+	// the end of its first warmup day instead of warming up until convergence; the warmup
+	// days saved are reported in the eio file.
+	// The load histories of the ground heat exchangers and buried pipes count time from the
+	// first day of the environment, which a restart moves, and the state of ice and electric
+	// storage, storage collectors, EMS programs and external interfaces is not kept either.
+	// An input with any of these (UnsupportedStateObject) writes no checkpoint, does not
+	// share warmup states and cannot be restarted, instead of giving different results.
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// na
+
+	// Using/Aliasing
+	using namespace DataPrecisionGlobals;
+	using General::RoundSigDigits;
+	using General::TrimSigDigits;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	std::string const CheckpointFileName( "eplusout.ckpt" ); // Checkpoint file written by a run
+	std::string const CheckpointMagic( "EnergyPlus checkpoint" ); // First bytes of a checkpoint file
+	int const CheckpointVersion( 2 ); // Layout version of the checkpoint file
+
+	// DERIVED TYPE DEFINITIONS:
+	// na
+
+	// MODULE VARIABLE DECLARATIONS:
+	int CheckpointDay( 0 ); // Day of year after which the state is written (0 = none)
+	bool CheckpointAfterWarmup( false ); // True to write the state when the run period warmup has converged
+	bool RestartPending( false ); // True until the state of the restart file has been restored
+	bool RestoredFromCheckpoint( false ); // True once the state of the restart file has been restored
+	bool WarmupStateReused( false ); // True if the warmup of the current environment was replaced by a cached state
+	std::string UnsupportedObject; // First object of the input whose state is not in a checkpoint (blank if none)
+
+	// SUBROUTINE SPECIFICATIONS FOR MODULE SimulationCheckpoint:
+
+	// Object Data
+	std::map< std::string, WarmupState > WarmupStates; // Converged warmup states by WarmupStateKey
+
+	// Functions
+
+	void
+	InitSimulationCheckpoint()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Interprets the checkpoint, restart and shared warmup settings after ProcessInput and,
+		// for a restart, moves the start of the RunPeriod to the restart date of the checkpoint
+		// file.
+
+		// METHODOLOGY EMPLOYED:
+		// Only the header of the restart file is read here; the state itself is read when it
+		// is restored, once all arrays have been allocated by the simulation. Inputs with state
+		// the checkpoint does not hold write no checkpoint and share no warmup (with a warning)
+		// and cannot be restarted.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataIPShortCuts::cAlphaArgs;
+		using DataIPShortCuts::cAlphaFieldNames;
+		using DataIPShortCuts::cNumericFieldNames;
+		using DataIPShortCuts::lAlphaFieldBlanks;
+		using DataIPShortCuts::lNumericFieldBlanks;
+		using DataIPShortCuts::rNumericArgs;
+		using DataSystemVariables::cCheckpointDate;
+		using DataSystemVariables::CheckpointDate;
+		using DataSystemVariables::cRunPeriodChunks;
+		using DataSystemVariables::DDOnly;
+		using DataSystemVariables::FullAnnualRun;
+		using DataSystemVariables::NumRunPeriodChunks;
+		using DataSystemVariables::RestartFile;
+		using DataSystemVariables::cSharedWarmup;
+		using DataSystemVariables::SharedWarmup;
+		using General::InvJulianDay;
+		using General::JulianDay;
+		using InputProcessor::GetNumObjectsFound;
+		using InputProcessor::GetObjectItem;
+		using InputProcessor::SameString;
+		using RunPeriodChunks::ChunkDateString;
+		using RunPeriodChunks::SetRunPeriodDates;
+		using RunPeriodChunks::UnmergedOutputRequested;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtLD( "*" );
+		static std::string const RoutineName( "InitSimulationCheckpoint: " );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string::size_type Pos; // position of the month/day separator
+		int Month( 0 ); // month of the checkpoint date
+		int Day( 0 ); // day of month of the checkpoint date
+		int ReadStat( 1 ); // status of reading the checkpoint date
+		std::string Magic; // first bytes of the restart file
+		int Version( 0 ); // layout version of the restart file
+		int RestartDate( 0 ); // day of year the restarted run period starts on
+		int StartDate; // first day of year of the run period
+		int EndDate; // last day of year of the run period
+		std::string SplitObject; // output object whose totals would span the restart date
+		int NumAlpha; // number of alphas of the RunPeriod
+		int NumNumber; // number of numbers of the RunPeriod
+		int IOStat; // status of GetObjectItem
+
+		if ( ! CheckpointDate.empty() ) {
+			if ( SameString( CheckpointDate, "WARMUP" ) ) {
+				CheckpointAfterWarmup = true;
+			} else {
+				Pos = index( CheckpointDate, '/' );
+				if ( Pos != std::string::npos ) {
+					{ IOFlags flags; gio::read( CheckpointDate.substr( 0, Pos ), fmtLD, flags ) >> Month; ReadStat = flags.ios(); }
+					if ( ReadStat == 0 ) {
+						IOFlags flags; gio::read( CheckpointDate.substr( Pos + 1 ), fmtLD, flags ) >> Day; ReadStat = flags.ios();
+					}
+				}
+				if ( ReadStat != 0 || Month < 1 || Month > 12 || Day < 1 || Day > 31 ) {
+					ShowWarningError( RoutineName + "Invalid " + cCheckpointDate + "=\"" + CheckpointDate + "\", expected WARMUP or month/day. No checkpoint is written." );
+				} else {
+					CheckpointDay = JulianDay( Month, Day, 0 );
+				}
+			}
+		}
+
+		UnsupportedObject = UnsupportedStateObject();
+		if ( ! UnsupportedObject.empty() ) {
+			if ( CheckpointAfterWarmup || CheckpointDay > 0 ) {
+				ShowWarningError( RoutineName + "The state of " + UnsupportedObject + " is not kept in a checkpoint. No checkpoint is written." );
+				CheckpointAfterWarmup = false;
+				CheckpointDay = 0;
+			}
+			if ( SharedWarmup ) {
+				ShowWarningError( RoutineName + "The state of " + UnsupportedObject + " is not kept in a warmup state, " + cSharedWarmup + " is not used." );
+				SharedWarmup = false;
+			}
+		}
+
+		if ( RestartFile.empty() ) return;
+
+		std::ifstream File( RestartFile, std::ios_base::binary );
+		if ( ! File ) {
+			ShowFatalError( RoutineName + "Could not open the restart file \"" + RestartFile + "\"." );
+		}
+		Magic.resize( CheckpointMagic.size() );
+		File.read( &Magic[ 0 ], Magic.size() );
+		File.read( reinterpret_cast< char * >( &Version ), sizeof( Version ) );
+		File.read( reinterpret_cast< char * >( &RestartDate ), sizeof( RestartDate ) );
+		if ( ! File || Magic != CheckpointMagic || Version != CheckpointVersion ) {
+			ShowFatalError( RoutineName + "\"" + RestartFile + "\" is not a checkpoint file of this version of EnergyPlus." );
+		}
+		File.close();
+
+		if ( DDOnly || FullAnnualRun ) {
+			ShowFatalError( RoutineName + "A restart cannot be combined with the design day only or full annual run option." );
+		}
+		if ( GetNumObjectsFound( "RunPeriod" ) != 1 || GetNumObjectsFound( "RunPeriod:CustomRange" ) > 0 ) {
+			ShowFatalError( RoutineName + "A restart requires exactly one RunPeriod object and no RunPeriod:CustomRange objects." );
+		}
+		if ( ! UnsupportedObject.empty() ) {
+			ShowFatalError( RoutineName + "A restart cannot be used with " + UnsupportedObject + ", its state is not kept in a checkpoint." );
+		}
+		GetObjectItem( "RunPeriod", 1, cAlphaArgs, NumAlpha, rNumericArgs, NumNumber, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+		StartDate = JulianDay( int( rNumericArgs( 1 ) ), int( rNumericArgs( 2 ) ), 0 );
+		EndDate = JulianDay( int( rNumericArgs( 3 ) ), int( rNumericArgs( 4 ) ), 0 );
+		if ( RestartDate < 1 || RestartDate > EndDate ) {
+			ShowFatalError( RoutineName + "The checkpoint in \"" + RestartFile + "\" restarts on day " + TrimSigDigits( RestartDate ) + ", after the end of the RunPeriod; there is nothing left to simulate." );
+		}
+		if ( RestartDate != StartDate ) {
+			InvJulianDay( RestartDate, Month, Day, 0 );
+			SplitObject = UnmergedOutputRequested( Day != 1, false );
+			if ( ! SplitObject.empty() ) {
+				ShowFatalError( RoutineName + "A restart on " + ChunkDateString( RestartDate ) + " cannot be used with " + SplitObject + ", its totals would only cover the restarted days." );
+			}
+		}
+		if ( NumRunPeriodChunks > 1 ) {
+			ShowWarningError( RoutineName + "Run period chunks (" + cRunPeriodChunks + ") are not used in a restart." );
+			NumRunPeriodChunks = 1;
+		}
+
+		SetRunPeriodDates( RestartDate, EndDate );
+		RestartPending = true;
+		ShowMessage( "Restarting the run period on " + ChunkDateString( RestartDate ) + " from checkpoint file=" + RestartFile + '.' );
+
+	}
+
+	std::string
+	UnsupportedStateObject()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the first object type of the input whose state carried from one timestep to
+		// the next is not kept in a checkpoint, or blank if there is none.
+
+		// METHODOLOGY EMPLOYED:
+		// The ground heat exchangers and buried pipes keep load or temperature histories timed
+		// from the first day of the environment; the storage objects keep their charge or
+		// temperature; EMS programs and external interfaces keep variables of their own.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using InputProcessor::GetNumObjectsFound;
+
+		// Return value
+		std::string StateObject;
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static FArray1D_string const StateObjects( 16, { "GroundHeatExchanger:Vertical", "GroundHeatExchanger:Pond", "GroundHeatExchanger:Surface", "GroundHeatExchanger:HorizontalTrench", "PipingSystem:Underground:Domain", "Pipe:Indoor", "Pipe:Outdoor", "Pipe:Underground", "ThermalStorage:Ice:Simple", "ThermalStorage:Ice:Detailed", "ElectricLoadCenter:Storage:Simple", "ElectricLoadCenter:Storage:Battery", "SolarCollector:IntegralCollectorStorage", "WaterUse:Storage", "EnergyManagementSystem:ProgramCallingManager", "ExternalInterface" } );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int ObjType; // index into StateObjects
+
+		for ( ObjType = 1; ObjType <= isize( StateObjects ); ++ObjType ) {
+			if ( GetNumObjectsFound( StateObjects( ObjType ) ) > 0 ) {
+				StateObject = StateObjects( ObjType );
+				break;
+			}
+		}
+
+		return StateObject;
+
+	}
+
+	void
+	ManageSimulationCheckpoint()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the checkpoint at the end of the requested day of the run period.
+
+		// METHODOLOGY EMPLOYED:
+		// Called at the end of each day; the checkpoint is written once.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::DayOfYear;
+		using DataGlobals::KindOfSim;
+		using DataGlobals::ksRunPeriodWeather;
+		using DataGlobals::WarmupFlag;
+
+		if ( WarmupFlag || KindOfSim != ksRunPeriodWeather ) return;
+		if ( DayOfYear != CheckpointDay ) return;
+
+		WriteSimulationCheckpoint( DayOfYear + 1 );
+		CheckpointDay = 0;
+
+	}
+
+	void
+	WriteSimulationCheckpoint( int const RestartDate ) // Day of year the restarted run period starts on
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the checkpoint file and reports it in the audit file.
+
+		// METHODOLOGY EMPLOYED:
+		// Header (magic, layout version, restart date, number of arrays), then one block per
+		// array of GetCheckpointArrays, the surface history counters and the packed scalar
+		// state, each block preceded by its number of values.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataHeatBalSurface::SUMH;
+		using DataTimings::epElapsedTime;
+		using RunPeriodChunks::ChunkDateString;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+		static std::string const RoutineName( "WriteSimulationCheckpoint: " );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< CheckpointArray > Arrays; // arrays of the checkpoint
+		std::vector< Real64 > Values; // packed scalar state
+		std::vector< CheckpointArray >::size_type ArrayNum; // array index (zero based)
+		int NumArrays; // number of arrays
+		Real64 StartTime; // elapsed time when writing started (s)
+		Real64 WriteTime; // time spent writing the checkpoint (s)
+		std::streamoff FileSize; // size of the checkpoint file (bytes)
+		int EchoInputFile; // found unit number for "eplusout.audit"
+
+		StartTime = epElapsedTime();
+
+		GetCheckpointArrays( Arrays );
+		TransferPackedState( Values, false );
+		NumArrays = Arrays.size();
+
+		std::ofstream File( CheckpointFileName, std::ios_base::binary | std::ios_base::trunc );
+		if ( ! File ) {
+			ShowSevereError( RoutineName + "Could not open file \"" + CheckpointFileName + "\" for output (write), no checkpoint is written." );
+			return;
+		}
+		File.write( CheckpointMagic.c_str(), CheckpointMagic.size() );
+		File.write( reinterpret_cast< char const * >( &CheckpointVersion ), sizeof( CheckpointVersion ) );
+		File.write( reinterpret_cast< char const * >( &RestartDate ), sizeof( RestartDate ) );
+		File.write( reinterpret_cast< char const * >( &NumArrays ), sizeof( NumArrays ) );
+		for ( ArrayNum = 0; ArrayNum < Arrays.size(); ++ArrayNum ) {
+			WriteCheckpointBlock( File, Arrays[ ArrayNum ].Data, Arrays[ ArrayNum ].Count, sizeof( Real64 ) );
+		}
+		WriteCheckpointBlock( File, SUMH.data_, SUMH.size(), sizeof( int ) );
+		WriteCheckpointBlock( File, Values.data(), Values.size(), sizeof( Real64 ) );
+		FileSize = File.tellp();
+		File.close();
+		if ( ! File ) {
+			ShowSevereError( RoutineName + "Errors writing file \"" + CheckpointFileName + "\", the checkpoint cannot be used for a restart." );
+			return;
+		}
+
+		WriteTime = epElapsedTime() - StartTime;
+		if ( WriteTime < 0.0 ) WriteTime += 24.0 * 3600.0;
+
+		EchoInputFile = FindUnitNumber( "eplusout.audit" );
+		gio::write( EchoInputFile, fmtA ) << "Simulation Checkpoint,File,Restart Date,#Arrays,#Packed Values,Size {bytes},Write Time {s}";
+		gio::write( EchoInputFile, fmtA ) << "Simulation Checkpoint," + CheckpointFileName + ',' + ChunkDateString( RestartDate ) + ',' + TrimSigDigits( NumArrays ) + ',' + TrimSigDigits( int( Values.size() ) ) + ',' + TrimSigDigits( int( FileSize ) ) + ',' + RoundSigDigits( WriteTime, 3 );
+		ShowMessage( "Simulation state checkpoint written to " + CheckpointFileName + ", restart date " + ChunkDateString( RestartDate ) + '.' );
+
+	}
+
+	void
+	RestoreSimulationCheckpoint()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Replaces the state at the end of the first warmup day of a restarted run period with
+		// the state of the restart file and ends the warmup.
+
+		// METHODOLOGY EMPLOYED:
+		// The blocks are read in the order they were written; a block whose length does not
+		// match the array of this input ends the program.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataGlobals::WarmupFlag;
+		using DataHeatBalSurface::SUMH;
+		using DataSystemVariables::RestartFile;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "RestoreSimulationCheckpoint: " );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< CheckpointArray > Arrays; // arrays of the checkpoint
+		std::vector< Real64 > Values; // packed scalar state
+		std::vector< CheckpointArray >::size_type ArrayNum; // array index (zero based)
+		std::string Magic; // first bytes of the restart file
+		int Version( 0 ); // layout version of the restart file
+		int RestartDate( 0 ); // day of year the restarted run period starts on
+		int NumArrays( 0 ); // number of arrays in the restart file
+
+		GetCheckpointArrays( Arrays );
+		TransferPackedState( Values, false );
+
+		std::ifstream File( RestartFile, std::ios_base::binary );
+		Magic.resize( CheckpointMagic.size() );
+		File.read( &Magic[ 0 ], Magic.size() );
+		File.read( reinterpret_cast< char * >( &Version ), sizeof( Version ) );
+		File.read( reinterpret_cast< char * >( &RestartDate ), sizeof( RestartDate ) );
+		File.read( reinterpret_cast< char * >( &NumArrays ), sizeof( NumArrays ) );
+		if ( ! File || Magic != CheckpointMagic || Version != CheckpointVersion || NumArrays != int( Arrays.size() ) ) {
+			ShowFatalError( RoutineName + "\"" + RestartFile + "\" is not a checkpoint file of this version of EnergyPlus." );
+		}
+		for ( ArrayNum = 0; ArrayNum < Arrays.size(); ++ArrayNum ) {
+			if ( ! ReadCheckpointBlock( File, Arrays[ ArrayNum ].Data, Arrays[ ArrayNum ].Count, sizeof( Real64 ) ) ) {
+				ShowFatalError( RoutineName + "The " + Arrays[ ArrayNum ].Name + " state in \"" + RestartFile + "\" does not match this input." );
+			}
+		}
+		if ( ! ReadCheckpointBlock( File, SUMH.data_, SUMH.size(), sizeof( int ) ) ) {
+			ShowFatalError( RoutineName + "The SUMH state in \"" + RestartFile + "\" does not match this input." );
+		}
+		if ( ! ReadCheckpointBlock( File, Values.data(), Values.size(), sizeof( Real64 ) ) ) {
+			ShowFatalError( RoutineName + "The node, plant, window, tank and controller state in \"" + RestartFile + "\" does not match this input." );
+		}
+		File.close();
+		TransferPackedState( Values, true );
+
+		WarmupFlag = false;
+		RestartPending = false;
+		RestoredFromCheckpoint = true;
+		DisplayString( "Simulation state restored from checkpoint" );
+
+	}
+
+	std::string
+	WarmupStateKey()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the key under which the converged warmup state of the current environment is
+		// cached. Environments with the same key warm up on the same day of weather with the
+		// same schedule values, the same conditioning and the same model, and so converge to
+		// the same state.
+
+		// METHODOLOGY EMPLOYED:
+		// Called at the end of a warmup day, when the weather arrays of WeatherManager hold the
+		// weather of the warmup day for design days and run periods alike; their content is
+		// hashed, so that identical design days or run periods starting on the same weather
+		// share a state. The schedule values follow from the input objects and the day of year,
+		// day of week, holiday and daylight saving indicators of the day. Zone sizing conditions
+		// the zones with ideal loads instead of the HVAC system, which is a different model of
+		// the building and gives a different state. The input objects are hashed once.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::DayOfWeek;
+		using DataEnvironment::DayOfYear;
+		using DataEnvironment::DSTIndicator;
+		using DataEnvironment::HolidayIndex;
+		using DataGlobals::ZoneSizingCalc;
+		using InputProcessor::IDFRecords;
+		using InputProcessor::NumIDFRecords;
+		using WeatherManager::TodayAlbedo;
+		using WeatherManager::TodayBeamSolarRad;
+		using WeatherManager::TodayDifSolarRad;
+		using WeatherManager::TodayHorizIRSky;
+		using WeatherManager::TodayIsRain;
+		using WeatherManager::TodayIsSnow;
+		using WeatherManager::TodayLiquidPrecip;
+		using WeatherManager::TodayOutBaroPress;
+		using WeatherManager::TodayOutDewPointTemp;
+		using WeatherManager::TodayOutDryBulbTemp;
+		using WeatherManager::TodayOutHumRat;
+		using WeatherManager::TodayOutRelHum;
+		using WeatherManager::TodaySkyTemp;
+		using WeatherManager::TodayWindDir;
+		using WeatherManager::TodayWindSpeed;
+
+		// Return value
+		std::string Key;
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		static std::string ModelHash; // content hash of the input objects
+		std::string Content; // bytes of the weather or of the input objects
+		int RecordNum; // input object counter
+		int FieldNum; // field counter
+
+		if ( ModelHash.empty() ) {
+			for ( RecordNum = 1; RecordNum <= NumIDFRecords; ++RecordNum ) {
+				auto const & Record( IDFRecords( RecordNum ) );
+				Content += Record.Name + '\n';
+				for ( FieldNum = 1; FieldNum <= Record.NumAlphas; ++FieldNum ) {
+					Content += Record.Alphas( FieldNum ) + '\n';
+				}
+				AppendContent( Content, Record.Numbers.data_, Record.NumNumbers * sizeof( Real64 ) );
+			}
+			ModelHash = std::to_string( std::hash< std::string >()( Content ) );
+			Content.clear();
+		}
+
+		AppendContent( Content, TodayIsRain.data_, TodayIsRain.size() * sizeof( bool ) );
+		AppendContent( Content, TodayIsSnow.data_, TodayIsSnow.size() * sizeof( bool ) );
+		AppendContent( Content, TodayOutDryBulbTemp.data_, TodayOutDryBulbTemp.size() * sizeof( Real64 ) );
+		AppendContent( Content, TodayOutDewPointTemp.data_, TodayOutDewPointTemp.size() * sizeof( Real64 ) );
+		AppendContent( Content, TodayOutBaroPress.data_, TodayOutBaroPress.size() * sizeof( Real64 ) );
+		AppendContent( Content, TodayOutHumRat.data_, TodayOutHumRat.size() * sizeof( Real64 ) );
+		AppendContent( Content, TodayOutRelHum.data_, TodayOutRelHum.size() * sizeof( Real64 ) );
+		AppendContent( Content, TodayWindSpeed.data_, TodayWindSpeed.size() * sizeof( Real64 ) );
+		AppendContent( Content, TodayWindDir.data_, TodayWindDir.size() * sizeof( Real64 ) );
+		AppendContent( Content, TodaySkyTemp.data_, TodaySkyTemp.size() * sizeof( Real64 ) );
+		AppendContent( Content, TodayHorizIRSky.data_, TodayHorizIRSky.size() * sizeof( Real64 ) );
+		AppendContent( Content, TodayBeamSolarRad.data_, TodayBeamSolarRad.size() * sizeof( Real64 ) );
+		AppendContent( Content, TodayDifSolarRad.data_, TodayDifSolarRad.size() * sizeof( Real64 ) );
+		AppendContent( Content, TodayAlbedo.data_, TodayAlbedo.size() * sizeof( Real64 ) );
+		AppendContent( Content, TodayLiquidPrecip.data_, TodayLiquidPrecip.size() * sizeof( Real64 ) );
+
+		Key = TrimSigDigits( DayOfYear ) + ',' + TrimSigDigits( DayOfWeek ) + ',' + TrimSigDigits( HolidayIndex ) + ',' + TrimSigDigits( DSTIndicator );
+		Key += ZoneSizingCalc ? ",IdealLoads" : ",HVAC";
+		Key += ',' + std::to_string( std::hash< std::string >()( Content ) ) + ',' + ModelHash;
+
+		return Key;
+
+	}
+
+	void
+	AppendContent(
+		std::string & Content, // Bytes to be hashed
+		void const * Data, // First byte of the values
+		std::size_t const Size // Number of bytes
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends the bytes of a block of values to the content of a WarmupStateKey hash.
+
+		if ( Size > 0 ) Content.append( static_cast< char const * >( Data ), Size );
+
+	}
+
+	void
+	SaveWarmupState()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Caches the state of the current environment when its warmup has converged, unless a
+		// state is already cached under its key.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::EnvironmentName;
+		using DataGlobals::NumOfWarmupDays;
+		using DataHeatBalSurface::SUMH;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string Key( WarmupStateKey() ); // cache key of the environment
+		std::vector< CheckpointArray > Arrays; // arrays of the state
+		std::vector< CheckpointArray >::size_type ArrayNum; // array index (zero based)
+
+		if ( WarmupStates.find( Key ) != WarmupStates.end() ) return;
+
+		WarmupState & State( WarmupStates[ Key ] );
+		State.EnvironmentName = EnvironmentName;
+		State.NumWarmupDays = NumOfWarmupDays;
+		GetCheckpointArrays( Arrays );
+		State.Arrays.resize( Arrays.size() );
+		for ( ArrayNum = 0; ArrayNum < Arrays.size(); ++ArrayNum ) {
+			State.Arrays[ ArrayNum ].assign( Arrays[ ArrayNum ].Data, Arrays[ ArrayNum ].Data + Arrays[ ArrayNum ].Count );
+		}
+		State.SUMH.assign( SUMH.data_, SUMH.data_ + SUMH.size() );
+		TransferPackedState( State.Packed, false );
+
+	}
+
+	bool
+	ReuseWarmupState()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// At the end of the first warmup day of an environment, restores the cached state of
+		// an earlier environment with the same key and ends the warmup. Returns true if the
+		// state was restored.
+
+		// METHODOLOGY EMPLOYED:
+		// The cached arrays are copied back only if every array and the packed state still have
+		// their cached length.
+		// The reuse is reported in the eio file with the warmup days it saved.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::EnvironmentName;
+		using DataGlobals::NumOfWarmupDays;
+		using DataGlobals::OutputFileInits;
+		using DataGlobals::WarmupFlag;
+		using DataHeatBalSurface::SUMH;
+
+		// Return value
+		bool Reused( false );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		static bool PrintHeader( true ); // true until the eio header has been written
+		std::map< std::string, WarmupState >::iterator Found; // cached state of the environment
+		std::vector< CheckpointArray > Arrays; // arrays of the state
+		std::vector< Real64 > Values; // packed scalar state of this environment
+		std::vector< CheckpointArray >::size_type ArrayNum; // array index (zero based)
+
+		WarmupStateReused = false;
+		Found = WarmupStates.find( WarmupStateKey() );
+		if ( Found == WarmupStates.end() ) return Reused;
+		WarmupState & State( Found->second );
+
+		GetCheckpointArrays( Arrays );
+		if ( Arrays.size() != State.Arrays.size() || SUMH.size() != State.SUMH.size() ) return Reused;
+		for ( ArrayNum = 0; ArrayNum < Arrays.size(); ++ArrayNum ) {
+			if ( Arrays[ ArrayNum ].Count != State.Arrays[ ArrayNum ].size() ) return Reused;
+		}
+		TransferPackedState( Values, false );
+		if ( Values.size() != State.Packed.size() ) return Reused;
+		for ( ArrayNum = 0; ArrayNum < Arrays.size(); ++ArrayNum ) {
+			std::copy( State.Arrays[ ArrayNum ].begin(), State.Arrays[ ArrayNum ].end(), Arrays[ ArrayNum ].Data );
+		}
+		std::copy( State.SUMH.begin(), State.SUMH.end(), SUMH.data_ );
+		TransferPackedState( State.Packed, true );
+
+		WarmupFlag = false;
+		WarmupStateReused = true;
+		Reused = true;
+		++State.TimesReused;
+
+		if ( PrintHeader ) {
+			gio::write( OutputFileInits, fmtA ) << "! <Environment:Warmup Reused>, Environment Name, Reused From Environment, Warmup Days Simulated, Warmup Days Saved";
+			PrintHeader = false;
+		}
+		gio::write( OutputFileInits, fmtA ) << "Environment:Warmup Reused," + EnvironmentName + ',' + State.EnvironmentName + ',' + TrimSigDigits( NumOfWarmupDays ) + ',' + TrimSigDigits( max( State.NumWarmupDays - NumOfWarmupDays, 0 ) );
+		DisplayString( "Warmup state reused from " + State.EnvironmentName );
+
+		return Reused;
+
+	}
+
+	void
+	GetCheckpointArrays( std::vector< CheckpointArray > & Arrays ) // Arrays of the checkpoint, in file order
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Lists the history arrays kept in a checkpoint. Writing and restoring both use this
+		// list, so that the two always agree on the layout of the file.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using namespace DataHeatBalFanSys;
+		using namespace DataHeatBalSurface;
+
+		Arrays.clear();
+
+		// Surface conduction histories
+		Arrays.push_back( CheckpointArray( "TH", TH.data_, TH.size() ) );
+		Arrays.push_back( CheckpointArray( "QH", QH.data_, QH.size() ) );
+		Arrays.push_back( CheckpointArray( "THM", THM.data_, THM.size() ) );
+		Arrays.push_back( CheckpointArray( "QHM", QHM.data_, QHM.size() ) );
+		Arrays.push_back( CheckpointArray( "TsrcHist", TsrcHist.data_, TsrcHist.size() ) );
+		Arrays.push_back( CheckpointArray( "QsrcHist", QsrcHist.data_, QsrcHist.size() ) );
+		Arrays.push_back( CheckpointArray( "TsrcHistM", TsrcHistM.data_, TsrcHistM.size() ) );
+		Arrays.push_back( CheckpointArray( "QsrcHistM", QsrcHistM.data_, QsrcHistM.size() ) );
+		Arrays.push_back( CheckpointArray( "TempSurfIn", TempSurfIn.data_, TempSurfIn.size() ) );
+		Arrays.push_back( CheckpointArray( "TempSurfInTmp", TempSurfInTmp.data_, TempSurfInTmp.size() ) );
+		Arrays.push_back( CheckpointArray( "TempSurfOut", TempSurfOut.data_, TempSurfOut.size() ) );
+		Arrays.push_back( CheckpointArray( "TempSource", TempSource.data_, TempSource.size() ) );
+
+		// Zone air temperature histories
+		Arrays.push_back( CheckpointArray( "MAT", MAT.data_, MAT.size() ) );
+		Arrays.push_back( CheckpointArray( "ZT", ZT.data_, ZT.size() ) );
+		Arrays.push_back( CheckpointArray( "ZTAV", ZTAV.data_, ZTAV.size() ) );
+		Arrays.push_back( CheckpointArray( "TempTstatAir", TempTstatAir.data_, TempTstatAir.size() ) );
+		Arrays.push_back( CheckpointArray( "XMAT", XMAT.data_, XMAT.size() ) );
+		Arrays.push_back( CheckpointArray( "XM2T", XM2T.data_, XM2T.size() ) );
+		Arrays.push_back( CheckpointArray( "XM3T", XM3T.data_, XM3T.size() ) );
+		Arrays.push_back( CheckpointArray( "XM4T", XM4T.data_, XM4T.size() ) );
+		Arrays.push_back( CheckpointArray( "DSXMAT", DSXMAT.data_, DSXMAT.size() ) );
+		Arrays.push_back( CheckpointArray( "DSXM2T", DSXM2T.data_, DSXM2T.size() ) );
+		Arrays.push_back( CheckpointArray( "DSXM3T", DSXM3T.data_, DSXM3T.size() ) );
+		Arrays.push_back( CheckpointArray( "DSXM4T", DSXM4T.data_, DSXM4T.size() ) );
+		Arrays.push_back( CheckpointArray( "XMPT", XMPT.data_, XMPT.size() ) );
+		Arrays.push_back( CheckpointArray( "ZTM1", ZTM1.data_, ZTM1.size() ) );
+		Arrays.push_back( CheckpointArray( "ZTM2", ZTM2.data_, ZTM2.size() ) );
+		Arrays.push_back( CheckpointArray( "ZTM3", ZTM3.data_, ZTM3.size() ) );
+		Arrays.push_back( CheckpointArray( "ZoneTMX", ZoneTMX.data_, ZoneTMX.size() ) );
+		Arrays.push_back( CheckpointArray( "ZoneTM2", ZoneTM2.data_, ZoneTM2.size() ) );
+		Arrays.push_back( CheckpointArray( "ZoneT1", ZoneT1.data_, ZoneT1.size() ) );
+		Arrays.push_back( CheckpointArray( "SysDepZoneLoadsLagged", SysDepZoneLoadsLagged.data_, SysDepZoneLoadsLagged.size() ) );
+
+		// Zone air humidity ratio histories
+		Arrays.push_back( CheckpointArray( "ZoneAirHumRat", ZoneAirHumRat.data_, ZoneAirHumRat.size() ) );
+		Arrays.push_back( CheckpointArray( "ZoneAirHumRatAvg", ZoneAirHumRatAvg.data_, ZoneAirHumRatAvg.size() ) );
+		Arrays.push_back( CheckpointArray( "ZoneAirHumRatOld", ZoneAirHumRatOld.data_, ZoneAirHumRatOld.size() ) );
+		Arrays.push_back( CheckpointArray( "WZoneTimeMinus1", WZoneTimeMinus1.data_, WZoneTimeMinus1.size() ) );
+		Arrays.push_back( CheckpointArray( "WZoneTimeMinus2", WZoneTimeMinus2.data_, WZoneTimeMinus2.size() ) );
+		Arrays.push_back( CheckpointArray( "WZoneTimeMinus3", WZoneTimeMinus3.data_, WZoneTimeMinus3.size() ) );
+		Arrays.push_back( CheckpointArray( "WZoneTimeMinus4", WZoneTimeMinus4.data_, WZoneTimeMinus4.size() ) );
+		Arrays.push_back( CheckpointArray( "DSWZoneTimeMinus1", DSWZoneTimeMinus1.data_, DSWZoneTimeMinus1.size() ) );
+		Arrays.push_back( CheckpointArray( "DSWZoneTimeMinus2", DSWZoneTimeMinus2.data_, DSWZoneTimeMinus2.size() ) );
+		Arrays.push_back( CheckpointArray( "DSWZoneTimeMinus3", DSWZoneTimeMinus3.data_, DSWZoneTimeMinus3.size() ) );
+		Arrays.push_back( CheckpointArray( "DSWZoneTimeMinus4", DSWZoneTimeMinus4.data_, DSWZoneTimeMinus4.size() ) );
+		Arrays.push_back( CheckpointArray( "WZoneTimeMinusP", WZoneTimeMinusP.data_, WZoneTimeMinusP.size() ) );
+		Arrays.push_back( CheckpointArray( "ZoneWMX", ZoneWMX.data_, ZoneWMX.size() ) );
+		Arrays.push_back( CheckpointArray( "ZoneWM2", ZoneWM2.data_, ZoneWM2.size() ) );
+		Arrays.push_back( CheckpointArray( "ZoneW1", ZoneW1.data_, ZoneW1.size() ) );
+
+	}
+
+	void
+	TransferPackedState(
+		std::vector< Real64 > & Values, // Packed scalar state
+		bool const Restore // True to set the state from Values, false to fill Values from the state
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Packs the state held in members of derived types (loop nodes, plant loop sides,
+		// windows, water thermal tanks and air loop controllers) into one vector, or sets it
+		// back from that vector.
+
+		// METHODOLOGY EMPLOYED:
+		// The same member list is walked in both directions with TransferValue; integer and
+		// logical members are packed as reals. Of the controllers only the solution saved for
+		// the warm restart of the next timestep is kept.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataLoopNode::Node;
+		using DataLoopNode::NumOfNodes;
+		using DataPlant::PlantLoop;
+		using DataPlant::TotNumLoops;
+		using DataSurfaces::SurfaceWindow;
+		using HVACControllers::ControllerProps;
+		using WaterThermalTanks::HPWaterHeater;
+		using WaterThermalTanks::WaterHeaterDesuperheater;
+		using WaterThermalTanks::WaterThermalTank;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< Real64 >::size_type Pos( 0 ); // next position in Values
+		int NodeNum; // node counter
+		int LoopNum; // plant loop counter
+		int LoopSideNum; // plant loop side counter
+		int SurfNum; // surface counter
+		int FaceNum; // window face counter
+		int TankNum; // water thermal tank counter
+		int TankNodeNum; // stratified tank node counter
+		int HeaterNum; // heat pump water heater or desuperheater counter
+		int ControlNum; // controller counter
+		int TrackerNum; // controller solution tracker counter
+
+		if ( ! Restore ) Values.clear();
+
+		for ( NodeNum = 1; NodeNum <= NumOfNodes; ++NodeNum ) {
+			auto & ThisNode( Node( NodeNum ) );
+			TransferValue( ThisNode.Temp, Values, Pos, Restore );
+			TransferValue( ThisNode.TempMin, Values, Pos, Restore );
+			TransferValue( ThisNode.TempMax, Values, Pos, Restore );
+			TransferValue( ThisNode.TempSetPoint, Values, Pos, Restore );
+			TransferValue( ThisNode.TempSetPointHi, Values, Pos, Restore );
+			TransferValue( ThisNode.TempSetPointLo, Values, Pos, Restore );
+			TransferValue( ThisNode.TempLastTimestep, Values, Pos, Restore );
+			TransferValue( ThisNode.MassFlowRate, Values, Pos, Restore );
+			TransferValue( ThisNode.MassFlowRateRequest, Values, Pos, Restore );
+			TransferValue( ThisNode.MassFlowRateMin, Values, Pos, Restore );
+			TransferValue( ThisNode.MassFlowRateMax, Values, Pos, Restore );
+			TransferValue( ThisNode.MassFlowRateMinAvail, Values, Pos, Restore );
+			TransferValue( ThisNode.MassFlowRateMaxAvail, Values, Pos, Restore );
+			TransferValue( ThisNode.MassFlowRateSetPoint, Values, Pos, Restore );
+			TransferValue( ThisNode.Quality, Values, Pos, Restore );
+			TransferValue( ThisNode.Press, Values, Pos, Restore );
+			TransferValue( ThisNode.Enthalpy, Values, Pos, Restore );
+			TransferValue( ThisNode.EnthalpyLastTimestep, Values, Pos, Restore );
+			TransferValue( ThisNode.HumRat, Values, Pos, Restore );
+			TransferValue( ThisNode.HumRatMin, Values, Pos, Restore );
+			TransferValue( ThisNode.HumRatMax, Values, Pos, Restore );
+			TransferValue( ThisNode.HumRatSetPoint, Values, Pos, Restore );
+			TransferValue( ThisNode.CO2, Values, Pos, Restore );
+			TransferValue( ThisNode.CO2SetPoint, Values, Pos, Restore );
+			TransferValue( ThisNode.GenContam, Values, Pos, Restore );
+			TransferValue( ThisNode.GenContamSetPoint, Values, Pos, Restore );
+		}
+
+		for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+			for ( LoopSideNum = 1; LoopSideNum <= isize( PlantLoop( LoopNum ).LoopSide ); ++LoopSideNum ) {
+				TransferValue( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).TempInterfaceTankOutlet, Values, Pos, Restore );
+				TransferValue( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).LastTempInterfaceTankOutlet, Values, Pos, Restore );
+			}
+		}
+
+		for ( SurfNum = 1; SurfNum <= isize( SurfaceWindow ); ++SurfNum ) {
+			for ( FaceNum = 1; FaceNum <= isize( SurfaceWindow( SurfNum ).ThetaFace ); ++FaceNum ) {
+				TransferValue( SurfaceWindow( SurfNum ).ThetaFace( FaceNum ), Values, Pos, Restore );
+			}
+		}
+
+		for ( TankNum = 1; TankNum <= isize( WaterThermalTank ); ++TankNum ) {
+			auto & ThisTank( WaterThermalTank( TankNum ) );
+			TransferValue( ThisTank.TankTemp, Values, Pos, Restore );
+			TransferValue( ThisTank.SavedTankTemp, Values, Pos, Restore );
+			TransferValue( ThisTank.SavedUseOutletTemp, Values, Pos, Restore );
+			TransferValue( ThisTank.SavedSourceOutletTemp, Values, Pos, Restore );
+			TransferValue( ThisTank.Mode, Values, Pos, Restore );
+			TransferValue( ThisTank.SavedMode, Values, Pos, Restore );
+			TransferValue( ThisTank.HeaterOn1, Values, Pos, Restore );
+			TransferValue( ThisTank.SavedHeaterOn1, Values, Pos, Restore );
+			TransferValue( ThisTank.HeaterOn2, Values, Pos, Restore );
+			TransferValue( ThisTank.SavedHeaterOn2, Values, Pos, Restore );
+			for ( TankNodeNum = 1; TankNodeNum <= isize( ThisTank.Node ); ++TankNodeNum ) {
+				TransferValue( ThisTank.Node( TankNodeNum ).Temp, Values, Pos, Restore );
+				TransferValue( ThisTank.Node( TankNodeNum ).SavedTemp, Values, Pos, Restore );
+			}
+		}
+		for ( HeaterNum = 1; HeaterNum <= isize( HPWaterHeater ); ++HeaterNum ) {
+			TransferValue( HPWaterHeater( HeaterNum ).Mode, Values, Pos, Restore );
+			TransferValue( HPWaterHeater( HeaterNum ).SaveMode, Values, Pos, Restore );
+			TransferValue( HPWaterHeater( HeaterNum ).SaveWHMode, Values, Pos, Restore );
+		}
+		for ( HeaterNum = 1; HeaterNum <= isize( WaterHeaterDesuperheater ); ++HeaterNum ) {
+			TransferValue( WaterHeaterDesuperheater( HeaterNum ).Mode, Values, Pos, Restore );
+			TransferValue( WaterHeaterDesuperheater( HeaterNum ).SaveMode, Values, Pos, Restore );
+			TransferValue( WaterHeaterDesuperheater( HeaterNum ).SaveWHMode, Values, Pos, Restore );
+		}
+
+		for ( ControlNum = 1; ControlNum <= isize( ControllerProps ); ++ControlNum ) {
+			auto & ThisController( ControllerProps( ControlNum ) );
+			TransferValue( ThisController.Mode, Values, Pos, Restore );
+			TransferValue( ThisController.ActuatedValue, Values, Pos, Restore );
+			TransferValue( ThisController.NextActuatedValue, Values, Pos, Restore );
+			for ( TrackerNum = 1; TrackerNum <= isize( ThisController.SolutionTrackers ); ++TrackerNum ) {
+				auto & ThisTracker( ThisController.SolutionTrackers( TrackerNum ) );
+				TransferValue( ThisTracker.DefinedFlag, Values, Pos, Restore );
+				TransferValue( ThisTracker.ActuatedValue, Values, Pos, Restore );
+				TransferValue( ThisTracker.Mode, Values, Pos, Restore );
+				TransferValue( ThisTracker.BracketDefinedFlag, Values, Pos, Restore );
+				TransferValue( ThisTracker.LowerBracket, Values, Pos, Restore );
+				TransferValue( ThisTracker.UpperBracket, Values, Pos, Restore );
+			}
+		}
+
+	}
+
+	void
+	TransferValue(
+		Real64 & Value, // State variable
+		std::vector< Real64 > & Values, // Packed scalar state
+		std::vector< Real64 >::size_type & Pos, // Next position in Values
+		bool const Restore // True to set Value from Values, false to append Value to Values
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Moves one state variable into or out of the packed state.
+
+		if ( Restore ) {
+			if ( Pos < Values.size() ) Value = Values[ Pos ];
+		} else {
+			Values.push_back( Value );
+		}
+		++Pos;
+
+	}
+
+	void
+	TransferValue(
+		int & Value, // State variable
+		std::vector< Real64 > & Values, // Packed scalar state
+		std::vector< Real64 >::size_type & Pos, // Next position in Values
+		bool const Restore // True to set Value from Values, false to append Value to Values
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Moves one integer state variable into or out of the packed state.
+
+		if ( Restore ) {
+			if ( Pos < Values.size() ) Value = nint( Values[ Pos ] );
+		} else {
+			Values.push_back( Real64( Value ) );
+		}
+		++Pos;
+
+	}
+
+	void
+	TransferValue(
+		bool & Value, // State variable
+		std::vector< Real64 > & Values, // Packed scalar state
+		std::vector< Real64 >::size_type & Pos, // Next position in Values
+		bool const Restore // True to set Value from Values, false to append Value to Values
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Moves one logical state variable into or out of the packed state.
+
+		if ( Restore ) {
+			if ( Pos < Values.size() ) Value = ( Values[ Pos ] != 0.0 );
+		} else {
+			Values.push_back( Value ? 1.0 : 0.0 );
+		}
+		++Pos;
+
+	}
+
+	void
+	WriteCheckpointBlock(
+		std::ofstream & File, // Checkpoint file
+		void const * Data, // First value of the block
+		std::size_t const Count, // Number of values
+		std::size_t const Size // Size of a value (bytes)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes one block of the checkpoint file: the number of values, then the values.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Int64 BlockCount( Count ); // number of values as written to the file
+
+		File.write( reinterpret_cast< char const * >( &BlockCount ), sizeof( BlockCount ) );
+		if ( Count > 0 ) File.write( static_cast< char const * >( Data ), Count * Size );
+
+	}
+
+	bool
+	ReadCheckpointBlock(
+		std::ifstream & File, // Checkpoint file
+		void * Data, // First value of the block
+		std::size_t const Count, // Number of values expected
+		std::size_t const Size // Size of a value (bytes)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads one block of the checkpoint file into an array of the expected length.
+		// Returns false, without changing the array, if the block has another length.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Int64 BlockCount( -1 ); // number of values in the file
+
+		File.read( reinterpret_cast< char * >( &BlockCount ), sizeof( BlockCount ) );
+		if ( ! File || BlockCount != Int64( Count ) ) return false;
+		if ( Count > 0 ) File.read( static_cast< char * >( Data ), Count * Size );
+		return bool( File );
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in EnergyPlus.f90.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // SimulationCheckpoint
+
+} // EnergyPlus
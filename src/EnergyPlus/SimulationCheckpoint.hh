@@ -0,0 +1,169 @@
+#ifndef SimulationCheckpoint_hh_INCLUDED
+#define SimulationCheckpoint_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace SimulationCheckpoint {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern std::string const CheckpointFileName; // Checkpoint file written by a run
+	extern std::string const CheckpointMagic; // First bytes of a checkpoint file
+	extern int const CheckpointVersion; // Layout version of the checkpoint file
+
+	// DERIVED TYPE DEFINITIONS
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern int CheckpointDay; // Day of year after which the state is written (0 = none)
+	extern bool CheckpointAfterWarmup; // True to write the state when the run period warmup has converged
+	extern bool RestartPending; // True until the state of the restart file has been restored
+	extern bool RestoredFromCheckpoint; // True once the state of the restart file has been restored
+	extern bool WarmupStateReused; // True if the warmup of the current environment was replaced by a cached state
+	extern std::string UnsupportedObject; // First object of the input whose state is not in a checkpoint (blank if none)
+
+	// Types
+
+	struct CheckpointArray
+	{
+		// Members
+		std::string Name; // Name of the array for messages
+		Real64 * Data; // First value of the array
+		std::size_t Count; // Number of values
+
+		// Default Constructor
+		CheckpointArray() :
+			Data( nullptr ),
+			Count( 0 )
+		{}
+
+		// Member Constructor
+		CheckpointArray(
+			std::string const & Name,
+			Real64 * Data,
+			std::size_t const Count
+		) :
+			Name( Name ),
+			Data( Data ),
+			Count( Count )
+		{}
+
+	};
+
+	struct WarmupState
+	{
+		// Members
+		std::string EnvironmentName; // Environment whose warmup produced the state
+		int NumWarmupDays; // Warmup days the environment needed to converge
+		int TimesReused; // Number of later environments that reused the state
+		std::vector< std::vector< Real64 > > Arrays; // Values of the arrays of GetCheckpointArrays
+		std::vector< int > SUMH; // Surface history counters
+		std::vector< Real64 > Packed; // Packed scalar state of TransferPackedState
+
+		// Default Constructor
+		WarmupState() :
+			NumWarmupDays( 0 ),
+			TimesReused( 0 )
+		{}
+
+	};
+
+	// Object Data
+	extern std::map< std::string, WarmupState > WarmupStates; // Converged warmup states by WarmupStateKey
+
+	// Functions
+
+	void
+	InitSimulationCheckpoint();
+
+	std::string
+	UnsupportedStateObject();
+
+	void
+	ManageSimulationCheckpoint();
+
+	void
+	WriteSimulationCheckpoint( int const RestartDate ); // Day of year the restarted run period starts on
+
+	void
+	RestoreSimulationCheckpoint();
+
+	std::string
+	WarmupStateKey();
+
+	void
+	AppendContent(
+		std::string & Content, // Bytes to be hashed
+		void const * Data, // First byte of the values
+		std::size_t const Size // Number of bytes
+	);
+
+	void
+	SaveWarmupState();
+
+	bool
+	ReuseWarmupState();
+
+	void
+	GetCheckpointArrays( std::vector< CheckpointArray > & Arrays ); // Arrays of the checkpoint, in file order
+
+	void
+	TransferPackedState(
+		std::vector< Real64 > & Values, // Packed scalar state
+		bool const Restore // True to set the state from Values, false to fill Values from the state
+	);
+
+	void
+	TransferValue(
+		Real64 & Value, // State variable
+		std::vector< Real64 > & Values, // Packed scalar state
+		std::vector< Real64 >::size_type & Pos, // Next position in Values
+		bool const Restore // True to set Value from Values, false to append Value to Values
+	);
+
+	void
+	TransferValue(
+		int & Value, // State variable
+		std::vector< Real64 > & Values, // Packed scalar state
+		std::vector< Real64 >::size_type & Pos, // Next position in Values
+		bool const Restore // True to set Value from Values, false to append Value to Values
+	);
+
+	void
+	TransferValue(
+		bool & Value, // State variable
+		std::vector< Real64 > & Values, // Packed scalar state
+		std::vector< Real64 >::size_type & Pos, // Next position in Values
+		bool const Restore // True to set Value from Values, false to append Value to Values
+	);
+
+	void
+	WriteCheckpointBlock(
+		std::ofstream & File, // Checkpoint file
+		void const * Data, // First value of the block
+		std::size_t const Count, // Number of values
+		std::size_t const Size // Size of a value (bytes)
+	);
+
+	bool
+	ReadCheckpointBlock(
+		std::ifstream & File, // Checkpoint file
+		void * Data, // First value of the block
+		std::size_t const Count, // Number of values expected
+		std::size_t const Size // Size of a value (bytes)
+	);
+
+} // SimulationCheckpoint
+
+} // EnergyPlus
+
+#endif
@@ -77,13 +77,16 @@ extern "C" {
 #include <PlantPipingSystemsManager.hh>
 #include <Psychrometrics.hh>
 #include <RefrigeratedCase.hh>
+#include <RunPeriodChunks.hh>
 #include <SetPointManager.hh>
+#include <SimulationCheckpoint.hh>
 #include <SizingManager.hh>
 #include <SolarShading.hh>
 #include <SQLiteProcedures.hh>
 #include <SystemReports.hh>
 #include <UtilityRoutines.hh>
 #include <WeatherManager.hh>
+#include <WindowComplexManager.hh>
 #include <ZoneContaminantPredictorCorrector.hh>
 #include <ZoneTempPredictorCorrector.hh>
 #include <ZoneEquipmentManager.hh>
@@ -204,6 +207,9 @@ namespace SimulationManager {
 		using General::TrimSigDigits;
 		using OutputReportPredefined::SetPredefinedTables;
 		using HVACControllers::DumpAirLoopStatistics;
+		using HVACControllers::WriteControllerTelemetry;
+		using HVACManager::ReportHVACQuiescence;
+		using WindowComplexManager::ReportTARCOGCache;
 		using NodeInputManager::SetupNodeVarsForReporting;
 		using NodeInputManager::CheckMarkedNodes;
 		using BranchNodeConnections::CheckNodeConnections;
@@ -234,6 +240,9 @@ namespace SimulationManager {
 		using namespace FaultsManager;
 		using PlantPipingSystemsManager::InitAndSimGroundDomains;
 		using PlantPipingSystemsManager::CheckIfAnySlabs;
+		using RunPeriodChunks::ExchangeChunkTabularResults;
+		using RunPeriodChunks::RecordChunkSeamTemperatures;
+		using SimulationCheckpoint::ManageSimulationCheckpoint;
 		
 
 		// Locals
@@ -483,6 +492,10 @@ namespace SimulationManager {
 
 						ManageHeatBalance();
 
+						if ( RunPeriodChunks::ChunkNum > 0 && EndHourFlag ) RecordChunkSeamTemperatures();
+
+						if ( SimulationCheckpoint::CheckpointDay > 0 && EndDayFlag ) ManageSimulationCheckpoint();
+
 						//  After the first iteration of HeatBalance, all the 'input' has been gotten
 						if ( BeginFullSimFlag ) {
 							if ( GetNumRangeCheckErrorsFound() > 0 ) {
@@ -535,6 +548,8 @@ namespace SimulationManager {
 
 		ReportForTabularReports(); // For Energy Meters (could have other things that need to be pushed to after simulation)
 
+		if ( RunPeriodChunks::ChunkNum > 0 ) ExchangeChunkTabularResults(); // Monthly and binned results of the chunks
+
 		OpenOutputTabularFile();
 
 		WriteTabularReports(); //     Create the tabular reports at completion of each
@@ -547,6 +562,14 @@ namespace SimulationManager {
 
 		DumpAirLoopStatistics(); // Dump runtime statistics for air loop controller simulation to csv file
 
+		WriteControllerTelemetry(); // Convergence telemetry for each air loop controller to SQLite
+
+		ReportHVACQuiescence(); // Skipped quiescent HVAC solutions to the audit file
+
+		ReportTARCOGCache(); // Complex fenestration thermal solutions reused from the cache to the audit file
+
+		ReportExternalInterfaceExchanges(); // ExternalInterface round trip latency histogram to the audit file
+
 #ifdef EP_Detailed_Timings
 		epStopTime( "Closeout Reporting=" );
 #endif
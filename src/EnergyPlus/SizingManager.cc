@@ -1,9 +1,23 @@
 // C++ Headers
+#include <algorithm>
+#include <cerrno>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
 #include <string>
+#include <vector>
+#ifdef __unix__
+#include <csignal>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
+#include <ObjexxFCL/Fmath.hh>
 #include <ObjexxFCL/gio.hh>
 #include <ObjexxFCL/string.functions.hh>
 
@@ -14,12 +28,15 @@
 #include <DataHeatBalance.hh>
 #include <DataHVACGlobals.hh>
 #include <DataIPShortCuts.hh>
+#include <DataErrorTracking.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <DisplayRoutines.hh>
 #include <EMSManager.hh>
+#include <ExternalInterface.hh>
 #include <General.hh>
 #include <HeatBalanceManager.hh>
 #include <InputProcessor.hh>
@@ -51,7 +68,25 @@ namespace SizingManager {
 
 	// REFERENCES: none
 
-	// OTHER NOTES: none
+	// OTHER NOTES:
+	// With the environment variable EP_PARALLEL_SIZING set to a number of processes greater than one,
+	// the zone sizing periods after the first are shared out among forked worker processes (POSIX only).
+	// The workers send their CalcZoneSizing, ZoneSizing set point and DesDayWeath days back through
+	// pipes and the parent rebuilds CalcFinalZoneSizing in sizing period order before the results are
+	// finalized and reported, so the sizing results and reports match the serial calculation.
+	// A worker starts its sizing periods from the state after the first period, where the serial
+	// calculation starts them from the state after the previous period. Every environment starts
+	// from the initial state: the models simulated in zone sizing (surface and zone air heat
+	// balances, moisture and finite difference models, airflow network, shading, ideal loads)
+	// reset their histories and iteration starting values at BeginEnvrnFlag, the one-time
+	// initializations have all run in the first period before the fork, and the psychrometric
+	// caches return the value of the cached grid point whatever filled them. The state that
+	// differs at the fork is therefore overwritten before it is used, in both calculations alike.
+	// The error and eio text of the sizing periods after the first is written by each process
+	// to one file per sizing period and copied into eplusout.err and eplusout.eio in sizing
+	// period order by the parent. The error counters and recurring error statistics the workers
+	// gather are added to those of the parent, so the end of run summary has the same counts;
+	// a recurring message first issued by a worker is listed after those the parent issued.
 
 	// Using/Aliasing
 	using namespace DataPrecisionGlobals;
@@ -61,6 +96,7 @@ namespace SizingManager {
 	using namespace DataSizing;
 	using DataHVACGlobals::NumPrimaryAirSys;
 	using DataZoneEquipment::ZoneEquipConfig;
+	using DataErrorTracking::RecurringErrorData;
 	using DataStringGlobals::CharTab;
 	using DataStringGlobals::CharComma;
 	using DataStringGlobals::CharSpace;
@@ -74,6 +110,24 @@ namespace SizingManager {
 
 	// MODULE VARIABLE DECLARATIONS:
 	int NumAirLoops( 0 );
+	int NumSizingProcs( 1 ); // Number of processes sharing the zone sizing periods (1 = serial)
+	int SizingProcNum( 0 ); // 0 in the parent, 1..NumSizingProcs-1 in a zone sizing worker
+	int SizingWorkerFD( -1 ); // Write end of the pipe to the parent (zone sizing worker only)
+	int WarningsAtFork( 0 ); // TotalWarningErrors when the zone sizing workers were started
+	int SeveresAtFork( 0 ); // TotalSevereErrors when the zone sizing workers were started
+	int WarmupWarningsAtFork( 0 ); // TotalWarningErrorsDuringWarmup when the zone sizing workers were started
+	int WarmupSeveresAtFork( 0 ); // TotalSevereErrorsDuringWarmup when the zone sizing workers were started
+	int SizingWarningsAtFork( 0 ); // TotalWarningErrorsDuringSizing when the zone sizing workers were started
+	int SizingSeveresAtFork( 0 ); // TotalSevereErrorsDuringSizing when the zone sizing workers were started
+	FArray1D_int MatchCountsAtFork; // MatchCounts when the zone sizing workers were started
+	int NumRecurringErrorsAtFork( 0 ); // NumRecurringErrors when the zone sizing workers were started
+	std::vector< int > SizingProcDays; // Sizing period days simulated by this process after the fork
+	FArray1D_int SizingWorkerPID; // Process id of each zone sizing worker
+	FArray1D_int SizingWorkerPipe; // Read end of the pipe from each zone sizing worker
+	int SizingErrUnit( 0 ); // Unit of eplusout.err while the zone sizing periods are shared out
+
+	// Object Data
+	FArray1D< DataErrorTracking::RecurringErrorData > RecurringErrorsAtFork; // Recurring errors when the zone sizing workers were started
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SimulationManager
 
@@ -88,7 +142,7 @@ namespace SizingManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Buhl
 		//       DATE WRITTEN   December 2000
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, optional parallel zone sizing periods
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -106,12 +160,15 @@ namespace SizingManager {
 
 		// Using/Aliasing
 		using InputProcessor::GetNumRangeCheckErrorsFound;
+		using DataSystemVariables::NumSizingWorkers;
+		using ExternalInterface::NumExternalInterfaces;
 		using ZoneEquipmentManager::UpdateZoneSizing;
 		using ZoneEquipmentManager::ManageZoneEquipment;
 		using ZoneEquipmentManager::RezeroZoneSizingArrays;
 		using SimAirServingZones::ManageAirLoops;
 		using SimAirServingZones::UpdateSysSizing;
 		using DataEnvironment::TotDesDays;
+		using DataEnvironment::TotRunDesPersDays;
 		using DataEnvironment::OutDryBulbTemp;
 		using DataEnvironment::OutHumRat;
 		using DataEnvironment::OutBaroPress;
@@ -156,6 +213,9 @@ namespace SizingManager {
 		static int TimeStepAtPeak( 0 ); // time step number at heat or cool peak
 		static int DDNum( 0 ); // Design Day index
 		static int AirLoopNum( 0 ); // air loop index
+		static int LastSizingPeriod( 0 ); // last zone sizing period simulated by this process
+		int FirstDayOfPeriod; // first sizing period day of the current zone sizing period
+		int PeriodDayNum; // sizing period day index
 		//  EXTERNAL            ReportZoneSizing
 		//  EXTERNAL            ReportSysSizing
 		std::string curName;
@@ -244,6 +304,16 @@ namespace SizingManager {
 			SetupZoneSizing( ErrorsFound ); // Should only be done ONCE
 			KickOffSizing = false;
 
+			// share the zone sizing periods after the first among worker processes if requested
+			NumSizingProcs = 1;
+			if ( NumSizingWorkers > 1 ) {
+				if ( numZoneSizeIter == 1 && ! AnyEnergyManagementSystemInModel && NumExternalInterfaces == 0 && ! sqlite->writeOutputToSQLite() ) {
+					NumSizingProcs = max( 1, min( NumSizingWorkers, TotDesDays + TotRunDesPersDays - 1 ) );
+				} else {
+					DisplayString( "Parallel zone sizing is not available for this input file, zone sizing runs serially" );
+				}
+			}
+
 			for ( iZoneCalcIter = 1; iZoneCalcIter <= numZoneSizeIter; ++iZoneCalcIter ) { //normally this is performed once but if load component
 				//report is requested, these are repeated with a pulse in
 				//each zone.
@@ -273,6 +343,17 @@ namespace SizingManager {
 
 					++NumSizingPeriodsPerformed;
 
+					// the first sizing period initializes the simulation in the parent, the rest are shared out
+					if ( NumSizingProcs > 1 && NumSizingPeriodsPerformed == 2 ) {
+						if ( StartZoneSizingWorkers() ) SizingProcDays.clear();
+					}
+					if ( NumSizingProcs > 1 && NumSizingPeriodsPerformed > 1 && ( NumSizingPeriodsPerformed - 2 ) % NumSizingProcs != SizingProcNum ) {
+						CurOverallSimDay += NumOfDayInEnvrn; // simulated by another process
+						continue;
+					}
+					if ( NumSizingProcs > 1 && NumSizingPeriodsPerformed > 1 ) SwitchSizingPeriodOutput( NumSizingPeriodsPerformed );
+					FirstDayOfPeriod = CurOverallSimDay + 1;
+
 					BeginEnvrnFlag = true;
 					EndEnvrnFlag = false;
 					EndMonthFlag = false;
@@ -390,9 +471,21 @@ namespace SizingManager {
 
 					LastMonth = Month;
 					LastDayOfMonth = DayOfMonth;
+					LastSizingPeriod = NumSizingPeriodsPerformed;
+					if ( SizingProcNum > 0 ) {
+						for ( PeriodDayNum = FirstDayOfPeriod; PeriodDayNum <= CurOverallSimDay; ++PeriodDayNum ) {
+							SizingProcDays.push_back( PeriodDayNum );
+						}
+					}
 
 				} // ... End environment loop
 
+				if ( NumSizingProcs > 1 && NumSizingPeriodsPerformed > 1 ) {
+					if ( SizingProcNum > 0 ) FinishZoneSizingWorker( LastSizingPeriod, LastMonth, LastDayOfMonth, ErrorsFound );
+					GatherZoneSizingWorkers( LastSizingPeriod, LastMonth, LastDayOfMonth, ErrorsFound );
+					NumSizingProcs = 1;
+				}
+
 				if ( NumSizingPeriodsPerformed > 0 ) {
 					UpdateZoneSizing( EndZoneSizingCalc );
 					ZoneSizingRunDone = true;
@@ -2589,6 +2682,839 @@ namespace SizingManager {
 	}
 
 
+	void
+	SizingWorkerBuffer::Transfer( int & Value )
+	{
+		if ( Packing ) {
+			Data.append( reinterpret_cast< char const * >( &Value ), sizeof( Value ) );
+		} else {
+			CheckRemaining( sizeof( Value ) );
+			std::memcpy( &Value, Data.data() + Pos, sizeof( Value ) );
+			Pos += sizeof( Value );
+		}
+	}
+
+	void
+	SizingWorkerBuffer::Transfer( Real64 & Value )
+	{
+		if ( Packing ) {
+			Data.append( reinterpret_cast< char const * >( &Value ), sizeof( Value ) );
+		} else {
+			CheckRemaining( sizeof( Value ) );
+			std::memcpy( &Value, Data.data() + Pos, sizeof( Value ) );
+			Pos += sizeof( Value );
+		}
+	}
+
+	void
+	SizingWorkerBuffer::Transfer( std::string & Value )
+	{
+		int Length( Value.length() );
+
+		Transfer( Length );
+		if ( Packing ) {
+			Data.append( Value );
+		} else {
+			CheckRemaining( Length );
+			Value.assign( Data, Pos, Length );
+			Pos += Length;
+		}
+	}
+
+	void
+	SizingWorkerBuffer::Transfer( FArray1D< Real64 > & Values )
+	{
+		int NumValues( Values.size() );
+		int ValueNum;
+
+		Transfer( NumValues );
+		if ( ! Packing && NumValues != int( Values.size() ) ) {
+			ShowFatalError( "ManageSizing: zone sizing worker results do not match the sizing arrays." );
+		}
+		for ( ValueNum = 1; ValueNum <= NumValues; ++ValueNum ) {
+			Transfer( Values( ValueNum ) );
+		}
+	}
+
+	void
+	SizingWorkerBuffer::CheckRemaining( std::string::size_type const Length ) const
+	{
+		if ( Pos + Length > Data.length() ) {
+			ShowFatalError( "ManageSizing: zone sizing worker results are incomplete." );
+		}
+	}
+
+	void
+	TransferZoneSizingDay(
+		SizingWorkerBuffer & Buffer, // packed results of a zone sizing worker
+		int const DDNum // sizing period day index
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Packs (in a zone sizing worker) or unpacks (in the parent) everything the zone sizing
+		// calculation stores for one sizing period day: the design day weather, the zone
+		// thermostat set point sequences and the calculated zone sizing results.
+
+		// METHODOLOGY EMPLOYED:
+		// The same list of fields is used in both directions so the two sides cannot drift apart.
+		// Only fields set by UpdateZoneSizing (BeginDay, DuringDay, EndDay) are transferred; the
+		// input fields are identical in every process.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS: none
+
+		// DERIVED TYPE DEFINITIONS: none
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int CtrlZoneNum; // controlled zone index
+
+		Buffer.Transfer( DesDayWeath( DDNum ).DateString );
+		Buffer.Transfer( DesDayWeath( DDNum ).Temp );
+		Buffer.Transfer( DesDayWeath( DDNum ).HumRat );
+		Buffer.Transfer( DesDayWeath( DDNum ).Press );
+
+		for ( CtrlZoneNum = 1; CtrlZoneNum <= NumOfZones; ++CtrlZoneNum ) {
+			if ( ! ZoneEquipConfig( CtrlZoneNum ).IsControlled ) continue;
+
+			auto & ZoneSizingDay( ZoneSizing( CtrlZoneNum, DDNum ) );
+			Buffer.Transfer( ZoneSizingDay.DesHeatSetPtSeq );
+			Buffer.Transfer( ZoneSizingDay.HeatTstatTempSeq );
+			Buffer.Transfer( ZoneSizingDay.DesCoolSetPtSeq );
+			Buffer.Transfer( ZoneSizingDay.CoolTstatTempSeq );
+
+			auto & CalcZoneSizingDay( CalcZoneSizing( CtrlZoneNum, DDNum ) );
+			Buffer.Transfer( CalcZoneSizingDay.HeatDesDay );
+			Buffer.Transfer( CalcZoneSizingDay.DesHeatDens );
+			Buffer.Transfer( CalcZoneSizingDay.HeatDDNum );
+			Buffer.Transfer( CalcZoneSizingDay.HeatFlowSeq );
+			Buffer.Transfer( CalcZoneSizingDay.HeatLoadSeq );
+			Buffer.Transfer( CalcZoneSizingDay.HeatZoneTempSeq );
+			Buffer.Transfer( CalcZoneSizingDay.HeatOutTempSeq );
+			Buffer.Transfer( CalcZoneSizingDay.HeatZoneRetTempSeq );
+			Buffer.Transfer( CalcZoneSizingDay.HeatTstatTempSeq );
+			Buffer.Transfer( CalcZoneSizingDay.HeatZoneHumRatSeq );
+			Buffer.Transfer( CalcZoneSizingDay.HeatOutHumRatSeq );
+			Buffer.Transfer( CalcZoneSizingDay.DesHeatLoad );
+			Buffer.Transfer( CalcZoneSizingDay.DesHeatMassFlow );
+			Buffer.Transfer( CalcZoneSizingDay.DesHeatVolFlow );
+			Buffer.Transfer( CalcZoneSizingDay.ZoneTempAtHeatPeak );
+			Buffer.Transfer( CalcZoneSizingDay.OutTempAtHeatPeak );
+			Buffer.Transfer( CalcZoneSizingDay.ZoneRetTempAtHeatPeak );
+			Buffer.Transfer( CalcZoneSizingDay.HeatTstatTemp );
+			Buffer.Transfer( CalcZoneSizingDay.ZoneHumRatAtHeatPeak );
+			Buffer.Transfer( CalcZoneSizingDay.OutHumRatAtHeatPeak );
+			Buffer.Transfer( CalcZoneSizingDay.TimeStepNumAtHeatMax );
+			Buffer.Transfer( CalcZoneSizingDay.DesHeatCoilInTemp );
+			Buffer.Transfer( CalcZoneSizingDay.DesHeatCoilInHumRat );
+
+			Buffer.Transfer( CalcZoneSizingDay.CoolDesDay );
+			Buffer.Transfer( CalcZoneSizingDay.DesCoolDens );
+			Buffer.Transfer( CalcZoneSizingDay.CoolDDNum );
+			Buffer.Transfer( CalcZoneSizingDay.CoolFlowSeq );
+			Buffer.Transfer( CalcZoneSizingDay.CoolLoadSeq );
+			Buffer.Transfer( CalcZoneSizingDay.CoolZoneTempSeq );
+			Buffer.Transfer( CalcZoneSizingDay.CoolOutTempSeq );
+			Buffer.Transfer( CalcZoneSizingDay.CoolZoneRetTempSeq );
+			Buffer.Transfer( CalcZoneSizingDay.CoolTstatTempSeq );
+			Buffer.Transfer( CalcZoneSizingDay.CoolZoneHumRatSeq );
+			Buffer.Transfer( CalcZoneSizingDay.CoolOutHumRatSeq );
+			Buffer.Transfer( CalcZoneSizingDay.DesCoolLoad );
+			Buffer.Transfer( CalcZoneSizingDay.DesCoolMassFlow );
+			Buffer.Transfer( CalcZoneSizingDay.DesCoolVolFlow );
+			Buffer.Transfer( CalcZoneSizingDay.ZoneTempAtCoolPeak );
+			Buffer.Transfer( CalcZoneSizingDay.OutTempAtCoolPeak );
+			Buffer.Transfer( CalcZoneSizingDay.ZoneRetTempAtCoolPeak );
+			Buffer.Transfer( CalcZoneSizingDay.CoolTstatTemp );
+			Buffer.Transfer( CalcZoneSizingDay.ZoneHumRatAtCoolPeak );
+			Buffer.Transfer( CalcZoneSizingDay.OutHumRatAtCoolPeak );
+			Buffer.Transfer( CalcZoneSizingDay.TimeStepNumAtCoolMax );
+			Buffer.Transfer( CalcZoneSizingDay.DesCoolCoilInTemp );
+			Buffer.Transfer( CalcZoneSizingDay.DesCoolCoilInHumRat );
+		}
+
+	}
+
+	void
+	TransferRecurringError(
+		SizingWorkerBuffer & Buffer, // packed results of a zone sizing worker
+		RecurringErrorData & Error // recurring error statistics
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Packs (in a zone sizing worker) or unpacks (in the parent) the statistics of one
+		// recurring error message.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS: none
+
+		// DERIVED TYPE DEFINITIONS: none
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Flag; // logical field being packed
+
+		Buffer.Transfer( Error.Message );
+		Buffer.Transfer( Error.Count );
+		Buffer.Transfer( Error.WarmupCount );
+		Buffer.Transfer( Error.SizingCount );
+		Buffer.Transfer( Error.MaxValue );
+		Buffer.Transfer( Error.MinValue );
+		Buffer.Transfer( Error.SumValue );
+		Buffer.Transfer( Error.MaxUnits );
+		Buffer.Transfer( Error.MinUnits );
+		Buffer.Transfer( Error.SumUnits );
+		Flag = ( Error.ReportMax ? 1 : 0 );
+		Buffer.Transfer( Flag );
+		Error.ReportMax = ( Flag != 0 );
+		Flag = ( Error.ReportMin ? 1 : 0 );
+		Buffer.Transfer( Flag );
+		Error.ReportMin = ( Flag != 0 );
+		Flag = ( Error.ReportSum ? 1 : 0 );
+		Buffer.Transfer( Flag );
+		Error.ReportSum = ( Flag != 0 );
+
+	}
+
+	void
+	MergeRecurringError(
+		int const ErrNum, // recurring error index in the zone sizing worker
+		RecurringErrorData const & Error // statistics of the worker since the fork
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the recurring error statistics a zone sizing worker gathered after the fork to
+		// the recurring errors of the parent, so that the end of run summary matches the serial
+		// calculation.
+
+		// METHODOLOGY EMPLOYED:
+		// A message that existed at the fork has the same index in both processes. A message
+		// first issued after the fork is matched by its text with the messages the parent or
+		// an earlier worker added since, or else appended. Counts and sums are added; the max
+		// and min values are combined.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataErrorTracking::NumRecurringErrors;
+		using DataErrorTracking::RecurringErrors;
+		using DataErrorTracking::MergedRecurringErrors;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS: none
+
+		// DERIVED TYPE DEFINITIONS: none
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int MergeNum( 0 ); // recurring error index in the parent
+		int Loop; // recurring error index searched
+
+		if ( Error.Count == 0 ) return;
+
+		if ( ErrNum <= NumRecurringErrorsAtFork ) {
+			MergeNum = ErrNum;
+		} else {
+			for ( Loop = NumRecurringErrorsAtFork + 1; Loop <= NumRecurringErrors; ++Loop ) {
+				if ( RecurringErrors( Loop ).Message != Error.Message ) continue;
+				MergeNum = Loop;
+				break;
+			}
+			if ( MergeNum == 0 ) {
+				StoreRecurringErrorMessage( Error.Message, MergeNum );
+				RecurringErrors( MergeNum ) = Error;
+				MergedRecurringErrors = true;
+				return;
+			}
+		}
+
+		auto & Merged( RecurringErrors( MergeNum ) );
+		Merged.Count += Error.Count;
+		Merged.WarmupCount += Error.WarmupCount;
+		Merged.SizingCount += Error.SizingCount;
+		if ( Error.ReportMax ) {
+			Merged.MaxValue = ( Merged.ReportMax ? max( Merged.MaxValue, Error.MaxValue ) : Error.MaxValue );
+			if ( Merged.MaxUnits.empty() ) Merged.MaxUnits = Error.MaxUnits;
+			Merged.ReportMax = true;
+		}
+		if ( Error.ReportMin ) {
+			Merged.MinValue = ( Merged.ReportMin ? min( Merged.MinValue, Error.MinValue ) : Error.MinValue );
+			if ( Merged.MinUnits.empty() ) Merged.MinUnits = Error.MinUnits;
+			Merged.ReportMin = true;
+		}
+		if ( Error.ReportSum ) {
+			Merged.SumValue += Error.SumValue;
+			if ( Merged.SumUnits.empty() ) Merged.SumUnits = Error.SumUnits;
+			Merged.ReportSum = true;
+		}
+
+	}
+
+	bool
+	StartZoneSizingWorkers()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Forks NumSizingProcs - 1 zone sizing worker processes. Returns true in a worker and
+		// false in the parent.
+
+		// METHODOLOGY EMPLOYED:
+		// The error and eio files are flushed first, so that no buffered text is duplicated
+		// into the workers. Each worker gets a pipe back to the parent. All other inherited
+		// descriptors of a worker (output files, console) are pointed at /dev/null so that only
+		// the parent writes the output files of the run; the error and eio text of its sizing
+		// periods goes to the sizing period files of SwitchSizingPeriodOutput, and standard
+		// error is kept for crash diagnostics. The fork follows the first sizing period, so
+		// the workers start their periods from a state that differs from the serial one only
+		// in what BeginEnvrnFlag initializes (see the module notes).
+		// If a worker cannot be started the ones already running are stopped and the zone
+		// sizing continues serially in the parent.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::SizingWorkerProcess;
+		using namespace DataErrorTracking;
+
+		// Return value
+		bool IsWorker( false );
+
+#ifdef __unix__
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const MaxDescriptor( 65536 ); // highest file descriptor redirected in a worker
+
+		// INTERFACE BLOCK SPECIFICATIONS: none
+
+		// DERIVED TYPE DEFINITIONS: none
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int ProcNum; // zone sizing process index
+		int PipeFD[ 2 ]; // read and write end of the pipe to a worker
+		pid_t PID; // process id returned by fork
+		int NullFD; // descriptor of /dev/null
+		int FD; // descriptor index
+		int NumFD; // number of descriptors checked in a worker
+		int Status; // exit status of a stopped worker
+		int ErrNum; // recurring error index
+
+		SizingWorkerPID.dimension( NumSizingProcs - 1, 0 );
+		SizingWorkerPipe.dimension( NumSizingProcs - 1, -1 );
+		WarningsAtFork = TotalWarningErrors;
+		SeveresAtFork = TotalSevereErrors;
+		WarmupWarningsAtFork = TotalWarningErrorsDuringWarmup;
+		WarmupSeveresAtFork = TotalSevereErrorsDuringWarmup;
+		SizingWarningsAtFork = TotalWarningErrorsDuringSizing;
+		SizingSeveresAtFork = TotalSevereErrorsDuringSizing;
+		MatchCountsAtFork.dimension( SearchCounts, 0 );
+		MatchCountsAtFork = MatchCounts;
+		NumRecurringErrorsAtFork = NumRecurringErrors;
+		RecurringErrorsAtFork.allocate( NumRecurringErrors );
+		for ( ErrNum = 1; ErrNum <= NumRecurringErrors; ++ErrNum ) {
+			RecurringErrorsAtFork( ErrNum ) = RecurringErrors( ErrNum );
+		}
+
+		SizingErrUnit = FindUnitNumber( "eplusout.err" );
+		gio::close( SizingErrUnit );
+		{ IOFlags flags; flags.POSITION( "APPEND" ); gio::open( SizingErrUnit, "eplusout.err", flags ); }
+		gio::close( OutputFileInits );
+		{ IOFlags flags; flags.POSITION( "APPEND" ); gio::open( OutputFileInits, "eplusout.eio", flags ); }
+		std::cout.flush();
+
+		for ( ProcNum = 1; ProcNum <= NumSizingProcs - 1; ++ProcNum ) {
+			if ( pipe( PipeFD ) != 0 ) break;
+			PID = fork();
+			if ( PID < 0 ) {
+				close( PipeFD[ 0 ] );
+				close( PipeFD[ 1 ] );
+				break;
+			}
+			if ( PID == 0 ) {
+				close( PipeFD[ 0 ] );
+				NullFD = open( "/dev/null", O_WRONLY );
+				NumFD = min( int( sysconf( _SC_OPEN_MAX ) ), MaxDescriptor );
+				if ( NumFD <= 0 ) NumFD = MaxDescriptor;
+				for ( FD = 1; FD < NumFD; ++FD ) {
+					if ( FD == STDERR_FILENO || FD == PipeFD[ 1 ] || FD == NullFD ) continue;
+					if ( fcntl( FD, F_GETFD ) != -1 ) dup2( NullFD, FD );
+				}
+				SizingProcNum = ProcNum;
+				SizingWorkerFD = PipeFD[ 1 ];
+				SizingWorkerProcess = true;
+				IsWorker = true;
+				return IsWorker;
+			}
+			close( PipeFD[ 1 ] );
+			SizingWorkerPID( ProcNum ) = PID;
+			SizingWorkerPipe( ProcNum ) = PipeFD[ 0 ];
+		}
+
+		if ( ProcNum < NumSizingProcs ) {
+			for ( ProcNum = 1; ProcNum <= NumSizingProcs - 1; ++ProcNum ) {
+				if ( SizingWorkerPID( ProcNum ) <= 0 ) continue;
+				kill( SizingWorkerPID( ProcNum ), SIGKILL );
+				waitpid( SizingWorkerPID( ProcNum ), &Status, 0 );
+				close( SizingWorkerPipe( ProcNum ) );
+			}
+			ShowWarningError( "ManageSizing: Could not start the zone sizing worker processes, zone sizing continues serially." );
+			NumSizingProcs = 1;
+		}
+#endif
+
+		return IsWorker;
+
+	}
+
+	void
+	FinishZoneSizingWorker(
+		int const LastPeriodNum, // last sizing period simulated by this worker
+		int const LastMonth, // month at the end of that sizing period
+		int const LastDayOfMonth, // day of month at the end of that sizing period
+		bool const ErrorsFound // true if the worker found errors
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sends the zone sizing results of a worker to the parent and ends the worker process.
+
+		// METHODOLOGY EMPLOYED:
+		// The sizing period files are closed, the results are packed into one buffer and
+		// written to the pipe; the process then ends without running any end-of-run processing.
+		// The error counters and the recurring error statistics are sent as their change
+		// since the fork, so that the parent can add them to its own.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using namespace DataErrorTracking;
+
+#ifdef __unix__
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS: none
+
+		// DERIVED TYPE DEFINITIONS: none
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		SizingWorkerBuffer Buffer; // packed results
+		int NumDays( SizingProcDays.size() ); // number of sizing period days simulated
+		int DayNum; // index into SizingProcDays
+		int Value; // scalar being packed
+		int Loop; // message search index
+		int ErrNum; // recurring error index
+		std::string::size_type Written( 0 ); // bytes written to the pipe so far
+		ssize_t Count; // bytes written by one call
+
+		CloseSizingPeriodOutput();
+
+		Buffer.Transfer( NumDays );
+		for ( DayNum = 0; DayNum < NumDays; ++DayNum ) {
+			Buffer.Transfer( SizingProcDays[ DayNum ] );
+			TransferZoneSizingDay( Buffer, SizingProcDays[ DayNum ] );
+		}
+		Buffer.Transfer( ZoneSizThermSetPtHi );
+		Buffer.Transfer( ZoneSizThermSetPtLo );
+		Value = LastPeriodNum;
+		Buffer.Transfer( Value );
+		Value = LastMonth;
+		Buffer.Transfer( Value );
+		Value = LastDayOfMonth;
+		Buffer.Transfer( Value );
+		Value = ( ErrorsFound ? 1 : 0 );
+		Buffer.Transfer( Value );
+		Value = TotalWarningErrors - WarningsAtFork;
+		Buffer.Transfer( Value );
+		Value = TotalSevereErrors - SeveresAtFork;
+		Buffer.Transfer( Value );
+		Value = TotalWarningErrorsDuringWarmup - WarmupWarningsAtFork;
+		Buffer.Transfer( Value );
+		Value = TotalSevereErrorsDuringWarmup - WarmupSeveresAtFork;
+		Buffer.Transfer( Value );
+		Value = TotalWarningErrorsDuringSizing - SizingWarningsAtFork;
+		Buffer.Transfer( Value );
+		Value = TotalSevereErrorsDuringSizing - SizingSeveresAtFork;
+		Buffer.Transfer( Value );
+		for ( Loop = 1; Loop <= SearchCounts; ++Loop ) {
+			Value = MatchCounts( Loop ) - MatchCountsAtFork( Loop );
+			Buffer.Transfer( Value );
+		}
+		Value = NumRecurringErrors;
+		Buffer.Transfer( Value );
+		for ( ErrNum = 1; ErrNum <= NumRecurringErrors; ++ErrNum ) {
+			RecurringErrorData Error( RecurringErrors( ErrNum ) );
+			if ( ErrNum <= NumRecurringErrorsAtFork ) {
+				Error.Count -= RecurringErrorsAtFork( ErrNum ).Count;
+				Error.WarmupCount -= RecurringErrorsAtFork( ErrNum ).WarmupCount;
+				Error.SizingCount -= RecurringErrorsAtFork( ErrNum ).SizingCount;
+				Error.SumValue -= RecurringErrorsAtFork( ErrNum ).SumValue;
+			}
+			TransferRecurringError( Buffer, Error );
+		}
+
+		while ( Written < Buffer.Data.length() ) {
+			Count = write( SizingWorkerFD, Buffer.Data.data() + Written, Buffer.Data.length() - Written );
+			if ( Count < 0 ) {
+				if ( errno == EINTR ) continue;
+				std::_Exit( EXIT_FAILURE );
+			}
+			Written += Count;
+		}
+		close( SizingWorkerFD );
+		std::_Exit( EXIT_SUCCESS );
+#endif
+
+	}
+
+	void
+	GatherZoneSizingWorkers(
+		int & LastPeriodNum, // last sizing period simulated by the parent, updated to the last overall
+		int & LastMonth, // month at the end of LastPeriodNum
+		int & LastDayOfMonth, // day of month at the end of LastPeriodNum
+		bool & ErrorsFound // set to true if a worker failed or found errors
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Collects the zone sizing results of all workers into the parent's CalcZoneSizing,
+		// ZoneSizing and DesDayWeath arrays and rebuilds CalcFinalZoneSizing.
+
+		// METHODOLOGY EMPLOYED:
+		// The parent's own error and eio files are reopened first. Each pipe is read to its end
+		// before the worker is reaped. The thermostat set point extremes are combined with
+		// max/min. The error and eio text of all sizing periods, including that of a failed
+		// worker, is then copied in sizing period order, and CalcFinalZoneSizing is rebuilt by
+		// folding in every sizing period day in day order, exactly as the serial calculation
+		// does, so ties between sizing periods are resolved the same way. The error counters
+		// and recurring error statistics of the workers are added to those of the parent.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using namespace DataErrorTracking;
+		using ZoneEquipmentManager::MergeZoneSizingDesignDay;
+		using General::RoundSigDigits;
+
+#ifdef __unix__
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const ChunkSize( 65536 ); // bytes read from a pipe per call
+
+		// INTERFACE BLOCK SPECIFICATIONS: none
+
+		// DERIVED TYPE DEFINITIONS: none
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ProcNum; // zone sizing process index
+		int NumDays; // number of sizing period days sent by a worker
+		int DayNum; // counter over those days
+		int DDNum; // sizing period day index
+		int CtrlZoneNum; // controlled zone index
+		int Status; // exit status of a worker
+		int Value; // scalar being unpacked
+		int WorkerPeriodNum; // last sizing period simulated by a worker
+		int WorkerMonth; // month at the end of that sizing period
+		int WorkerDayOfMonth; // day of month at the end of that sizing period
+		int NumErrors; // number of recurring errors sent by a worker
+		int ErrNum; // recurring error index in a worker
+		int Loop; // message search index
+		int WorkerWarnings( 0 ); // warnings issued by all workers
+		int WorkerSeveres( 0 ); // severe errors issued by all workers
+		bool WorkerFailed( false ); // true if any worker did not complete
+		ssize_t Count; // bytes read by one call
+		std::vector< char > Chunk( ChunkSize ); // read buffer
+		FArray1D< Real64 > WorkerSetPtHi( NumOfZones ); // highest thermostat set points of a worker
+		FArray1D< Real64 > WorkerSetPtLo( NumOfZones ); // lowest thermostat set points of a worker
+
+		CloseSizingPeriodOutput();
+		{ IOFlags flags; flags.POSITION( "APPEND" ); gio::open( SizingErrUnit, "eplusout.err", flags ); }
+		{ IOFlags flags; flags.POSITION( "APPEND" ); gio::open( OutputFileInits, "eplusout.eio", flags ); }
+
+		for ( ProcNum = 1; ProcNum <= NumSizingProcs - 1; ++ProcNum ) {
+			SizingWorkerBuffer Buffer;
+			while ( true ) {
+				Count = read( SizingWorkerPipe( ProcNum ), Chunk.data(), ChunkSize );
+				if ( Count < 0 && errno == EINTR ) continue;
+				if ( Count <= 0 ) break;
+				Buffer.Data.append( Chunk.data(), Count );
+			}
+			close( SizingWorkerPipe( ProcNum ) );
+			waitpid( SizingWorkerPID( ProcNum ), &Status, 0 );
+			if ( ! WIFEXITED( Status ) || WEXITSTATUS( Status ) != EXIT_SUCCESS ) {
+				ShowSevereError( "ManageSizing: Zone sizing worker " + RoundSigDigits( ProcNum ) + " did not complete." );
+				WorkerFailed = true;
+				continue;
+			}
+
+			Buffer.Packing = false;
+			Buffer.Transfer( NumDays );
+			for ( DayNum = 1; DayNum <= NumDays; ++DayNum ) {
+				Buffer.Transfer( DDNum );
+				TransferZoneSizingDay( Buffer, DDNum );
+			}
+			Buffer.Transfer( WorkerSetPtHi );
+			Buffer.Transfer( WorkerSetPtLo );
+			for ( CtrlZoneNum = 1; CtrlZoneNum <= NumOfZones; ++CtrlZoneNum ) {
+				ZoneSizThermSetPtHi( CtrlZoneNum ) = max( ZoneSizThermSetPtHi( CtrlZoneNum ), WorkerSetPtHi( CtrlZoneNum ) );
+				ZoneSizThermSetPtLo( CtrlZoneNum ) = min( ZoneSizThermSetPtLo( CtrlZoneNum ), WorkerSetPtLo( CtrlZoneNum ) );
+			}
+			Buffer.Transfer( WorkerPeriodNum );
+			Buffer.Transfer( WorkerMonth );
+			Buffer.Transfer( WorkerDayOfMonth );
+			if ( WorkerPeriodNum > LastPeriodNum ) {
+				LastPeriodNum = WorkerPeriodNum;
+				LastMonth = WorkerMonth;
+				LastDayOfMonth = WorkerDayOfMonth;
+			}
+			Buffer.Transfer( Value );
+			if ( Value != 0 ) ErrorsFound = true;
+			Buffer.Transfer( Value );
+			WorkerWarnings += Value;
+			Buffer.Transfer( Value );
+			WorkerSeveres += Value;
+			Buffer.Transfer( Value );
+			TotalWarningErrorsDuringWarmup += Value;
+			Buffer.Transfer( Value );
+			TotalSevereErrorsDuringWarmup += Value;
+			Buffer.Transfer( Value );
+			TotalWarningErrorsDuringSizing += Value;
+			Buffer.Transfer( Value );
+			TotalSevereErrorsDuringSizing += Value;
+			for ( Loop = 1; Loop <= SearchCounts; ++Loop ) {
+				Buffer.Transfer( Value );
+				MatchCounts( Loop ) += Value;
+			}
+			Buffer.Transfer( NumErrors );
+			for ( ErrNum = 1; ErrNum <= NumErrors; ++ErrNum ) {
+				RecurringErrorData Error;
+				TransferRecurringError( Buffer, Error );
+				MergeRecurringError( ErrNum, Error );
+			}
+		}
+
+		MergeSizingPeriodOutput();
+		if ( WorkerFailed ) {
+			ShowFatalError( "ManageSizing: Parallel zone sizing failed." );
+		}
+		TotalWarningErrors += WorkerWarnings;
+		TotalSevereErrors += WorkerSeveres;
+
+		for ( CtrlZoneNum = 1; CtrlZoneNum <= NumOfZones; ++CtrlZoneNum ) {
+			if ( ! ZoneEquipConfig( CtrlZoneNum ).IsControlled ) continue;
+			CalcFinalZoneSizing( CtrlZoneNum ).DesHeatVolFlow = 0.0;
+			CalcFinalZoneSizing( CtrlZoneNum ).DesCoolVolFlow = 0.0;
+		}
+		for ( DDNum = 1; DDNum <= CurOverallSimDay; ++DDNum ) {
+			MergeZoneSizingDesignDay( DDNum );
+		}
+
+		SizingWorkerPID.deallocate();
+		SizingWorkerPipe.deallocate();
+#endif
+
+	}
+
+	void
+	SwitchSizingPeriodOutput( int const PeriodNum ) // sizing period about to be simulated by this process
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Points the error and eio files of this process at the files of a sizing period, while
+		// the zone sizing periods are shared out among processes.
+
+		// METHODOLOGY EMPLOYED:
+		// The units keep their numbers, so all error and eio writes of the period go to
+		// eplusout.szp<period>.err and eplusout.szp<period>.eio until the next switch.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::TrimSigDigits;
+
+		CloseSizingPeriodOutput();
+		{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( SizingErrUnit, "eplusout.szp" + TrimSigDigits( PeriodNum ) + ".err", flags ); }
+		{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( OutputFileInits, "eplusout.szp" + TrimSigDigits( PeriodNum ) + ".eio", flags ); }
+
+	}
+
+	void
+	CloseSizingPeriodOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Closes the error and eio units while the zone sizing periods are shared out, so that
+		// the text written to them is on disk. Also called when a worker ends on a fatal error.
+
+		if ( SizingErrUnit > 0 ) gio::close( SizingErrUnit );
+		gio::close( OutputFileInits );
+
+	}
+
+	void
+	MergeSizingPeriodOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Copies the error and eio text of the shared out sizing periods into eplusout.err and
+		// eplusout.eio in sizing period order and deletes the sizing period files.
+
+		// METHODOLOGY EMPLOYED:
+		// Each process prints an eio header ("! <...>" line) the first time it writes the
+		// record, so a header first needed after the fork can be in several sizing period
+		// files; only its first copy is kept, where the serial calculation prints it.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::TotDesDays;
+		using DataEnvironment::TotRunDesPersDays;
+		using DataSystemVariables::GoodIOStatValue;
+		using General::TrimSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+
+		// INTERFACE BLOCK SPECIFICATIONS: none
+
+		// DERIVED TYPE DEFINITIONS: none
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int PeriodNum; // sizing period index
+		int FileNum; // 1 = error file, 2 = eio file
+		int ReadUnit; // unit of a sizing period file
+		int ReadStat; // status of reading a line
+		bool Exists; // true if a sizing period file exists
+		std::string FileName; // name of a sizing period file
+		std::string Line; // line of a sizing period file
+		std::vector< std::string > Headers; // eio headers already copied
+
+		for ( PeriodNum = 2; PeriodNum <= TotDesDays + TotRunDesPersDays; ++PeriodNum ) {
+			for ( FileNum = 1; FileNum <= 2; ++FileNum ) {
+				FileName = "eplusout.szp" + TrimSigDigits( PeriodNum ) + ( FileNum == 1 ? ".err" : ".eio" );
+				{ IOFlags flags; gio::inquire( FileName, flags ); Exists = flags.exists(); }
+				if ( ! Exists ) continue;
+				ReadUnit = GetNewUnitNumber();
+				{ IOFlags flags; flags.ACTION( "read" ); gio::open( ReadUnit, FileName, flags ); ReadStat = flags.ios(); }
+				while ( ReadStat == GoodIOStatValue ) {
+					{ IOFlags flags; gio::read( ReadUnit, fmtA, flags ) >> Line; ReadStat = flags.ios(); }
+					if ( ReadStat != GoodIOStatValue ) break;
+					if ( FileNum == 1 ) {
+						gio::write( SizingErrUnit, fmtA ) << Line;
+					} else {
+						if ( has_prefix( Line, "! <" ) ) {
+							if ( std::find( Headers.begin(), Headers.end(), Line ) != Headers.end() ) continue;
+							Headers.push_back( Line );
+						}
+						gio::write( OutputFileInits, fmtA ) << Line;
+					}
+				}
+				{ IOFlags flags; flags.DISPOSE( "DELETE" ); gio::close( ReadUnit, flags ); }
+			}
+		}
+
+	}
+
+
 	void
 		GetZoneHVACSizing( ) {
 
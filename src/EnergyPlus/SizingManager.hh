@@ -1,11 +1,16 @@
 #ifndef SizingManager_hh_INCLUDED
 #define SizingManager_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <DataErrorTracking.hh>
 #include <DataGlobals.hh>
 
 namespace EnergyPlus {
@@ -23,6 +28,24 @@ namespace SizingManager {
 
 	// MODULE VARIABLE DECLARATIONS:
 	extern int NumAirLoops;
+	extern int NumSizingProcs; // Number of processes sharing the zone sizing periods (1 = serial)
+	extern int SizingProcNum; // 0 in the parent, 1..NumSizingProcs-1 in a zone sizing worker
+	extern int SizingWorkerFD; // Write end of the pipe to the parent (zone sizing worker only)
+	extern int WarningsAtFork; // TotalWarningErrors when the zone sizing workers were started
+	extern int SeveresAtFork; // TotalSevereErrors when the zone sizing workers were started
+	extern int WarmupWarningsAtFork; // TotalWarningErrorsDuringWarmup when the zone sizing workers were started
+	extern int WarmupSeveresAtFork; // TotalSevereErrorsDuringWarmup when the zone sizing workers were started
+	extern int SizingWarningsAtFork; // TotalWarningErrorsDuringSizing when the zone sizing workers were started
+	extern int SizingSeveresAtFork; // TotalSevereErrorsDuringSizing when the zone sizing workers were started
+	extern FArray1D_int MatchCountsAtFork; // MatchCounts when the zone sizing workers were started
+	extern int NumRecurringErrorsAtFork; // NumRecurringErrors when the zone sizing workers were started
+	extern std::vector< int > SizingProcDays; // Sizing period days simulated by this process after the fork
+	extern FArray1D_int SizingWorkerPID; // Process id of each zone sizing worker
+	extern FArray1D_int SizingWorkerPipe; // Read end of the pipe from each zone sizing worker
+	extern int SizingErrUnit; // Unit of eplusout.err while the zone sizing periods are shared out
+
+	// Object Data
+	extern FArray1D< DataErrorTracking::RecurringErrorData > RecurringErrorsAtFork; // Recurring errors when the zone sizing workers were started
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SimulationManager
 
@@ -53,6 +76,37 @@ namespace SizingManager {
 
 	};
 
+	struct SizingWorkerBuffer
+	{
+		// Members
+		std::string Data; // Packed zone sizing results
+		std::string::size_type Pos; // Next byte to unpack
+		bool Packing; // True while values are appended, false while they are extracted
+
+		// Default Constructor
+		SizingWorkerBuffer() :
+			Pos( 0 ),
+			Packing( true )
+		{}
+
+		// Append Value to Data, or extract it at Pos
+		void
+		Transfer( int & Value );
+
+		void
+		Transfer( Real64 & Value );
+
+		void
+		Transfer( std::string & Value );
+
+		void
+		Transfer( FArray1D< Real64 > & Values );
+
+		void
+		CheckRemaining( std::string::size_type const Length ) const;
+
+	};
+
 	// Functions
 
 	void
@@ -115,6 +169,52 @@ namespace SizingManager {
 		Real64 const VarValue // the value from the sizing calculation
 	);
 
+	void
+	TransferZoneSizingDay(
+		SizingWorkerBuffer & Buffer, // packed results of a zone sizing worker
+		int const DDNum // sizing period day index
+	);
+
+	void
+	TransferRecurringError(
+		SizingWorkerBuffer & Buffer, // packed results of a zone sizing worker
+		DataErrorTracking::RecurringErrorData & Error // recurring error statistics
+	);
+
+	void
+	MergeRecurringError(
+		int const ErrNum, // recurring error index in the zone sizing worker
+		DataErrorTracking::RecurringErrorData const & Error // statistics of the worker since the fork
+	);
+
+	bool
+	StartZoneSizingWorkers();
+
+	void
+	FinishZoneSizingWorker(
+		int const LastPeriodNum, // last sizing period simulated by this worker
+		int const LastMonth, // month at the end of that sizing period
+		int const LastDayOfMonth, // day of month at the end of that sizing period
+		bool const ErrorsFound // true if the worker found errors
+	);
+
+	void
+	GatherZoneSizingWorkers(
+		int & LastPeriodNum, // last sizing period simulated by the parent, updated to the last overall
+		int & LastMonth, // month at the end of LastPeriodNum
+		int & LastDayOfMonth, // day of month at the end of LastPeriodNum
+		bool & ErrorsFound // set to true if a worker failed or found errors
+	);
+
+	void
+	SwitchSizingPeriodOutput( int const PeriodNum ); // sizing period about to be simulated by this process
+
+	void
+	CloseSizingPeriodOutput();
+
+	void
+	MergeSizingPeriodOutput();
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
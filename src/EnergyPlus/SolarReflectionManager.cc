@@ -1,5 +1,6 @@
 // C++ Headers
 #include <cmath>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -16,6 +17,7 @@
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <ScheduleManager.hh>
+#include <SurfaceRayTree.hh>
 #include <Vectors.hh>
 
 namespace EnergyPlus {
@@ -47,6 +49,7 @@ namespace SolarReflectionManager {
 	using namespace DataEnvironment;
 
 	using namespace DataVectorTypes;
+	using SurfaceRayTree::RayTreeCandidates;
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS:na
@@ -164,6 +167,9 @@ namespace SolarReflectionManager {
 		// CR 7640.  12/3/2008 BG simplified logic to allow for Other Side Conditions Modeled boundary condition.
 		//           and solar collectors on shading surfaces that need this.
 
+		// Obstruction tests for reflected rays go through the surface ray tree
+		SurfaceRayTree::InitSurfaceRayTree();
+
 		// shading surfaces have ExtSolar = False, so they are not included in TotSolReflRecSurf
 		TotSolReflRecSurf = 0;
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
@@ -650,6 +656,7 @@ namespace SolarReflectionManager {
 		static FArray1D< Real64 > OriginThisRay( 3, 0.0 ); // Origin point of a ray (m)
 		static FArray1D< Real64 > ObsHitPt( 3, 0.0 ); // Hit point on obstruction (m)
 		static int ObsSurfNum( 0 ); // Obstruction surface number
+		static std::vector< int > ObsCandidates; // Possible obstructions from the surface ray tree
 		static Real64 CosIncBmAtHitPt( 0.0 ); // Cosine of incidence angle of beam solar at hit point
 		static Real64 CosIncBmAtHitPt2( 0.0 ); // Cosine of incidence angle of beam solar at hit point,
 		//  the mirrored shading surface
@@ -746,7 +753,9 @@ namespace SolarReflectionManager {
 
 					// To speed up, ideally should store all possible shading surfaces for the HitPtSurfNum
 					//  obstruction surface in the SolReflSurf(HitPtSurfNum)%PossibleObsSurfNums(loop) array as well
-					for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+					RayTreeCandidates( OriginThisRay, SunVec, ObsCandidates );
+					for ( int iCand = 0, eCand = ObsCandidates.size(); iCand < eCand; ++iCand ) {
+						ObsSurfNum = ObsCandidates[ iCand ];
 						//        DO loop = 1,SolReflRecSurf(RecSurfNum)%NumPossibleObs
 						//          ObsSurfNum = SolReflRecSurf(RecSurfNum)%PossibleObsSurfNums(loop)
 
@@ -936,6 +945,7 @@ namespace SolarReflectionManager {
 		static FArray1D< Real64 > HitPtObs( 3, 0.0 ); // Hit point on obstruction (m)
 		static int IHitObsRefl( 0 ); // > 0 if obstruction hit between rec. pt. and reflection point
 		static int ObsSurfNum( 0 ); // Obstruction surface number
+		static std::vector< int > ObsCandidates; // Possible obstructions from the surface ray tree
 		static int ReflSurfNum( 0 ); // Reflecting surface number
 		static int ReflSurfRecNum( 0 ); // Receiving surface number corresponding to a reflecting surface number
 		static FArray1D< Real64 > ReflNorm( 3, 0.0 ); // Unit normal to reflecting surface
@@ -1021,7 +1031,9 @@ namespace SolarReflectionManager {
 									}
 								} else {
 									// Reflecting surface is a building shade
-									for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+									RayTreeCandidates( HitPtRefl, SunVec, ObsCandidates );
+									for ( int iCand = 0, eCand = ObsCandidates.size(); iCand < eCand; ++iCand ) {
+										ObsSurfNum = ObsCandidates[ iCand ];
 										if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 										if ( ObsSurfNum == ReflSurfNum ) continue;
 
@@ -1111,6 +1123,7 @@ namespace SolarReflectionManager {
 		static int RecSurfNum( 0 ); // Receiving surface number
 		static int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
 		static int ObsSurfNum( 0 ); // Obstruction surface number
+		static std::vector< int > ObsCandidates; // Possible obstructions from the surface ray tree
 		static int RecPtNum( 0 ); // Receiving point number
 		static int NumRecPts( 0 ); // Number of receiving points on a receiving surface
 		static int HitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
@@ -1222,7 +1235,9 @@ namespace SolarReflectionManager {
 								URay( 2 ) = CPhi * std::sin( Theta );
 								// Does this ray hit an obstruction?
 								IHitObs = 0;
-								for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+								RayTreeCandidates( HitPtRefl, URay, ObsCandidates );
+								for ( int iCand = 0, eCand = ObsCandidates.size(); iCand < eCand; ++iCand ) {
+									ObsSurfNum = ObsCandidates[ iCand ];
 									if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 									// Horizontal roof surfaces cannot be obstructions for rays from ground
 									if ( Surface( ObsSurfNum ).Tilt < 5.0 ) continue;
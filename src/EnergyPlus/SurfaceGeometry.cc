@@ -1,4 +1,5 @@
 // C++ Headers
+#include <algorithm>
 #include <cmath>
 #include <string>
 
@@ -19,6 +20,8 @@
 #include <DataIPShortCuts.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataReportingFlags.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataWindowEquivalentLayer.hh>
 #include <DisplayRoutines.hh>
 #include <EMSManager.hh>
@@ -78,6 +81,8 @@ namespace SurfaceGeometry {
 	// referencing another in adjacent zone
 	int const UnreconciledZoneSurface( -999 ); // interim value between entering surfaces ("Surface") and reconciling
 	// surface names in other zones
+	Real64 const GeometryIndexTolerance( 0.01 ); // Distance within which two surface bounding boxes touch (m)
+	int const GeometryIndexMaxCells( 64 ); // Surfaces spanning more grid cells than this are not filed by cell
 
 	static gio::Fmt const fmtLD( "*" );
 	static gio::Fmt const fmtA( "(A)" );
@@ -102,12 +107,23 @@ namespace SurfaceGeometry {
 	int Warning1Count( 0 ); // counts of Modify Window 5/6 windows
 	int Warning2Count( 0 ); // counts of overriding exterior windows with Window 5/6 glazing systems
 	int Warning3Count( 0 ); // counts of overriding interior windows with Window 5/6 glazing systems
+	// Following are used only during GetSurfaceData (spatial index of the surface vertices).
+	Real64 GeometryIndexCellSize( 0.0 ); // Edge length of the grid cells of the index (m)
+	int GeometryIndexQuery( 0 ); // Number of the current index query (marks the surfaces already collected)
+	int NumSubSurfsOutsideBase( 0 ); // Subsurfaces whose vertices extend outside the bounding box of the base surface
+	int NumInterzoneLocationMismatches( 0 ); // Interzone surface pairs whose bounding boxes do not touch
+	int NumUnconnectedSurfaces( 0 ); // Zone surfaces that touch no other floor, wall or roof of the zone
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE SurfaceGeometry
 
 	// Object Data
 	FArray1D< SurfaceData > SurfaceTmp; // Allocated/Deallocated during input processing
 	FArray1D< SurfaceData > SurfaceTmpSave; // Allocated/Deallocated during input processing
+	std::unordered_map< std::string, int > SurfaceTmpNameIndex; // First SurfaceTmp number of each surface name
+	FArray1D< GeometryIndexBox > SurfaceBox; // Vertex bounding box of each surface (Surface order)
+	std::unordered_map< std::int64_t, std::vector< int > > GeometryIndexCells; // Surfaces filed by grid cell
+	std::vector< int > GeometryIndexLargeSurfs; // Surfaces spanning more than GeometryIndexMaxCells cells
+	std::vector< int > GeometryIndexMark; // Query number that last collected each surface
 
 	// Functions
 
@@ -662,6 +678,7 @@ namespace SurfaceGeometry {
 		//       DATE WRITTEN   November 1997
 		//       MODIFIED       April 1999, Linda Lawrie
 		//                      Dec. 2000, FW (add "one-wall zone" checks)
+		//                      October 2014 (name, zone and spatial indexes for the surface matching and checks)
 		//       RE-ENGINEERED  May 2000, Linda Lawrie (breakout surface type gets)
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -678,6 +695,10 @@ namespace SurfaceGeometry {
 		//    etc
 		//  Heat Transfer Surfaces and Shading surfaces are mixed in the list
 		//  Pointers are set in the zones (First, Last)
+		// Surface names, zone names and base surfaces are looked up through indexes built
+		// once, and the geometry checks find nearby surfaces through the spatial index of
+		// BuildGeometryIndex, so the setup time grows about linearly with the number of
+		// surfaces. With the TimingFlag the time of each setup phase is written to the eio.
 
 		// REFERENCES:
 		//   This routine manages getting the input for the following Objects:
@@ -756,6 +777,8 @@ namespace SurfaceGeometry {
 		using ScheduleManager::GetScheduleMinValue;
 		using ScheduleManager::GetScheduleMaxValue;
 		using namespace DataErrorTracking;
+		using DataSystemVariables::TimingFlag;
+		using DataTimings::epElapsedTime;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -879,10 +902,27 @@ namespace SurfaceGeometry {
 		bool sameSurfNormal;
 		bool izConstDiff; // differences in construction for IZ surfaces
 		bool izConstDiffMsg; // display message about hb diffs only once.
+		Real64 SetupStartTime; // Elapsed time at the start of GetSurfaceData (s)
+		Real64 PhaseStartTime; // Elapsed time at the start of the current setup phase (s)
+		Real64 SurfaceInputTime; // Time spent getting the surface objects (s)
+		Real64 BaseSurfMatchTime; // Time spent matching subsurfaces with base surfaces (s)
+		Real64 ReorderTime; // Time spent putting the surfaces in hierarchical order (s)
+		Real64 IndexBuildTime; // Time spent building the spatial index (s)
+		Real64 SubSurfCheckTime; // Time spent checking subsurfaces against base surfaces (s)
+		Real64 InterzoneMatchTime; // Time spent matching interzone surfaces (s)
+		Real64 EnclosureCheckTime; // Time spent checking the zone surface connections (s)
+		std::vector< std::vector< int > > SubSurfsOfBase; // Subsurfaces of each surface (from BaseSurf), in ascending order
+		std::unordered_map< std::string, std::vector< int > > SurfsOfZoneName; // Zone surfaces by uppercase zone name
+		std::unordered_map< std::string, std::vector< int > > IntMassOfZoneName; // Internal mass surfaces by zone name
+		std::unordered_map< std::string, int > SurfaceNameIndex; // First Surface number of each surface name
+		std::vector< int > Candidates; // Surfaces found by the spatial index
 
 		// FLOW:
 		// Get the total number of surfaces to allocate derived type and for surface loops
 
+		SetupStartTime = epElapsedTime();
+		PhaseStartTime = SetupStartTime;
+
 		GetGeometryParameters( ErrorsFound );
 
 		if ( WorldCoordSystem ) {
@@ -959,6 +999,9 @@ namespace SurfaceGeometry {
 
 		GetRectSurfaces( ErrorsFound, SurfNum, TotRectExtWalls, TotRectIntWalls, TotRectIZWalls, TotRectUGWalls, TotRectRoofs, TotRectCeilings, TotRectIZCeilings, TotRectGCFloors, TotRectIntFloors, TotRectIZFloors, BaseSurfIDs, NeedToAddSurfaces );
 
+		// Base surfaces are in; index their names for the subsurface base surface lookups
+		IndexSurfaceTmpNames( SurfNum );
+
 		GetHTSubSurfaceData( ErrorsFound, SurfNum, TotHTSubs, SubSurfCls, SubSurfIDs, AddedSubSurfaces, NeedToAddSubSurfaces );
 
 		GetRectSubSurfaces( ErrorsFound, SurfNum, TotRectWindows, TotRectDoors, TotRectGlazedDoors, TotRectIZWindows, TotRectIZDoors, TotRectIZGlazedDoors, SubSurfIDs, AddedSubSurfaces, NeedToAddSubSurfaces );
@@ -973,6 +1016,9 @@ namespace SurfaceGeometry {
 
 		if ( CalcSolRefl ) GetShadingSurfReflectanceData( ErrorsFound );
 
+		SurfaceInputTime = epElapsedTime() - PhaseStartTime;
+		PhaseStartTime = epElapsedTime();
+
 		TotSurfaces = SurfNum + AddedSubSurfaces + NeedToAddSurfaces + NeedToAddSubSurfaces;
 
 		// Have to make room for added surfaces, if needed
@@ -993,7 +1039,6 @@ namespace SurfaceGeometry {
 		if ( NeedToAddSurfaces + NeedToAddSubSurfaces > 0 ) CurNewSurf = FirstTotalSurfaces;
 		auto const Zone_Name( Zone.Name() ); // Member array
 		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
-		auto const Surface_Name( Surface.Name() ); // Member array
 		for ( SurfNum = 1; SurfNum <= FirstTotalSurfaces; ++SurfNum ) {
 			if ( SurfaceTmp( SurfNum ).ExtBoundCond != UnenteredAdjacentZoneSurface ) continue;
 			// Need to add surface
@@ -1099,6 +1144,7 @@ namespace SurfaceGeometry {
 		// After all of the surfaces have been defined then the base surfaces for the
 		// sub-surfaces can be defined.  Loop through surfaces and match with the sub-surface
 		// names.
+		IndexSurfaceTmpNames( TotSurfaces );
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 			if ( ! SurfaceTmp( SurfNum ).HeatTransSurf ) continue;
 
@@ -1106,7 +1152,7 @@ namespace SurfaceGeometry {
 			if ( SameString( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp( SurfNum ).Name ) ) {
 				Found = SurfNum;
 			} else {
-				Found = FindItemInList( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp_Name, TotSurfaces );
+				Found = FindSurfaceTmpName( SurfaceTmp( SurfNum ).BaseSurfName, TotSurfaces );
 			}
 			if ( Found > 0 ) {
 				SurfaceTmp( SurfNum ).BaseSurf = Found;
@@ -1126,6 +1172,14 @@ namespace SurfaceGeometry {
 		} // ...end of the Surface DO loop for finding BaseSurf
 		//**********************************************************************************
 
+		// List the subsurfaces of each surface once, instead of searching all surfaces for each base surface
+		SubSurfsOfBase.assign( TotSurfaces + 1, std::vector< int >() );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			BaseSurfNum = SurfaceTmp( SurfNum ).BaseSurf;
+			if ( BaseSurfNum < 1 || BaseSurfNum > TotSurfaces || BaseSurfNum == SurfNum ) continue;
+			SubSurfsOfBase[ BaseSurfNum ].push_back( SurfNum );
+		}
+
 		//**********************************************************************************
 		// orientation of flat subsurfaces (window/door/etc) need to match base surface
 		// CR8628
@@ -1137,9 +1191,8 @@ namespace SurfaceGeometry {
 			SurfTilt = SurfaceTmp( SurfNum ).Tilt;
 			if ( std::abs( SurfTilt ) <= 1.0e-5 || std::abs( SurfTilt - 180.0 ) <= 1.0e-5 ) {
 				// see if there are any subsurfaces on roofs/floors
-				for ( iTmp1 = 1; iTmp1 <= TotSurfaces; ++iTmp1 ) {
-					if ( iTmp1 == SurfNum ) continue;
-					if ( SurfaceTmp( iTmp1 ).BaseSurf != SurfNum ) continue;
+				for ( auto const SubSurf : SubSurfsOfBase[ SurfNum ] ) {
+					iTmp1 = SubSurf;
 					if ( ! SurfaceTmp( iTmp1 ).HeatTransSurf ) continue;
 					//          write(outputfiledebug,'(A)') 'roof/floor basesurface='//TRIM(SurfaceTmp(SurfNum)%Name)
 					//          write(outputfiledebug,'(A,3f7.2)') 'basesurface lc vectors=',SurfaceTmp(SurfNum)%lcsx
@@ -1248,6 +1301,16 @@ namespace SurfaceGeometry {
 		//      Internal Mass
 		//    After reordering, MovedSurfs should equal TotSurfaces
 
+		BaseSurfMatchTime = epElapsedTime() - PhaseStartTime;
+		PhaseStartTime = epElapsedTime();
+
+		// Group the surfaces by zone name once, instead of comparing every surface name with every zone name
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( SurfaceTmp( SurfNum ).Class == SurfaceClass_IntMass ) IntMassOfZoneName[ SurfaceTmp( SurfNum ).ZoneName ].push_back( SurfNum );
+			if ( SurfaceTmp( SurfNum ).Zone == 0 ) continue;
+			SurfsOfZoneName[ uppercased( SurfaceTmp( SurfNum ).ZoneName ) ].push_back( SurfNum );
+		}
+
 		MovedSurfs = 0;
 		Surface.allocate( TotSurfaces ); // Allocate the Surface derived type appropriately
 
@@ -1267,15 +1330,20 @@ namespace SurfaceGeometry {
 
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
+			auto const ZoneSurfs( SurfsOfZoneName.find( uppercased( Zone( ZoneNum ).Name ) ) ); // Surfaces with the zone name (any case)
+			auto const ZoneIntMass( IntMassOfZoneName.find( Zone( ZoneNum ).Name ) ); // Internal mass surfaces with the zone name
+
 			//  For each Base Surface Type (Wall, Floor, Roof)
 
 			for ( Loop = 1; Loop <= 3; ++Loop ) {
 
-				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( ZoneSurfs == SurfsOfZoneName.end() ) break;
 
+				for ( auto const ZoneSurf : ZoneSurfs->second ) {
+
+					SurfNum = ZoneSurf;
 					if ( SurfaceTmp( SurfNum ).Zone == 0 ) continue;
 
-					if ( ! SameString( SurfaceTmp( SurfNum ).ZoneName, Zone( ZoneNum ).Name ) ) continue;
 					if ( SurfaceTmp( SurfNum ).Class != BaseSurfIDs( Loop ) ) continue;
 
 					++MovedSurfs;
@@ -1286,8 +1354,9 @@ namespace SurfaceGeometry {
 					Surface( MovedSurfs ).BaseSurf = BaseSurfNum;
 
 					//  Find all subsurfaces to this surface
-					for ( SubSurfNum = 1; SubSurfNum <= TotSurfaces; ++SubSurfNum ) {
+					for ( auto const SubSurf : SubSurfsOfBase[ SurfNum ] ) {
 
+						SubSurfNum = SubSurf;
 						if ( SurfaceTmp( SubSurfNum ).Zone == 0 ) continue;
 						if ( SurfaceTmp( SubSurfNum ).BaseSurf != SurfNum ) continue;
 
@@ -1300,8 +1369,11 @@ namespace SurfaceGeometry {
 				}
 			}
 
-			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( ZoneIntMass == IntMassOfZoneName.end() ) continue;
 
+			for ( auto const IntMassSurf : ZoneIntMass->second ) {
+
+				SurfNum = IntMassSurf;
 				if ( SurfaceTmp( SurfNum ).ZoneName != Zone( ZoneNum ).Name ) continue;
 				if ( SurfaceTmp( SurfNum ).Class != SurfaceClass_IntMass ) continue;
 
@@ -1330,6 +1402,24 @@ namespace SurfaceGeometry {
 		}
 
 		SurfaceTmp.deallocate(); // DeAllocate the Temp Surface derived type
+		SurfsOfZoneName.clear();
+		IntMassOfZoneName.clear();
+
+		ReorderTime = epElapsedTime() - PhaseStartTime;
+		PhaseStartTime = epElapsedTime();
+
+		// The vertices of the surfaces are complete and in their final order; index them for the geometry checks
+		BuildGeometryIndex( MovedSurfs );
+
+		IndexBuildTime = epElapsedTime() - PhaseStartTime;
+		PhaseStartTime = epElapsedTime();
+
+		SubSurfsOfBase.assign( TotSurfaces + 1, std::vector< int >() );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			BaseSurfNum = Surface( SurfNum ).BaseSurf;
+			if ( BaseSurfNum < 1 || BaseSurfNum > TotSurfaces || BaseSurfNum == SurfNum ) continue;
+			SubSurfsOfBase[ BaseSurfNum ].push_back( SurfNum );
+		}
 
 		//  For each Base Surface Type (Wall, Floor, Roof)
 
@@ -1342,12 +1432,31 @@ namespace SurfaceGeometry {
 				if ( Surface( SurfNum ).Class != BaseSurfIDs( Loop ) ) continue;
 
 				//  Find all subsurfaces to this surface
-				for ( SubSurfNum = 1; SubSurfNum <= TotSurfaces; ++SubSurfNum ) {
+				for ( auto const SubSurf : SubSurfsOfBase[ SurfNum ] ) {
 
+					SubSurfNum = SubSurf;
 					if ( SurfNum == SubSurfNum ) continue;
 					if ( Surface( SubSurfNum ).Zone == 0 ) continue;
 					if ( Surface( SubSurfNum ).BaseSurf != SurfNum ) continue;
 
+					// Check that the vertices of windows and doors lie within the extent of the base surface
+					if ( ( Surface( SubSurfNum ).Class == SurfaceClass_Window || Surface( SubSurfNum ).Class == SurfaceClass_GlassDoor || Surface( SubSurfNum ).Class == SurfaceClass_Door ) && SubSurfNum <= MovedSurfs && SurfNum <= MovedSurfs ) {
+						if ( ! BoxContainsBox( SurfaceBox( SurfNum ), SurfaceBox( SubSurfNum ), GeometryIndexTolerance ) ) {
+							++NumSubSurfsOutsideBase;
+							if ( DisplayExtraWarnings ) {
+								ShowWarningError( RoutineName + "Subsurface=\"" + Surface( SubSurfNum ).Name + "\" extends outside the extent of its base surface=\"" + Surface( SurfNum ).Name + "\"." );
+								GeometryIndexCandidates( SurfaceBox( SubSurfNum ), GeometryIndexTolerance, Candidates );
+								for ( auto const Candidate : Candidates ) {
+									if ( Candidate == SurfNum || Surface( Candidate ).Zone != Surface( SurfNum ).Zone ) continue;
+									if ( Surface( Candidate ).Class != SurfaceClass_Wall && Surface( Candidate ).Class != SurfaceClass_Floor && Surface( Candidate ).Class != SurfaceClass_Roof ) continue;
+									if ( ! BoxContainsBox( SurfaceBox( Candidate ), SurfaceBox( SubSurfNum ), GeometryIndexTolerance ) ) continue;
+									ShowContinueError( "...its vertices lie within the extent of surface=\"" + Surface( Candidate ).Name + "\" of the same zone." );
+									break;
+								}
+							}
+						}
+					}
+
 					// Check facing angle of Sub compared to base
 					// ignore problems of subsurfaces on roofs/ceilings/floors with azimuth
 					//          IF (Surface(SurfNum)%Class == SurfaceClass_Roof .or. Surface(SurfNum)%Class == SurfaceClass_Floor) CYCLE
@@ -1393,11 +1502,19 @@ namespace SurfaceGeometry {
 				}
 			}
 		}
+		SubSurfsOfBase.clear();
+
+		SubSurfCheckTime = epElapsedTime() - PhaseStartTime;
+		PhaseStartTime = epElapsedTime();
 
 		//**********************************************************************************
 		// Now, match up interzone surfaces
 		NonMatch = false;
 		izConstDiffMsg = false;
+		SurfaceNameIndex.reserve( MovedSurfs );
+		for ( SurfNum = 1; SurfNum <= MovedSurfs; ++SurfNum ) {
+			SurfaceNameIndex.emplace( Surface( SurfNum ).Name, SurfNum ); // first occurrence, as FindItemInList
+		}
 		for ( SurfNum = 1; SurfNum <= MovedSurfs; ++SurfNum ) { //TotSurfaces
 			//  Clean up Shading Surfaces, make sure they don't go through here.
 			//  Shading surfaces have "Zone=0", should also have "BaseSurf=0"
@@ -1416,7 +1533,8 @@ namespace SurfaceGeometry {
 					if ( Surface( SurfNum ).ExtBoundCondName == Surface( SurfNum ).Name ) {
 						Found = SurfNum;
 					} else {
-						Found = FindItemInList( Surface( SurfNum ).ExtBoundCondName, Surface_Name, MovedSurfs );
+						auto const FoundName( SurfaceNameIndex.find( Surface( SurfNum ).ExtBoundCondName ) );
+						Found = ( FoundName != SurfaceNameIndex.end() ) ? FoundName->second : 0;
 					}
 					if ( Found != 0 ) {
 						Surface( SurfNum ).ExtBoundCond = Found;
@@ -1430,6 +1548,15 @@ namespace SurfaceGeometry {
 						}
 						// Check that matching interzone surface has construction with reversed layers
 						if ( Found != SurfNum ) { // Interzone surface
+							// Make sure the two surfaces are at the same location
+							if ( ! BoxesTouch( SurfaceBox( SurfNum ), SurfaceBox( Found ), GeometryIndexTolerance ) ) {
+								++NumInterzoneLocationMismatches;
+								if ( DisplayExtraWarnings ) {
+									ShowWarningError( RoutineName + "InterZone Surfaces are not at the same location." );
+									ShowContinueError( "Surface=" + Surface( SurfNum ).Name + ", Zone=" + Surface( SurfNum ).ZoneName );
+									ShowContinueError( "Adjacent Surface=" + Surface( Found ).Name + ", Zone=" + Surface( Found ).ZoneName );
+								}
+							}
 							// Make sure different zones too (CR 4110)
 							if ( Surface( SurfNum ).Zone == Surface( Found ).Zone ) {
 								++ErrCount2;
@@ -1603,6 +1730,15 @@ namespace SurfaceGeometry {
 						//  Seems unlikely that an internal surface would be missing itself, so this message
 						//  only indicates for adjacent (interzone) surfaces.
 						ShowSevereError( RoutineName + "Adjacent Surface not found: " + Surface( SurfNum ).ExtBoundCondName + " adjacent to surface " + Surface( SurfNum ).Name );
+						// Point out a surface of another zone at the same location, if there is one
+						GeometryIndexCandidates( SurfaceBox( SurfNum ), GeometryIndexTolerance, Candidates );
+						for ( auto const Candidate : Candidates ) {
+							if ( ! Surface( Candidate ).HeatTransSurf || Surface( Candidate ).Zone == 0 || Surface( Candidate ).Zone == Surface( SurfNum ).Zone ) continue;
+							if ( ( Surface( Candidate ).BaseSurf == Candidate ) != ( Surface( SurfNum ).BaseSurf == SurfNum ) ) continue;
+							if ( ! BoxContainsBox( SurfaceBox( Candidate ), SurfaceBox( SurfNum ), GeometryIndexTolerance ) || ! BoxContainsBox( SurfaceBox( SurfNum ), SurfaceBox( Candidate ), GeometryIndexTolerance ) ) continue;
+							ShowContinueError( "...Surface=" + Surface( Candidate ).Name + ", Zone=" + Surface( Candidate ).ZoneName + " is at the same location." );
+							break;
+						}
 						NonMatch = true;
 						SurfError = true;
 					}
@@ -1698,17 +1834,17 @@ namespace SurfaceGeometry {
 			}
 		}
 
+		SurfaceNameIndex.clear();
+
+		InterzoneMatchTime = epElapsedTime() - PhaseStartTime;
+		PhaseStartTime = epElapsedTime();
+
 		//**********************************************************************************
 		//   Set up Zone Surface Pointers
-		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
-			for ( SurfNum = 1; SurfNum <= MovedSurfs; ++SurfNum ) { //TotSurfaces
-				if ( Surface( SurfNum ).Zone == ZoneNum ) {
-					if ( Zone( ZoneNum ).SurfaceFirst == 0 ) {
-						Zone( ZoneNum ).SurfaceFirst = SurfNum;
-						break;
-					}
-				}
-			}
+		for ( SurfNum = 1; SurfNum <= MovedSurfs; ++SurfNum ) { //TotSurfaces
+			ZoneNum = Surface( SurfNum ).Zone;
+			if ( ZoneNum < 1 || ZoneNum > NumOfZones ) continue;
+			if ( Zone( ZoneNum ).SurfaceFirst == 0 ) Zone( ZoneNum ).SurfaceFirst = SurfNum;
 		}
 		//  Surface First pointers are set, set last
 		if ( NumOfZones > 0 ) {
@@ -1725,6 +1861,12 @@ namespace SurfaceGeometry {
 			}
 		}
 
+		// Check that the floors, walls and roofs of each zone are connected
+		CheckZoneSurfaceConnections();
+
+		EnclosureCheckTime = epElapsedTime() - PhaseStartTime;
+		PhaseStartTime = epElapsedTime();
+
 		// Set up Floor Areas for Zones
 		if ( ! SurfError ) {
 			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
@@ -2010,6 +2152,22 @@ namespace SurfaceGeometry {
 
 		GetSurfaceHeatTransferAlgorithmOverrides( ErrorsFound );
 
+		if ( TimingFlag ) {
+			gio::write( OutputFileInits, fmtA ) << "! <Surface Geometry Setup Timing>, Phase, Elapsed Time {s}";
+			gio::write( OutputFileInits, fmtA ) << " Surface Geometry Setup Timing,Surface Input," + RoundSigDigits( SurfaceInputTime, 3 );
+			gio::write( OutputFileInits, fmtA ) << " Surface Geometry Setup Timing,Base Surface Matching," + RoundSigDigits( BaseSurfMatchTime, 3 );
+			gio::write( OutputFileInits, fmtA ) << " Surface Geometry Setup Timing,Hierarchical Ordering," + RoundSigDigits( ReorderTime, 3 );
+			gio::write( OutputFileInits, fmtA ) << " Surface Geometry Setup Timing,Spatial Index," + RoundSigDigits( IndexBuildTime, 3 );
+			gio::write( OutputFileInits, fmtA ) << " Surface Geometry Setup Timing,Subsurface Checks," + RoundSigDigits( SubSurfCheckTime, 3 );
+			gio::write( OutputFileInits, fmtA ) << " Surface Geometry Setup Timing,Interzone Matching," + RoundSigDigits( InterzoneMatchTime, 3 );
+			gio::write( OutputFileInits, fmtA ) << " Surface Geometry Setup Timing,Zone Surface Connections," + RoundSigDigits( EnclosureCheckTime, 3 );
+			gio::write( OutputFileInits, fmtA ) << " Surface Geometry Setup Timing,Remaining Checks," + RoundSigDigits( epElapsedTime() - PhaseStartTime, 3 );
+			gio::write( OutputFileInits, fmtA ) << " Surface Geometry Setup Timing,Total," + RoundSigDigits( epElapsedTime() - SetupStartTime, 3 );
+			gio::write( OutputFileInits, fmtA ) << "! <Surface Geometry Index>, Number of Surfaces, Cell Size {m}, Number of Cells, " "Number of Large Surfaces, Subsurfaces Outside Base Surface, Interzone Surfaces Not at Same Location, " "Unconnected Zone Surfaces";
+			gio::write( OutputFileInits, fmtA ) << " Surface Geometry Index," + RoundSigDigits( int( SurfaceBox.size() ) ) + ',' + RoundSigDigits( GeometryIndexCellSize, 2 ) + ',' + RoundSigDigits( int( GeometryIndexCells.size() ) ) + ',' + RoundSigDigits( int( GeometryIndexLargeSurfs.size() ) ) + ',' + RoundSigDigits( NumSubSurfsOutsideBase ) + ',' + RoundSigDigits( NumInterzoneLocationMismatches ) + ',' + RoundSigDigits( NumUnconnectedSurfaces );
+		}
+		ClearGeometryIndex();
+
 		if ( SurfError || ErrorsFound ) {
 			ErrorsFound = true;
 			ShowFatalError( RoutineName + "Errors discovered, program terminates." );
@@ -2017,6 +2175,490 @@ namespace SurfaceGeometry {
 
 	}
 
+	void
+	IndexSurfaceTmpNames( int const NumSurfs ) // Number of SurfaceTmp entries to index
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the name index of the first NumSurfs SurfaceTmp entries used by
+		// FindSurfaceTmpName, so that base surface names are found without a
+		// search through all of the surfaces for every subsurface.
+
+		// METHODOLOGY EMPLOYED:
+		// Only the first occurrence of a name is kept, as in FindItemInList.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum; // Loop counter
+
+		SurfaceTmpNameIndex.clear();
+		SurfaceTmpNameIndex.reserve( NumSurfs );
+		for ( SurfNum = 1; SurfNum <= NumSurfs; ++SurfNum ) {
+			SurfaceTmpNameIndex.emplace( SurfaceTmp( SurfNum ).Name, SurfNum );
+		}
+
+	}
+
+	int
+	FindSurfaceTmpName(
+		std::string const & Name, // Surface name to find
+		int const NumItems // Number of SurfaceTmp entries searched
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the same surface number as FindItemInList( Name, SurfaceTmp.Name(), NumItems ).
+
+		// METHODOLOGY EMPLOYED:
+		// Looks the name up in the index of IndexSurfaceTmpNames. Entries read or renamed
+		// after the index was built are not in it, so a name that is not found (or whose
+		// entry no longer has that name) is searched for in the list.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using InputProcessor::FindItemInList;
+
+		// Return value
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		auto const Found( SurfaceTmpNameIndex.find( Name ) );
+		if ( Found != SurfaceTmpNameIndex.end() && Found->second <= NumItems && SurfaceTmp( Found->second ).Name == Name ) return Found->second;
+		return FindItemInList( Name, SurfaceTmp.Name(), NumItems );
+
+	}
+
+	void
+	SetSurfaceBox(
+		SurfaceData const & ThisSurf, // Surface whose vertices are boxed
+		GeometryIndexBox & Box // Bounding box of the vertices
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the axis-aligned bounding box of the vertices of a surface.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Vert; // Vertex loop counter
+
+		Box = GeometryIndexBox();
+		if ( ThisSurf.Sides <= 0 ) return;
+		Box.XMin = Box.XMax = ThisSurf.Vertex( 1 ).x;
+		Box.YMin = Box.YMax = ThisSurf.Vertex( 1 ).y;
+		Box.ZMin = Box.ZMax = ThisSurf.Vertex( 1 ).z;
+		for ( Vert = 2; Vert <= ThisSurf.Sides; ++Vert ) {
+			auto const & Vertex( ThisSurf.Vertex( Vert ) );
+			Box.XMin = min( Box.XMin, Vertex.x );
+			Box.YMin = min( Box.YMin, Vertex.y );
+			Box.ZMin = min( Box.ZMin, Vertex.z );
+			Box.XMax = max( Box.XMax, Vertex.x );
+			Box.YMax = max( Box.YMax, Vertex.y );
+			Box.ZMax = max( Box.ZMax, Vertex.z );
+		}
+
+	}
+
+	bool
+	BoxesTouch(
+		GeometryIndexBox const & Box1,
+		GeometryIndexBox const & Box2,
+		Real64 const Tolerance // Gap allowed between the boxes (m)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the two boxes overlap or are no further apart than Tolerance.
+
+		return ( Box1.XMin <= Box2.XMax + Tolerance ) && ( Box2.XMin <= Box1.XMax + Tolerance ) && ( Box1.YMin <= Box2.YMax + Tolerance ) && ( Box2.YMin <= Box1.YMax + Tolerance ) && ( Box1.ZMin <= Box2.ZMax + Tolerance ) && ( Box2.ZMin <= Box1.ZMax + Tolerance );
+
+	}
+
+	bool
+	BoxContainsBox(
+		GeometryIndexBox const & Outer,
+		GeometryIndexBox const & Inner,
+		Real64 const Tolerance // Distance Inner may extend beyond Outer (m)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if Inner lies within Outer, allowing Inner to extend beyond Outer by Tolerance.
+
+		return ( Inner.XMin >= Outer.XMin - Tolerance ) && ( Inner.XMax <= Outer.XMax + Tolerance ) && ( Inner.YMin >= Outer.YMin - Tolerance ) && ( Inner.YMax <= Outer.YMax + Tolerance ) && ( Inner.ZMin >= Outer.ZMin - Tolerance ) && ( Inner.ZMax <= Outer.ZMax + Tolerance );
+
+	}
+
+	void
+	BuildGeometryIndex( int const NumSurfs ) // Number of surfaces (Surface order) to index
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the spatial index of the surface vertices used by the geometry checks
+		// of GetSurfaceData (subsurface containment, interzone partner location and
+		// zone surface connections), so that the surfaces near a surface are found
+		// without comparing it with every other surface.
+
+		// METHODOLOGY EMPLOYED:
+		// Each surface is represented by the bounding box of its vertices. The boxes
+		// are filed in a sparse uniform grid of cubic cells whose edge is the median
+		// box size, so that a typical surface spans a few cells. Surfaces spanning
+		// more than GeometryIndexMaxCells cells (ground planes, large shades) are kept
+		// in a separate list that every query checks.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const MinCellSize( 0.5 ); // Smallest grid cell edge (m)
+		Real64 const MaxCellSize( 1000.0 ); // Largest grid cell edge (m)
+		std::int64_t const CellOffset( 1 << 20 ); // Offset making the cell indices positive in the cell key
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum; // Loop counter
+		std::vector< Real64 > Sizes; // Largest box extent of each surface (m)
+		std::int64_t IX; // Grid cell loop counters
+		std::int64_t IY;
+		std::int64_t IZ;
+		std::int64_t IXMin; // Range of cells spanned by a box
+		std::int64_t IYMin;
+		std::int64_t IZMin;
+		std::int64_t IXMax;
+		std::int64_t IYMax;
+		std::int64_t IZMax;
+
+		ClearGeometryIndex();
+		SurfaceBox.allocate( NumSurfs );
+		GeometryIndexMark.assign( NumSurfs + 1, 0 );
+		GeometryIndexQuery = 0;
+		NumSubSurfsOutsideBase = 0;
+		NumInterzoneLocationMismatches = 0;
+		NumUnconnectedSurfaces = 0;
+		if ( NumSurfs == 0 ) return;
+
+		Sizes.reserve( NumSurfs );
+		for ( SurfNum = 1; SurfNum <= NumSurfs; ++SurfNum ) {
+			auto & Box( SurfaceBox( SurfNum ) );
+			SetSurfaceBox( Surface( SurfNum ), Box );
+			Sizes.push_back( max( Box.XMax - Box.XMin, Box.YMax - Box.YMin, Box.ZMax - Box.ZMin ) );
+		}
+		std::nth_element( Sizes.begin(), Sizes.begin() + Sizes.size() / 2, Sizes.end() );
+		GeometryIndexCellSize = min( max( Sizes[ Sizes.size() / 2 ], MinCellSize ), MaxCellSize );
+
+		for ( SurfNum = 1; SurfNum <= NumSurfs; ++SurfNum ) {
+			auto const & Box( SurfaceBox( SurfNum ) );
+			IXMin = std::int64_t( std::floor( Box.XMin / GeometryIndexCellSize ) );
+			IYMin = std::int64_t( std::floor( Box.YMin / GeometryIndexCellSize ) );
+			IZMin = std::int64_t( std::floor( Box.ZMin / GeometryIndexCellSize ) );
+			IXMax = std::int64_t( std::floor( Box.XMax / GeometryIndexCellSize ) );
+			IYMax = std::int64_t( std::floor( Box.YMax / GeometryIndexCellSize ) );
+			IZMax = std::int64_t( std::floor( Box.ZMax / GeometryIndexCellSize ) );
+			if ( ( IXMax - IXMin + 1 ) * ( IYMax - IYMin + 1 ) * ( IZMax - IZMin + 1 ) > GeometryIndexMaxCells ) {
+				GeometryIndexLargeSurfs.push_back( SurfNum );
+				continue;
+			}
+			for ( IX = IXMin; IX <= IXMax; ++IX ) {
+				for ( IY = IYMin; IY <= IYMax; ++IY ) {
+					for ( IZ = IZMin; IZ <= IZMax; ++IZ ) {
+						GeometryIndexCells[ ( ( IX + CellOffset ) << 42 ) | ( ( IY + CellOffset ) << 21 ) | ( IZ + CellOffset ) ].push_back( SurfNum );
+					}
+				}
+			}
+		}
+
+	}
+
+	void
+	GeometryIndexCandidates(
+		GeometryIndexBox const & Box, // Box to search around
+		Real64 const Tolerance, // Gap allowed between Box and the surface boxes (m)
+		std::vector< int > & Candidates // Surfaces whose boxes touch Box, in ascending order
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Returns the surfaces of the spatial index whose vertex bounding boxes
+		// touch the given box.
+
+		// METHODOLOGY EMPLOYED:
+		// Collects the surfaces filed in the grid cells spanned by the box (padded
+		// by Tolerance) and the large surfaces, each once, and keeps those whose
+		// boxes touch the box. A box spanning more cells than there are surfaces
+		// is compared with every surface instead.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		std::int64_t const CellOffset( 1 << 20 ); // Offset making the cell indices positive in the cell key
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum; // Loop counter
+		int NumSurfs; // Number of surfaces in the index
+		std::int64_t IX; // Grid cell loop counters
+		std::int64_t IY;
+		std::int64_t IZ;
+		std::int64_t IXMin; // Range of cells spanned by the box
+		std::int64_t IYMin;
+		std::int64_t IZMin;
+		std::int64_t IXMax;
+		std::int64_t IYMax;
+		std::int64_t IZMax;
+
+		Candidates.clear();
+		NumSurfs = int( SurfaceBox.size() );
+		if ( NumSurfs == 0 ) return;
+
+		IXMin = std::int64_t( std::floor( ( Box.XMin - Tolerance ) / GeometryIndexCellSize ) );
+		IYMin = std::int64_t( std::floor( ( Box.YMin - Tolerance ) / GeometryIndexCellSize ) );
+		IZMin = std::int64_t( std::floor( ( Box.ZMin - Tolerance ) / GeometryIndexCellSize ) );
+		IXMax = std::int64_t( std::floor( ( Box.XMax + Tolerance ) / GeometryIndexCellSize ) );
+		IYMax = std::int64_t( std::floor( ( Box.YMax + Tolerance ) / GeometryIndexCellSize ) );
+		IZMax = std::int64_t( std::floor( ( Box.ZMax + Tolerance ) / GeometryIndexCellSize ) );
+		if ( ( IXMax - IXMin + 1 ) * ( IYMax - IYMin + 1 ) * ( IZMax - IZMin + 1 ) > NumSurfs ) {
+			for ( SurfNum = 1; SurfNum <= NumSurfs; ++SurfNum ) {
+				if ( BoxesTouch( Box, SurfaceBox( SurfNum ), Tolerance ) ) Candidates.push_back( SurfNum );
+			}
+			return;
+		}
+
+		++GeometryIndexQuery;
+		for ( IX = IXMin; IX <= IXMax; ++IX ) {
+			for ( IY = IYMin; IY <= IYMax; ++IY ) {
+				for ( IZ = IZMin; IZ <= IZMax; ++IZ ) {
+					auto const Cell( GeometryIndexCells.find( ( ( IX + CellOffset ) << 42 ) | ( ( IY + CellOffset ) << 21 ) | ( IZ + CellOffset ) ) );
+					if ( Cell == GeometryIndexCells.end() ) continue;
+					for ( auto const CellSurf : Cell->second ) {
+						if ( GeometryIndexMark[ CellSurf ] == GeometryIndexQuery ) continue;
+						GeometryIndexMark[ CellSurf ] = GeometryIndexQuery;
+						if ( BoxesTouch( Box, SurfaceBox( CellSurf ), Tolerance ) ) Candidates.push_back( CellSurf );
+					}
+				}
+			}
+		}
+		for ( auto const LargeSurf : GeometryIndexLargeSurfs ) {
+			if ( BoxesTouch( Box, SurfaceBox( LargeSurf ), Tolerance ) ) Candidates.push_back( LargeSurf );
+		}
+		std::sort( Candidates.begin(), Candidates.end() );
+
+	}
+
+	void
+	CheckZoneSurfaceConnections()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Checks that every floor, wall and roof of a zone touches at least one other
+		// floor, wall or roof of the same zone. A surface that touches none of them
+		// cannot be part of a closed zone, so the calculated zone volume and the
+		// interior radiant exchange will not be right.
+
+		// METHODOLOGY EMPLOYED:
+		// Uses the spatial index of BuildGeometryIndex. Touching bounding boxes are a
+		// necessary (not a sufficient) condition for shared edges, so only clearly
+		// disconnected surfaces are counted; they are shown with DisplayExtraWarnings.
+		// Zones with fewer than two floors, walls and roofs are left to the "not
+		// enough surfaces" check of GetSurfaceData.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "GetSurfaceData: " );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ZoneNum; // Loop counter
+		int SurfNum; // Loop counter
+		int NumZoneBaseSurfs; // Number of floors, walls and roofs of the zone
+		bool Connected; // True if the surface touches another floor, wall or roof of the zone
+		std::vector< int > Candidates; // Surfaces near the surface being checked
+
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( Zone( ZoneNum ).SurfaceFirst == 0 ) continue;
+			NumZoneBaseSurfs = 0;
+			for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+				if ( Surface( SurfNum ).Class == SurfaceClass_Floor || Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Roof ) ++NumZoneBaseSurfs;
+			}
+			if ( NumZoneBaseSurfs < 2 ) continue;
+			for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+				if ( Surface( SurfNum ).Class != SurfaceClass_Floor && Surface( SurfNum ).Class != SurfaceClass_Wall && Surface( SurfNum ).Class != SurfaceClass_Roof ) continue;
+				if ( SurfNum > int( SurfaceBox.size() ) ) continue;
+				GeometryIndexCandidates( SurfaceBox( SurfNum ), GeometryIndexTolerance, Candidates );
+				Connected = false;
+				for ( auto const Candidate : Candidates ) {
+					if ( Candidate == SurfNum || Surface( Candidate ).Zone != ZoneNum ) continue;
+					if ( Surface( Candidate ).Class != SurfaceClass_Floor && Surface( Candidate ).Class != SurfaceClass_Wall && Surface( Candidate ).Class != SurfaceClass_Roof ) continue;
+					Connected = true;
+					break;
+				}
+				if ( Connected ) continue;
+				++NumUnconnectedSurfaces;
+				if ( DisplayExtraWarnings ) {
+					ShowWarningError( RoutineName + "Surface=\"" + Surface( SurfNum ).Name + "\" does not touch any other floor, wall or roof of Zone=\"" + Zone( ZoneNum ).Name + "\"." );
+					ShowContinueError( "...the zone may not be enclosed; the calculated zone volume may be inaccurate." );
+				}
+			}
+		}
+	}
+
+	void
+	ClearGeometryIndex()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Releases the name index and the spatial index once the surfaces are set up.
+
+		SurfaceTmpNameIndex.clear();
+		SurfaceBox.deallocate();
+		GeometryIndexCells.clear();
+		GeometryIndexLargeSurfs.clear();
+		GeometryIndexMark.clear();
+
+	}
+
 	void
 	GetGeometryParameters( bool & ErrorsFound ) // set to true if errors found during input
 	{
@@ -2612,7 +3254,7 @@ namespace SurfaceGeometry {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda Lawrie
 		//       DATE WRITTEN   May 2000
-		//       MODIFIED       na
+		//       MODIFIED       October 2014: read the records through GetObjectItemRecord
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2729,6 +3371,9 @@ namespace SurfaceGeometry {
 		using InputProcessor::VerifyName;
 		using InputProcessor::SameString;
 		using InputProcessor::GetObjectDefMaxArgs;
+		using InputProcessor::GetObjectDefFieldNames;
+		using InputProcessor::GetObjectItemRecord;
+		using InputProcessor::LineDefinition;
 		using General::RoundSigDigits;
 		using General::TrimSigDigits;
 
@@ -2747,7 +3392,6 @@ namespace SurfaceGeometry {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int IOStat; // IO Status when calling get input subroutine
 		int SurfaceNumAlpha; // Number of material alpha names being passed
 		int SurfaceNumProp; // Number of material properties being passed
 		int ZoneNum; // DO loop counter (zones)
@@ -2800,9 +3444,26 @@ namespace SurfaceGeometry {
 					ErrorsFound = true;
 				}
 			}
+			GetObjectDefFieldNames( cCurrentModuleObject, cAlphaFieldNames, cNumericFieldNames );
 
 			for ( Loop = 1; Loop <= ItemsToGet; ++Loop ) {
-				GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, SurfaceNumAlpha, rNumericArgs, SurfaceNumProp, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+				// The record is read in place: only the alphas and the first two numbers are copied,
+				// the vertex coordinates are read straight from the record.
+				LineDefinition const & SurfaceRec( GetObjectItemRecord( cCurrentModuleObject, Loop ) );
+				SurfaceNumAlpha = SurfaceRec.NumAlphas;
+				SurfaceNumProp = SurfaceRec.NumNumbers;
+				cAlphaArgs( {1,8} ) = BlankString;
+				lAlphaFieldBlanks( {1,8} ) = true;
+				if ( SurfaceNumAlpha > 0 ) {
+					cAlphaArgs( {1,SurfaceNumAlpha} ) = SurfaceRec.Alphas( {1,SurfaceNumAlpha} );
+					lAlphaFieldBlanks( {1,SurfaceNumAlpha} ) = SurfaceRec.AlphBlank( {1,SurfaceNumAlpha} );
+				}
+				rNumericArgs( {1,2} ) = 0.0;
+				lNumericFieldBlanks( {1,2} ) = true;
+				if ( SurfaceNumProp > 0 ) {
+					rNumericArgs( {1,min( 2, SurfaceNumProp )} ) = SurfaceRec.Numbers( {1,min( 2, SurfaceNumProp )} );
+					lNumericFieldBlanks( {1,min( 2, SurfaceNumProp )} ) = SurfaceRec.NumBlank( {1,min( 2, SurfaceNumProp )} );
+				}
 				ErrorInName = false;
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), SurfaceTmp_Name, SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
@@ -3027,7 +3688,13 @@ namespace SurfaceGeometry {
 					}
 				}
 				SurfaceTmp( SurfNum ).Vertex.allocate( SurfaceTmp( SurfNum ).Sides );
-				GetVertices( SurfNum, SurfaceTmp( SurfNum ).Sides, rNumericArgs( {3,_} ) );
+				if ( 3 * SurfaceTmp( SurfNum ).Sides <= SurfaceNumProp - 2 ) {
+					GetVertices( SurfNum, SurfaceTmp( SurfNum ).Sides, SurfaceRec.Numbers( {3,_} ) );
+				} else { // Fewer coordinates entered than indicated -- the missing ones are 0.0 (as GetObjectItem pads them)
+					rNumericArgs( {3,min( 2 + 3 * SurfaceTmp( SurfNum ).Sides, isize( rNumericArgs ) )} ) = 0.0;
+					if ( SurfaceNumProp > 2 ) rNumericArgs( {3,SurfaceNumProp} ) = SurfaceRec.Numbers( {3,SurfaceNumProp} );
+					GetVertices( SurfNum, SurfaceTmp( SurfNum ).Sides, rNumericArgs( {3,_} ) );
+				}
 				if ( SurfaceTmp( SurfNum ).Area <= 0.0 ) {
 					ShowSevereError( cCurrentModuleObject + "=\"" + SurfaceTmp( SurfNum ).Name + "\", Surface Area <= 0.0; Entered Area=" + TrimSigDigits( SurfaceTmp( SurfNum ).Area, 2 ) );
 					ErrorsFound = true;
@@ -3756,7 +4423,7 @@ namespace SurfaceGeometry {
 			//  The subsurface inherits properties from the base surface
 			//  Exterior conditions, Zone, etc.
 			//  We can figure out the base surface though, because they've all been entered
-			Found = FindItemInList( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp_Name, TotSurfaces );
+			Found = FindSurfaceTmpName( SurfaceTmp( SurfNum ).BaseSurfName, TotSurfaces );
 			if ( Found > 0 ) {
 				SurfaceTmp( SurfNum ).BaseSurf = Found;
 				SurfaceTmp( SurfNum ).ExtBoundCond = SurfaceTmp( Found ).ExtBoundCond;
@@ -4102,7 +4769,7 @@ namespace SurfaceGeometry {
 				//  The subsurface inherits properties from the base surface
 				//  Exterior conditions, Zone, etc.
 				//  We can figure out the base surface though, because they've all been entered
-				Found = FindItemInList( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp_Name, TotSurfaces );
+				Found = FindSurfaceTmpName( SurfaceTmp( SurfNum ).BaseSurfName, TotSurfaces );
 				if ( Found > 0 ) {
 					SurfaceTmp( SurfNum ).BaseSurf = Found;
 					SurfaceTmp( SurfNum ).ExtBoundCond = SurfaceTmp( Found ).ExtBoundCond;
@@ -4915,7 +5582,7 @@ namespace SurfaceGeometry {
 			//  The subsurface inherits properties from the base surface
 			//  Exterior conditions, Zone, etc.
 			//  We can figure out the base surface though, because they've all been entered
-			Found = FindItemInList( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp_Name, TotSurfaces );
+			Found = FindSurfaceTmpName( SurfaceTmp( SurfNum ).BaseSurfName, TotSurfaces );
 			if ( Found > 0 ) {
 				//SurfaceTmp(SurfNum)%BaseSurf=Found
 				SurfaceTmp( SurfNum ).ExtBoundCond = SurfaceTmp( Found ).ExtBoundCond;
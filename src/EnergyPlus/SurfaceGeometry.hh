@@ -1,6 +1,12 @@
 #ifndef SurfaceGeometry_hh_INCLUDED
 #define SurfaceGeometry_hh_INCLUDED
 
+// C++ Headers
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
 #include <ObjexxFCL/FArray1S.hh>
@@ -30,6 +36,8 @@ namespace SurfaceGeometry {
 	// referencing another in adjacent zone
 	extern int const UnreconciledZoneSurface; // interim value between entering surfaces ("Surface") and reconciling
 	// surface names in other zones
+	extern Real64 const GeometryIndexTolerance; // Distance within which two surface bounding boxes touch (m)
+	extern int const GeometryIndexMaxCells; // Surfaces spanning more grid cells than this are not filed by cell
 
 	// DERIVED TYPE DEFINITIONS
 
@@ -50,12 +58,47 @@ namespace SurfaceGeometry {
 	extern int Warning1Count; // counts of Modify Window 5/6 windows
 	extern int Warning2Count; // counts of overriding exterior windows with Window 5/6 glazing systems
 	extern int Warning3Count; // counts of overriding interior windows with Window 5/6 glazing systems
+	// Following are used only during GetSurfaceData (spatial index of the surface vertices).
+	extern Real64 GeometryIndexCellSize; // Edge length of the grid cells of the index (m)
+	extern int GeometryIndexQuery; // Number of the current index query (marks the surfaces already collected)
+	extern int NumSubSurfsOutsideBase; // Subsurfaces whose vertices extend outside the bounding box of the base surface
+	extern int NumInterzoneLocationMismatches; // Interzone surface pairs whose bounding boxes do not touch
+	extern int NumUnconnectedSurfaces; // Zone surfaces that touch no other floor, wall or roof of the zone
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE SurfaceGeometry
 
+	// Types
+
+	struct GeometryIndexBox
+	{
+		// Members
+		Real64 XMin; // Minimum x coordinate of the vertices (m)
+		Real64 YMin; // Minimum y coordinate of the vertices (m)
+		Real64 ZMin; // Minimum z coordinate of the vertices (m)
+		Real64 XMax; // Maximum x coordinate of the vertices (m)
+		Real64 YMax; // Maximum y coordinate of the vertices (m)
+		Real64 ZMax; // Maximum z coordinate of the vertices (m)
+
+		// Default Constructor
+		GeometryIndexBox() :
+			XMin( 0.0 ),
+			YMin( 0.0 ),
+			ZMin( 0.0 ),
+			XMax( 0.0 ),
+			YMax( 0.0 ),
+			ZMax( 0.0 )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< SurfaceData > SurfaceTmp; // Allocated/Deallocated during input processing
 	extern FArray1D< SurfaceData > SurfaceTmpSave; // Allocated/Deallocated during input processing
+	extern std::unordered_map< std::string, int > SurfaceTmpNameIndex; // First SurfaceTmp number of each surface name
+	extern FArray1D< GeometryIndexBox > SurfaceBox; // Vertex bounding box of each surface (Surface order)
+	extern std::unordered_map< std::int64_t, std::vector< int > > GeometryIndexCells; // Surfaces filed by grid cell
+	extern std::vector< int > GeometryIndexLargeSurfs; // Surfaces spanning more than GeometryIndexMaxCells cells
+	extern std::vector< int > GeometryIndexMark; // Query number that last collected each surface
 
 	// Functions
 
@@ -68,6 +111,51 @@ namespace SurfaceGeometry {
 	void
 	GetSurfaceData( bool & ErrorsFound ); // If errors found in input
 
+	void
+	IndexSurfaceTmpNames( int const NumSurfs ); // Number of SurfaceTmp entries to index
+
+	int
+	FindSurfaceTmpName(
+		std::string const & Name, // Surface name to find
+		int const NumItems // Number of SurfaceTmp entries searched
+	);
+
+	void
+	SetSurfaceBox(
+		SurfaceData const & ThisSurf, // Surface whose vertices are boxed
+		GeometryIndexBox & Box // Bounding box of the vertices
+	);
+
+	bool
+	BoxesTouch(
+		GeometryIndexBox const & Box1,
+		GeometryIndexBox const & Box2,
+		Real64 const Tolerance // Gap allowed between the boxes (m)
+	);
+
+	bool
+	BoxContainsBox(
+		GeometryIndexBox const & Outer,
+		GeometryIndexBox const & Inner,
+		Real64 const Tolerance // Distance Inner may extend beyond Outer (m)
+	);
+
+	void
+	BuildGeometryIndex( int const NumSurfs ); // Number of surfaces (Surface order) to index
+
+	void
+	GeometryIndexCandidates(
+		GeometryIndexBox const & Box, // Box to search around
+		Real64 const Tolerance, // Gap allowed between Box and the surface boxes (m)
+		std::vector< int > & Candidates // Surfaces whose boxes touch Box, in ascending order
+	);
+
+	void
+	CheckZoneSurfaceConnections();
+
+	void
+	ClearGeometryIndex();
+
 	void
 	GetGeometryParameters( bool & ErrorsFound ); // set to true if errors found during input
 
@@ -0,0 +1,427 @@
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray.functions.hh>
+#include <ObjexxFCL/Fmath.hh>
+#include <ObjexxFCL/gio.hh>
+#include <ObjexxFCL/string.functions.hh>
+
+// EnergyPlus Headers
+#include <SurfaceRayTree.hh>
+#include <DataPrecisionGlobals.hh>
+#include <DataSurfaces.hh>
+#include <General.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace SurfaceRayTree {
+
+	// MODULE INFORMATION
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2014
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Provides a bounding volume hierarchy over the surface list so that the obstruction
+	// tests in daylighting and solar reflection do not have to pierce every surface with
+	// every ray.
+
+	// METHODOLOGY EMPLOYED:
+	// Each surface gets an axis-aligned bounding box from its vertices. The boxes are
+	// split top-down at the median centroid along the longest axis of the centroid
+	// bounds until a node holds MaxSurfacesPerLeaf or fewer surfaces. A ray query
+	// walks the hierarchy with a slab test and returns the surfaces whose boxes are hit
+	// in ascending surface number order, so that callers that loop over candidates and
+	// stop at the first hit (or break ties on surface order) give exactly the same
+	// answer as the original loop over all surfaces.
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// The hierarchy is built once, after the surface list is final. Surfaces do not move
+	// during the simulation, so it is never rebuilt.
+
+	// Using/Aliasing
+	using namespace DataPrecisionGlobals;
+	using DataSurfaces::Surface;
+	using DataSurfaces::TotSurfaces;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const MaxSurfacesPerLeaf( 4 );
+	Real64 const BoxTolerance( 0.001 );
+
+	// DERIVED TYPE DEFINITIONS:
+	// na
+
+	// MODULE VARIABLE DECLARATIONS:
+	bool RayTreeBuilt( false );
+	int NumRayTreeNodes( 0 );
+	int RayTreeDepth( 0 );
+	Int64 NumRayTreeQueries( 0 );
+	Int64 NumRayTreeNodesVisited( 0 );
+	Int64 NumRayTreeCandidates( 0 );
+
+	// SUBROUTINE SPECIFICATIONS FOR MODULE SurfaceRayTree:
+
+	// Object Data
+	std::vector< RayTreeNode > TreeNodes;
+	std::vector< RayTreeBox > SurfBox;
+	std::vector< int > TreeSurfNums;
+
+	// Functions
+
+	void
+	InitSurfaceRayTree()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the surface bounding boxes and the hierarchy over them. Safe to call
+		// more than once; only the first call after surfaces are read does any work.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum; // Surface index
+		int Vert; // Vertex index
+
+		if ( RayTreeBuilt ) return;
+		RayTreeBuilt = true;
+
+		SurfBox.clear();
+		TreeNodes.clear();
+		TreeSurfNums.clear();
+		NumRayTreeNodes = 0;
+		RayTreeDepth = 0;
+		if ( TotSurfaces <= 0 ) return;
+
+		SurfBox.resize( TotSurfaces );
+		TreeSurfNums.reserve( TotSurfaces );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto & box( SurfBox[ SurfNum - 1 ] );
+			auto const & vertex( Surface( SurfNum ).Vertex );
+			if ( Surface( SurfNum ).Sides <= 0 ) continue; // Never hit, left out of the tree
+			box.XMin = box.XMax = vertex( 1 ).x;
+			box.YMin = box.YMax = vertex( 1 ).y;
+			box.ZMin = box.ZMax = vertex( 1 ).z;
+			for ( Vert = 2; Vert <= Surface( SurfNum ).Sides; ++Vert ) {
+				box.XMin = min( box.XMin, vertex( Vert ).x );
+				box.YMin = min( box.YMin, vertex( Vert ).y );
+				box.ZMin = min( box.ZMin, vertex( Vert ).z );
+				box.XMax = max( box.XMax, vertex( Vert ).x );
+				box.YMax = max( box.YMax, vertex( Vert ).y );
+				box.ZMax = max( box.ZMax, vertex( Vert ).z );
+			}
+			box.XMin -= BoxTolerance;
+			box.YMin -= BoxTolerance;
+			box.ZMin -= BoxTolerance;
+			box.XMax += BoxTolerance;
+			box.YMax += BoxTolerance;
+			box.ZMax += BoxTolerance;
+			TreeSurfNums.push_back( SurfNum );
+		}
+		if ( TreeSurfNums.empty() ) return;
+
+		// A binary tree with leaves of at least one surface never needs more than 2N-1 nodes
+		TreeNodes.reserve( 2 * TreeSurfNums.size() );
+		BuildRayTreeNode( 0, TreeSurfNums.size(), 1 );
+		NumRayTreeNodes = TreeNodes.size();
+
+	}
+
+	int
+	BuildRayTreeNode(
+		int const FirstItem, // First entry of TreeSurfNums covered by the node (zero based)
+		int const NumItems, // Number of entries of TreeSurfNums covered by the node
+		int const Depth // Depth of the node (root = 1)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Creates the node covering TreeSurfNums[ FirstItem, FirstItem + NumItems ) and,
+		// unless it is small enough to be a leaf, its two children. Returns the node index.
+
+		// METHODOLOGY EMPLOYED:
+		// Median split on the longest axis of the centroid bounds (std::nth_element).
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int NodeNum; // Index of the new node
+		int Item; // Loop index over TreeSurfNums
+		int Axis; // Split axis: 0 = x, 1 = y, 2 = z
+		int NumLeft; // Number of surfaces in the first child
+		int LeftNode; // Index of the first child
+		int RightNode; // Index of the second child
+		Real64 CMin[ 3 ]; // Centroid bounds
+		Real64 CMax[ 3 ];
+		Real64 Centroid[ 3 ];
+
+		NodeNum = TreeNodes.size();
+		TreeNodes.push_back( RayTreeNode() );
+		RayTreeDepth = max( RayTreeDepth, Depth );
+
+		RayTreeBox Box( SurfBox[ TreeSurfNums[ FirstItem ] - 1 ] );
+		for ( Item = FirstItem + 1; Item < FirstItem + NumItems; ++Item ) {
+			auto const & box( SurfBox[ TreeSurfNums[ Item ] - 1 ] );
+			Box.XMin = min( Box.XMin, box.XMin );
+			Box.YMin = min( Box.YMin, box.YMin );
+			Box.ZMin = min( Box.ZMin, box.ZMin );
+			Box.XMax = max( Box.XMax, box.XMax );
+			Box.YMax = max( Box.YMax, box.YMax );
+			Box.ZMax = max( Box.ZMax, box.ZMax );
+		}
+		TreeNodes[ NodeNum ].Box = Box;
+
+		if ( NumItems <= MaxSurfacesPerLeaf ) {
+			TreeNodes[ NodeNum ].FirstItem = FirstItem;
+			TreeNodes[ NodeNum ].NumItems = NumItems;
+			return NodeNum;
+		}
+
+		for ( Item = FirstItem; Item < FirstItem + NumItems; ++Item ) {
+			auto const & box( SurfBox[ TreeSurfNums[ Item ] - 1 ] );
+			Centroid[ 0 ] = 0.5 * ( box.XMin + box.XMax );
+			Centroid[ 1 ] = 0.5 * ( box.YMin + box.YMax );
+			Centroid[ 2 ] = 0.5 * ( box.ZMin + box.ZMax );
+			for ( int i = 0; i < 3; ++i ) {
+				if ( Item == FirstItem ) {
+					CMin[ i ] = CMax[ i ] = Centroid[ i ];
+				} else {
+					CMin[ i ] = min( CMin[ i ], Centroid[ i ] );
+					CMax[ i ] = max( CMax[ i ], Centroid[ i ] );
+				}
+			}
+		}
+		Axis = 0;
+		if ( CMax[ 1 ] - CMin[ 1 ] > CMax[ Axis ] - CMin[ Axis ] ) Axis = 1;
+		if ( CMax[ 2 ] - CMin[ 2 ] > CMax[ Axis ] - CMin[ Axis ] ) Axis = 2;
+		if ( CMax[ Axis ] - CMin[ Axis ] <= 0.0 ) { // All centroids coincide: cannot split usefully
+			TreeNodes[ NodeNum ].FirstItem = FirstItem;
+			TreeNodes[ NodeNum ].NumItems = NumItems;
+			return NodeNum;
+		}
+
+		NumLeft = NumItems / 2;
+		std::nth_element( TreeSurfNums.begin() + FirstItem, TreeSurfNums.begin() + FirstItem + NumLeft, TreeSurfNums.begin() + FirstItem + NumItems, [ Axis ]( int const a, int const b ) -> bool {
+			auto const & boxA( SurfBox[ a - 1 ] );
+			auto const & boxB( SurfBox[ b - 1 ] );
+			if ( Axis == 0 ) return boxA.XMin + boxA.XMax < boxB.XMin + boxB.XMax;
+			if ( Axis == 1 ) return boxA.YMin + boxA.YMax < boxB.YMin + boxB.YMax;
+			return boxA.ZMin + boxA.ZMax < boxB.ZMin + boxB.ZMax;
+		} );
+
+		LeftNode = BuildRayTreeNode( FirstItem, NumLeft, Depth + 1 );
+		RightNode = BuildRayTreeNode( FirstItem + NumLeft, NumItems - NumLeft, Depth + 1 );
+		TreeNodes[ NodeNum ].Left = LeftNode;
+		TreeNodes[ NodeNum ].Right = RightNode;
+		return NodeNum;
+
+	}
+
+	bool
+	RayHitsBox(
+		RayTreeBox const & Box, // Box to be tested
+		FArray1< Real64 > const & R1, // Origin of ray (m)
+		FArray1< Real64 > const & RN // Unit vector along ray
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Slab test of the half line R1 + t*RN, t >= 0, against an axis-aligned box.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		Real64 const SmallDirection( 1.0e-12 ); // Direction components below this are treated as parallel
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 TNear( 0.0 ); // Entry parameter along ray
+		Real64 TFar( 1.0e30 ); // Exit parameter along ray
+		Real64 BMin[ 3 ] = { Box.XMin, Box.YMin, Box.ZMin };
+		Real64 BMax[ 3 ] = { Box.XMax, Box.YMax, Box.ZMax };
+
+		for ( int i = 0; i < 3; ++i ) {
+			Real64 const O( R1( i + 1 ) );
+			Real64 const D( RN( i + 1 ) );
+			if ( std::abs( D ) < SmallDirection ) {
+				if ( O < BMin[ i ] || O > BMax[ i ] ) return false;
+			} else {
+				Real64 const InvD( 1.0 / D );
+				Real64 T1( ( BMin[ i ] - O ) * InvD );
+				Real64 T2( ( BMax[ i ] - O ) * InvD );
+				if ( T1 > T2 ) std::swap( T1, T2 );
+				if ( T1 > TNear ) TNear = T1;
+				if ( T2 < TFar ) TFar = T2;
+				if ( TNear > TFar ) return false;
+			}
+		}
+		return true;
+
+	}
+
+	void
+	RayTreeCandidates(
+		FArray1< Real64 > const & R1, // Origin of ray (m)
+		FArray1< Real64 > const & RN, // Unit vector along ray
+		std::vector< int > & Candidates // Surfaces whose bounding box is hit, in ascending surface number order
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Returns every surface that the ray from R1 along RN could pierce. Callers still
+		// apply their own filters and the exact pierce test to each candidate.
+
+		// METHODOLOGY EMPLOYED:
+		// Iterative depth-first walk of the hierarchy with an explicit stack.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static std::vector< int > Stack; // Nodes still to be visited
+		int NodeNum; // Node being visited
+		int Item; // Loop index over leaf surfaces
+
+		assert( ( R1.l() == 1 ) && ( R1.u() >= 3 ) );
+		assert( ( RN.l() == 1 ) && ( RN.u() >= 3 ) );
+
+		if ( ! RayTreeBuilt ) InitSurfaceRayTree();
+
+		Candidates.clear();
+		++NumRayTreeQueries;
+		if ( TreeNodes.empty() ) return;
+
+		Stack.clear();
+		Stack.push_back( 0 );
+		while ( ! Stack.empty() ) {
+			NodeNum = Stack.back();
+			Stack.pop_back();
+			++NumRayTreeNodesVisited;
+			auto const & node( TreeNodes[ NodeNum ] );
+			if ( ! RayHitsBox( node.Box, R1, RN ) ) continue;
+			if ( node.NumItems > 0 ) {
+				for ( Item = node.FirstItem; Item < node.FirstItem + node.NumItems; ++Item ) {
+					if ( RayHitsBox( SurfBox[ TreeSurfNums[ Item ] - 1 ], R1, RN ) ) Candidates.push_back( TreeSurfNums[ Item ] );
+				}
+			} else {
+				Stack.push_back( node.Right );
+				Stack.push_back( node.Left );
+			}
+		}
+		std::sort( Candidates.begin(), Candidates.end() );
+		NumRayTreeCandidates += Candidates.size();
+
+	}
+
+	void
+	ReportSurfaceRayTreeSummary()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the ray query counters to the audit file, in the manner of ShowPsychrometricSummary.
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+		using General::TrimSigDigits;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtLD( "*" );
+		static gio::Fmt const fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int EchoInputFile; // found unit number for "eplusout.audit"
+		std::string sQueries;
+		std::string sVisited;
+		std::string sCandidates;
+
+		if ( NumRayTreeQueries == 0 ) return;
+		EchoInputFile = FindUnitNumber( "eplusout.audit" );
+		if ( EchoInputFile == 0 ) return;
+
+		gio::write( sQueries, fmtLD ) << NumRayTreeQueries;
+		strip( sQueries );
+		gio::write( sVisited, fmtLD ) << NumRayTreeNodesVisited;
+		strip( sVisited );
+		gio::write( sCandidates, fmtLD ) << NumRayTreeCandidates;
+		strip( sCandidates );
+		gio::write( EchoInputFile, fmtA ) << "Surface Ray Tree,#Surfaces,#Nodes,Depth,#Rays,#Nodes Visited,#Candidates,Avg Nodes/Ray,Avg Candidates/Ray";
+		gio::write( EchoInputFile, fmtA ) << "Surface Ray Tree," + TrimSigDigits( int( TreeSurfNums.size() ) ) + ',' + TrimSigDigits( NumRayTreeNodes ) + ',' + TrimSigDigits( RayTreeDepth ) + ',' + sQueries + ',' + sVisited + ',' + sCandidates + ',' + RoundSigDigits( double( NumRayTreeNodesVisited ) / double( NumRayTreeQueries ), 2 ) + ',' + RoundSigDigits( double( NumRayTreeCandidates ) / double( NumRayTreeQueries ), 2 );
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in EnergyPlus.f90.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // SurfaceRayTree
+
+} // EnergyPlus
@@ -0,0 +1,113 @@
+#ifndef SurfaceRayTree_hh_INCLUDED
+#define SurfaceRayTree_hh_INCLUDED
+
+// C++ Headers
+#include <vector>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace SurfaceRayTree {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern int const MaxSurfacesPerLeaf; // Node is not subdivided further at or below this number of surfaces
+	extern Real64 const BoxTolerance; // Padding added to each surface bounding box (m)
+
+	// DERIVED TYPE DEFINITIONS
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern bool RayTreeBuilt; // True once the hierarchy has been built over the final surface list
+	extern int NumRayTreeNodes; // Number of nodes in the hierarchy
+	extern int RayTreeDepth; // Depth of the deepest leaf (root = 1)
+	extern Int64 NumRayTreeQueries; // Number of rays passed to RayTreeCandidates
+	extern Int64 NumRayTreeNodesVisited; // Number of node bounding boxes tested
+	extern Int64 NumRayTreeCandidates; // Number of surfaces handed back for an exact pierce test
+
+	// Types
+
+	struct RayTreeBox
+	{
+		// Members
+		Real64 XMin;
+		Real64 YMin;
+		Real64 ZMin;
+		Real64 XMax;
+		Real64 YMax;
+		Real64 ZMax;
+
+		// Default Constructor
+		RayTreeBox() :
+			XMin( 0.0 ),
+			YMin( 0.0 ),
+			ZMin( 0.0 ),
+			XMax( 0.0 ),
+			YMax( 0.0 ),
+			ZMax( 0.0 )
+		{}
+
+	};
+
+	struct RayTreeNode
+	{
+		// Members
+		RayTreeBox Box; // Bounding box of all surfaces below this node
+		int Left; // Index of first child node (0 for a leaf)
+		int Right; // Index of second child node (0 for a leaf)
+		int FirstItem; // Index of first surface of a leaf in TreeSurfNums
+		int NumItems; // Number of surfaces in a leaf
+
+		// Default Constructor
+		RayTreeNode() :
+			Left( 0 ),
+			Right( 0 ),
+			FirstItem( 0 ),
+			NumItems( 0 )
+		{}
+
+	};
+
+	// Object Data
+	extern std::vector< RayTreeNode > TreeNodes; // Hierarchy nodes, root is TreeNodes[ 0 ]
+	extern std::vector< RayTreeBox > SurfBox; // Bounding box of each surface, SurfBox[ SurfNum - 1 ]
+	extern std::vector< int > TreeSurfNums; // Surface numbers in leaf order
+
+	// Functions
+
+	void
+	InitSurfaceRayTree();
+
+	int
+	BuildRayTreeNode(
+		int const FirstItem, // First entry of TreeSurfNums covered by the node (zero based)
+		int const NumItems, // Number of entries of TreeSurfNums covered by the node
+		int const Depth // Depth of the node (root = 1)
+	);
+
+	bool
+	RayHitsBox(
+		RayTreeBox const & Box, // Box to be tested
+		FArray1< Real64 > const & R1, // Origin of ray (m)
+		FArray1< Real64 > const & RN // Unit vector along ray
+	);
+
+	void
+	RayTreeCandidates(
+		FArray1< Real64 > const & R1, // Origin of ray (m)
+		FArray1< Real64 > const & RN, // Unit vector along ray
+		std::vector< int > & Candidates // Surfaces whose bounding box is hit, in ascending surface number order
+	);
+
+	void
+	ReportSurfaceRayTreeSummary();
+
+} // SurfaceRayTree
+
+} // EnergyPlus
+
+#endif
@@ -37,6 +37,7 @@ extern "C" {
 #include <OutputReports.hh>
 #include <PlantManager.hh>
 #include <SimulationManager.hh>
+#include <SizingManager.hh>
 #include <SolarShading.hh>
 #include <SQLiteProcedures.hh>
 #include <SystemReports.hh>
@@ -115,6 +116,12 @@ AbortEnergyPlus(
 	bool TerminalError;
 	int write_stat;
 
+	// a zone sizing worker only writes its sizing period files; the parent copies them and reports the failure
+	if ( SizingWorkerProcess ) {
+		SizingManager::CloseSizingPeriodOutput();
+		std::_Exit( EXIT_FAILURE );
+	}
+
 	if ( sqlite && sqlite->writeOutputToSQLite() ) {
 		sqlite->updateSQLiteSimulationRecord( true, false );
 	}
@@ -1445,6 +1452,7 @@ StoreRecurringErrorMessage(
 	//       AUTHOR         Michael J. Witte
 	//       DATE WRITTEN   August 2004
 	//       MODIFIED       September 2005;LKL;Added Units
+	//                      October 2014; reuse messages first stored by a zone sizing worker
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -1478,10 +1486,20 @@ StoreRecurringErrorMessage(
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+	int Loop;
 
 	// Object Data
 	FArray1D< RecurringErrorData > TempRecurringErrors;
 
+	// A message first stored by a zone sizing worker has an entry, but no index in the caller
+	if ( ErrorMsgIndex == 0 && MergedRecurringErrors ) {
+		for ( Loop = 1; Loop <= NumRecurringErrors; ++Loop ) {
+			if ( RecurringErrors( Loop ).Message != ErrorMessage ) continue;
+			ErrorMsgIndex = Loop;
+			break;
+		}
+	}
+
 	// If Index is zero, then assign next available index and reallocate array
 	if ( ErrorMsgIndex == 0 ) {
 		++NumRecurringErrors;
@@ -130,6 +130,11 @@ namespace WaterThermalTanks {
 	int const InletModeFixed( 1 ); // water heater only, inlet water always enters at the user-specified height
 	int const InletModeSeeking( 2 ); // water heater only, inlet water seeks out the node with the closest temperature
 
+	int const NodeSolverExplicit( 1 ); // stratified tank only, forward Euler node balance with one second sub-steps
+	int const NodeSolverImplicit( 2 ); // stratified tank only, backward Euler node balance with adaptive sub-steps
+	Real64 const NodeSolverTempTol( 0.01 ); // Allowed local error of a node temperature in one implicit sub-step (C)
+	Real64 const NodeSolverMinStep( 1.0 ); // Smallest implicit sub-step (s)
+
 	// integer parameter for water heater
 	int const MixedWaterHeater( TypeOf_WtrHeaterMixed ); // WaterHeater:Mixed
 	int const StratifiedWaterHeater( TypeOf_WtrHeaterStratified ); // WaterHeater:Stratified
@@ -2758,6 +2763,21 @@ namespace WaterThermalTanks {
 						}
 					}
 
+					// Node solution method
+					if ( ( NumAlphas > 22 ) && ( ! lAlphaFieldBlanks( 23 ) ) ) {
+						{ auto const SELECT_CASE_var( cAlphaArgs( 23 ) );
+						if ( SELECT_CASE_var == "EXPLICIT" ) {
+							WaterThermalTank( WaterThermalTankNum ).NodeSolver = NodeSolverExplicit;
+						} else if ( SELECT_CASE_var == "IMPLICITADAPTIVE" ) {
+							WaterThermalTank( WaterThermalTankNum ).NodeSolver = NodeSolverImplicit;
+						} else {
+							ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Invalid " + cAlphaFieldNames( 23 ) + " entered=" + cAlphaArgs( 23 ) );
+							ErrorsFound = true;
+						}}
+					} else {
+						WaterThermalTank( WaterThermalTankNum ).NodeSolver = NodeSolverExplicit;
+					}
+
 				} // WaterThermalTankNum
 
 				if ( ErrorsFound ) {
@@ -3765,6 +3785,8 @@ namespace WaterThermalTanks {
 							SetupOutputVariable( "Water Heater Heater 1 Runtime Fraction []", WaterThermalTank( WaterThermalTankNum ).RuntimeFraction1, "System", "Average", WaterThermalTank( WaterThermalTankNum ).Name );
 							SetupOutputVariable( "Water Heater Heater 2 Runtime Fraction []", WaterThermalTank( WaterThermalTankNum ).RuntimeFraction2, "System", "Average", WaterThermalTank( WaterThermalTankNum ).Name );
 
+							SetupOutputVariable( "Water Heater Node Solution Sub-Step Count []", WaterThermalTank( WaterThermalTankNum ).SubSteps, "System", "Sum", WaterThermalTank( WaterThermalTankNum ).Name );
+
 							for ( NodeNum = 1; NodeNum <= WaterThermalTank( WaterThermalTankNum ).Nodes; ++NodeNum ) {
 								SetupOutputVariable( "Water Heater Temperature Node " + TrimSigDigits( NodeNum ) + " [C]", WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).TempAvg, "System", "Average", WaterThermalTank( WaterThermalTankNum ).Name );
 							}
@@ -5673,6 +5695,7 @@ namespace WaterThermalTanks {
 		//       DATE WRITTEN   January 2007
 		//       MODIFIED       na
 		//                      Nov 2011, BAN; modified the use and source outlet temperature calculation
+		//                      Oct 2014; optional implicit node solution with adaptive sub-steps
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5683,6 +5706,10 @@ namespace WaterThermalTanks {
 		// node at a sub time step interval of one second.  Temperatures and energies change dynamically over the system
 		// time step.  Final node temperatures are reported as final instantaneous values as well as averages over the
 		// time step.  Heat transfer rates are averages over the time step.
+		// With the IMPLICITADAPTIVE node solution method the node heat balance is solved with the backward Euler method
+		// instead (CalcStratifiedNodesImplicit), with sub-steps sized to keep the estimated local error within
+		// NodeSolverTempTol and ending where a heater element is switched, so runtimes are accounted as in the explicit
+		// method.
 
 		// Using/Aliasing
 		using DataGlobals::TimeStep;
@@ -5697,13 +5724,17 @@ namespace WaterThermalTanks {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const dt( 1.0 ); // Sub time step interval (s)
+		Real64 const ExplicitStep( 1.0 ); // Sub time step interval of the explicit node balance (s)
 		static std::string const RoutineName( "CalcWaterThermalTankStratified" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 TimeElapsed; // Fraction of the current hour that has elapsed (h)
 		Real64 SecInTimeStep; // Seconds in one timestep (s)
 		Real64 TimeRemaining; // Time remaining in the current timestep (s)
+		Real64 dt; // Sub time step interval (s)
+		Real64 StepError; // Estimated local error of an implicit sub-step (C)
+		Real64 CrossTime; // Time into the sub-step at which a heater element is switched (s)
+		int SubSteps; // Number of sub-steps taken
 		int NumNodes; // Number of stratified nodes
 		int NodeNum; // Node number index
 		Real64 NodeMass; // Mass of water in a node (kg)
@@ -5829,6 +5860,7 @@ namespace WaterThermalTanks {
 
 		if ( WaterThermalTank( WaterThermalTankNum ).InletMode == InletModeFixed ) CalcNodeMassFlows( WaterThermalTankNum, InletModeFixed );
 
+		SubSteps = 0;
 		TimeRemaining = SecInTimeStep;
 		while ( TimeRemaining > 0.0 ) {
 
@@ -5856,7 +5888,6 @@ namespace WaterThermalTanks {
 
 				if ( WaterThermalTank( WaterThermalTankNum ).HeaterOn1 ) {
 					Qheater1 = WaterThermalTank( WaterThermalTankNum ).MaxCapacity;
-					Runtime1 += dt;
 				} else {
 					Qheater1 = 0.0;
 				}
@@ -5886,7 +5917,6 @@ namespace WaterThermalTanks {
 
 				if ( WaterThermalTank( WaterThermalTankNum ).HeaterOn2 ) {
 					Qheater2 = WaterThermalTank( WaterThermalTankNum ).MaxCapacity2;
-					Runtime2 += dt;
 				} else {
 					Qheater2 = 0.0;
 				}
@@ -5898,8 +5928,6 @@ namespace WaterThermalTanks {
 			}
 
 			if ( WaterThermalTank( WaterThermalTankNum ).HeaterOn1 || WaterThermalTank( WaterThermalTankNum ).HeaterOn2 ) {
-				Runtime += dt;
-
 				Qfuel = ( Qheater1 + Qheater2 ) / WaterThermalTank( WaterThermalTankNum ).Efficiency;
 				Qoncycfuel = WaterThermalTank( WaterThermalTankNum ).OnCycParaLoad;
 				Qoffcycfuel = 0.0;
@@ -5909,80 +5937,165 @@ namespace WaterThermalTanks {
 				Qoffcycfuel = WaterThermalTank( WaterThermalTankNum ).OffCycParaLoad;
 			}
 
-			// Loop through all nodes and simulate heat balance
-			for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
-				NodeMass = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).Mass;
-				NodeTemp = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).Temp;
+			if ( WaterThermalTank( WaterThermalTankNum ).NodeSolver == NodeSolverImplicit ) {
+				// The sub-step is shortened until the local error is within tolerance, and then to end at the first
+				// thermostat crossing of an element (rounded up to whole seconds, which is when the explicit method
+				// switches the element), so that the element states are constant within the sub-step.
+				dt = min( max( WaterThermalTank( WaterThermalTankNum ).NodeSubStep, NodeSolverMinStep ), TimeRemaining );
+				while ( true ) {
+					StepError = CalcStratifiedNodesImplicit( WaterThermalTankNum, dt, Cp, Qheater1, Qheater2 );
+					if ( ( StepError > NodeSolverTempTol ) && ( dt > NodeSolverMinStep ) ) {
+						dt = max( dt * max( 0.2, 0.9 * std::sqrt( NodeSolverTempTol / StepError ) ), NodeSolverMinStep );
+						continue;
+					}
 
-				UseMassFlowRate = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).UseMassFlowRate * WaterThermalTank( WaterThermalTankNum ).UseEffectiveness;
-				SourceMassFlowRate = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).SourceMassFlowRate * WaterThermalTank( WaterThermalTankNum ).SourceEffectiveness;
+					CrossTime = dt;
+					if ( ! WaterThermalTank( WaterThermalTankNum ).IsChilledWaterTank ) {
+						if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacity > 0.0 ) {
+							NodeNum = WaterThermalTank( WaterThermalTankNum ).HeaterNode1;
+							CrossTime = min( CrossTime, ThermostatCrossingTime( dt, WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).Temp, WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).NewTemp, WaterThermalTank( WaterThermalTankNum ).HeaterOn1, SetPointTemp1, MinTemp1 ) );
+						}
+						if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacity2 > 0.0 ) {
+							if ( ! ( ( WaterThermalTank( WaterThermalTankNum ).ControlType == PriorityMasterSlave ) && WaterThermalTank( WaterThermalTankNum ).HeaterOn1 ) ) {
+								NodeNum = WaterThermalTank( WaterThermalTankNum ).HeaterNode2;
+								CrossTime = min( CrossTime, ThermostatCrossingTime( dt, WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).Temp, WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).NewTemp, WaterThermalTank( WaterThermalTankNum ).HeaterOn2, SetPointTemp2, MinTemp2 ) );
+							}
+						}
+					}
+					CrossTime = min( max( std::ceil( CrossTime ), NodeSolverMinStep ), dt );
+					if ( CrossTime < dt ) {
+						dt = CrossTime;
+						continue;
+					}
+					break;
+				}
+				WaterThermalTank( WaterThermalTankNum ).NodeSubStep = dt * min( 2.0, 0.9 * std::sqrt( NodeSolverTempTol / max( StepError, 0.01 * NodeSolverTempTol ) ) );
 
-				// Heat transfer due to fluid flow entering an inlet node
-				Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
-				Qsource = SourceMassFlowRate * Cp * ( SourceInletTemp - NodeTemp );
+				// Energy flows at the end of the sub-step temperatures, consistent with the implicit balance
+				for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+					NodeMass = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).Mass;
+					NodeTemp = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).NewTemp;
 
-				InvMixUp = 0.0;
-				if ( NodeNum > 1 ) {
-					TempUp = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum - 1 ).Temp;
-					if ( TempUp < NodeTemp ) InvMixUp = WaterThermalTank( WaterThermalTankNum ).InversionMixingRate;
-				}
+					UseMassFlowRate = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).UseMassFlowRate * WaterThermalTank( WaterThermalTankNum ).UseEffectiveness;
+					SourceMassFlowRate = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).SourceMassFlowRate * WaterThermalTank( WaterThermalTankNum ).SourceEffectiveness;
 
-				InvMixDn = 0.0;
-				if ( NodeNum < NumNodes ) {
-					TempDn = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum + 1 ).Temp;
-					if ( TempDn > NodeTemp ) InvMixDn = WaterThermalTank( WaterThermalTankNum ).InversionMixingRate;
-				}
+					Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
+					Qsource = SourceMassFlowRate * Cp * ( SourceInletTemp - NodeTemp );
 
-				// Heat transfer due to vertical conduction between nodes
-				Qcond = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).CondCoeffUp * ( TempUp - NodeTemp ) + WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).CondCoeffDn * ( TempDn - NodeTemp );
+					if ( WaterThermalTank( WaterThermalTankNum ).HeaterOn1 || WaterThermalTank( WaterThermalTankNum ).HeaterOn2 ) {
+						Qloss = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OnCycLossCoeff * ( AmbientTemp - NodeTemp );
+						Qoncycheat = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OnCycParaLoad * WaterThermalTank( WaterThermalTankNum ).OnCycParaFracToTank;
+						Qneeded = max( -Quse - Qsource - Qloss - Qoncycheat, 0.0 );
+					} else {
+						Qloss = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OffCycLossCoeff * ( AmbientTemp - NodeTemp );
+						Qoffcycheat = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OffCycParaLoad * WaterThermalTank( WaterThermalTankNum ).OffCycParaFracToTank;
+						Qneeded = max( -Quse - Qsource - Qloss - Qoffcycheat, 0.0 );
+					}
+					Qlosszone = Qloss * WaterThermalTank( WaterThermalTankNum ).SkinLossFracToZone;
 
-				// Heat transfer due to fluid flow between inlet and outlet nodes
-				Qflow = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).MassFlowFromUpper * Cp * ( TempUp - NodeTemp ) + WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).MassFlowFromLower * Cp * ( TempDn - NodeTemp );
+					Qunmet = max( Qneeded - Qheater1 - Qheater2, 0.0 );
 
-				// Heat transfer due to temperature inversion mixing between nodes
-				Qmix = InvMixUp * Cp * ( TempUp - NodeTemp ) + InvMixDn * Cp * ( TempDn - NodeTemp );
+					if ( ! WaterThermalTank( WaterThermalTankNum ).IsChilledWaterTank ) {
+						if ( ( NodeNum == 1 ) && ( NodeTemp > MaxTemp ) ) {
+							Event += NodeMass * Cp * ( MaxTemp - NodeTemp );
+							WaterThermalTank( WaterThermalTankNum ).Node( 1 ).NewTemp = MaxTemp;
+						}
+					}
 
-				if ( WaterThermalTank( WaterThermalTankNum ).HeaterOn1 || WaterThermalTank( WaterThermalTankNum ).HeaterOn2 ) {
-					LossCoeff = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OnCycLossCoeff;
-					Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
-					Qlosszone = Qloss * WaterThermalTank( WaterThermalTankNum ).SkinLossFracToZone;
-					Qoncycheat = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OnCycParaLoad * WaterThermalTank( WaterThermalTankNum ).OnCycParaFracToTank;
+					Euse += Quse * dt;
+					Esource += Qsource * dt;
+					Eloss += Qloss * dt;
+					Elosszone += Qlosszone * dt;
+					Eneeded += Qneeded * dt;
+					Eunmet += Qunmet * dt;
 
-					Qneeded = max( -Quse - Qsource - Qloss - Qoncycheat, 0.0 );
+				} // NodeNum
 
-					Qheat = Qoncycheat;
-					if ( NodeNum == WaterThermalTank( WaterThermalTankNum ).HeaterNode1 ) Qheat += Qheater1;
-					if ( NodeNum == WaterThermalTank( WaterThermalTankNum ).HeaterNode2 ) Qheat += Qheater2;
-				} else {
-					LossCoeff = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OffCycLossCoeff;
-					Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
-					Qlosszone = Qloss * WaterThermalTank( WaterThermalTankNum ).SkinLossFracToZone;
-					Qoffcycheat = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OffCycParaLoad * WaterThermalTank( WaterThermalTankNum ).OffCycParaFracToTank;
+			} else {
+				dt = ExplicitStep;
 
-					Qneeded = max( -Quse - Qsource - Qloss - Qoffcycheat, 0.0 );
-					Qheat = Qoffcycheat;
-				}
+				// Loop through all nodes and simulate heat balance
+				for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+					NodeMass = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).Mass;
+					NodeTemp = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).Temp;
 
-				Qunmet = max( Qneeded - Qheater1 - Qheater2, 0.0 );
+					UseMassFlowRate = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).UseMassFlowRate * WaterThermalTank( WaterThermalTankNum ).UseEffectiveness;
+					SourceMassFlowRate = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).SourceMassFlowRate * WaterThermalTank( WaterThermalTankNum ).SourceEffectiveness;
 
-				// Calculate node heat balance
-				WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).NewTemp = NodeTemp + ( Quse + Qsource + Qcond + Qflow + Qmix + Qloss + Qheat ) * dt / ( NodeMass * Cp );
+					// Heat transfer due to fluid flow entering an inlet node
+					Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
+					Qsource = SourceMassFlowRate * Cp * ( SourceInletTemp - NodeTemp );
 
-				if ( ! WaterThermalTank( WaterThermalTankNum ).IsChilledWaterTank ) {
-					if ( ( NodeNum == 1 ) && ( WaterThermalTank( WaterThermalTankNum ).Node( 1 ).NewTemp > MaxTemp ) ) {
-						Event += NodeMass * Cp * ( MaxTemp - WaterThermalTank( WaterThermalTankNum ).Node( 1 ).NewTemp );
-						WaterThermalTank( WaterThermalTankNum ).Node( 1 ).NewTemp = MaxTemp;
+					InvMixUp = 0.0;
+					if ( NodeNum > 1 ) {
+						TempUp = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum - 1 ).Temp;
+						if ( TempUp < NodeTemp ) InvMixUp = WaterThermalTank( WaterThermalTankNum ).InversionMixingRate;
 					}
-				}
 
-				Euse += Quse * dt;
-				Esource += Qsource * dt;
-				Eloss += Qloss * dt;
-				Elosszone += Qlosszone * dt;
-				Eneeded += Qneeded * dt;
-				Eunmet += Qunmet * dt;
+					InvMixDn = 0.0;
+					if ( NodeNum < NumNodes ) {
+						TempDn = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum + 1 ).Temp;
+						if ( TempDn > NodeTemp ) InvMixDn = WaterThermalTank( WaterThermalTankNum ).InversionMixingRate;
+					}
 
-			} // NodeNum
+					// Heat transfer due to vertical conduction between nodes
+					Qcond = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).CondCoeffUp * ( TempUp - NodeTemp ) + WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).CondCoeffDn * ( TempDn - NodeTemp );
+
+					// Heat transfer due to fluid flow between inlet and outlet nodes
+					Qflow = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).MassFlowFromUpper * Cp * ( TempUp - NodeTemp ) + WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).MassFlowFromLower * Cp * ( TempDn - NodeTemp );
+
+					// Heat transfer due to temperature inversion mixing between nodes
+					Qmix = InvMixUp * Cp * ( TempUp - NodeTemp ) + InvMixDn * Cp * ( TempDn - NodeTemp );
+
+					if ( WaterThermalTank( WaterThermalTankNum ).HeaterOn1 || WaterThermalTank( WaterThermalTankNum ).HeaterOn2 ) {
+						LossCoeff = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OnCycLossCoeff;
+						Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
+						Qlosszone = Qloss * WaterThermalTank( WaterThermalTankNum ).SkinLossFracToZone;
+						Qoncycheat = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OnCycParaLoad * WaterThermalTank( WaterThermalTankNum ).OnCycParaFracToTank;
+
+						Qneeded = max( -Quse - Qsource - Qloss - Qoncycheat, 0.0 );
+
+						Qheat = Qoncycheat;
+						if ( NodeNum == WaterThermalTank( WaterThermalTankNum ).HeaterNode1 ) Qheat += Qheater1;
+						if ( NodeNum == WaterThermalTank( WaterThermalTankNum ).HeaterNode2 ) Qheat += Qheater2;
+					} else {
+						LossCoeff = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OffCycLossCoeff;
+						Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
+						Qlosszone = Qloss * WaterThermalTank( WaterThermalTankNum ).SkinLossFracToZone;
+						Qoffcycheat = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OffCycParaLoad * WaterThermalTank( WaterThermalTankNum ).OffCycParaFracToTank;
+
+						Qneeded = max( -Quse - Qsource - Qloss - Qoffcycheat, 0.0 );
+						Qheat = Qoffcycheat;
+					}
+
+					Qunmet = max( Qneeded - Qheater1 - Qheater2, 0.0 );
+
+					// Calculate node heat balance
+					WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).NewTemp = NodeTemp + ( Quse + Qsource + Qcond + Qflow + Qmix + Qloss + Qheat ) * dt / ( NodeMass * Cp );
+
+					if ( ! WaterThermalTank( WaterThermalTankNum ).IsChilledWaterTank ) {
+						if ( ( NodeNum == 1 ) && ( WaterThermalTank( WaterThermalTankNum ).Node( 1 ).NewTemp > MaxTemp ) ) {
+							Event += NodeMass * Cp * ( MaxTemp - WaterThermalTank( WaterThermalTankNum ).Node( 1 ).NewTemp );
+							WaterThermalTank( WaterThermalTankNum ).Node( 1 ).NewTemp = MaxTemp;
+						}
+					}
+
+					Euse += Quse * dt;
+					Esource += Qsource * dt;
+					Eloss += Qloss * dt;
+					Elosszone += Qlosszone * dt;
+					Eneeded += Qneeded * dt;
+					Eunmet += Qunmet * dt;
+
+				} // NodeNum
+
+			}
+
+			if ( ! WaterThermalTank( WaterThermalTankNum ).IsChilledWaterTank ) {
+				if ( WaterThermalTank( WaterThermalTankNum ).HeaterOn1 ) Runtime1 += dt;
+				if ( WaterThermalTank( WaterThermalTankNum ).HeaterOn2 ) Runtime2 += dt;
+			}
+			if ( WaterThermalTank( WaterThermalTankNum ).HeaterOn1 || WaterThermalTank( WaterThermalTankNum ).HeaterOn2 ) Runtime += dt;
 
 			// Calculation for standard ratings
 			if ( ! WaterThermalTank( WaterThermalTankNum ).FirstRecoveryDone ) {
@@ -5995,9 +6108,12 @@ namespace WaterThermalTanks {
 			WaterThermalTank( WaterThermalTankNum ).Node.TempSum() += WaterThermalTank( WaterThermalTankNum ).Node.Temp() * dt;
 
 			TimeRemaining -= dt;
+			++SubSteps;
 
 		} // TimeRemaining > 0.0
 
+		WaterThermalTank( WaterThermalTankNum ).SubSteps = SubSteps;
+
 		Eheater1 = WaterThermalTank( WaterThermalTankNum ).MaxCapacity * Runtime1;
 		Eheater2 = WaterThermalTank( WaterThermalTankNum ).MaxCapacity2 * Runtime2;
 		Efuel = ( Eheater1 + Eheater2 ) / WaterThermalTank( WaterThermalTankNum ).Efficiency;
@@ -6080,6 +6196,150 @@ namespace WaterThermalTanks {
 
 	}
 
+	Real64
+	CalcStratifiedNodesImplicit(
+		int const WaterThermalTankNum, // Water Heater being simulated
+		Real64 const dt, // Sub-step (s)
+		Real64 const Cp, // Specific heat of water (J/kg K)
+		Real64 const Qheater1, // Heating rate of heater 1 (W)
+		Real64 const Qheater2 // Heating rate of heater 2 (W)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Calculates the node temperatures (Node%NewTemp) of a stratified tank at the end of one sub-step with the
+		// backward Euler method and returns an estimate of the local error of the step.
+
+		// METHODOLOGY EMPLOYED:
+		// A node only exchanges heat with the nodes directly above and below it, so the implicit node heat balance
+		// is a tridiagonal system, solved directly with the Thomas algorithm.  Flow rates, inversion mixing, loss
+		// coefficients and heater input are taken at the start of the sub-step as in the explicit method.  The
+		// local error is estimated as half of the largest difference between the implicit and the explicit (forward
+		// Euler) temperature change of a node.
+
+		// Return value
+		Real64 StepError; // Estimated local error of the node temperatures (C)
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		static FArray1D< Real64 > CoeffUp; // Conductance to the node above (W/K)
+		static FArray1D< Real64 > CoeffDn; // Conductance to the node below (W/K)
+		static FArray1D< Real64 > Diag; // Diagonal of the node balance (W/K)
+		static FArray1D< Real64 > RHS; // Right hand side of the node balance (W)
+		int NumNodes; // Number of stratified nodes
+		int NodeNum; // Node number index
+		Real64 NodeTemp; // Node temperature at the start of the sub-step (C)
+		Real64 Capacitance; // Heat capacity of a node divided by the sub-step (W/K)
+		Real64 CoeffIn; // Conductance to the use and source inlets and the ambient (W/K)
+		Real64 Qin; // Heating rate from the inlets, the ambient and the heaters at zero node temperature (W)
+		Real64 Rate; // Explicit rate of change of a node temperature (K/s)
+		Real64 Factor; // Elimination factor
+
+		NumNodes = WaterThermalTank( WaterThermalTankNum ).Nodes;
+		if ( isize( Diag ) < NumNodes ) {
+			CoeffUp.allocate( NumNodes );
+			CoeffDn.allocate( NumNodes );
+			Diag.allocate( NumNodes );
+			RHS.allocate( NumNodes );
+		}
+
+		StepError = 0.0;
+		for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+			NodeTemp = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).Temp;
+
+			CoeffUp( NodeNum ) = 0.0;
+			if ( NodeNum > 1 ) {
+				CoeffUp( NodeNum ) = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).CondCoeffUp + WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).MassFlowFromUpper * Cp;
+				if ( WaterThermalTank( WaterThermalTankNum ).Node( NodeNum - 1 ).Temp < NodeTemp ) CoeffUp( NodeNum ) += WaterThermalTank( WaterThermalTankNum ).InversionMixingRate * Cp;
+			}
+
+			CoeffDn( NodeNum ) = 0.0;
+			if ( NodeNum < NumNodes ) {
+				CoeffDn( NodeNum ) = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).CondCoeffDn + WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).MassFlowFromLower * Cp;
+				if ( WaterThermalTank( WaterThermalTankNum ).Node( NodeNum + 1 ).Temp > NodeTemp ) CoeffDn( NodeNum ) += WaterThermalTank( WaterThermalTankNum ).InversionMixingRate * Cp;
+			}
+
+			CoeffIn = ( WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).UseMassFlowRate * WaterThermalTank( WaterThermalTankNum ).UseEffectiveness + WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).SourceMassFlowRate * WaterThermalTank( WaterThermalTankNum ).SourceEffectiveness ) * Cp;
+			Qin = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).UseMassFlowRate * WaterThermalTank( WaterThermalTankNum ).UseEffectiveness * Cp * WaterThermalTank( WaterThermalTankNum ).UseInletTemp + WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).SourceMassFlowRate * WaterThermalTank( WaterThermalTankNum ).SourceEffectiveness * Cp * WaterThermalTank( WaterThermalTankNum ).SourceInletTemp;
+			if ( WaterThermalTank( WaterThermalTankNum ).HeaterOn1 || WaterThermalTank( WaterThermalTankNum ).HeaterOn2 ) {
+				CoeffIn += WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OnCycLossCoeff;
+				Qin += WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OnCycLossCoeff * WaterThermalTank( WaterThermalTankNum ).AmbientTemp + WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OnCycParaLoad * WaterThermalTank( WaterThermalTankNum ).OnCycParaFracToTank;
+				if ( NodeNum == WaterThermalTank( WaterThermalTankNum ).HeaterNode1 ) Qin += Qheater1;
+				if ( NodeNum == WaterThermalTank( WaterThermalTankNum ).HeaterNode2 ) Qin += Qheater2;
+			} else {
+				CoeffIn += WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OffCycLossCoeff;
+				Qin += WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OffCycLossCoeff * WaterThermalTank( WaterThermalTankNum ).AmbientTemp + WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).OffCycParaLoad * WaterThermalTank( WaterThermalTankNum ).OffCycParaFracToTank;
+			}
+
+			Capacitance = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).Mass * Cp / dt;
+			Diag( NodeNum ) = Capacitance + CoeffIn + CoeffUp( NodeNum ) + CoeffDn( NodeNum );
+			RHS( NodeNum ) = Capacitance * NodeTemp + Qin;
+
+			// Explicit temperature change, kept in NewTemp until the implicit solution overwrites it
+			Rate = Qin - CoeffIn * NodeTemp;
+			if ( NodeNum > 1 ) Rate += CoeffUp( NodeNum ) * ( WaterThermalTank( WaterThermalTankNum ).Node( NodeNum - 1 ).Temp - NodeTemp );
+			if ( NodeNum < NumNodes ) Rate += CoeffDn( NodeNum ) * ( WaterThermalTank( WaterThermalTankNum ).Node( NodeNum + 1 ).Temp - NodeTemp );
+			WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).NewTemp = Rate / Capacitance;
+		}
+
+		// Forward elimination (top to bottom), then back substitution
+		for ( NodeNum = 2; NodeNum <= NumNodes; ++NodeNum ) {
+			Factor = CoeffUp( NodeNum ) / Diag( NodeNum - 1 );
+			Diag( NodeNum ) -= Factor * CoeffDn( NodeNum - 1 );
+			RHS( NodeNum ) += Factor * RHS( NodeNum - 1 );
+		}
+		for ( NodeNum = NumNodes; NodeNum >= 1; --NodeNum ) {
+			if ( NodeNum < NumNodes ) RHS( NodeNum ) += CoeffDn( NodeNum ) * RHS( NodeNum + 1 );
+			RHS( NodeNum ) /= Diag( NodeNum );
+
+			NodeTemp = WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).Temp;
+			StepError = max( StepError, 0.5 * std::abs( RHS( NodeNum ) - NodeTemp - WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).NewTemp ) );
+			WaterThermalTank( WaterThermalTankNum ).Node( NodeNum ).NewTemp = RHS( NodeNum );
+		}
+
+		return StepError;
+
+	}
+
+	Real64
+	ThermostatCrossingTime(
+		Real64 const dt, // Sub-step (s)
+		Real64 const TempStart, // Heater node temperature at the start of the sub-step (C)
+		Real64 const TempEnd, // Heater node temperature at the end of the sub-step (C)
+		bool const HeaterOn, // Heater element state during the sub-step
+		Real64 const SetPointTemp, // Temperature at or above which the element is switched off (C)
+		Real64 const MinTemp // Temperature below which the element is switched on (C)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the time into a sub-step at which the heater node reaches the temperature that switches the
+		// element, by linear interpolation, or the full sub-step if the element is not switched.
+
+		if ( HeaterOn ) {
+			if ( ( TempStart < SetPointTemp ) && ( TempEnd >= SetPointTemp ) ) {
+				return dt * ( SetPointTemp - TempStart ) / ( TempEnd - TempStart );
+			}
+		} else {
+			if ( ( TempStart >= MinTemp ) && ( TempEnd < MinTemp ) ) {
+				return dt * ( TempStart - MinTemp ) / ( TempStart - TempEnd );
+			}
+		}
+		return dt;
+
+	}
+
 	void
 	CalcNodeMassFlows(
 		int const WaterThermalTankNum, // Water Heater being simulated
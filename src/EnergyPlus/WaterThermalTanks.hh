@@ -50,6 +50,11 @@ namespace WaterThermalTanks {
 	extern int const InletModeFixed; // water heater only, inlet water always enters at the user-specified height
 	extern int const InletModeSeeking; // water heater only, inlet water seeks out the node with the closest temperature
 
+	extern int const NodeSolverExplicit; // stratified tank only, forward Euler node balance with one second sub-steps
+	extern int const NodeSolverImplicit; // stratified tank only, backward Euler node balance with adaptive sub-steps
+	extern Real64 const NodeSolverTempTol; // Allowed local error of a node temperature in one implicit sub-step (C)
+	extern Real64 const NodeSolverMinStep; // Smallest implicit sub-step (s)
+
 	// integer parameter for water heater
 	extern int const MixedWaterHeater; // WaterHeater:Mixed
 	extern int const StratifiedWaterHeater; // WaterHeater:Stratified
@@ -444,6 +449,8 @@ namespace WaterThermalTanks {
 		int SourceOutletStratNode; // Source-side outlet node number
 		int InletMode; // Inlet position mode:  1 = FIXED; 2 = SEEKING
 		Real64 InversionMixingRate;
+		int NodeSolver; // Node solution method:  1 = EXPLICIT; 2 = IMPLICITADAPTIVE
+		Real64 NodeSubStep; // Last accepted sub-step of the implicit node solution (s)
 		FArray1D< Real64 > AdditionalLossCoeff; // Loss coefficient added to the skin loss coefficient (W/m2-K)
 		int Nodes; // Number of nodes
 		FArray1D< StratifiedNodeData > Node; // Array of node data
@@ -471,6 +478,7 @@ namespace WaterThermalTanks {
 		int CycleOnCount; // Number of times heater cycles on in the current time step
 		int CycleOnCount1; // Number of times heater 1 cycles on in the current time step
 		int CycleOnCount2; // Number of times heater 2 cycles on in the current time step
+		int SubSteps; // Number of node solution sub-steps taken in the current time step
 		Real64 RuntimeFraction; // Runtime fraction, fraction of timestep that any  heater is running
 		Real64 RuntimeFraction1; // Runtime fraction, fraction of timestep that heater 1 is running
 		Real64 RuntimeFraction2; // Runtime fraction, fraction of timestep that heater 2 is running
@@ -617,6 +625,8 @@ namespace WaterThermalTanks {
 			SourceOutletStratNode( 0 ),
 			InletMode( 1 ),
 			InversionMixingRate( 0.0 ),
+			NodeSolver( 1 ),
+			NodeSubStep( 60.0 ),
 			Nodes( 0 ),
 			VolFlowRate( 0.0 ),
 			VolumeConsumed( 0.0 ),
@@ -641,6 +651,7 @@ namespace WaterThermalTanks {
 			CycleOnCount( 0 ),
 			CycleOnCount1( 0 ),
 			CycleOnCount2( 0 ),
+			SubSteps( 0 ),
 			RuntimeFraction( 0.0 ),
 			RuntimeFraction1( 0.0 ),
 			RuntimeFraction2( 0.0 ),
@@ -793,6 +804,8 @@ namespace WaterThermalTanks {
 			int const SourceOutletStratNode, // Source-side outlet node number
 			int const InletMode, // Inlet position mode:  1 = FIXED; 2 = SEEKING
 			Real64 const InversionMixingRate,
+			int const NodeSolver, // Node solution method:  1 = EXPLICIT; 2 = IMPLICITADAPTIVE
+			Real64 const NodeSubStep, // Last accepted sub-step of the implicit node solution (s)
 			FArray1< Real64 > const & AdditionalLossCoeff, // Loss coefficient added to the skin loss coefficient (W/m2-K)
 			int const Nodes, // Number of nodes
 			FArray1< StratifiedNodeData > const & Node, // Array of node data
@@ -819,6 +832,7 @@ namespace WaterThermalTanks {
 			int const CycleOnCount, // Number of times heater cycles on in the current time step
 			int const CycleOnCount1, // Number of times heater 1 cycles on in the current time step
 			int const CycleOnCount2, // Number of times heater 2 cycles on in the current time step
+			int const SubSteps, // Number of node solution sub-steps taken in the current time step
 			Real64 const RuntimeFraction, // Runtime fraction, fraction of timestep that any  heater is running
 			Real64 const RuntimeFraction1, // Runtime fraction, fraction of timestep that heater 1 is running
 			Real64 const RuntimeFraction2, // Runtime fraction, fraction of timestep that heater 2 is running
@@ -969,6 +983,8 @@ namespace WaterThermalTanks {
 			SourceOutletStratNode( SourceOutletStratNode ),
 			InletMode( InletMode ),
 			InversionMixingRate( InversionMixingRate ),
+			NodeSolver( NodeSolver ),
+			NodeSubStep( NodeSubStep ),
 			AdditionalLossCoeff( AdditionalLossCoeff ),
 			Nodes( Nodes ),
 			Node( Node ),
@@ -995,6 +1011,7 @@ namespace WaterThermalTanks {
 			CycleOnCount( CycleOnCount ),
 			CycleOnCount1( CycleOnCount1 ),
 			CycleOnCount2( CycleOnCount2 ),
+			SubSteps( SubSteps ),
 			RuntimeFraction( RuntimeFraction ),
 			RuntimeFraction1( RuntimeFraction1 ),
 			RuntimeFraction2( RuntimeFraction2 ),
@@ -1748,6 +1765,25 @@ namespace WaterThermalTanks {
 	void
 	CalcWaterThermalTankStratified( int const WaterThermalTankNum ); // Water Heater being simulated
 
+	Real64
+	CalcStratifiedNodesImplicit(
+		int const WaterThermalTankNum, // Water Heater being simulated
+		Real64 const dt, // Sub-step (s)
+		Real64 const Cp, // Specific heat of water (J/kg K)
+		Real64 const Qheater1, // Heating rate of heater 1 (W)
+		Real64 const Qheater2 // Heating rate of heater 2 (W)
+	);
+
+	Real64
+	ThermostatCrossingTime(
+		Real64 const dt, // Sub-step (s)
+		Real64 const TempStart, // Heater node temperature at the start of the sub-step (C)
+		Real64 const TempEnd, // Heater node temperature at the end of the sub-step (C)
+		bool const HeaterOn, // Heater element state during the sub-step
+		Real64 const SetPointTemp, // Temperature at or above which the element is switched off (C)
+		Real64 const MinTemp // Temperature below which the element is switched on (C)
+	);
+
 	void
 	CalcNodeMassFlows(
 		int const WaterThermalTankNum, // Water Heater being simulated
@@ -1,11 +1,13 @@
 // C++ Headers
 #include <cmath>
 #include <cstdint>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
 #include <ObjexxFCL/FArrayS.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
+#include <ObjexxFCL/gio.hh>
 
 // EnergyPlus Headers
 #include <WindowComplexManager.hh>
@@ -98,6 +100,14 @@ namespace WindowComplexManager {
 	int const Back_Transmitted( 5 );
 	int const Back_Reflected( 6 );
 
+	int const TARCOGCacheSize( 8 ); // Solutions kept for each window by the TARCOG result cache
+	Real64 const TARCOGCacheTempStep( 0.01 ); // Quantization of cache key temperatures [K]
+	Real64 const TARCOGCacheFluxStep( 0.1 ); // Quantization of cache key radiation and absorbed solar [W/m2]
+	Real64 const TARCOGCacheSpeedStep( 0.01 ); // Quantization of cache key wind speed [m/s]
+	Real64 const TARCOGCacheCoefStep( 0.01 ); // Quantization of cache key film coefficients [W/m2-K]
+	Real64 const TARCOGCacheFractionStep( 0.001 ); // Quantization of cache key clear sky fraction
+	Real64 const TARCOGCachePressureStep( 1.0 ); // Quantization of cache key pressure [Pa]
+
 	// DERIVED TYPE DEFINITIONS:
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -110,6 +120,10 @@ namespace WindowComplexManager {
 	Real64 DdbgTheta;
 	Real64 DdbgPhi;
 	//EndDebug
+	FArray1D_int GndObstrSurf; // Exterior and shading surfaces that can shade a ground point
+	FArray3D_int SunGndObstrSurf; // Surfaces of GndObstrSurf facing a ground point (surface, hour, timestep)
+	FArray2D_int NumSunGndObstrSurf; // Number of surfaces in SunGndObstrSurf (hour, timestep)
+	FArray2D< Vector > SunGndObstrDir; // Sun direction SunGndObstrSurf was listed for (hour, timestep)
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowComplexManager:
 
@@ -117,6 +131,7 @@ namespace WindowComplexManager {
 	FArray1D< BasisStruct > BasisList;
 	FArray1D< WindowIndex > WindowList;
 	FArray2D< WindowStateIndex > WindowStateList;
+	FArray1D< TARCOGWindowCache > TARCOGCache; // TARCOG result cache of each window (surface number)
 
 	// Functions
 
@@ -400,6 +415,25 @@ namespace WindowComplexManager {
 
 			} //State loop
 		} //Complex Window loop
+		//  States of a window that see the same ground points share the ground point shading, which is then
+		//   traced once for the window rather than once for each state
+		for ( IWind = 1; IWind <= NumComplexWind; ++IWind ) {
+			ISurf = WindowList( IWind ).SurfNo;
+			NumStates = WindowList( IWind ).NumStates;
+			for ( IState = 2; IState <= NumStates; ++IState ) {
+				for ( J = 1; J <= IState - 1; ++J ) {
+					if ( ComplexWind( ISurf ).Geom( J ).GndPtSourceState > 0 ) continue;
+					if ( ComplexWind( ISurf ).Geom( J ).NGnd != ComplexWind( ISurf ).Geom( IState ).NGnd ) continue;
+					for ( K = 1; K <= ComplexWind( ISurf ).Geom( IState ).NGnd; ++K ) {
+						if ( ComplexWind( ISurf ).Geom( J ).GndPt( K ).x != ComplexWind( ISurf ).Geom( IState ).GndPt( K ).x ) break;
+						if ( ComplexWind( ISurf ).Geom( J ).GndPt( K ).y != ComplexWind( ISurf ).Geom( IState ).GndPt( K ).y ) break;
+					}
+					if ( K <= ComplexWind( ISurf ).Geom( IState ).NGnd ) continue;
+					ComplexWind( ISurf ).Geom( IState ).GndPtSourceState = J;
+					break;
+				}
+			} //State loop
+		} //Complex Window loop
 		//  Allocate all beam-dependent complex fenestration quantities
 		for ( IWind = 1; IWind <= NumComplexWind; ++IWind ) {
 			ISurf = WindowList( IWind ).SurfNo;
@@ -812,23 +846,14 @@ namespace WindowComplexManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 DotProd( 0.0 ); // temporary variable for testing dot products
-		int I; // general purpose index
 		int IncRay; // Index of incident ray corresponding to beam direction
 		Real64 Theta; // Theta angle of incident ray correspongind to beam direction
 		Real64 Phi; // Phi angle of incident ray correspongind to beam direction
-		static int IHit( 0 ); // hit flag
-		int J; // general purpose index
-		int JSurf; // general purpose surface number
-		int K; // general purpose index
 		int Hour; // hour of day
-		int TotHits; // hit counter
 		int TS; // time step
 
 		// Object Data
 		static Vector SunDir( 0.0, 0.0, 1.0 ); // unit vector pointing toward sun (world CS)
-		static Vector Posit( 0.0, 0.0, 1.0 ); // vector location of current ground point
-		static Vector HitPt( 0.0, 0.0, 1.0 ); // vector location of ray intersection with a surface
 
 		if ( KickOffSizing || KickOffSimulation ) return;
 
@@ -854,30 +879,7 @@ namespace WindowComplexManager {
 						//Window can't be sunlit, set front incidence ray index to zero
 						ComplexWind( iSurf ).Geom( iState ).SolBmIndex( Hour, TS ) = 0;
 					}
-					for ( I = 1; I <= ComplexWind( iSurf ).Geom( iState ).NGnd; ++I ) { //Gnd pt loop
-						IHit = 0;
-						TotHits = 0;
-						for ( JSurf = 1; JSurf <= TotSurfaces; ++JSurf ) {
-							// the following test will cycle on anything except exterior surfaces and shading surfaces
-							if ( Surface( JSurf ).HeatTransSurf && Surface( JSurf ).ExtBoundCond != ExternalEnvironment ) continue;
-							//  skip surfaces that face away from the ground point
-							DotProd = dot( SunDir, Surface( JSurf ).NewellSurfaceNormalVector );
-							if ( DotProd >= 0.0 ) continue;
-							//Looking for surfaces between GndPt and sun
-							PierceSurfaceVector( JSurf, ComplexWind( iSurf ).Geom( iState ).GndPt( I ), SunDir, IHit, HitPt );
-							if ( IHit == 0 ) continue;
-							//  Are not going into the details of whether a hit surface is transparent
-							//  Since this is ultimately simply weighting the transmittance, so great
-							//  detail is not warranted
-							++TotHits;
-							break;
-						}
-						if ( TotHits > 0 ) {
-							ComplexWind( iSurf ).Geom( iState ).SolBmGndWt( I, Hour, TS ) = 0.0;
-						} else {
-							ComplexWind( iSurf ).Geom( iState ).SolBmGndWt( I, Hour, TS ) = 1.0;
-						}
-					} // Gnd pt loop
+					CalcGroundBeamWeights( iSurf, iState, SunDir, Hour, TS );
 
 					// update window beam properties
 					CalculateWindowBeamProperties( iSurf, iState, ComplexWind( iSurf ), ComplexWind( iSurf ).Geom( iState ), SurfaceWindow( iSurf ).ComplexFen.State( iState ), Hour, TS );
@@ -904,30 +906,7 @@ namespace WindowComplexManager {
 				//Window can't be sunlit, set front incidence ray index to zero
 				ComplexWind( iSurf ).Geom( iState ).SolBmIndex( HourOfDay, TimeStep ) = 0.0;
 			}
-			for ( I = 1; I <= ComplexWind( iSurf ).Geom( iState ).NGnd; ++I ) { //Gnd pt loop
-				IHit = 0;
-				TotHits = 0;
-				for ( JSurf = 1; JSurf <= TotSurfaces; ++JSurf ) {
-					// the following test will cycle on anything except exterior surfaces and shading surfaces
-					if ( Surface( JSurf ).HeatTransSurf && Surface( JSurf ).ExtBoundCond != ExternalEnvironment ) continue;
-					//  skip surfaces that face away from the ground point
-					DotProd = dot( SunDir, Surface( JSurf ).NewellSurfaceNormalVector );
-					if ( DotProd >= 0.0 ) continue;
-					//Looking for surfaces between GndPt and sun
-					PierceSurfaceVector( JSurf, ComplexWind( iSurf ).Geom( iState ).GndPt( I ), SunDir, IHit, HitPt );
-					if ( IHit == 0 ) continue;
-					//  Are not going into the details of whether a hit surface is transparent
-					//  Since this is ultimately simply weighting the transmittance, so great
-					//  detail is not warranted
-					++TotHits;
-					break;
-				}
-				if ( TotHits > 0 ) {
-					ComplexWind( iSurf ).Geom( iState ).SolBmGndWt( I, HourOfDay, TimeStep ) = 0.0;
-				} else {
-					ComplexWind( iSurf ).Geom( iState ).SolBmGndWt( I, HourOfDay, TimeStep ) = 1.0;
-				}
-			} // Gnd pt loop
+			CalcGroundBeamWeights( iSurf, iState, SunDir, HourOfDay, TimeStep );
 
 			// Update window beam properties
 			CalculateWindowBeamProperties( iSurf, iState, ComplexWind( iSurf ), ComplexWind( iSurf ).Geom( iState ), SurfaceWindow( iSurf ).ComplexFen.State( iState ), HourOfDay, TimeStep );
@@ -935,6 +914,172 @@ namespace WindowComplexManager {
 
 	}
 
+	void
+	SetupGroundObstructions(
+		Vector const & SunDir, // Unit vector pointing toward sun (world CS)
+		int const Hour, // Hour number
+		int const TS // Timestep number
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Lists the surfaces that can lie between a ground point and the sun for the sun direction of an
+		// hour and timestep.
+
+		// METHODOLOGY EMPLOYED:
+		// The exterior and shading surfaces are found once. The ones facing away from the sun are listed for
+		// each hour and timestep and kept until the sun direction of that hour and timestep changes, so all the
+		// complex windows and states of a shading period share one list instead of testing every surface for
+		// every ground point.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int JSurf; // general purpose surface number
+		int K; // general purpose index
+		int NumObstr; // Number of exterior and shading surfaces
+
+		if ( ! allocated( GndObstrSurf ) ) {
+			NumObstr = 0;
+			for ( JSurf = 1; JSurf <= TotSurfaces; ++JSurf ) {
+				// the following test will cycle on anything except exterior surfaces and shading surfaces
+				if ( Surface( JSurf ).HeatTransSurf && Surface( JSurf ).ExtBoundCond != ExternalEnvironment ) continue;
+				++NumObstr;
+			}
+			GndObstrSurf.allocate( NumObstr );
+			NumObstr = 0;
+			for ( JSurf = 1; JSurf <= TotSurfaces; ++JSurf ) {
+				if ( Surface( JSurf ).HeatTransSurf && Surface( JSurf ).ExtBoundCond != ExternalEnvironment ) continue;
+				++NumObstr;
+				GndObstrSurf( NumObstr ) = JSurf;
+			}
+			SunGndObstrSurf.allocate( NumObstr, 24, NumOfTimeStepInHour );
+			NumSunGndObstrSurf.allocate( 24, NumOfTimeStepInHour );
+			SunGndObstrDir.allocate( 24, NumOfTimeStepInHour );
+			NumSunGndObstrSurf = 0;
+			SunGndObstrDir = Vector( 0.0, 0.0, 0.0 ); // never a sun direction, so every list is made on first use
+		}
+
+		if ( SunGndObstrDir( Hour, TS ).x == SunDir.x && SunGndObstrDir( Hour, TS ).y == SunDir.y && SunGndObstrDir( Hour, TS ).z == SunDir.z ) return;
+
+		SunGndObstrDir( Hour, TS ) = SunDir;
+		NumSunGndObstrSurf( Hour, TS ) = 0;
+		for ( K = 1; K <= isize( GndObstrSurf ); ++K ) {
+			JSurf = GndObstrSurf( K );
+			//  skip surfaces that face away from the ground point
+			if ( dot( SunDir, Surface( JSurf ).NewellSurfaceNormalVector ) >= 0.0 ) continue;
+			++NumSunGndObstrSurf( Hour, TS );
+			SunGndObstrSurf( NumSunGndObstrSurf( Hour, TS ), Hour, TS ) = JSurf;
+		}
+
+	}
+
+	void
+	CalcGroundBeamWeights(
+		int const iSurf, // Window surface number
+		int const iState, // Window state number
+		Vector const & SunDir, // Unit vector pointing toward sun (world CS)
+		int const Hour, // Hour number
+		int const TS // Timestep number
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the weights for beam radiation reflected from the ground points of a complex fenestration
+		// state: 1 if the ground point is sunlit, 0 if a surface lies between it and the sun.
+
+		// METHODOLOGY EMPLOYED:
+		// A state whose ground points are those of an earlier state of the same window (GndPtSourceState)
+		// copies the weights of that state, which UpdateComplexWindows has just found for the same sun.
+		// Otherwise each ground point is traced toward the sun through the surfaces of SetupGroundObstructions.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int I; // general purpose index
+		int IHit; // hit flag
+		int K; // general purpose index
+		int SourceState; // state whose ground point weights are copied
+		int TotHits; // hit counter
+
+		// Object Data
+		Vector HitPt; // vector location of ray intersection with a surface
+
+		SourceState = ComplexWind( iSurf ).Geom( iState ).GndPtSourceState;
+		if ( SourceState > 0 ) {
+			for ( I = 1; I <= ComplexWind( iSurf ).Geom( iState ).NGnd; ++I ) {
+				ComplexWind( iSurf ).Geom( iState ).SolBmGndWt( I, Hour, TS ) = ComplexWind( iSurf ).Geom( SourceState ).SolBmGndWt( I, Hour, TS );
+			}
+			return;
+		}
+
+		SetupGroundObstructions( SunDir, Hour, TS );
+		for ( I = 1; I <= ComplexWind( iSurf ).Geom( iState ).NGnd; ++I ) { //Gnd pt loop
+			IHit = 0;
+			TotHits = 0;
+			for ( K = 1; K <= NumSunGndObstrSurf( Hour, TS ); ++K ) {
+				//Looking for surfaces between GndPt and sun
+				PierceSurfaceVector( SunGndObstrSurf( K, Hour, TS ), ComplexWind( iSurf ).Geom( iState ).GndPt( I ), SunDir, IHit, HitPt );
+				if ( IHit == 0 ) continue;
+				//  Are not going into the details of whether a hit surface is transparent
+				//  Since this is ultimately simply weighting the transmittance, so great
+				//  detail is not warranted
+				++TotHits;
+				break;
+			}
+			if ( TotHits > 0 ) {
+				ComplexWind( iSurf ).Geom( iState ).SolBmGndWt( I, Hour, TS ) = 0.0;
+			} else {
+				ComplexWind( iSurf ).Geom( iState ).SolBmGndWt( I, Hour, TS ) = 1.0;
+			}
+		} // Gnd pt loop
+
+	}
+
 	void
 	CalculateWindowBeamProperties(
 		int const ISurf, // Window surface number
@@ -991,7 +1136,6 @@ namespace WindowComplexManager {
 		int JSurf; // gen purpose surface no
 		int BaseSurf; // base surface no
 		int K; // general purpose index
-		int M; // general purpose index--ray
 		int L; // general purpose index--layer
 		int KBkSurf; // general purpose index--back surface
 		Real64 Sum1; // general purpose sum
@@ -1021,19 +1165,12 @@ namespace WindowComplexManager {
 			State.WinDirSpecTrans( Hour, TS ) = 0.0;
 			State.WinBmFtAbs( {1,State.NLayers}, Hour, TS ) = 0.0;
 		} else {
+			//Beam sums over the outgoing basis are done once for each incident ray in CalcWindowStaticProperties
 			for ( I = 1; I <= Window.NBkSurf; ++I ) { //Back surface loop
-				Sum1 = 0.0;
-				for ( J = 1; J <= Geom.NSurfInt( I ); ++J ) { //Ray loop
-					Sum1 += Geom.Trn.Lamda( Geom.SurfInt( I, J ) ) * Construct( IConst ).BSDFInput.SolFrtTrans( Geom.SurfInt( I, J ), IBm );
-				} //Ray loop
-				State.WinToSurfBmTrans( I, Hour, TS ) = Sum1;
+				State.WinToSurfBmTrans( I, Hour, TS ) = State.FtBmToSurfTrans( I, IBm );
 			} //Back surface loop
 			//Calculate the directional-hemispherical transmittance
-			Sum1 = 0.0;
-			for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-				Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTrans( J, IBm );
-			}
-			State.WinDirHemiTrans( Hour, TS ) = Sum1;
+			State.WinDirHemiTrans( Hour, TS ) = State.FtDirHemiTrans( IBm );
 			//Calculate the directional specular transmittance
 			//Note:  again using assumption that Inc and Trn basis have same structure
 			State.WinDirSpecTrans( Hour, TS ) = Geom.Trn.Lamda( IBm ) * Construct( IConst ).BSDFInput.SolFrtTrans( IBm, IBm );
@@ -1051,9 +1188,7 @@ namespace WindowComplexManager {
 			JRay = Geom.GndIndex( J );
 			if ( Geom.SolBmGndWt( J, Hour, TS ) > 0.0 ) {
 				Sum2 += Geom.SolBmGndWt( J, Hour, TS ) * Geom.Inc.Lamda( JRay );
-				for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-					Sum1 += Geom.SolBmGndWt( J, Hour, TS ) * Geom.Inc.Lamda( JRay ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, JRay );
-				} //Outgoing ray loop
+				Sum1 += Geom.SolBmGndWt( J, Hour, TS ) * Geom.Inc.Lamda( JRay ) * State.FtDirHemiTrans( JRay );
 			}
 		} //Indcident ray loop
 		if ( Sum2 > 0.0 ) {
@@ -1105,11 +1240,7 @@ namespace WindowComplexManager {
 				//Here calculate the back incidence properties for the solar ray
 				//this does not say whether or not the ray can pass through the
 				//back surface window and hit this one!
-				Sum1 = 0.0;
-				for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-					Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolBkRefl( J, BkIncRay );
-				}
-				Refl = Sum1;
+				Refl = State.BkDirHemiRefl( BkIncRay );
 				for ( L = 1; L <= State.NLayers; ++L ) {
 					Absorb( L ) = Construct( IConst ).BSDFInput.Layer( L ).BkAbs( 1, BkIncRay );
 				}
@@ -2424,6 +2555,43 @@ namespace WindowComplexManager {
 			State.IntegratedBkTrans( J ) = 1 - State.IntegratedBkRefl( J ) - State.IntegratedBkAbs( J );
 		} //Outgoing ray loop
 
+		// ********************************************************************************
+		// Beam values for each basis direction, looked up by CalculateWindowBeamProperties
+		// ********************************************************************************
+
+		// Front directional-hemispherical transmittance (one pass down each column of the matrix)
+		if ( ! allocated( State.FtDirHemiTrans ) ) State.FtDirHemiTrans.allocate( Geom.Inc.NBasis );
+		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { // Incident ray loop
+			Sum1 = 0.0;
+			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { // Outgoing ray loop
+				Sum1 += Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, J );
+			} // Outgoing ray loop
+			State.FtDirHemiTrans( J ) = Sum1;
+		} // Incident ray loop
+
+		// Front beam transmittance to each back surface
+		if ( ! allocated( State.FtBmToSurfTrans ) ) State.FtBmToSurfTrans.allocate( Window.NBkSurf, Geom.Inc.NBasis );
+		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { // Incident ray loop
+			for ( I = 1; I <= Window.NBkSurf; ++I ) { // Back surface loop
+				Sum1 = 0.0;
+				for ( JJ = 1; JJ <= Geom.NSurfInt( I ); ++JJ ) { // Outgoing ray loop
+					M = Geom.SurfInt( I, JJ );
+					Sum1 += Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, J );
+				} // Outgoing ray loop
+				State.FtBmToSurfTrans( I, J ) = Sum1;
+			} // Back surface loop
+		} // Incident ray loop
+
+		// Back directional-hemispherical reflectance
+		if ( ! allocated( State.BkDirHemiRefl ) ) State.BkDirHemiRefl.allocate( Geom.Trn.NBasis );
+		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) { // Back incident ray loop
+			Sum1 = 0.0;
+			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { // Reflected ray loop
+				Sum1 += Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolBkRefl( M, J );
+			} // Reflected ray loop
+			State.BkDirHemiRefl( J ) = Sum1;
+		} // Back incident ray loop
+
 	}
 
 	Real64
@@ -3025,6 +3193,7 @@ namespace WindowComplexManager {
 		using DataHeatBalance::GasCoeffsAir;
 		using DataHeatBalance::SupportPillar;
 		using TARCOGMain::TARCOG90;
+		using DataSystemVariables::TARCOGResultCache;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -3328,6 +3497,8 @@ namespace WindowComplexManager {
 		Real64 outir;
 		Real64 Ebout;
 		Real64 dominantGapWidth; // store value for dominant gap width.  Used for airflow calculations
+		static std::vector< std::int64_t > CacheKey; // Quantized boundary conditions for the TARCOG result cache
+		int CacheEntryNum; // TARCOG result cache entry solved for CacheKey (0 = call TARCOG)
 
 		// fill local vars
 
@@ -3731,8 +3902,52 @@ namespace WindowComplexManager {
 			theta = 273.15;
 		}
 
-		//  call TARCOG
-		TARCOG90( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, CalcDeflection, Pa, Pini, Tini, gap, GapDefMax, thick, scon, YoungsMod, PoissonsRat, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, gcon, gvis, gcp, wght, gama, nmix, SupportPlr, PillarSpacing, PillarRadius, theta, LayerDef, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgap, hrgap, shgc, nperr, tarcogErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, hg, hr, hs, he, hi, Ra, Nu, standard, ThermalMod, Debug_mode, Debug_dir, Debug_file, Window_ID, IGU_ID, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, SDScalar, CalcSHGC, NumOfIterations );
+		// Boundary conditions that differ by less than the quantization steps from an earlier solution
+		// of this window (typically successive surface heat balance iterations) reuse that solution
+		CacheEntryNum = 0;
+		if ( TARCOGResultCache && ( CalcCondition == noCondition ) ) {
+			CacheKey.clear();
+			CacheKey.push_back( ConstrNum );
+			CacheKey.push_back( QuantizeTARCOGInput( tout, TARCOGCacheTempStep ) );
+			CacheKey.push_back( QuantizeTARCOGInput( tind, TARCOGCacheTempStep ) );
+			CacheKey.push_back( QuantizeTARCOGInput( trmin, TARCOGCacheTempStep ) );
+			CacheKey.push_back( QuantizeTARCOGInput( tsky, TARCOGCacheTempStep ) );
+			CacheKey.push_back( QuantizeTARCOGInput( outir, TARCOGCacheFluxStep ) );
+			CacheKey.push_back( QuantizeTARCOGInput( dir, TARCOGCacheFluxStep ) );
+			CacheKey.push_back( QuantizeTARCOGInput( wso, TARCOGCacheSpeedStep ) );
+			CacheKey.push_back( QuantizeTARCOGInput( hin, TARCOGCacheCoefStep ) );
+			CacheKey.push_back( QuantizeTARCOGInput( hout, TARCOGCacheCoefStep ) );
+			CacheKey.push_back( QuantizeTARCOGInput( fclr, TARCOGCacheFractionStep ) );
+			CacheKey.push_back( QuantizeTARCOGInput( OutBaroPress, TARCOGCachePressureStep ) );
+			for ( k = 1; k <= nlayer; ++k ) {
+				CacheKey.push_back( QuantizeTARCOGInput( asol( k ), TARCOGCacheFluxStep ) );
+			}
+			CacheEntryNum = FindTARCOGCacheEntry( SurfNum, CacheKey );
+		}
+
+		if ( CacheEntryNum > 0 ) {
+			auto const & entry( TARCOGCache( SurfNum ).Entries[ CacheEntryNum - 1 ] );
+			for ( k = 1; k <= nlayer; ++k ) {
+				theta( 2 * k - 1 ) = entry.theta( 2 * k - 1 );
+				theta( 2 * k ) = entry.theta( 2 * k );
+				scon( k ) = entry.scon( k );
+				thick( k ) = entry.thick( k );
+			}
+			qv = 0.0;
+			for ( k = 1; k <= nlayer + 1; ++k ) {
+				qv( k ) = entry.qv( k );
+			}
+			hcin = entry.hcin;
+			NumOfIterations = entry.NumOfIterations;
+			nperr = 0;
+		} else {
+			//  call TARCOG; theta holds the solution of the previous call as the starting guess
+			TARCOG90( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, CalcDeflection, Pa, Pini, Tini, gap, GapDefMax, thick, scon, YoungsMod, PoissonsRat, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, gcon, gvis, gcp, wght, gama, nmix, SupportPlr, PillarSpacing, PillarRadius, theta, LayerDef, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgap, hrgap, shgc, nperr, tarcogErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, hg, hr, hs, he, hi, Ra, Nu, standard, ThermalMod, Debug_mode, Debug_dir, Debug_file, Window_ID, IGU_ID, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, SDScalar, CalcSHGC, NumOfIterations );
+
+			if ( TARCOGResultCache && ( CalcCondition == noCondition ) && ! ( ( nperr > 0 ) && ( nperr < 1000 ) ) ) {
+				StoreTARCOGCacheEntry( SurfNum, CacheKey, nlayer, theta, qv, scon, thick, hcin, NumOfIterations );
+			}
+		}
 
 		// process results from TARCOG
 		if ( ( nperr > 0 ) && ( nperr < 1000 ) ) { // process error signal from tarcog
@@ -3959,6 +4174,250 @@ namespace WindowComplexManager {
 
 	}
 
+	std::int64_t
+	QuantizeTARCOGInput(
+		Real64 const Value, // Boundary condition
+		Real64 const Step // Quantization step of the boundary condition
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the number of quantization steps nearest to a TARCOG boundary condition, so that
+		// conditions closer than about half a step give the same TARCOG result cache key.
+
+		// Return value
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		return std::llround( Value / Step );
+
+	}
+
+	int
+	FindTARCOGCacheEntry(
+		int const SurfNum, // Surface number of the window
+		std::vector< std::int64_t > const & Key // Quantized boundary conditions
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Looks up the TARCOG result cache of a window and returns the (one based) entry solved
+		// for the same quantized boundary conditions, or zero if TARCOG has to be called.
+
+		// METHODOLOGY EMPLOYED:
+		// The few entries of a window are searched linearly. A hit marks the entry as most
+		// recently used so that StoreTARCOGCacheEntry replaces the least recently used one.
+
+		// Return value
+		int EntryNum; // Entry solved for Key (0 = not found)
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Loop;
+
+		if ( ! allocated( TARCOGCache ) ) TARCOGCache.allocate( TotSurfaces );
+
+		auto & cache( TARCOGCache( SurfNum ) );
+		++cache.UseCount;
+		EntryNum = 0;
+		for ( Loop = 1; Loop <= int( cache.Entries.size() ); ++Loop ) {
+			if ( cache.Entries[ Loop - 1 ].Key == Key ) {
+				EntryNum = Loop;
+				cache.Entries[ Loop - 1 ].LastUse = cache.UseCount;
+				++cache.NumHits;
+				break;
+			}
+		}
+
+		return EntryNum;
+
+	}
+
+	void
+	StoreTARCOGCacheEntry(
+		int const SurfNum, // Surface number of the window
+		std::vector< std::int64_t > const & Key, // Quantized boundary conditions
+		int const nlayer, // Number of layers
+		FArray1D< Real64 > const & theta, // Surface temperatures of the layers [K]
+		FArray1D< Real64 > const & qv, // Heat fluxes to each gap by ventilation [W/m2]
+		FArray1D< Real64 > const & scon, // Layer conductivities [W/m-K]
+		FArray1D< Real64 > const & thick, // Layer thicknesses [m]
+		Real64 const hcin, // Indoor convective surface heat transfer coefficient [W/m2-K]
+		int const NumOfIterations // TARCOG iterations of the solution
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Keeps a TARCOG solution of a window in its result cache and counts the solve.
+
+		// METHODOLOGY EMPLOYED:
+		// Only the TARCOG outputs used by CalcComplexWindowThermal are kept. Once a window holds
+		// TARCOGCacheSize entries, the least recently used one is replaced.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Loop;
+		int EntryNum; // Entry replaced by the solution (zero based)
+		int k; // Layer counter
+
+		if ( ! allocated( TARCOGCache ) ) TARCOGCache.allocate( TotSurfaces );
+
+		auto & cache( TARCOGCache( SurfNum ) );
+		++cache.NumSolves;
+		cache.TotIterations += NumOfIterations;
+		cache.MaxIterations = max( cache.MaxIterations, NumOfIterations );
+
+		if ( int( cache.Entries.size() ) < TARCOGCacheSize ) {
+			cache.Entries.push_back( TARCOGCacheEntry() );
+			EntryNum = int( cache.Entries.size() ) - 1;
+		} else {
+			EntryNum = 0;
+			for ( Loop = 1; Loop < int( cache.Entries.size() ); ++Loop ) {
+				if ( cache.Entries[ Loop ].LastUse < cache.Entries[ EntryNum ].LastUse ) EntryNum = Loop;
+			}
+		}
+
+		auto & entry( cache.Entries[ EntryNum ] );
+		entry.Key = Key;
+		entry.theta.dimension( 2 * nlayer );
+		entry.qv.dimension( nlayer + 1 );
+		entry.scon.dimension( nlayer );
+		entry.thick.dimension( nlayer );
+		for ( k = 1; k <= nlayer; ++k ) {
+			entry.theta( 2 * k - 1 ) = theta( 2 * k - 1 );
+			entry.theta( 2 * k ) = theta( 2 * k );
+			entry.scon( k ) = scon( k );
+			entry.thick( k ) = thick( k );
+		}
+		for ( k = 1; k <= nlayer + 1; ++k ) {
+			entry.qv( k ) = qv( k );
+		}
+		entry.hcin = hcin;
+		entry.NumOfIterations = NumOfIterations;
+		entry.LastUse = cache.UseCount;
+
+	}
+
+	void
+	ReportTARCOGCache()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the hit rate and the TARCOG iteration counts of the result cache of each
+		// complex fenestration window to the audit file.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::TARCOGResultCache;
+		using General::RoundSigDigits;
+		using General::TrimSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int EchoInputFile; // found unit number for "eplusout.audit"
+		int SurfNum;
+		int NumLookups; // Solutions requested for a window
+		Real64 HitFraction; // Fraction of the requested solutions taken from the cache
+		Real64 AvgIterations; // Average TARCOG iterations of a solve
+
+		if ( ! TARCOGResultCache ) return;
+		if ( ! allocated( TARCOGCache ) ) return;
+		EchoInputFile = FindUnitNumber( "eplusout.audit" );
+		if ( EchoInputFile == 0 ) return;
+
+		gio::write( EchoInputFile, fmtA ) << "TARCOG Cache,Surface Name,#Solutions Requested,#Cache Hits,Hit Fraction,#TARCOG Solves,Average Iterations,Maximum Iterations";
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & cache( TARCOGCache( SurfNum ) );
+			NumLookups = cache.NumHits + cache.NumSolves;
+			if ( NumLookups == 0 ) continue;
+			HitFraction = double( cache.NumHits ) / double( NumLookups );
+			AvgIterations = 0.0;
+			if ( cache.NumSolves > 0 ) AvgIterations = double( cache.TotIterations ) / double( cache.NumSolves );
+			gio::write( EchoInputFile, fmtA ) << "TARCOG Cache," + Surface( SurfNum ).Name + ',' + TrimSigDigits( NumLookups ) + ',' + TrimSigDigits( cache.NumHits ) + ',' + RoundSigDigits( HitFraction, 3 ) + ',' + TrimSigDigits( cache.NumSolves ) + ',' + RoundSigDigits( AvgIterations, 2 ) + ',' + TrimSigDigits( cache.MaxIterations );
+		}
+
+	}
+
 	// This function check if gas with molecular weight has already been feed into coefficients and
 	// feed arrays
 
@@ -1,10 +1,16 @@
 #ifndef WindowComplexManager_hh_INCLUDED
 #define WindowComplexManager_hh_INCLUDED
 
+// C++ Headers
+#include <cstdint>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
+#include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/FArray1S.hh>
 #include <ObjexxFCL/FArray2D.hh>
+#include <ObjexxFCL/FArray3D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -43,6 +49,14 @@ namespace WindowComplexManager {
 	extern int const Back_Transmitted;
 	extern int const Back_Reflected;
 
+	extern int const TARCOGCacheSize; // Solutions kept for each window by the TARCOG result cache
+	extern Real64 const TARCOGCacheTempStep; // Quantization of cache key temperatures [K]
+	extern Real64 const TARCOGCacheFluxStep; // Quantization of cache key radiation and absorbed solar [W/m2]
+	extern Real64 const TARCOGCacheSpeedStep; // Quantization of cache key wind speed [m/s]
+	extern Real64 const TARCOGCacheCoefStep; // Quantization of cache key film coefficients [W/m2-K]
+	extern Real64 const TARCOGCacheFractionStep; // Quantization of cache key clear sky fraction
+	extern Real64 const TARCOGCachePressureStep; // Quantization of cache key pressure [Pa]
+
 	// DERIVED TYPE DEFINITIONS:
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -55,6 +69,10 @@ namespace WindowComplexManager {
 	extern Real64 DdbgTheta;
 	extern Real64 DdbgPhi;
 	//EndDebug
+	extern FArray1D_int GndObstrSurf; // Exterior and shading surfaces that can shade a ground point
+	extern FArray3D_int SunGndObstrSurf; // Surfaces of GndObstrSurf facing a ground point (surface, hour, timestep)
+	extern FArray2D_int NumSunGndObstrSurf; // Number of surfaces in SunGndObstrSurf (hour, timestep)
+	extern FArray2D< Vector > SunGndObstrDir; // Sun direction SunGndObstrSurf was listed for (hour, timestep)
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowComplexManager:
 
@@ -121,10 +139,53 @@ namespace WindowComplexManager {
 
 	};
 
+	struct TARCOGCacheEntry
+	{
+		// Members
+		std::vector< std::int64_t > Key; // Quantized boundary conditions of the solution
+		FArray1D< Real64 > theta; // Surface temperatures of the layers [K] {2*nlayer}
+		FArray1D< Real64 > qv; // Heat fluxes to each gap by ventilation [W/m2] {nlayer+1}
+		FArray1D< Real64 > scon; // Layer conductivities as adjusted by TARCOG [W/m-K] {nlayer}
+		FArray1D< Real64 > thick; // Layer thicknesses as adjusted by TARCOG [m] {nlayer}
+		Real64 hcin; // Indoor convective surface heat transfer coefficient [W/m2-K]
+		int NumOfIterations; // TARCOG iterations of the solution
+		int LastUse; // Value of the window's UseCount when the entry was last used
+
+		// Default Constructor
+		TARCOGCacheEntry() :
+			hcin( 0.0 ),
+			NumOfIterations( 0 ),
+			LastUse( 0 )
+		{}
+
+	};
+
+	struct TARCOGWindowCache
+	{
+		// Members
+		std::vector< TARCOGCacheEntry > Entries; // Most recently used solutions, at most TARCOGCacheSize
+		int UseCount; // Number of lookups, used to order the entries
+		int NumHits; // Lookups answered from Entries
+		int NumSolves; // Lookups that called TARCOG
+		int TotIterations; // Sum of the TARCOG iterations of the solves
+		int MaxIterations; // Largest number of TARCOG iterations of a solve
+
+		// Default Constructor
+		TARCOGWindowCache() :
+			UseCount( 0 ),
+			NumHits( 0 ),
+			NumSolves( 0 ),
+			TotIterations( 0 ),
+			MaxIterations( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< BasisStruct > BasisList;
 	extern FArray1D< WindowIndex > WindowList;
 	extern FArray2D< WindowStateIndex > WindowStateList;
+	extern FArray1D< TARCOGWindowCache > TARCOGCache; // TARCOG result cache of each window (surface number)
 
 	// Functions
 
@@ -161,6 +222,22 @@ namespace WindowComplexManager {
 		BSDFStateDescr & State // State Description
 	);
 
+	void
+	SetupGroundObstructions(
+		Vector const & SunDir, // Unit vector pointing toward sun (world CS)
+		int const Hour, // Hour number
+		int const TS // Timestep number
+	);
+
+	void
+	CalcGroundBeamWeights(
+		int const iSurf, // Window surface number
+		int const iState, // Window state number
+		Vector const & SunDir, // Unit vector pointing toward sun (world CS)
+		int const Hour, // Hour number
+		int const TS // Timestep number
+	);
+
 	void
 	CalculateWindowBeamProperties(
 		int const ISurf, // Window surface number
@@ -272,6 +349,34 @@ namespace WindowComplexManager {
 		int const CalcCondition // Calucation condition (summer, winter or no condition)
 	);
 
+	std::int64_t
+	QuantizeTARCOGInput(
+		Real64 const Value, // Boundary condition
+		Real64 const Step // Quantization step of the boundary condition
+	);
+
+	int
+	FindTARCOGCacheEntry(
+		int const SurfNum, // Surface number of the window
+		std::vector< std::int64_t > const & Key // Quantized boundary conditions
+	);
+
+	void
+	StoreTARCOGCacheEntry(
+		int const SurfNum, // Surface number of the window
+		std::vector< std::int64_t > const & Key, // Quantized boundary conditions
+		int const nlayer, // Number of layers
+		FArray1D< Real64 > const & theta, // Surface temperatures of the layers [K]
+		FArray1D< Real64 > const & qv, // Heat fluxes to each gap by ventilation [W/m2]
+		FArray1D< Real64 > const & scon, // Layer conductivities [W/m-K]
+		FArray1D< Real64 > const & thick, // Layer thicknesses [m]
+		Real64 const hcin, // Indoor convective surface heat transfer coefficient [W/m2-K]
+		int const NumOfIterations // TARCOG iterations of the solution
+	);
+
+	void
+	ReportTARCOGCache();
+
 	// This function check if gas with molecular weight has already been feed into coefficients and
 	// feed arrays
 
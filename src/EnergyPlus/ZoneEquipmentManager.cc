@@ -26,6 +26,7 @@
 #include <DataRoomAirModel.hh>
 #include <DataSizing.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
 #include <DirectAirManager.hh>
@@ -130,11 +131,17 @@ namespace ZoneEquipmentManager {
 	FArray1D_int DefaultSimOrder;
 	int NumOfTimeStepInDay; // number of zone time steps in a day
 	bool GetZoneEquipmentInputFlag( true );
+	bool ZoneEquipSimSetsFound( false ); // true once the controlled zones have been grouped into simulation sets
+	int NumZoneEquipSimSets( 0 ); // number of independent zone equipment simulation sets
+	int NumConcurrentZoneEquipSimSets( 0 ); // number of sets that may be simulated concurrently
+	FArray1D_int ConcurrentZoneEquipSimSet; // indices of the sets that may be simulated concurrently
+	FArray1D_bool ZoneEquipSimConcurrently; // true for controlled zones of a concurrent set
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE ZoneEquipmentManager
 
 	// Object Data
 	FArray1D< SimulationOrder > PrioritySimOrder;
+	FArray1D< ZoneEquipSimSetData > ZoneEquipSimSet; // independent zone equipment simulation sets
 
 	// Functions
 
@@ -271,7 +278,7 @@ namespace ZoneEquipmentManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Russ Taylor
 		//       DATE WRITTEN   Nov 1997
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, group the controlled zones into independent simulation sets
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -295,6 +302,8 @@ namespace ZoneEquipmentManager {
 		using DataContaminantBalance::OutdoorGC;
 		using DataZoneEnergyDemands::ZoneSysEnergyDemand;
 		using DataZoneEnergyDemands::ZoneSysMoistureDemand;
+		using DataHVACGlobals::AirLoopsSimOnce;
+		using DataSystemVariables::NumZoneEquipThreads;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -445,6 +454,12 @@ namespace ZoneEquipmentManager {
 			MyEnvrnFlag = true;
 		}
 
+		// group the controlled zones for concurrent simulation once the air loops know their zones
+		if ( NumZoneEquipThreads > 1 && ! ZoneEquipSimSetsFound && AirLoopsSimOnce ) {
+			FindZoneEquipSimSets();
+			ZoneEquipSimSetsFound = true;
+		}
+
 		// do the  HVAC time step initializations
 
 		for ( ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum ) {
@@ -485,6 +500,255 @@ namespace ZoneEquipmentManager {
 
 	}
 
+	void
+	FindZoneEquipSimSets()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Groups the controlled zones into sets whose equipment does not interact within an HVAC
+		// iteration, and marks the sets that may be simulated at the same time as other sets.
+
+		// METHODOLOGY EMPLOYED:
+		// Two controlled zones are in the same set if they are served by the same air loop, return
+		// to the same return plenum or share a node. A set is concurrent if none of its zones is
+		// connected to an air loop or air path and all of its equipment is reentrant (see
+		// ZoneEquipIsReentrant). Plant coupled equipment is never reentrant, so zones coupled
+		// through a plant loop always stay in the serial simulation order. The sets are numbered
+		// in the order of their first controlled zone and written to the eio file.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataGlobals::OutputFileInits;
+		using DataLoopNode::NumOfNodes;
+		using General::TrimSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt const fmtA( "(A)" );
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ControlledZoneNum;
+		int EquipTypeNum;
+		int NodeNum;
+		int SetNum;
+		int MaxAirLoopNum; // highest air loop index of the controlled zones
+		int MaxPlenumNum; // highest return plenum index of the controlled zones
+		bool ZoneIsReentrant; // true if the zone only has reentrant equipment and no air connections
+		FArray1D_int SetRoot; // union-find parent of each controlled zone
+		FArray1D_int ZoneSetNum; // simulation set of each controlled zone
+		FArray1D_int NodeZone; // first controlled zone connected to each node
+		FArray1D_int AirLoopZone; // first controlled zone served by each air loop
+		FArray1D_int PlenumZone; // first controlled zone returning to each return plenum
+		FArray1D_bool ZoneReentrant; // true for zones that can be simulated concurrently
+
+		auto FindRoot = [ &SetRoot ]( int Zone ) -> int {
+			while ( SetRoot( Zone ) != Zone ) {
+				SetRoot( Zone ) = SetRoot( SetRoot( Zone ) );
+				Zone = SetRoot( Zone );
+			}
+			return Zone;
+		};
+		auto JoinZone = [ &SetRoot, &FindRoot ]( FArray1D_int & FirstZone, int const Index, int const Zone ) {
+			if ( Index <= 0 ) return;
+			if ( FirstZone( Index ) == 0 ) {
+				FirstZone( Index ) = Zone;
+			} else {
+				int const Root1 = FindRoot( FirstZone( Index ) );
+				int const Root2 = FindRoot( Zone );
+				if ( Root1 != Root2 ) SetRoot( max( Root1, Root2 ) ) = min( Root1, Root2 );
+			}
+		};
+
+		MaxAirLoopNum = 0;
+		MaxPlenumNum = 0;
+		for ( ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum ) {
+			if ( ! ZoneEquipConfig( ControlledZoneNum ).IsControlled ) continue;
+			MaxAirLoopNum = max( MaxAirLoopNum, ZoneEquipConfig( ControlledZoneNum ).AirLoopNum );
+			MaxPlenumNum = max( MaxPlenumNum, ZoneEquipConfig( ControlledZoneNum ).ReturnZonePlenumCondNum );
+		}
+
+		SetRoot.allocate( NumOfZones );
+		ZoneSetNum.allocate( NumOfZones );
+		ZoneReentrant.allocate( NumOfZones );
+		NodeZone.allocate( NumOfNodes );
+		AirLoopZone.allocate( MaxAirLoopNum );
+		PlenumZone.allocate( MaxPlenumNum );
+		ZoneSetNum = 0;
+		ZoneReentrant = false;
+		NodeZone = 0;
+		AirLoopZone = 0;
+		PlenumZone = 0;
+		for ( ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum ) {
+			SetRoot( ControlledZoneNum ) = ControlledZoneNum;
+		}
+
+		for ( ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum ) {
+			auto const & ThisZoneEquip( ZoneEquipConfig( ControlledZoneNum ) );
+			if ( ! ThisZoneEquip.IsControlled ) continue;
+
+			JoinZone( AirLoopZone, ThisZoneEquip.AirLoopNum, ControlledZoneNum );
+			JoinZone( PlenumZone, ThisZoneEquip.ReturnZonePlenumCondNum, ControlledZoneNum );
+			JoinZone( NodeZone, ThisZoneEquip.ZoneNode, ControlledZoneNum );
+			JoinZone( NodeZone, ThisZoneEquip.ReturnAirNode, ControlledZoneNum );
+			for ( NodeNum = 1; NodeNum <= ThisZoneEquip.NumInletNodes; ++NodeNum ) {
+				JoinZone( NodeZone, ThisZoneEquip.InletNode( NodeNum ), ControlledZoneNum );
+			}
+			for ( NodeNum = 1; NodeNum <= ThisZoneEquip.NumExhaustNodes; ++NodeNum ) {
+				JoinZone( NodeZone, ThisZoneEquip.ExhaustNode( NodeNum ), ControlledZoneNum );
+			}
+
+			ZoneIsReentrant = ( ThisZoneEquip.EquipListIndex > 0 && ThisZoneEquip.AirLoopNum == 0 && ThisZoneEquip.ReturnZonePlenumCondNum == 0 && ThisZoneEquip.NumInletNodes == 0 && ThisZoneEquip.NumExhaustNodes == 0 && ! ThisZoneEquip.SupLeakToRetPlen );
+			if ( ZoneIsReentrant ) {
+				ZoneIsReentrant = ( ZoneEquipList( ControlledZoneNum ).NumOfEquipTypes > 0 );
+				for ( EquipTypeNum = 1; EquipTypeNum <= ZoneEquipList( ControlledZoneNum ).NumOfEquipTypes; ++EquipTypeNum ) {
+					if ( ! ZoneEquipIsReentrant( ZoneEquipList( ControlledZoneNum ).EquipType_Num( EquipTypeNum ) ) ) ZoneIsReentrant = false;
+				}
+			}
+			ZoneReentrant( ControlledZoneNum ) = ZoneIsReentrant;
+		}
+
+		// Number the sets in the order of their first controlled zone
+		NumZoneEquipSimSets = 0;
+		for ( ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum ) {
+			if ( ! ZoneEquipConfig( ControlledZoneNum ).IsControlled ) continue;
+			SetNum = ZoneSetNum( FindRoot( ControlledZoneNum ) );
+			if ( SetNum == 0 ) {
+				++NumZoneEquipSimSets;
+				SetNum = NumZoneEquipSimSets;
+				ZoneSetNum( FindRoot( ControlledZoneNum ) ) = SetNum;
+			}
+			ZoneSetNum( ControlledZoneNum ) = SetNum;
+		}
+
+		ZoneEquipSimSet.allocate( NumZoneEquipSimSets );
+		for ( ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum ) {
+			if ( ! ZoneEquipConfig( ControlledZoneNum ).IsControlled ) continue;
+			++ZoneEquipSimSet( ZoneSetNum( ControlledZoneNum ) ).NumZones;
+		}
+		for ( SetNum = 1; SetNum <= NumZoneEquipSimSets; ++SetNum ) {
+			ZoneEquipSimSet( SetNum ).ControlledZoneNum.allocate( ZoneEquipSimSet( SetNum ).NumZones );
+			ZoneEquipSimSet( SetNum ).NumZones = 0;
+			ZoneEquipSimSet( SetNum ).Concurrent = true;
+		}
+		for ( ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum ) {
+			if ( ! ZoneEquipConfig( ControlledZoneNum ).IsControlled ) continue;
+			auto & ThisSet( ZoneEquipSimSet( ZoneSetNum( ControlledZoneNum ) ) );
+			++ThisSet.NumZones;
+			ThisSet.ControlledZoneNum( ThisSet.NumZones ) = ControlledZoneNum;
+			if ( ! ZoneReentrant( ControlledZoneNum ) ) ThisSet.Concurrent = false;
+		}
+
+		NumConcurrentZoneEquipSimSets = 0;
+		ConcurrentZoneEquipSimSet.allocate( NumZoneEquipSimSets );
+		ZoneEquipSimConcurrently.allocate( NumOfZones );
+		ConcurrentZoneEquipSimSet = 0;
+		ZoneEquipSimConcurrently = false;
+		for ( SetNum = 1; SetNum <= NumZoneEquipSimSets; ++SetNum ) {
+			if ( ! ZoneEquipSimSet( SetNum ).Concurrent ) continue;
+			++NumConcurrentZoneEquipSimSets;
+			ConcurrentZoneEquipSimSet( NumConcurrentZoneEquipSimSets ) = SetNum;
+			for ( int Loop = 1; Loop <= ZoneEquipSimSet( SetNum ).NumZones; ++Loop ) {
+				ZoneEquipSimConcurrently( ZoneEquipSimSet( SetNum ).ControlledZoneNum( Loop ) ) = true;
+			}
+		}
+
+		gio::write( OutputFileInits, fmtA ) << "! <Zone Equipment Simulation Set>, Zone Name, Set Number, Concurrent [Yes/No]";
+		for ( ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum ) {
+			if ( ! ZoneEquipConfig( ControlledZoneNum ).IsControlled ) continue;
+			gio::write( OutputFileInits, fmtA ) << " Zone Equipment Simulation Set, " + ZoneEquipConfig( ControlledZoneNum ).ZoneName + ", " + TrimSigDigits( ZoneSetNum( ControlledZoneNum ) ) + ", " + ( ZoneEquipSimConcurrently( ControlledZoneNum ) ? "Yes" : "No" );
+		}
+
+	}
+
+	bool
+	ZoneEquipIsReentrant( int const EquipType_Num ) // zone equipment type
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true for zone equipment types that SimReentrantZoneEquipment can simulate for
+		// several zones at the same time.
+
+		// METHODOLOGY EMPLOYED:
+		// A type qualifies if, once its units have been initialized and sized, its simulation only
+		// reads shared data and writes the data of the unit and of its zone: no module scratch
+		// variables, no plant or air loop coupling, no messages, and no psychrometric functions
+		// other than PsyCpAirFnWTdb, whose last call is kept per thread. The psychrometric caches
+		// of Psychrometrics.cc and the last call memos of PsyTsatFnPb and PsyTwbFnTdbWPb are
+		// shared by all threads.
+		// Only ZoneHVAC:Baseboard:Convective:Electric qualifies so far. The other common zone units
+		// were audited (October 2014) and stay in the serial simulation order:
+		//  ZoneHVAC:FourPipeFanCoil -- water coils request plant flow (SetComponentFlowRate writes the
+		//   shared loop side data); the fan reads DataHVACGlobals::OnOffFanPartLoadFraction and
+		//   ZoneCompTurnFansOn/Off; Fans keeps VFDSpdRatio, FlowFracForPower and the warning counters
+		//   in function statics.
+		//  ZoneHVAC:PackagedTerminalAirConditioner (and the heat pumps) -- module scratch variables
+		//   CompOnMassFlow, CompOffMassFlow, OACompOnMassFlow, OACompOffMassFlow, CompOnFlowRatio,
+		//   CompOffFlowRatio, FanSpeedRatio, SupHeaterLoad, SaveCompressorPLR, HeatingLoad and
+		//   CoolingLoad; function statics PartLoadFrac, SpeedRatio, SpeedNum, AverageUnitMassFlow and
+		//   AverageOAMassFlow; the DX coil module scratch data, plus the fan issues above.
+		//  ZoneHVAC:UnitHeater -- module variable QZnReq, the heating coil scratch data and the fan
+		//   issues above; water and steam coils also request plant flow.
+		// Enabling any of them needs those variables moved onto the unit (or made per thread), as was
+		// done for the PsyCpAirFnWTdb memo.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		bool IsReentrant;
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		{ auto const SELECT_CASE_var( EquipType_Num );
+		if ( SELECT_CASE_var == BBElectricConvective_Num ) { // 'ZoneHVAC:Baseboard:Convective:Electric'
+			IsReentrant = true;
+		} else {
+			IsReentrant = false;
+		}}
+
+		return IsReentrant;
+
+	}
+
 	void
 	SizeZoneEquipment()
 	{
@@ -1922,65 +2186,11 @@ namespace ZoneEquipmentManager {
 					CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolCoilInTemp = OAFrac * DesDayWeath( CurOverallSimDay ).Temp( TimeStepAtPeak ) + ( 1.0 - OAFrac ) * CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneTempAtCoolPeak;
 					CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolCoilInHumRat = OAFrac * DesDayWeath( CurOverallSimDay ).HumRat( TimeStepAtPeak ) + ( 1.0 - OAFrac ) * CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneHumRatAtCoolPeak;
 				}
-				if ( CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatVolFlow > CalcFinalZoneSizing( CtrlZoneNum ).DesHeatVolFlow ) {
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatVolFlow = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatVolFlow;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatLoad = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatLoad;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatMassFlow = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatMassFlow;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatDesDay = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatDesDay;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatDens = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatDens;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatFlowSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatFlowSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatLoadSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatLoadSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatZoneTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatZoneTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatOutTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatOutTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatZoneRetTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatZoneRetTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatTstatTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatTstatTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatTstatTemp = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatTstatTemp;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatZoneHumRatSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatZoneHumRatSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatOutHumRatSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatOutHumRatSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).ZoneTempAtHeatPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneTempAtHeatPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).OutTempAtHeatPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).OutTempAtHeatPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).ZoneRetTempAtHeatPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneRetTempAtHeatPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).ZoneHumRatAtHeatPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneHumRatAtHeatPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).OutHumRatAtHeatPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).OutHumRatAtHeatPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatDDNum = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatDDNum;
-					CalcFinalZoneSizing( CtrlZoneNum ).cHeatDDDate = DesDayWeath( CurOverallSimDay ).DateString;
-					CalcFinalZoneSizing( CtrlZoneNum ).TimeStepNumAtHeatMax = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).TimeStepNumAtHeatMax;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatCoilInTemp = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatCoilInTemp;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatCoilInHumRat = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatCoilInHumRat;
-				} else {
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatDens = StdRhoAir;
-				}
-				if ( CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolVolFlow > CalcFinalZoneSizing( CtrlZoneNum ).DesCoolVolFlow ) {
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolVolFlow = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolVolFlow;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolLoad = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolLoad;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolMassFlow = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolMassFlow;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolDesDay = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolDesDay;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolDens = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolDens;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolFlowSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolFlowSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolLoadSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolLoadSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolZoneTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolZoneTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolOutTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolOutTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolZoneRetTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolZoneRetTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolTstatTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolTstatTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolTstatTemp = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolTstatTemp;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolZoneHumRatSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolZoneHumRatSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolOutHumRatSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolOutHumRatSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).ZoneTempAtCoolPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneTempAtCoolPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).OutTempAtCoolPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).OutTempAtCoolPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).ZoneRetTempAtCoolPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneRetTempAtCoolPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).ZoneHumRatAtCoolPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneHumRatAtCoolPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).OutHumRatAtCoolPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).OutHumRatAtCoolPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolDDNum = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolDDNum;
-					CalcFinalZoneSizing( CtrlZoneNum ).cCoolDDDate = DesDayWeath( CurOverallSimDay ).DateString;
-					CalcFinalZoneSizing( CtrlZoneNum ).TimeStepNumAtCoolMax = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).TimeStepNumAtCoolMax;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolCoilInTemp = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolCoilInTemp;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolCoilInHumRat = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolCoilInHumRat;
-				} else {
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolDens = StdRhoAir;
-				}
-
 			}
 
+			// fold this design day's peaks into the running maxima over all sizing periods
+			MergeZoneSizingDesignDay( CurOverallSimDay );
+
 		} else if ( SELECT_CASE_var == EndZoneSizingCalc ) {
 
 			// candidate EMS calling point to customize CalcFinalZoneSizing
@@ -2522,6 +2732,110 @@ namespace ZoneEquipmentManager {
 
 	}
 
+	void
+	MergeZoneSizingDesignDay( int const DDNum ) // sizing period (design day) index
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Fred Buhl
+		//       DATE WRITTEN   December 2000
+		//       MODIFIED       October 2014, moved out of UpdateZoneSizing so that the sizing periods
+		//                      can be folded in after a parallel zone sizing run
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Fold the daily heating and cooling peaks of one sizing period into CalcFinalZoneSizing.
+
+		// METHODOLOGY EMPLOYED:
+		// A sizing period replaces the current final values when its design volume flow rate is
+		// strictly greater, so calling this in sizing period order reproduces the serial result.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::StdRhoAir;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int CtrlZoneNum; // controlled zone index
+
+		for ( CtrlZoneNum = 1; CtrlZoneNum <= NumOfZones; ++CtrlZoneNum ) {
+
+			if ( ! ZoneEquipConfig( CtrlZoneNum ).IsControlled ) continue;
+
+			if ( CalcZoneSizing( CtrlZoneNum, DDNum ).DesHeatVolFlow > CalcFinalZoneSizing( CtrlZoneNum ).DesHeatVolFlow ) {
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatVolFlow = CalcZoneSizing( CtrlZoneNum, DDNum ).DesHeatVolFlow;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatLoad = CalcZoneSizing( CtrlZoneNum, DDNum ).DesHeatLoad;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatMassFlow = CalcZoneSizing( CtrlZoneNum, DDNum ).DesHeatMassFlow;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatDesDay = CalcZoneSizing( CtrlZoneNum, DDNum ).HeatDesDay;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatDens = CalcZoneSizing( CtrlZoneNum, DDNum ).DesHeatDens;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatFlowSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).HeatFlowSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatLoadSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).HeatLoadSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatZoneTempSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).HeatZoneTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatOutTempSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).HeatOutTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatZoneRetTempSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).HeatZoneRetTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatTstatTempSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).HeatTstatTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatTstatTemp = CalcZoneSizing( CtrlZoneNum, DDNum ).HeatTstatTemp;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatZoneHumRatSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).HeatZoneHumRatSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatOutHumRatSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).HeatOutHumRatSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).ZoneTempAtHeatPeak = CalcZoneSizing( CtrlZoneNum, DDNum ).ZoneTempAtHeatPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).OutTempAtHeatPeak = CalcZoneSizing( CtrlZoneNum, DDNum ).OutTempAtHeatPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).ZoneRetTempAtHeatPeak = CalcZoneSizing( CtrlZoneNum, DDNum ).ZoneRetTempAtHeatPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).ZoneHumRatAtHeatPeak = CalcZoneSizing( CtrlZoneNum, DDNum ).ZoneHumRatAtHeatPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).OutHumRatAtHeatPeak = CalcZoneSizing( CtrlZoneNum, DDNum ).OutHumRatAtHeatPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatDDNum = CalcZoneSizing( CtrlZoneNum, DDNum ).HeatDDNum;
+				CalcFinalZoneSizing( CtrlZoneNum ).cHeatDDDate = DesDayWeath( DDNum ).DateString;
+				CalcFinalZoneSizing( CtrlZoneNum ).TimeStepNumAtHeatMax = CalcZoneSizing( CtrlZoneNum, DDNum ).TimeStepNumAtHeatMax;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatCoilInTemp = CalcZoneSizing( CtrlZoneNum, DDNum ).DesHeatCoilInTemp;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatCoilInHumRat = CalcZoneSizing( CtrlZoneNum, DDNum ).DesHeatCoilInHumRat;
+			} else {
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatDens = StdRhoAir;
+			}
+			if ( CalcZoneSizing( CtrlZoneNum, DDNum ).DesCoolVolFlow > CalcFinalZoneSizing( CtrlZoneNum ).DesCoolVolFlow ) {
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolVolFlow = CalcZoneSizing( CtrlZoneNum, DDNum ).DesCoolVolFlow;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolLoad = CalcZoneSizing( CtrlZoneNum, DDNum ).DesCoolLoad;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolMassFlow = CalcZoneSizing( CtrlZoneNum, DDNum ).DesCoolMassFlow;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolDesDay = CalcZoneSizing( CtrlZoneNum, DDNum ).CoolDesDay;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolDens = CalcZoneSizing( CtrlZoneNum, DDNum ).DesCoolDens;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolFlowSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).CoolFlowSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolLoadSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).CoolLoadSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolZoneTempSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).CoolZoneTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolOutTempSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).CoolOutTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolZoneRetTempSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).CoolZoneRetTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolTstatTempSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).CoolTstatTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolTstatTemp = CalcZoneSizing( CtrlZoneNum, DDNum ).CoolTstatTemp;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolZoneHumRatSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).CoolZoneHumRatSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolOutHumRatSeq = CalcZoneSizing( CtrlZoneNum, DDNum ).CoolOutHumRatSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).ZoneTempAtCoolPeak = CalcZoneSizing( CtrlZoneNum, DDNum ).ZoneTempAtCoolPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).OutTempAtCoolPeak = CalcZoneSizing( CtrlZoneNum, DDNum ).OutTempAtCoolPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).ZoneRetTempAtCoolPeak = CalcZoneSizing( CtrlZoneNum, DDNum ).ZoneRetTempAtCoolPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).ZoneHumRatAtCoolPeak = CalcZoneSizing( CtrlZoneNum, DDNum ).ZoneHumRatAtCoolPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).OutHumRatAtCoolPeak = CalcZoneSizing( CtrlZoneNum, DDNum ).OutHumRatAtCoolPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolDDNum = CalcZoneSizing( CtrlZoneNum, DDNum ).CoolDDNum;
+				CalcFinalZoneSizing( CtrlZoneNum ).cCoolDDDate = DesDayWeath( DDNum ).DateString;
+				CalcFinalZoneSizing( CtrlZoneNum ).TimeStepNumAtCoolMax = CalcZoneSizing( CtrlZoneNum, DDNum ).TimeStepNumAtCoolMax;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolCoilInTemp = CalcZoneSizing( CtrlZoneNum, DDNum ).DesCoolCoilInTemp;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolCoilInHumRat = CalcZoneSizing( CtrlZoneNum, DDNum ).DesCoolCoilInHumRat;
+			} else {
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolDens = StdRhoAir;
+			}
+
+		}
+
+	}
+
 	void
 	SimZoneEquipment(
 		bool const FirstHVACIteration,
@@ -2535,6 +2849,7 @@ namespace ZoneEquipmentManager {
 		//       MODIFIED       Raustad/Shirey, FSEC, June 2003
 		//       MODIFIED       Gu, FSEC, Jan. 2004, Don Shirey, Aug 2009 (LatOutputProvided)
 		//                      July 2012, Chandan Sharma - FSEC: Added zone sys avail managers
+		//                      October 2014, simulate the concurrent zone simulation sets on several threads
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2603,6 +2918,8 @@ namespace ZoneEquipmentManager {
 		using HVACUnitarySystem::SimUnitarySystem;
 		using DataHeatBalance::Mixing;
 		using DataHeatBalance::ZoneAirMassFlow;
+		using DataGlobals::SysSizingCalc;
+		using DataSystemVariables::NumZoneEquipThreads;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2619,6 +2936,7 @@ namespace ZoneEquipmentManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ActualZoneNum;
 		int ControlledZoneNum;
+		bool SimConcurrently; // true if the concurrent simulation sets are simulated apart from the other zones
 		int EquipTypeNum;
 		int SupplyAirPathNum;
 		int CompNum;
@@ -2686,9 +3004,16 @@ namespace ZoneEquipmentManager {
 			 CalcAirFlowSimple( AdjustZoneMixingFlowFlag );
 		}
 
+		// Zones of the concurrent simulation sets do not interact with the other zones within the
+		// iteration, so they are simulated first on several threads and skipped in the zone loop.
+		// Their units are initialized and sized by the serial first iteration of each environment.
+		SimConcurrently = ( NumZoneEquipThreads > 1 && NumConcurrentZoneEquipSimSets > 1 && AirLoopsSimOnce && ! SysSizingCalc && ! ZoneSizingCalc );
+		if ( SimConcurrently ) SimConcurrentZoneEquipment( FirstHVACIteration );
+
 		for ( ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum ) {
 
 			if ( ! ZoneEquipConfig( ControlledZoneNum ).IsControlled ) continue;
+			if ( SimConcurrently && ZoneEquipSimConcurrently( ControlledZoneNum ) ) continue;
 			ActualZoneNum = ZoneEquipConfig( ControlledZoneNum ).ActualZoneNum;
 
 			NonAirSystemResponse( ActualZoneNum ) = 0.0;
@@ -3001,17 +3326,178 @@ namespace ZoneEquipmentManager {
 
 	}
 
+	void
+	SimConcurrentZoneEquipment( bool const FirstHVACIteration )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Simulates the equipment of the concurrent simulation sets, several sets at a time.
+
+		// METHODOLOGY EMPLOYED:
+		// The sets are shared out over EP_ZONE_EQUIP_THREADS threads; the zones of a set are
+		// simulated in their serial order by one thread. The sets do not share any data that
+		// their equipment writes, so the results do not depend on the number of threads.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::NumZoneEquipThreads;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const NumThreads( max( 1, min( NumZoneEquipThreads, NumConcurrentZoneEquipSimSets ) ) );
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( NumThreads ) schedule( static )
+#endif
+		for ( int Loop = 1; Loop <= NumConcurrentZoneEquipSimSets; ++Loop ) {
+			auto const & ThisSet( ZoneEquipSimSet( ConcurrentZoneEquipSimSet( Loop ) ) );
+			for ( int ZoneLoop = 1; ZoneLoop <= ThisSet.NumZones; ++ZoneLoop ) {
+				SimReentrantZoneEquipment( ThisSet.ControlledZoneNum( ZoneLoop ), FirstHVACIteration );
+			}
+		}
+
+	}
+
+	void
+	SimReentrantZoneEquipment(
+		int const ControlledZoneNum,
+		bool const FirstHVACIteration // unused (no reentrant type needs it yet)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Simulates the equipment of one zone of a concurrent simulation set.
+
+		// METHODOLOGY EMPLOYED:
+		// Same sequence as the controlled zone loop of SimZoneEquipment for the equipment types
+		// accepted by ZoneEquipIsReentrant, but with a local simulation order. The module and
+		// global scratch data of that loop (PrioritySimOrder, CurZoneEqNum, the fan flags and the
+		// exhaust flows) are left alone, so that several zones can be simulated at the same time.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataHeatBalFanSys::NonAirSystemResponse;
+		using DataHeatBalFanSys::SysDepZoneLoads;
+		using BaseboardElectric::SimElectricBaseboard;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const ActualZoneNum( ZoneEquipConfig( ControlledZoneNum ).ActualZoneNum );
+		int EquipTypeNum;
+		int EquipPtr;
+		Real64 SysOutputProvided; // sensible output delivered by zone equipment (W)
+		Real64 LatOutputProvided; // latent output delivered by zone equipment (kg/s)
+		FArray1D< SimulationOrder > SimOrder( ZoneEquipList( ControlledZoneNum ).NumOfEquipTypes ); // simulation order of the zone equipment
+
+		NonAirSystemResponse( ActualZoneNum ) = 0.0;
+		SysDepZoneLoads( ActualZoneNum ) = 0.0;
+		ZoneEquipConfig( ControlledZoneNum ).ZoneExh = 0.0;
+		ZoneEquipConfig( ControlledZoneNum ).ZoneExhBalanced = 0.0;
+		ZoneEquipConfig( ControlledZoneNum ).PlenumMassFlow = 0.0;
+
+		InitSystemOutputRequired( ActualZoneNum, SysOutputProvided, LatOutputProvided );
+
+		SetZoneEquipSimOrder( ControlledZoneNum, ActualZoneNum, SimOrder );
+
+		for ( EquipTypeNum = 1; EquipTypeNum <= ZoneEquipList( ControlledZoneNum ).NumOfEquipTypes; ++EquipTypeNum ) {
+
+			EquipPtr = SimOrder( EquipTypeNum ).EquipPtr;
+			SysOutputProvided = 0.0;
+			LatOutputProvided = 0.0;
+
+			{ auto const SELECT_CASE_var( SimOrder( EquipTypeNum ).EquipType_Num );
+
+			if ( SELECT_CASE_var == BBElectricConvective_Num ) { // 'ZoneHVAC:Baseboard:Convective:Electric'
+				SimElectricBaseboard( SimOrder( EquipTypeNum ).EquipName, ActualZoneNum, ControlledZoneNum, SysOutputProvided, ZoneEquipList( ControlledZoneNum ).EquipIndex( EquipPtr ) );
+
+				NonAirSystemResponse( ActualZoneNum ) += SysOutputProvided;
+				LatOutputProvided = 0.0; // This baseboard does not add/remove any latent heat
+
+			}}
+
+			UpdateSystemOutputRequired( ActualZoneNum, SysOutputProvided, LatOutputProvided );
+			UpdateSequencedOutputRequired( ActualZoneNum, SimOrder( EquipTypeNum ), EquipTypeNum );
+
+		}
+
+	}
+
 	void
 	SetZoneEquipSimOrder(
 		int const ControlledZoneNum,
 		int const ActualZoneNum
 	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2014
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Set simulation priorities of the module simulation order PrioritySimOrder.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		SetZoneEquipSimOrder( ControlledZoneNum, ActualZoneNum, PrioritySimOrder );
+
+	}
+
+	void
+	SetZoneEquipSimOrder(
+		int const ControlledZoneNum,
+		int const ActualZoneNum,
+		FArray1D< SimulationOrder > & SimOrder // simulation order of the zone equipment
+	)
 	{
 
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Russ Taylor
 		//       DATE WRITTEN   May 1997
-		//       MODIFIED       na
+		//       MODIFIED       October 2014, order into a given array
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3046,7 +3532,7 @@ namespace ZoneEquipmentManager {
 		auto const & zeq( ZoneEquipList( ControlledZoneNum ) );
 		int const NumOfEquipTypes( zeq.NumOfEquipTypes );
 		for ( int EquipTypeNum = 1; EquipTypeNum <= NumOfEquipTypes; ++EquipTypeNum ) {
-			auto & pso( PrioritySimOrder( EquipTypeNum ) );
+			auto & pso( SimOrder( EquipTypeNum ) );
 			pso.EquipType = zeq.EquipType( EquipTypeNum );
 			pso.EquipName = zeq.EquipName( EquipTypeNum );
 			pso.EquipType_Num = zeq.EquipType_Num( EquipTypeNum );
@@ -3054,8 +3540,8 @@ namespace ZoneEquipmentManager {
 			pso.HeatingPriority = zeq.HeatingPriority( EquipTypeNum );
 			pso.EquipPtr = DefaultSimOrder( EquipTypeNum );
 		}
-		for ( int EquipTypeNum = NumOfEquipTypes + 1, EquipTypeNum_end = PrioritySimOrder.u(); EquipTypeNum <= EquipTypeNum_end; ++EquipTypeNum ) { // Reset unused upper array portion
-			auto & pso( PrioritySimOrder( EquipTypeNum ) );
+		for ( int EquipTypeNum = NumOfEquipTypes + 1, EquipTypeNum_end = SimOrder.u(); EquipTypeNum <= EquipTypeNum_end; ++EquipTypeNum ) { // Reset unused upper array portion
+			auto & pso( SimOrder( EquipTypeNum ) );
 			pso.EquipType.clear();
 			pso.EquipName.clear();
 			pso.EquipType_Num = 0;
@@ -3063,13 +3549,13 @@ namespace ZoneEquipmentManager {
 		}
 
 		for ( int EquipTypeNum = 1; EquipTypeNum <= NumOfEquipTypes; ++EquipTypeNum ) {
-			auto & pso( PrioritySimOrder( EquipTypeNum ) );
+			auto & pso( SimOrder( EquipTypeNum ) );
 
 			CurEqHeatingPriority = pso.HeatingPriority;
 			CurEqCoolingPriority = pso.CoolingPriority;
 
 			for ( int ComparedEquipTypeNum = EquipTypeNum; ComparedEquipTypeNum <= NumOfEquipTypes; ++ComparedEquipTypeNum ) {
-				auto & psc( PrioritySimOrder( ComparedEquipTypeNum ) );
+				auto & psc( SimOrder( ComparedEquipTypeNum ) );
 
 				if ( ( CurEqCoolingPriority > psc.CoolingPriority && ZoneSysEnergyDemand( ActualZoneNum ).RemainingOutputRequired < 0.0 ) || ( CurEqHeatingPriority > psc.HeatingPriority && ZoneSysEnergyDemand( ActualZoneNum ).RemainingOutputRequired >= 0.0 ) ) {
 
@@ -3172,6 +3658,7 @@ namespace ZoneEquipmentManager {
 		//       AUTHOR         Russ Taylor
 		//       DATE WRITTEN   Unknown
 		//       MODIFIED       B. Griffith Sept 2011, add storage of requirements by sequence
+		//                      October 2014, sequence storage moved to UpdateSequencedOutputRequired
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3251,20 +3738,67 @@ namespace ZoneEquipmentManager {
 		}}
 
 		if ( present( EquipPriorityNum ) ) {
-			//now store remaining load at the by sequence level
-			if ( EquipPriorityNum + 1 <= ZoneSysEnergyDemand( ZoneNum ).NumZoneEquipment ) {
-				ZoneSysEnergyDemand( ZoneNum ).SequencedOutputRequired( EquipPriorityNum + 1 ) = ZoneSysEnergyDemand( ZoneNum ).RemainingOutputRequired;
-				ZoneSysMoistureDemand( ZoneNum ).SequencedOutputRequired( EquipPriorityNum + 1 ) = ZoneSysMoistureDemand( ZoneNum ).RemainingOutputRequired;
-			}
+			UpdateSequencedOutputRequired( ZoneNum, PrioritySimOrder( EquipPriorityNum ), EquipPriorityNum );
+		}
 
-			if ( PrioritySimOrder( EquipPriorityNum ).HeatingPriority + 1 <= ZoneSysEnergyDemand( ZoneNum ).NumZoneEquipment ) {
-				ZoneSysEnergyDemand( ZoneNum ).SequencedOutputRequiredToHeatingSP( PrioritySimOrder( EquipPriorityNum ).HeatingPriority + 1 ) = ZoneSysEnergyDemand( ZoneNum ).RemainingOutputReqToHeatSP;
-				ZoneSysMoistureDemand( ZoneNum ).SequencedOutputRequiredToHumidSP( PrioritySimOrder( EquipPriorityNum ).HeatingPriority + 1 ) = ZoneSysMoistureDemand( ZoneNum ).RemainingOutputReqToHumidSP;
-			}
-			if ( PrioritySimOrder( EquipPriorityNum ).CoolingPriority + 1 <= ZoneSysEnergyDemand( ZoneNum ).NumZoneEquipment ) {
-				ZoneSysEnergyDemand( ZoneNum ).SequencedOutputRequiredToCoolingSP( PrioritySimOrder( EquipPriorityNum ).CoolingPriority + 1 ) = ZoneSysEnergyDemand( ZoneNum ).RemainingOutputReqToCoolSP;
-				ZoneSysMoistureDemand( ZoneNum ).SequencedOutputRequiredToDehumidSP( PrioritySimOrder( EquipPriorityNum ).CoolingPriority + 1 ) = ZoneSysMoistureDemand( ZoneNum ).RemainingOutputReqToDehumidSP;
-			}
+	}
+
+	void
+	UpdateSequencedOutputRequired(
+		int const ZoneNum,
+		SimulationOrder const & EquipSimOrder, // simulation order entry of the equipment
+		int const EquipPriorityNum // index of the equipment in the simulation order
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         B. Griffith
+		//       DATE WRITTEN   Sept 2011
+		//       MODIFIED       October 2014, moved here from UpdateSystemOutputRequired
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stores the remaining zone loads by equipment sequence after a piece of zone equipment
+		// has been simulated.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataZoneEnergyDemands::ZoneSysEnergyDemand;
+		using DataZoneEnergyDemands::ZoneSysMoistureDemand;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		//now store remaining load at the by sequence level
+		if ( EquipPriorityNum + 1 <= ZoneSysEnergyDemand( ZoneNum ).NumZoneEquipment ) {
+			ZoneSysEnergyDemand( ZoneNum ).SequencedOutputRequired( EquipPriorityNum + 1 ) = ZoneSysEnergyDemand( ZoneNum ).RemainingOutputRequired;
+			ZoneSysMoistureDemand( ZoneNum ).SequencedOutputRequired( EquipPriorityNum + 1 ) = ZoneSysMoistureDemand( ZoneNum ).RemainingOutputRequired;
+		}
+
+		if ( EquipSimOrder.HeatingPriority + 1 <= ZoneSysEnergyDemand( ZoneNum ).NumZoneEquipment ) {
+			ZoneSysEnergyDemand( ZoneNum ).SequencedOutputRequiredToHeatingSP( EquipSimOrder.HeatingPriority + 1 ) = ZoneSysEnergyDemand( ZoneNum ).RemainingOutputReqToHeatSP;
+			ZoneSysMoistureDemand( ZoneNum ).SequencedOutputRequiredToHumidSP( EquipSimOrder.HeatingPriority + 1 ) = ZoneSysMoistureDemand( ZoneNum ).RemainingOutputReqToHumidSP;
+		}
+		if ( EquipSimOrder.CoolingPriority + 1 <= ZoneSysEnergyDemand( ZoneNum ).NumZoneEquipment ) {
+			ZoneSysEnergyDemand( ZoneNum ).SequencedOutputRequiredToCoolingSP( EquipSimOrder.CoolingPriority + 1 ) = ZoneSysEnergyDemand( ZoneNum ).RemainingOutputReqToCoolSP;
+			ZoneSysMoistureDemand( ZoneNum ).SequencedOutputRequiredToDehumidSP( EquipSimOrder.CoolingPriority + 1 ) = ZoneSysMoistureDemand( ZoneNum ).RemainingOutputReqToDehumidSP;
 		}
 
 	}
@@ -26,6 +26,11 @@ namespace ZoneEquipmentManager {
 	extern FArray1D_int DefaultSimOrder;
 	extern int NumOfTimeStepInDay; // number of zone time steps in a day
 	extern bool GetZoneEquipmentInputFlag;
+	extern bool ZoneEquipSimSetsFound; // true once the controlled zones have been grouped into simulation sets
+	extern int NumZoneEquipSimSets; // number of independent zone equipment simulation sets
+	extern int NumConcurrentZoneEquipSimSets; // number of sets that may be simulated concurrently
+	extern FArray1D_int ConcurrentZoneEquipSimSet; // indices of the sets that may be simulated concurrently
+	extern FArray1D_bool ZoneEquipSimConcurrently; // true for controlled zones of a concurrent set
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE ZoneEquipmentManager
 
@@ -68,8 +73,24 @@ namespace ZoneEquipmentManager {
 
 	};
 
+	struct ZoneEquipSimSetData
+	{
+		// Members
+		int NumZones; // number of controlled zones in the set
+		FArray1D_int ControlledZoneNum; // controlled zones of the set, in serial simulation order
+		bool Concurrent; // true if the set may be simulated at the same time as other sets
+
+		// Default Constructor
+		ZoneEquipSimSetData() :
+			NumZones( 0 ),
+			Concurrent( false )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< SimulationOrder > PrioritySimOrder;
+	extern FArray1D< ZoneEquipSimSetData > ZoneEquipSimSet; // independent zone equipment simulation sets
 
 	// Functions
 
@@ -86,6 +107,12 @@ namespace ZoneEquipmentManager {
 	void
 	InitZoneEquipment( bool const FirstHVACIteration ); // unused 1208
 
+	void
+	FindZoneEquipSimSets();
+
+	bool
+	ZoneEquipIsReentrant( int const EquipType_Num );
+
 	void
 	SizeZoneEquipment();
 
@@ -98,18 +125,37 @@ namespace ZoneEquipmentManager {
 	void
 	UpdateZoneSizing( int const CallIndicator );
 
+	void
+	MergeZoneSizingDesignDay( int const DDNum ); // sizing period (design day) index
+
 	void
 	SimZoneEquipment(
 		bool const FirstHVACIteration,
 		bool & SimAir
 	);
 
+	void
+	SimConcurrentZoneEquipment( bool const FirstHVACIteration );
+
+	void
+	SimReentrantZoneEquipment(
+		int const ControlledZoneNum,
+		bool const FirstHVACIteration
+	);
+
 	void
 	SetZoneEquipSimOrder(
 		int const ControlledZoneNum,
 		int const ActualZoneNum
 	);
 
+	void
+	SetZoneEquipSimOrder(
+		int const ControlledZoneNum,
+		int const ActualZoneNum,
+		FArray1D< SimulationOrder > & SimOrder // simulation order of the zone equipment
+	);
+
 	void
 	InitSystemOutputRequired(
 		int const ZoneNum,
@@ -125,6 +171,13 @@ namespace ZoneEquipmentManager {
 		Optional_int_const EquipPriorityNum = _ // index in PrioritySimOrder for this update
 	);
 
+	void
+	UpdateSequencedOutputRequired(
+		int const ZoneNum,
+		SimulationOrder const & EquipSimOrder, // simulation order entry of the equipment
+		int const EquipPriorityNum // index of the equipment in the simulation order
+	);
+
 	void
 	CalcZoneMassBalance();
 
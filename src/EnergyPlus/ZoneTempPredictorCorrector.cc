@@ -2563,6 +2563,8 @@ namespace ZoneTempPredictorCorrector {
 		int I;
 		int Itemp;
 		Real64 SetpointOffset;
+		static FArray1D< Real64 > ZoneRhoAir; // Air density of each zone
+		static FArray1D< Real64 > ZoneCpAir; // Air heat capacity of each zone
 
 		// Staged thermostat setpoint
 		if ( NumStageCtrZone > 0 ) {
@@ -2683,7 +2685,19 @@ namespace ZoneTempPredictorCorrector {
 
 			}
 
-			AIRRAT( ZoneNum ) = Zone( ZoneNum ).Volume * ZoneVolCapMultpSens * PsyRhoAirFnPbTdbW( OutBaroPress, MAT( ZoneNum ), ZoneAirHumRat( ZoneNum ) ) * PsyCpAirFnWTdb( ZoneAirHumRat( ZoneNum ), MAT( ZoneNum ) ) / ( TimeStepSys * SecInHour );
+		}
+
+		// With the zone histories in place, evaluate the air properties of all zones at once
+		if ( ! allocated( ZoneRhoAir ) ) {
+			ZoneRhoAir.allocate( NumOfZones );
+			ZoneCpAir.allocate( NumOfZones );
+		}
+		PsyRhoAirFnPbTdbW( OutBaroPress, MAT, ZoneAirHumRat, ZoneRhoAir );
+		PsyCpAirFnWTdb( ZoneAirHumRat, MAT, ZoneCpAir );
+
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+
+			AIRRAT( ZoneNum ) = Zone( ZoneNum ).Volume * ZoneVolCapMultpSens * ZoneRhoAir( ZoneNum ) * ZoneCpAir( ZoneNum ) / ( TimeStepSys * SecInHour );
 			AirCap = AIRRAT( ZoneNum );
 
 			// Calculate the various heat balance sums
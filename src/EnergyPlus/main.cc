@@ -22,11 +22,16 @@
 #include <DataTimings.hh>
 #include <DisplayRoutines.hh>
 #include <FluidProperties.hh>
+#include <General.hh>
 #include <InputProcessor.hh>
 #include <OutputProcessor.hh>
+#include <ParametricRuns.hh>
 #include <Psychrometrics.hh>
+#include <RunPeriodChunks.hh>
 #include <ScheduleManager.hh>
+#include <SimulationCheckpoint.hh>
 #include <SimulationManager.hh>
+#include <SurfaceRayTree.hh>
 #include <UtilityRoutines.hh>
 
 int
@@ -212,6 +217,11 @@ main()
 	using ScheduleManager::ReportOrphanSchedules;
 	using FluidProperties::ReportOrphanFluids;
 	using Psychrometrics::ShowPsychrometricSummary;
+	using SurfaceRayTree::ReportSurfaceRayTreeSummary;
+	using ParametricRuns::RunParametricVariants;
+	using RunPeriodChunks::SimulateRunPeriodChunks;
+	using SimulationCheckpoint::InitSimulationCheckpoint;
+	using General::ReportRootSolverCallers;
 
 // Enable floating point exceptions
 #ifndef NDEBUG
@@ -225,6 +235,7 @@ main()
 	// Note: General Parameters for the entire EnergyPlus program are contained
 	// in "DataGlobals.f90"
 	gio::Fmt const EPlusiniFormat( "(/,'[',A,']',/,'dir=',A)" );
+	gio::Fmt const fmtLD( "*" );
 	std::string const BlankString;
 
 	// INTERFACE BLOCK SPECIFICATIONS
@@ -324,6 +335,90 @@ main()
 	get_environment_variable( TraceHVACControllerEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) TraceHVACControllerEnvFlag = env_var_on( cEnvValue ); // Yes or True
 
+	get_environment_variable( AdaptiveControllerEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) AdaptiveControllerEnvFlag = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cParallelSizing, cEnvValue );
+	if ( ! cEnvValue.empty() ) {
+		{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> NumSizingWorkers; iostatus = flags.ios(); }
+		if ( iostatus != 0 || NumSizingWorkers < 1 ) NumSizingWorkers = 1;
+	}
+
+	get_environment_variable( cParametricDeltas, cEnvValue );
+	if ( ! cEnvValue.empty() ) ParametricDeltaFile = cEnvValue;
+
+	get_environment_variable( cParametricJobs, cEnvValue );
+	if ( ! cEnvValue.empty() ) {
+		{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> NumParametricJobs; iostatus = flags.ios(); }
+		if ( iostatus != 0 || NumParametricJobs < 1 ) NumParametricJobs = 1;
+	}
+
+	get_environment_variable( cIDDCache, cEnvValue );
+	if ( ! cEnvValue.empty() ) UseIDDCache = env_var_on( cEnvValue ); // No or False to always parse the text IDD
+
+	get_environment_variable( cIDFScanThreads, cEnvValue );
+	if ( ! cEnvValue.empty() ) {
+		{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> NumIDFScanThreads; iostatus = flags.ios(); }
+		if ( iostatus != 0 || NumIDFScanThreads < 0 ) NumIDFScanThreads = 0;
+	}
+
+	get_environment_variable( cCTFThreads, cEnvValue );
+	if ( ! cEnvValue.empty() ) {
+		{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> NumCTFThreads; iostatus = flags.ios(); }
+		if ( iostatus != 0 || NumCTFThreads < 1 ) NumCTFThreads = 1;
+	}
+
+	get_environment_variable( cZoneEquipThreads, cEnvValue );
+	if ( ! cEnvValue.empty() ) {
+		{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> NumZoneEquipThreads; iostatus = flags.ios(); }
+		if ( iostatus != 0 || NumZoneEquipThreads < 1 ) NumZoneEquipThreads = 1;
+	}
+
+	get_environment_variable( cGLHEMultiLevelAgg, cEnvValue );
+	if ( ! cEnvValue.empty() ) GLHEMultiLevelAgg = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cGLHEAggBenchmark, cEnvValue );
+	if ( ! cEnvValue.empty() ) GLHEAggBenchmark = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cRunPeriodChunks, cEnvValue );
+	if ( ! cEnvValue.empty() ) {
+		{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> NumRunPeriodChunks; iostatus = flags.ios(); }
+		if ( iostatus != 0 || NumRunPeriodChunks < 1 ) NumRunPeriodChunks = 1;
+	}
+
+	get_environment_variable( cRunPeriodOverlap, cEnvValue );
+	if ( ! cEnvValue.empty() ) {
+		{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> RunPeriodOverlapDays; iostatus = flags.ios(); }
+		if ( iostatus != 0 || RunPeriodOverlapDays < 0 ) RunPeriodOverlapDays = 7;
+	}
+
+	get_environment_variable( cCheckpointDate, cEnvValue );
+	if ( ! cEnvValue.empty() ) CheckpointDate = cEnvValue;
+
+	get_environment_variable( cRestartFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) RestartFile = cEnvValue;
+
+	get_environment_variable( cSharedWarmup, cEnvValue );
+	if ( ! cEnvValue.empty() ) SharedWarmup = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cQuiescentHVAC, cEnvValue );
+	if ( ! cEnvValue.empty() ) QuiescentHVACSkip = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cTARCOGCache, cEnvValue );
+	if ( ! cEnvValue.empty() ) TARCOGResultCache = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cExternalSharedMemory, cEnvValue );
+	if ( ! cEnvValue.empty() ) ExternalSharedMemoryName = cEnvValue;
+
+	get_environment_variable( cTabularBenchmark, cEnvValue );
+	if ( ! cEnvValue.empty() ) TabularBenchmark = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cTabularThreads, cEnvValue );
+	if ( ! cEnvValue.empty() ) {
+		{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> NumTabularThreads; iostatus = flags.ios(); }
+		if ( iostatus != 0 || NumTabularThreads < 1 ) NumTabularThreads = 1;
+	}
+
 	{ IOFlags flags; gio::inquire( "eplusout.end", flags ); FileExists = flags.exists(); }
 	if ( FileExists ) {
 		LFN = GetNewUnitNumber();
@@ -388,6 +483,14 @@ main()
 
 	ProcessInput();
 
+	// In a parametric batch only the variant processes and the setup process return here
+	if ( ! ParametricDeltaFile.empty() ) RunParametricVariants();
+
+	if ( ! CheckpointDate.empty() || ! RestartFile.empty() || SharedWarmup ) InitSimulationCheckpoint();
+
+	// When the run period is split into chunks only the chunk processes return here
+	if ( NumRunPeriodChunks > 1 ) SimulateRunPeriodChunks();
+
 	ManageSimulation();
 
 	ShowMessage( "Simulation Error Summary *************" );
@@ -395,6 +498,8 @@ main()
 	GenOutputVariablesAuditReport();
 
 	ShowPsychrometricSummary();
+	ReportSurfaceRayTreeSummary();
+	ReportRootSolverCallers();
 
 	ReportOrphanRecordObjects();
 	ReportOrphanFluids();